@@ -0,0 +1,137 @@
+#ifndef SFU_BENCH_BENCH_H_
+#define SFU_BENCH_BENCH_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <random>
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "sfu/testing/alloc_counter.h"
+#include "sfu/testing/perf_counters.h"
+#include "sfu/tmpfile.h"
+
+namespace sfu {
+namespace bench {
+
+// Benchmarks of sfu functions are named BM_<Name>, and their baselines of
+// the closest standard library or libc equivalent BM_Std_<Name>, with the
+// same arguments, so compare.py can pair them up.
+
+// Size sweep of 16 bytes to 1 MiB, for functions over buffers.
+inline void SizeSweep(benchmark::internal::Benchmark* b) {
+  b->RangeMultiplier(8)->Range(16, 1 << 20);
+}
+
+// Text of size bytes of lower case words of 1-12 letters separated by a
+// single sep, like log lines or CSV fields. Always the same for a size.
+inline std::string Words(size_t size, char sep = ' ') {
+  std::mt19937 rng(static_cast<uint32_t>(size));
+  std::string text;
+  text.reserve(size);
+  while (text.size() < size) {
+    if (!text.empty()) text.push_back(sep);
+    const size_t length = 1 + rng() % 12;
+    for (size_t i = 0; i < length && text.size() < size; ++i) {
+      text.push_back(static_cast<char>('a' + rng() % 26));
+    }
+  }
+  return text;
+}
+
+// Binary data of size random bytes.
+inline std::string Bytes(size_t size) {
+  std::mt19937 rng(static_cast<uint32_t>(size));
+  std::string data(size, '\0');
+  for (size_t i = 0; i < size; ++i) data[i] = static_cast<char>(rng());
+  return data;
+}
+
+// UTF-8 text of size bytes, mostly ASCII with some 2, 3 and 4 byte
+// sequences, as in European text with the odd symbol.
+inline std::string Utf8Text(size_t size) {
+  static const char* const kChars[] = {
+    "a", "b", "c", "d", "e", " ", "\xc3\xa6", "\xc3\xb8", "\xc3\xa5",
+    "\xe2\x82\xac", "\xf0\x9f\x98\x80",
+  };
+  std::mt19937 rng(static_cast<uint32_t>(size));
+  std::string text;
+  while (text.size() < size) {
+    const uint32_t r = rng() % 40;
+    text.append(kChars[r < 30 ? r % 6 : 6 + r % 5]);
+  }
+  return text;
+}
+
+// The path of a file of Words(size, '\n'), i.e. size bytes of short lines.
+// Written on first use, and removed when the benchmark exits.
+inline const std::string& WordsFile(size_t size) {
+  static TmpFile tmp("/tmp/sfu_bench");
+  static std::map<size_t, std::string> paths;
+  std::string& path = paths[size];
+  if (path.empty()) {
+    path = tmp.Create("txt");
+    const std::string text = Words(size, '\n');
+    FILE* file = fopen(path.c_str(), "w");
+    if (file != NULL) {
+      fwrite(text.data(), 1, text.size(), file);
+      fclose(file);
+    }
+  }
+  return path;
+}
+
+// Count the bytes and items processed per iteration of the benchmark, for
+// bytes/s and items/s in the output. Bytes of 0 are left out.
+inline void SetProcessed(benchmark::State& state, size_t bytes,
+                         size_t items) {
+  const int64_t iterations = static_cast<int64_t>(state.iterations());
+  if (bytes > 0) state.SetBytesProcessed(iterations * bytes);
+  state.SetItemsProcessed(iterations * items);
+}
+
+// Adds the allocations per iteration of the benchmark to its output as the
+// counter "allocs", and the hardware events per iteration as "cycles",
+// "instructions", "cache_misses" and "branch_misses" where they can be
+// read. Put it right before the loop:
+//
+//   const std::string text = Words(state.range(0));
+//   Instrument instrument(state);
+//   while (state.KeepRunning()) {
+//     ...
+//   }
+class Instrument {
+  public:
+    explicit Instrument(benchmark::State& state) : state_(state) {}
+
+    ~Instrument() {
+      perf_.Stop();
+      const double iterations =
+          state_.iterations() > 0 ? static_cast<double>(state_.iterations())
+                                  : 1.0;
+      state_.counters["allocs"] = allocs_.allocations() / iterations;
+      for (int i = 0; i < testing::PerfCounters::NUM_EVENTS; ++i) {
+        const testing::PerfCounters::Event event =
+            static_cast<testing::PerfCounters::Event>(i);
+        if (!perf_.available(event)) continue;
+        state_.counters[testing::PerfCounters::name(event)] =
+            perf_.value(event) / iterations;
+      }
+    }
+
+  private:
+    // Not copyable.
+    Instrument(const Instrument& instrument);
+    Instrument& operator=(const Instrument& instrument);
+
+    benchmark::State& state_;
+    testing::AllocationCounter allocs_;
+    testing::PerfCounters perf_;
+};
+
+}  // namespace bench
+}  // namespace sfu
+
+#endif  // SFU_BENCH_BENCH_H_
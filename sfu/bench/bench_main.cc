@@ -0,0 +1,29 @@
+#include <cstring>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+// Runs the benchmarks linked in. Output is JSON unless --benchmark_format
+// is given, so runs can be diffed across commits with compare.py. All the
+// flags of Google Benchmark work, e.g.
+//
+//   bazel run //sfu/bench:strings_bench -- --benchmark_filter=Cord
+//       --benchmark_out=strings.json
+int main(int argc, char** argv) {
+  static char kJsonFormat[] = "--benchmark_format=json";
+
+  std::vector<char*> args(argv, argv + argc);
+  bool has_format = false;
+  for (int i = 1; i < argc; ++i) {
+    if (strncmp(argv[i], "--benchmark_format", 18) == 0) has_format = true;
+  }
+  if (!has_format) args.insert(args.begin() + 1, kJsonFormat);
+
+  int args_size = static_cast<int>(args.size());
+  benchmark::Initialize(&args_size, args.data());
+  if (benchmark::ReportUnrecognizedArguments(args_size, args.data())) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+#
+# Compares the JSON output of the sfu benchmarks.
+#
+# Against the standard library baselines of the same run, pairing each
+# BM_<Name> with its BM_Std_<Name>:
+#
+#   python3 sfu/bench/compare.py strings.json
+#
+# Across runs, e.g. of two commits, for every benchmark in both:
+#
+#   python3 sfu/bench/compare.py old.json new.json
+#
+# Ratios are of CPU time, or wall time for benchmarks that use it (named
+# .../real_time), so below 1.0 means sfu (or new) is faster.
+
+import json
+import sys
+
+STD_PREFIX = 'BM_Std_'
+
+
+def load(path):
+    """The benchmarks of the JSON file, as name -> time in ns."""
+    with open(path) as f:
+        data = json.load(f)
+    scale = {'ns': 1.0, 'us': 1e3, 'ms': 1e6, 's': 1e9}
+    times = {}
+    for benchmark in data['benchmarks']:
+        # Skip the mean, median and stddev of repeated runs.
+        if benchmark.get('run_type', 'iteration') != 'iteration':
+            continue
+        unit = scale[benchmark.get('time_unit', 'ns')]
+        name = benchmark['name']
+        # Wall time where the benchmark measures it, e.g. as most of the
+        # work is done by other processes.
+        key = 'real_time' if name.endswith('/real_time') else 'cpu_time'
+        times[name] = benchmark[key] * unit
+    return times
+
+
+def print_rows(header, rows):
+    width = max([len(header[0])] + [len(row[0]) for row in rows])
+    print('%-*s %14s %14s %8s' % ((width,) + header))
+    for name, a, b in rows:
+        print('%-*s %14.1f %14.1f %8.3f' % (width, name, a, b, b / a))
+
+
+def baseline(path):
+    times = load(path)
+    rows = []
+    for name, std_time in times.items():
+        if not name.startswith(STD_PREFIX):
+            continue
+        sfu_name = 'BM_' + name[len(STD_PREFIX):]
+        if sfu_name in times:
+            rows.append((sfu_name, std_time, times[sfu_name]))
+    print_rows(('benchmark', 'std ns', 'sfu ns', 'ratio'), sorted(rows))
+
+
+def diff(old_path, new_path):
+    old = load(old_path)
+    new = load(new_path)
+    rows = [(name, old[name], new[name]) for name in old if name in new]
+    print_rows(('benchmark', 'old ns', 'new ns', 'ratio'), sorted(rows))
+
+
+def main(argv):
+    if len(argv) == 2:
+        baseline(argv[1])
+    elif len(argv) == 3:
+        diff(argv[1], argv[2])
+    else:
+        sys.stderr.write('usage: %s run.json | old.json new.json\n' % argv[0])
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
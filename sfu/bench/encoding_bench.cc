@@ -0,0 +1,205 @@
+#include <clocale>
+#include <cstdio>
+#include <cwchar>
+#include <string>
+
+#include "sfu/bench/bench.h"
+#include "sfu/encoding.h"
+#include "sfu/utf8.h"
+
+using namespace sfu;
+using namespace sfu::bench;
+
+static void BM_HexEncode(benchmark::State& state) {
+  const std::string data = Bytes(state.range(0));
+  std::string hex;
+  while (state.KeepRunning()) {
+    hex.clear();
+    HexEncode(data, &hex);
+  }
+  SetProcessed(state, data.size(), data.size());
+}
+BENCHMARK(BM_HexEncode)->Apply(SizeSweep);
+
+static void BM_Std_HexEncode(benchmark::State& state) {
+  const std::string data = Bytes(state.range(0));
+  std::string hex;
+  while (state.KeepRunning()) {
+    hex.resize(data.size() * 2 + 1);
+    for (size_t i = 0; i < data.size(); ++i) {
+      snprintf(&hex[i * 2], 3, "%02x", static_cast<uint8_t>(data[i]));
+    }
+    hex.resize(data.size() * 2);
+  }
+  SetProcessed(state, data.size(), data.size());
+}
+BENCHMARK(BM_Std_HexEncode)->Apply(SizeSweep);
+
+static void BM_HexDecode(benchmark::State& state) {
+  std::string hex;
+  HexEncode(Bytes(state.range(0)), &hex);
+  std::string data;
+  while (state.KeepRunning()) {
+    data.clear();
+    HexDecode(hex, &data);
+  }
+  SetProcessed(state, hex.size(), data.size());
+}
+BENCHMARK(BM_HexDecode)->Apply(SizeSweep);
+
+static void BM_Std_HexDecode(benchmark::State& state) {
+  std::string hex;
+  HexEncode(Bytes(state.range(0)), &hex);
+  std::string data;
+  while (state.KeepRunning()) {
+    data.resize(hex.size() / 2);
+    for (size_t i = 0; i < data.size(); ++i) {
+      unsigned int byte;
+      sscanf(&hex[i * 2], "%2x", &byte);
+      data[i] = static_cast<char>(byte);
+    }
+  }
+  SetProcessed(state, hex.size(), data.size());
+}
+BENCHMARK(BM_Std_HexDecode)->Apply(SizeSweep);
+
+static void BM_Base64Encode(benchmark::State& state) {
+  const std::string data = Bytes(state.range(0));
+  std::string base64;
+  while (state.KeepRunning()) {
+    base64.clear();
+    Base64Encode(data, false, &base64);
+  }
+  SetProcessed(state, data.size(), data.size());
+}
+BENCHMARK(BM_Base64Encode)->Apply(SizeSweep);
+
+static void BM_Base64Decode(benchmark::State& state) {
+  std::string base64;
+  Base64Encode(Bytes(state.range(0)), false, &base64);
+  std::string data;
+  while (state.KeepRunning()) {
+    data.clear();
+    Base64Decode(base64, false, &data);
+  }
+  SetProcessed(state, base64.size(), data.size());
+}
+BENCHMARK(BM_Base64Decode)->Apply(SizeSweep);
+
+static void BM_UrlEncode(benchmark::State& state) {
+  // Words with some chars to escape.
+  std::string text = Words(state.range(0));
+  for (size_t i = 7; i < text.size(); i += 13) text[i] = '/';
+  std::string encoded;
+  while (state.KeepRunning()) {
+    encoded.clear();
+    UrlEncode(text, &encoded);
+  }
+  SetProcessed(state, text.size(), text.size());
+}
+BENCHMARK(BM_UrlEncode)->Apply(SizeSweep);
+
+static void BM_UrlDecode(benchmark::State& state) {
+  std::string text = Words(state.range(0));
+  for (size_t i = 7; i < text.size(); i += 13) text[i] = '/';
+  std::string encoded;
+  UrlEncode(text, &encoded);
+  std::string decoded;
+  Instrument instrument(state);
+  while (state.KeepRunning()) {
+    decoded.clear();
+    UrlDecode(encoded, &decoded);
+  }
+  SetProcessed(state, encoded.size(), decoded.size());
+}
+BENCHMARK(BM_UrlDecode)->Apply(SizeSweep);
+
+namespace {
+
+// Words with some quotes and control chars to escape.
+std::string EscapeText(size_t size) {
+  static const char kEscaped[] = "\t\n\"\\";
+  std::string text = Words(size);
+  for (size_t i = 5, n = 0; i < text.size(); i += 11, ++n) {
+    text[i] = kEscaped[n % 4];
+  }
+  return text;
+}
+
+}  // namespace
+
+static void BM_CEncode(benchmark::State& state) {
+  const std::string data = EscapeText(state.range(0));
+  std::string escaped;
+  while (state.KeepRunning()) {
+    escaped.clear();
+    CEncode(data, &escaped);
+  }
+  SetProcessed(state, data.size(), data.size());
+}
+BENCHMARK(BM_CEncode)->Apply(SizeSweep);
+
+static void BM_CDecode(benchmark::State& state) {
+  std::string escaped;
+  CEncode(EscapeText(state.range(0)), &escaped);
+  std::string data;
+  while (state.KeepRunning()) {
+    data.clear();
+    CDecode(escaped, &data);
+  }
+  SetProcessed(state, escaped.size(), data.size());
+}
+BENCHMARK(BM_CDecode)->Apply(SizeSweep);
+
+static void BM_Utf8Codepoints(benchmark::State& state) {
+  const std::string text = Utf8Text(state.range(0));
+  size_t count = 0;
+  while (state.KeepRunning()) {
+    count = 0;
+    int32_t sum = 0;
+    for (int32_t cp : codepoints(text)) {
+      sum += cp;
+      ++count;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  SetProcessed(state, text.size(), count);
+}
+BENCHMARK(BM_Utf8Codepoints)->Apply(SizeSweep);
+
+static void BM_Std_Utf8Codepoints(benchmark::State& state) {
+  setlocale(LC_CTYPE, "C.UTF-8");
+  const std::string text = Utf8Text(state.range(0));
+  size_t count = 0;
+  while (state.KeepRunning()) {
+    count = 0;
+    int32_t sum = 0;
+    mbstate_t mb = mbstate_t();
+    const char* p = text.data();
+    const char* end = p + text.size();
+    while (p < end) {
+      wchar_t wc;
+      size_t n = mbrtowc(&wc, p, end - p, &mb);
+      if (n == 0 || n > 4) n = 1;
+      sum += wc;
+      p += n;
+      ++count;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  SetProcessed(state, text.size(), count);
+}
+BENCHMARK(BM_Std_Utf8Codepoints)->Apply(SizeSweep);
+
+static void BM_Utf8AppendCodepoint(benchmark::State& state) {
+  const int32_t kCodepoints[] = {'a', 0xe6, 0x20ac, 0x1f600};
+  std::string out;
+  while (state.KeepRunning()) {
+    out.clear();
+    for (int i = 0; i < state.range(0); ++i) {
+      Utf8AppendCodepoint(kCodepoints[i % 4], &out);
+    }
+  }
+  SetProcessed(state, out.size(), state.range(0));
+}
+BENCHMARK(BM_Utf8AppendCodepoint)->RangeMultiplier(8)->Range(16, 1 << 16);
@@ -0,0 +1,92 @@
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "sfu/bench/bench.h"
+#include "sfu/mapped_file.h"
+#include "sfu/record_reader.h"
+#include "sfu/strings/cord.h"
+
+using namespace sfu;
+using namespace sfu::bench;
+
+// Files are read from the page cache, after the first iteration.
+
+static void BM_RecordReader(benchmark::State& state) {
+  const std::string& path = WordsFile(state.range(0));
+  size_t records = 0;
+  Instrument instrument(state);
+  while (state.KeepRunning()) {
+    const int fd = open(path.c_str(), O_RDONLY);
+    RecordReader reader(fd);
+    strings::cord line;
+    records = 0;
+    while (reader.Next(&line)) ++records;
+    close(fd);
+  }
+  SetProcessed(state, state.range(0), records);
+}
+BENCHMARK(BM_RecordReader)->Apply(SizeSweep);
+
+static void BM_Std_RecordReader(benchmark::State& state) {
+  const std::string& path = WordsFile(state.range(0));
+  size_t records = 0;
+  Instrument instrument(state);
+  while (state.KeepRunning()) {
+    FILE* file = fopen(path.c_str(), "r");
+    char* line = NULL;
+    size_t capacity = 0;
+    records = 0;
+    while (getline(&line, &capacity, file) >= 0) ++records;
+    free(line);
+    fclose(file);
+  }
+  SetProcessed(state, state.range(0), records);
+}
+BENCHMARK(BM_Std_RecordReader)->Apply(SizeSweep);
+
+// Map the file and count its lines.
+static void BM_MappedFile(benchmark::State& state) {
+  const std::string& path = WordsFile(state.range(0));
+  size_t lines = 0;
+  while (state.KeepRunning()) {
+    MappedFile file;
+    file.Open(path);
+    const char* p = file.ptr();
+    const char* end = p + file.size();
+    lines = 0;
+    while ((p = static_cast<const char*>(memchr(p, '\n', end - p)))) {
+      ++lines;
+      ++p;
+    }
+  }
+  SetProcessed(state, state.range(0), lines);
+}
+BENCHMARK(BM_MappedFile)->Apply(SizeSweep);
+
+// Read the file in 64KB blocks and count its lines.
+static void BM_Std_MappedFile(benchmark::State& state) {
+  const std::string& path = WordsFile(state.range(0));
+  std::string buffer(64 * 1024, '\0');
+  size_t lines = 0;
+  while (state.KeepRunning()) {
+    const int fd = open(path.c_str(), O_RDONLY);
+    lines = 0;
+    ssize_t n;
+    while ((n = read(fd, &buffer[0], buffer.size())) > 0) {
+      const char* p = buffer.data();
+      const char* end = p + n;
+      while ((p = static_cast<const char*>(memchr(p, '\n', end - p)))) {
+        ++lines;
+        ++p;
+      }
+    }
+    close(fd);
+  }
+  SetProcessed(state, state.range(0), lines);
+}
+BENCHMARK(BM_Std_MappedFile)->Apply(SizeSweep);
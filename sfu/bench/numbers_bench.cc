@@ -0,0 +1,243 @@
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "sfu/bench/bench.h"
+#include "sfu/numbers.h"
+#include "sfu/numbers_batch.h"
+
+using namespace sfu;
+using namespace sfu::bench;
+
+namespace {
+
+// Integers of mixed length, like ids and counters in logs.
+std::vector<std::string> Integers(size_t count) {
+  std::mt19937_64 rng(4711);
+  std::vector<std::string> numbers;
+  for (size_t i = 0; i < count; ++i) {
+    const int64_t value = static_cast<int64_t>(rng() >> (rng() % 64));
+    numbers.push_back(std::to_string(i % 2 ? value : -value));
+  }
+  return numbers;
+}
+
+// Doubles of mixed magnitude, with the shortest round trip digits.
+std::vector<std::string> Doubles(size_t count) {
+  std::mt19937_64 rng(4711);
+  std::uniform_real_distribution<double> mantissa(0, 1);
+  std::uniform_int_distribution<int> exponent(-20, 20);
+  std::vector<std::string> numbers;
+  for (size_t i = 0; i < count; ++i) {
+    char buffer[kMaxDoubleChars];
+    const double value = mantissa(rng) * std::pow(10.0, exponent(rng));
+    char* end = to_chars(buffer, buffer + sizeof(buffer), value);
+    numbers.push_back(std::string(buffer, end));
+  }
+  return numbers;
+}
+
+size_t TotalSize(const std::vector<std::string>& strings) {
+  size_t size = 0;
+  for (const std::string& str : strings) size += str.size();
+  return size;
+}
+
+std::string Column(const std::vector<std::string>& numbers) {
+  std::string column;
+  for (const std::string& number : numbers) {
+    column += number;
+    column += '\n';
+  }
+  return column;
+}
+
+const size_t kCount = 1000;
+
+}  // namespace
+
+static void BM_FromCharsInt64(benchmark::State& state) {
+  const std::vector<std::string> numbers = Integers(kCount);
+  while (state.KeepRunning()) {
+    for (const std::string& number : numbers) {
+      int64_t value;
+      from_chars(number.data(), number.data() + number.size(), &value);
+      benchmark::DoNotOptimize(value);
+    }
+  }
+  SetProcessed(state, TotalSize(numbers), numbers.size());
+}
+BENCHMARK(BM_FromCharsInt64);
+
+static void BM_Std_FromCharsInt64(benchmark::State& state) {
+  const std::vector<std::string> numbers = Integers(kCount);
+  while (state.KeepRunning()) {
+    for (const std::string& number : numbers) {
+      benchmark::DoNotOptimize(strtoll(number.c_str(), NULL, 10));
+    }
+  }
+  SetProcessed(state, TotalSize(numbers), numbers.size());
+}
+BENCHMARK(BM_Std_FromCharsInt64);
+
+static void BM_FromCharsDouble(benchmark::State& state) {
+  const std::vector<std::string> numbers = Doubles(kCount);
+  while (state.KeepRunning()) {
+    for (const std::string& number : numbers) {
+      double value;
+      from_chars(number.data(), number.data() + number.size(), &value);
+      benchmark::DoNotOptimize(value);
+    }
+  }
+  SetProcessed(state, TotalSize(numbers), numbers.size());
+}
+BENCHMARK(BM_FromCharsDouble);
+
+static void BM_Std_FromCharsDouble(benchmark::State& state) {
+  const std::vector<std::string> numbers = Doubles(kCount);
+  while (state.KeepRunning()) {
+    for (const std::string& number : numbers) {
+      benchmark::DoNotOptimize(strtod(number.c_str(), NULL));
+    }
+  }
+  SetProcessed(state, TotalSize(numbers), numbers.size());
+}
+BENCHMARK(BM_Std_FromCharsDouble);
+
+static void BM_SafeStr2Int64(benchmark::State& state) {
+  const std::vector<std::string> numbers = Integers(kCount);
+  while (state.KeepRunning()) {
+    for (const std::string& number : numbers) {
+      int64_t value;
+      benchmark::DoNotOptimize(safe_str2int64(number, &value));
+    }
+  }
+  SetProcessed(state, TotalSize(numbers), numbers.size());
+}
+BENCHMARK(BM_SafeStr2Int64);
+
+static void BM_ToCharsInt64(benchmark::State& state) {
+  std::vector<int64_t> values;
+  for (const std::string& number : Integers(kCount)) {
+    values.push_back(strtoll(number.c_str(), NULL, 10));
+  }
+  char buffer[kMaxIntegerChars];
+  while (state.KeepRunning()) {
+    for (int64_t value : values) {
+      benchmark::DoNotOptimize(
+          to_chars(buffer, buffer + sizeof(buffer), value));
+    }
+  }
+  SetProcessed(state, 0, values.size());
+}
+BENCHMARK(BM_ToCharsInt64);
+
+static void BM_Std_ToCharsInt64(benchmark::State& state) {
+  std::vector<int64_t> values;
+  for (const std::string& number : Integers(kCount)) {
+    values.push_back(strtoll(number.c_str(), NULL, 10));
+  }
+  char buffer[kMaxIntegerChars + 1];
+  while (state.KeepRunning()) {
+    for (int64_t value : values) {
+      benchmark::DoNotOptimize(snprintf(buffer, sizeof(buffer), "%lld",
+                                        static_cast<long long>(value)));
+    }
+  }
+  SetProcessed(state, 0, values.size());
+}
+BENCHMARK(BM_Std_ToCharsInt64);
+
+static void BM_ToCharsDouble(benchmark::State& state) {
+  std::vector<double> values;
+  for (const std::string& number : Doubles(kCount)) {
+    values.push_back(strtod(number.c_str(), NULL));
+  }
+  char buffer[kMaxDoubleChars];
+  while (state.KeepRunning()) {
+    for (double value : values) {
+      benchmark::DoNotOptimize(
+          to_chars(buffer, buffer + sizeof(buffer), value));
+    }
+  }
+  SetProcessed(state, 0, values.size());
+}
+BENCHMARK(BM_ToCharsDouble);
+
+static void BM_Std_ToCharsDouble(benchmark::State& state) {
+  std::vector<double> values;
+  for (const std::string& number : Doubles(kCount)) {
+    values.push_back(strtod(number.c_str(), NULL));
+  }
+  char buffer[32];
+  while (state.KeepRunning()) {
+    for (double value : values) {
+      // %.17g also round trips, but is not the shortest.
+      benchmark::DoNotOptimize(
+          snprintf(buffer, sizeof(buffer), "%.17g", value));
+    }
+  }
+  SetProcessed(state, 0, values.size());
+}
+BENCHMARK(BM_Std_ToCharsDouble);
+
+static void BM_ParseColumnInt64(benchmark::State& state) {
+  const std::string column = Column(Integers(state.range(0)));
+  std::vector<int64_t> values;
+  std::vector<uint64_t> errors;
+  Instrument instrument(state);
+  while (state.KeepRunning()) {
+    parse_column(column, '\n', &values, &errors);
+  }
+  SetProcessed(state, column.size(), state.range(0));
+}
+BENCHMARK(BM_ParseColumnInt64)->RangeMultiplier(8)->Range(8, 1 << 18);
+
+static void BM_Std_ParseColumnInt64(benchmark::State& state) {
+  const std::string column = Column(Integers(state.range(0)));
+  std::vector<int64_t> values;
+  Instrument instrument(state);
+  while (state.KeepRunning()) {
+    values.clear();
+    const char* p = column.c_str();
+    const char* end = p + column.size();
+    while (p < end) {
+      char* next;
+      values.push_back(strtoll(p, &next, 10));
+      p = next + 1;
+    }
+  }
+  SetProcessed(state, column.size(), state.range(0));
+}
+BENCHMARK(BM_Std_ParseColumnInt64)->RangeMultiplier(8)->Range(8, 1 << 18);
+
+static void BM_ParseColumnDouble(benchmark::State& state) {
+  const std::string column = Column(Doubles(state.range(0)));
+  std::vector<double> values;
+  std::vector<uint64_t> errors;
+  while (state.KeepRunning()) {
+    parse_column(column, '\n', &values, &errors);
+  }
+  SetProcessed(state, column.size(), state.range(0));
+}
+BENCHMARK(BM_ParseColumnDouble)->RangeMultiplier(8)->Range(8, 1 << 18);
+
+static void BM_Std_ParseColumnDouble(benchmark::State& state) {
+  const std::string column = Column(Doubles(state.range(0)));
+  std::vector<double> values;
+  while (state.KeepRunning()) {
+    values.clear();
+    const char* p = column.c_str();
+    const char* end = p + column.size();
+    while (p < end) {
+      char* next;
+      values.push_back(strtod(p, &next));
+      p = next + 1;
+    }
+  }
+  SetProcessed(state, column.size(), state.range(0));
+}
+BENCHMARK(BM_Std_ParseColumnDouble)->RangeMultiplier(8)->Range(8, 1 << 18);
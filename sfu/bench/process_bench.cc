@@ -0,0 +1,93 @@
+#include <cstdio>
+#include <string>
+
+#include "sfu/bench/bench.h"
+#include "sfu/popen.h"
+#include "sfu/strings/cord.h"
+
+using namespace sfu;
+using namespace sfu::bench;
+
+// Throughput of the output of processes into this one. Starting the
+// processes dominates for the small sizes. popen(3) only goes one way, so
+// Popen::communicate() of both stdin and stdout has no BM_Std_ pair.
+
+namespace {
+
+// The sizes of SizeSweep in wall time, as most of the work is done by the
+// processes started.
+void ProcessSweep(benchmark::internal::Benchmark* b) {
+  SizeSweep(b);
+  b->Unit(benchmark::kMicrosecond)->UseRealTime();
+}
+
+// Read all of the output of the shell command with popen(3).
+void StdPopen(const std::string& command, std::string* out) {
+  out->clear();
+  FILE* pipe = popen(command.c_str(), "r");
+  char buffer[64 * 1024];
+  size_t n;
+  while ((n = fread(buffer, 1, sizeof(buffer), pipe)) > 0) {
+    out->append(buffer, n);
+  }
+  pclose(pipe);
+}
+
+}  // namespace
+
+static void BM_PopenRun(benchmark::State& state) {
+  const std::string& path = WordsFile(state.range(0));
+  std::string out;
+  while (state.KeepRunning()) {
+    out.clear();
+    Popen::run({"cat", path}, &out);
+  }
+  SetProcessed(state, out.size(), 1);
+}
+BENCHMARK(BM_PopenRun)->Apply(ProcessSweep);
+
+static void BM_Std_PopenRun(benchmark::State& state) {
+  const std::string command = "cat " + WordsFile(state.range(0));
+  std::string out;
+  while (state.KeepRunning()) {
+    StdPopen(command, &out);
+  }
+  SetProcessed(state, out.size(), 1);
+}
+BENCHMARK(BM_Std_PopenRun)->Apply(ProcessSweep);
+
+// Through cat, in and out.
+static void BM_PopenCommunicate(benchmark::State& state) {
+  const std::string in = Words(state.range(0), '\n');
+  std::string out;
+  while (state.KeepRunning()) {
+    out.clear();
+    Popen::run({"cat"}, in, &out);
+  }
+  SetProcessed(state, in.size() * 2, 1);
+}
+BENCHMARK(BM_PopenCommunicate)->Apply(ProcessSweep);
+
+static void BM_Pipeline(benchmark::State& state) {
+  const std::string& path = WordsFile(state.range(0));
+  std::string out;
+  while (state.KeepRunning()) {
+    Pipeline pipeline;
+    pipeline.Add({"cat", path});
+    pipeline.Add({"cat"});
+    out.clear();
+    pipeline.run(strings::cord(), &out);
+  }
+  SetProcessed(state, out.size(), 1);
+}
+BENCHMARK(BM_Pipeline)->Apply(ProcessSweep);
+
+static void BM_Std_Pipeline(benchmark::State& state) {
+  const std::string command = "cat " + WordsFile(state.range(0)) + " | cat";
+  std::string out;
+  while (state.KeepRunning()) {
+    StdPopen(command, &out);
+  }
+  SetProcessed(state, out.size(), 1);
+}
+BENCHMARK(BM_Std_Pipeline)->Apply(ProcessSweep);
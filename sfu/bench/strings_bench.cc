@@ -0,0 +1,271 @@
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "sfu/bench/bench.h"
+#include "sfu/strings/cord.h"
+#include "sfu/strings/format.h"
+#include "sfu/strings/keyword.h"
+#include "sfu/strings/strings.h"
+
+using namespace sfu;
+using namespace sfu::bench;
+
+namespace {
+
+// A needle found only at the end of the haystack, as a worst case scan.
+const char kNeedle[] = "needle in";
+
+std::string Haystack(size_t size) {
+  std::string text = Words(size);
+  text.replace(text.size() - sizeof(kNeedle) + 1, sizeof(kNeedle) - 1,
+               kNeedle);
+  return text;
+}
+
+}  // namespace
+
+static void BM_CordFind(benchmark::State& state) {
+  const std::string text = Haystack(state.range(0));
+  const strings::cord haystack(text);
+  const strings::cord needle(kNeedle);
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(haystack.find(needle));
+  }
+  SetProcessed(state, text.size(), 1);
+}
+BENCHMARK(BM_CordFind)->Apply(SizeSweep);
+
+static void BM_Std_CordFind(benchmark::State& state) {
+  const std::string text = Haystack(state.range(0));
+  const std::string needle(kNeedle);
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(text.find(needle));
+  }
+  SetProcessed(state, text.size(), 1);
+}
+BENCHMARK(BM_Std_CordFind)->Apply(SizeSweep);
+
+static void BM_CordFindChar(benchmark::State& state) {
+  std::string text = Words(state.range(0));
+  text.back() = '!';
+  const strings::cord haystack(text);
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(haystack.find('!'));
+  }
+  SetProcessed(state, text.size(), 1);
+}
+BENCHMARK(BM_CordFindChar)->Apply(SizeSweep);
+
+static void BM_Std_CordFindChar(benchmark::State& state) {
+  std::string text = Words(state.range(0));
+  text.back() = '!';
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(text.find('!'));
+  }
+  SetProcessed(state, text.size(), 1);
+}
+BENCHMARK(BM_Std_CordFindChar)->Apply(SizeSweep);
+
+static void BM_CordFindLastChar(benchmark::State& state) {
+  std::string text = Words(state.range(0));
+  text.front() = '!';
+  const strings::cord haystack(text);
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(haystack.find_last('!'));
+  }
+  SetProcessed(state, text.size(), 1);
+}
+BENCHMARK(BM_CordFindLastChar)->Apply(SizeSweep);
+
+static void BM_Std_CordFindLastChar(benchmark::State& state) {
+  std::string text = Words(state.range(0));
+  text.front() = '!';
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(text.rfind('!'));
+  }
+  SetProcessed(state, text.size(), 1);
+}
+BENCHMARK(BM_Std_CordFindLastChar)->Apply(SizeSweep);
+
+static void BM_SplitCb(benchmark::State& state) {
+  const std::string text = Words(state.range(0), ',');
+  size_t fields = 0;
+  Instrument instrument(state);
+  while (state.KeepRunning()) {
+    fields = strings::split_cb([](const std::string& field) {
+      benchmark::DoNotOptimize(field.data());
+      return true;
+    }, text, ",");
+  }
+  SetProcessed(state, text.size(), fields);
+}
+BENCHMARK(BM_SplitCb)->Apply(SizeSweep);
+
+static void BM_Std_SplitCb(benchmark::State& state) {
+  const std::string text = Words(state.range(0), ',');
+  size_t fields = 0;
+  Instrument instrument(state);
+  while (state.KeepRunning()) {
+    fields = 0;
+    size_t start = 0;
+    for (;;) {
+      const size_t end = text.find(',', start);
+      std::string field = text.substr(start, end - start);
+      benchmark::DoNotOptimize(field.data());
+      ++fields;
+      if (end == std::string::npos) break;
+      start = end + 1;
+    }
+  }
+  SetProcessed(state, text.size(), fields);
+}
+BENCHMARK(BM_Std_SplitCb)->Apply(SizeSweep);
+
+static void BM_SplitInto(benchmark::State& state) {
+  const std::string text = Words(state.range(0), ',');
+  std::vector<std::string> fields;
+  while (state.KeepRunning()) {
+    fields.clear();
+    strings::split_into(&fields, text, ",");
+  }
+  SetProcessed(state, text.size(), fields.size());
+}
+BENCHMARK(BM_SplitInto)->Apply(SizeSweep);
+
+static void BM_Join(benchmark::State& state) {
+  std::vector<std::string> fields;
+  strings::split_into(&fields, Words(state.range(0), ','), ",");
+  size_t size = 0;
+  while (state.KeepRunning()) {
+    const std::string joined = strings::join(fields, ",");
+    size = joined.size();
+  }
+  SetProcessed(state, size, fields.size());
+}
+BENCHMARK(BM_Join)->Apply(SizeSweep);
+
+static void BM_Std_Join(benchmark::State& state) {
+  std::vector<std::string> fields;
+  strings::split_into(&fields, Words(state.range(0), ','), ",");
+  size_t size = 0;
+  while (state.KeepRunning()) {
+    std::string joined;
+    for (const std::string& field : fields) {
+      if (!joined.empty()) joined.append(",");
+      joined.append(field);
+    }
+    size = joined.size();
+  }
+  SetProcessed(state, size, fields.size());
+}
+BENCHMARK(BM_Std_Join)->Apply(SizeSweep);
+
+static void BM_SplitKvp(benchmark::State& state) {
+  std::string text;
+  for (int i = 0; i < state.range(0); ++i) {
+    if (i > 0) text += "&";
+    text += "key" + std::to_string(i) + "=value" + std::to_string(i);
+  }
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(strings::split_kvp(text, "&", "="));
+  }
+  SetProcessed(state, text.size(), state.range(0));
+}
+BENCHMARK(BM_SplitKvp)->RangeMultiplier(8)->Range(1, 512);
+
+static void BM_TrimWhitespace(benchmark::State& state) {
+  const std::string padding(state.range(0), ' ');
+  const std::string text = padding + "value" + padding;
+  Instrument instrument(state);
+  while (state.KeepRunning()) {
+    std::string str = text;
+    strings::trim_whitespace(&str);
+    benchmark::DoNotOptimize(str.data());
+  }
+  SetProcessed(state, text.size(), 1);
+}
+BENCHMARK(BM_TrimWhitespace)->RangeMultiplier(8)->Range(1, 4096);
+
+static void BM_Std_TrimWhitespace(benchmark::State& state) {
+  const std::string padding(state.range(0), ' ');
+  const std::string text = padding + "value" + padding;
+  Instrument instrument(state);
+  while (state.KeepRunning()) {
+    std::string str = text;
+    auto not_space = [](char c) { return !isspace(c); };
+    str.erase(std::find_if(str.rbegin(), str.rend(), not_space).base(),
+              str.end());
+    str.erase(str.begin(), std::find_if(str.begin(), str.end(), not_space));
+    benchmark::DoNotOptimize(str.data());
+  }
+  SetProcessed(state, text.size(), 1);
+}
+BENCHMARK(BM_Std_TrimWhitespace)->RangeMultiplier(8)->Range(1, 4096);
+
+namespace {
+
+enum Level { DEBUG, INFO, WARNING, ERROR, CRITICAL };
+
+constexpr strings::Keyword<Level> kLevels[] = {
+  {"debug", DEBUG}, {"info", INFO}, {"warning", WARNING},
+  {"error", ERROR}, {"critical", CRITICAL},
+};
+
+const char* const kLevelNames[] = {
+  "DEBUG", "info", "Warning", "error", "CRITICAL", "notice",
+};
+
+}  // namespace
+
+static void BM_MatchKeyword(benchmark::State& state) {
+  std::vector<strings::cord> names(std::begin(kLevelNames),
+                                   std::end(kLevelNames));
+  while (state.KeepRunning()) {
+    for (const strings::cord& name : names) {
+      Level level;
+      benchmark::DoNotOptimize(strings::match_keyword(name, kLevels, &level));
+    }
+  }
+  SetProcessed(state, 0, names.size());
+}
+BENCHMARK(BM_MatchKeyword);
+
+static void BM_Std_MatchKeyword(benchmark::State& state) {
+  std::unordered_map<std::string, Level> levels;
+  for (const auto& keyword : kLevels) levels[keyword.name] = keyword.value;
+  std::vector<std::string> names(std::begin(kLevelNames),
+                                 std::end(kLevelNames));
+  while (state.KeepRunning()) {
+    for (const std::string& name : names) {
+      std::string lower(name);
+      std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+      benchmark::DoNotOptimize(levels.find(lower));
+    }
+  }
+  SetProcessed(state, 0, names.size());
+}
+BENCHMARK(BM_Std_MatchKeyword);
+
+static void BM_Format(benchmark::State& state) {
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(
+        strings::format("%s:%d %s", "file.cc", 4711, "message"));
+  }
+  SetProcessed(state, 0, 1);
+}
+BENCHMARK(BM_Format);
+
+static void BM_Std_Format(benchmark::State& state) {
+  char buffer[256];
+  while (state.KeepRunning()) {
+    snprintf(buffer, sizeof(buffer), "%s:%d %s", "file.cc", 4711, "message");
+    benchmark::DoNotOptimize(std::string(buffer));
+  }
+  SetProcessed(state, 0, 1);
+}
+BENCHMARK(BM_Std_Format);
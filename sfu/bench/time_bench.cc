@@ -0,0 +1,235 @@
+#include <chrono>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <vector>
+
+#include "sfu/bench/bench.h"
+#include "sfu/time/clock.h"
+#include "sfu/time/datetime.h"
+#include "sfu/time/format.h"
+#include "sfu/time/parse.h"
+#include "sfu/time/zoneinfo.h"
+
+using namespace sfu::time;
+using namespace sfu::bench;
+
+namespace {
+
+const time_t kStart = 1234567890;
+
+// Timestamps of log lines: many per second, in order.
+const int kLinesPerSecond = 1000;
+
+std::vector<std::string> Rfc3339Lines(size_t count) {
+  Formatter formatter("%FT%T.%6NZ");
+  std::vector<std::string> lines;
+  for (size_t i = 0; i < count; ++i) {
+    lines.push_back(formatter.Format(kStart + i * 7919, i * 1000));
+  }
+  return lines;
+}
+
+}  // namespace
+
+static void BM_ClockRealtime(benchmark::State& state) {
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(realtime_ns());
+  }
+  SetProcessed(state, 0, 1);
+}
+BENCHMARK(BM_ClockRealtime);
+
+static void BM_Std_ClockRealtime(benchmark::State& state) {
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(std::chrono::system_clock::now());
+  }
+  SetProcessed(state, 0, 1);
+}
+BENCHMARK(BM_Std_ClockRealtime);
+
+static void BM_ClockMonotonic(benchmark::State& state) {
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(monotonic_ns());
+  }
+  SetProcessed(state, 0, 1);
+}
+BENCHMARK(BM_ClockMonotonic);
+
+static void BM_Std_ClockMonotonic(benchmark::State& state) {
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(std::chrono::steady_clock::now());
+  }
+  SetProcessed(state, 0, 1);
+}
+BENCHMARK(BM_Std_ClockMonotonic);
+
+static void BM_ClockMonotonicCoarse(benchmark::State& state) {
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(monotonic_coarse_ns());
+  }
+  SetProcessed(state, 0, 1);
+}
+BENCHMARK(BM_ClockMonotonicCoarse);
+
+static void BM_TscClock(benchmark::State& state) {
+  TscClock::now_ns();
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(TscClock::now_ns());
+  }
+  SetProcessed(state, 0, 1);
+}
+BENCHMARK(BM_TscClock);
+
+static void BM_CachedClock(benchmark::State& state) {
+  const CachedClock& clock = CachedClock::Default();
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(clock.realtime_ns());
+  }
+  SetProcessed(state, 0, 1);
+}
+BENCHMARK(BM_CachedClock);
+
+static void BM_Now(benchmark::State& state) {
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(now());
+  }
+  SetProcessed(state, 0, 1);
+}
+BENCHMARK(BM_Now);
+
+static void BM_Std_Now(benchmark::State& state) {
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(::time(NULL));
+  }
+  SetProcessed(state, 0, 1);
+}
+BENCHMARK(BM_Std_Now);
+
+static void BM_ZoneinfoUtcoffset(benchmark::State& state) {
+  const Zoneinfo* zone = Zoneinfo::GetZoneinfo("Europe/Oslo");
+  time_t ts = kStart;
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(zone->utcoffset(ts));
+    ts += 7919;
+  }
+  SetProcessed(state, 0, 1);
+}
+BENCHMARK(BM_ZoneinfoUtcoffset);
+
+static void BM_Std_ZoneinfoUtcoffset(benchmark::State& state) {
+  setenv("TZ", "Europe/Oslo", 1);
+  tzset();
+  time_t ts = kStart;
+  while (state.KeepRunning()) {
+    struct tm tm;
+    localtime_r(&ts, &tm);
+    benchmark::DoNotOptimize(tm.tm_gmtoff);
+    ts += 7919;
+  }
+  SetProcessed(state, 0, 1);
+}
+BENCHMARK(BM_Std_ZoneinfoUtcoffset);
+
+static void BM_DatetimeFields(benchmark::State& state) {
+  const Zoneinfo* zone = Zoneinfo::GetZoneinfo("Europe/Oslo");
+  time_t ts = kStart;
+  while (state.KeepRunning()) {
+    Datetime dt(ts, zone);
+    benchmark::DoNotOptimize(dt.year() + dt.month() + dt.day() + dt.hour());
+    ts += 7919;
+  }
+  SetProcessed(state, 0, 1);
+}
+BENCHMARK(BM_DatetimeFields);
+
+static void BM_Formatter(benchmark::State& state) {
+  const Formatter formatter("%F %T.%6N %Z",
+                            Zoneinfo::GetZoneinfo("Europe/Oslo"));
+  char buffer[64];
+  size_t size = 0;
+  int64_t line = 0;
+  Instrument instrument(state);
+  while (state.KeepRunning()) {
+    size = formatter.Format(kStart + line / kLinesPerSecond,
+                            static_cast<uint32_t>(line % kLinesPerSecond),
+                            buffer, sizeof(buffer));
+    ++line;
+  }
+  SetProcessed(state, size, 1);
+}
+BENCHMARK(BM_Formatter);
+
+static void BM_Std_Formatter(benchmark::State& state) {
+  setenv("TZ", "Europe/Oslo", 1);
+  tzset();
+  char buffer[64];
+  size_t size = 0;
+  int64_t line = 0;
+  Instrument instrument(state);
+  while (state.KeepRunning()) {
+    const time_t ts = kStart + line / kLinesPerSecond;
+    struct tm tm;
+    localtime_r(&ts, &tm);
+    size = strftime(buffer, sizeof(buffer), "%F %T", &tm);
+    size += snprintf(buffer + size, sizeof(buffer) - size, ".%06d",
+                     static_cast<int>(line % kLinesPerSecond));
+    size += strftime(buffer + size, sizeof(buffer) - size, " %Z", &tm);
+    ++line;
+  }
+  SetProcessed(state, size, 1);
+}
+BENCHMARK(BM_Std_Formatter);
+
+static void BM_ParseRfc3339(benchmark::State& state) {
+  const std::vector<std::string> lines = Rfc3339Lines(1000);
+  size_t bytes = 0;
+  for (const std::string& line : lines) bytes += line.size();
+  Instrument instrument(state);
+  while (state.KeepRunning()) {
+    for (const std::string& line : lines) {
+      time_t ts;
+      uint32_t nanos;
+      parse_time(line.data(), line.data() + line.size(), TIME_RFC3339, &ts,
+                 &nanos);
+      benchmark::DoNotOptimize(ts);
+    }
+  }
+  SetProcessed(state, bytes, lines.size());
+}
+BENCHMARK(BM_ParseRfc3339);
+
+static void BM_Std_ParseRfc3339(benchmark::State& state) {
+  const std::vector<std::string> lines = Rfc3339Lines(1000);
+  size_t bytes = 0;
+  for (const std::string& line : lines) bytes += line.size();
+  Instrument instrument(state);
+  while (state.KeepRunning()) {
+    for (const std::string& line : lines) {
+      struct tm tm;
+      memset(&tm, 0, sizeof(tm));
+      const char* end = strptime(line.c_str(), "%Y-%m-%dT%H:%M:%S", &tm);
+      benchmark::DoNotOptimize(strtod(end, NULL));
+      benchmark::DoNotOptimize(timegm(&tm));
+    }
+  }
+  SetProcessed(state, bytes, lines.size());
+}
+BENCHMARK(BM_Std_ParseRfc3339);
+
+static void BM_ParseTimeColumn(benchmark::State& state) {
+  std::string column;
+  for (const std::string& line : Rfc3339Lines(state.range(0))) {
+    column += line;
+    column += '\n';
+  }
+  std::vector<time_t> timestamps;
+  std::vector<uint32_t> nanos;
+  std::vector<uint64_t> errors;
+  while (state.KeepRunning()) {
+    parse_time_column(column, '\n', TIME_RFC3339, &timestamps, &nanos,
+                      &errors);
+  }
+  SetProcessed(state, column.size(), state.range(0));
+}
+BENCHMARK(BM_ParseTimeColumn)->RangeMultiplier(8)->Range(8, 1 << 18);
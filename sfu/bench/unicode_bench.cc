@@ -0,0 +1,154 @@
+#include <climits>
+#include <clocale>
+#include <cwchar>
+#include <cwctype>
+#include <random>
+#include <string>
+
+#include "sfu/bench/bench.h"
+#include "sfu/strings/cord.h"
+#include "sfu/unicode/casefold.h"
+#include "sfu/unicode/normalize.h"
+
+using namespace sfu;
+using namespace sfu::bench;
+
+// Normalization has no equivalent in the standard library or libc, so the
+// Normalize, NormalizeView and QuickCheck benchmarks have no BM_Std_ pair.
+
+namespace {
+
+// Words of size bytes where about one letter in ten has a combining acute
+// accent (U+0301) after it, as text in NFD, so NFC has to compose them.
+std::string DecomposedText(size_t size) {
+  std::mt19937 rng(static_cast<uint32_t>(size));
+  const std::string words = Words(size);
+  std::string text;
+  text.reserve(size + size / 4);
+  for (char c : words) {
+    text.push_back(c);
+    if (c != ' ' && rng() % 10 == 0) text.append("\xcc\x81");
+  }
+  return text;
+}
+
+// Case fold with libc in the C.UTF-8 locale: decode, towlower() and encode
+// each char.
+void StdCaseFold(const std::string& text, std::string* out) {
+  out->clear();
+  mbstate_t in_state = mbstate_t();
+  mbstate_t out_state = mbstate_t();
+  const char* p = text.data();
+  const char* end = p + text.size();
+  char buffer[MB_LEN_MAX];
+  while (p < end) {
+    wchar_t wc;
+    size_t n = mbrtowc(&wc, p, end - p, &in_state);
+    if (n == 0 || n > MB_LEN_MAX) n = 1;
+    p += n;
+    const size_t m = wcrtomb(buffer, towlower(wc), &out_state);
+    if (m <= MB_LEN_MAX) out->append(buffer, m);
+  }
+}
+
+}  // namespace
+
+static void BM_QuickCheck(benchmark::State& state) {
+  const std::string text = Utf8Text(state.range(0));
+  const strings::cord str(text);
+  Instrument instrument(state);
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(unicode::QuickCheck(str, unicode::NFC));
+  }
+  SetProcessed(state, text.size(), 1);
+}
+BENCHMARK(BM_QuickCheck)->Apply(SizeSweep);
+
+static void BM_Normalize(benchmark::State& state) {
+  const std::string text = DecomposedText(state.range(0));
+  std::string out;
+  Instrument instrument(state);
+  while (state.KeepRunning()) {
+    unicode::Normalize(text, unicode::NFC, &out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  SetProcessed(state, text.size(), 1);
+}
+BENCHMARK(BM_Normalize)->Apply(SizeSweep);
+
+static void BM_NormalizeNfd(benchmark::State& state) {
+  const std::string text = Utf8Text(state.range(0));
+  std::string out;
+  while (state.KeepRunning()) {
+    unicode::Normalize(text, unicode::NFD, &out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  SetProcessed(state, text.size(), 1);
+}
+BENCHMARK(BM_NormalizeNfd)->Apply(SizeSweep);
+
+// Text that is already in NFC, which NormalizeView returns without copying.
+static void BM_NormalizeView(benchmark::State& state) {
+  const std::string text = Utf8Text(state.range(0));
+  std::string buffer;
+  strings::cord out;
+  Instrument instrument(state);
+  while (state.KeepRunning()) {
+    unicode::NormalizeView(text, unicode::NFC, &buffer, &out);
+    benchmark::DoNotOptimize(out.ptr());
+  }
+  SetProcessed(state, text.size(), 1);
+}
+BENCHMARK(BM_NormalizeView)->Apply(SizeSweep);
+
+static void BM_CaseFold(benchmark::State& state) {
+  const std::string text = Utf8Text(state.range(0));
+  std::string out;
+  Instrument instrument(state);
+  while (state.KeepRunning()) {
+    unicode::CaseFold(text, &out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  SetProcessed(state, text.size(), 1);
+}
+BENCHMARK(BM_CaseFold)->Apply(SizeSweep);
+
+static void BM_Std_CaseFold(benchmark::State& state) {
+  setlocale(LC_CTYPE, "C.UTF-8");
+  const std::string text = Utf8Text(state.range(0));
+  std::string out;
+  Instrument instrument(state);
+  while (state.KeepRunning()) {
+    StdCaseFold(text, &out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  SetProcessed(state, text.size(), 1);
+}
+BENCHMARK(BM_Std_CaseFold)->Apply(SizeSweep);
+
+// Equal text but for case, so the whole of it is compared.
+static void BM_CaseFoldEquals(benchmark::State& state) {
+  const std::string text = Utf8Text(state.range(0));
+  std::string upper;
+  for (char c : text) upper.push_back(c >= 'a' && c <= 'z' ? c - 32 : c);
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(unicode::CaseFoldEquals(text, upper));
+  }
+  SetProcessed(state, text.size(), 1);
+}
+BENCHMARK(BM_CaseFoldEquals)->Apply(SizeSweep);
+
+static void BM_Std_CaseFoldEquals(benchmark::State& state) {
+  setlocale(LC_CTYPE, "C.UTF-8");
+  const std::string text = Utf8Text(state.range(0));
+  std::string upper;
+  for (char c : text) upper.push_back(c >= 'a' && c <= 'z' ? c - 32 : c);
+  std::string a, b;
+  while (state.KeepRunning()) {
+    StdCaseFold(text, &a);
+    StdCaseFold(upper, &b);
+    benchmark::DoNotOptimize(a == b);
+  }
+  SetProcessed(state, text.size(), 1);
+}
+BENCHMARK(BM_Std_CaseFoldEquals)->Apply(SizeSweep);
@@ -5,6 +5,7 @@
 #include "sfu/nullstream.h"
 #include "sfu/numbers.h"
 #include "sfu/strings/cord.h"
+#include "sfu/trace/trace.h"
 
 using namespace std;
 
@@ -12,6 +13,13 @@ namespace sfu {
 namespace console {
 namespace {
   // Helpers...
+
+template<typename T>
+string NumberToString(T value) {
+  char buffer[kMaxDoubleChars];
+  return string(buffer, to_chars(buffer, buffer + sizeof(buffer), value));
+}
+
 }
 
 Option::Option(const strings::cord& name,
@@ -33,6 +41,7 @@ const string& Option::short_name()  const { return short_name_; }
 const string& Option::help()        const { return help_; }
 const string& Option::metavar()     const { return metavar_; }
 const string& Option::metaname()    const { return metaname_; }
+const string& Option::default_value() const { return default_value_; }
 bool          Option::hidden()      const { return hidden_; }
 char          Option::num_args()    const { return num_args_; }
 
@@ -51,6 +60,31 @@ Option* Option::set_default_value(const sfu::strings::cord& defval) {
   return this;
 }
 
+Option* Option::set_default_value(int32_t defval) {
+  default_value_ = NumberToString(defval);
+  return this;
+}
+
+Option* Option::set_default_value(uint32_t defval) {
+  default_value_ = NumberToString(defval);
+  return this;
+}
+
+Option* Option::set_default_value(int64_t defval) {
+  default_value_ = NumberToString(defval);
+  return this;
+}
+
+Option* Option::set_default_value(uint64_t defval) {
+  default_value_ = NumberToString(defval);
+  return this;
+}
+
+Option* Option::set_default_value(double defval) {
+  default_value_ = NumberToString(defval);
+  return this;
+}
+
 Option* Option::set_hidden() {
   hidden_ = true;
   return this;
@@ -163,6 +197,7 @@ bool ArgumentParser::Apply(int argc, char ** argv) {
 
 
 bool ArgumentParser::Apply(const vector<string>& args) {
+  SFU_TRACE_SCOPE("ArgumentParser::Apply");
   if (!ApplyInternal(args) || show_help_) {
     PrintHelp(os_);
     return show_help_;
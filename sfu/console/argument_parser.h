@@ -1,13 +1,16 @@
 #ifndef CONSOLE_ARGUMENT_PARSER_H_
 #define CONSOLE_ARGUMENT_PARSER_H_
 
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <ostream>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "sfu/strings/cord.h"
+#include "sfu/strings/keyword.h"
 
 namespace sfu {
 namespace console {
@@ -33,6 +36,28 @@ class Option {
   Option* set_metavar(const sfu::strings::cord& metavar);
   Option* set_metaname(const sfu::strings::cord& metaname);
   Option* set_default_value(const sfu::strings::cord& defval);
+  // Numeric defaults are shown as they would be parsed, with the shortest
+  // digits that give back the same value.
+  Option* set_default_value(int32_t defval);
+  Option* set_default_value(uint32_t defval);
+  Option* set_default_value(int64_t defval);
+  Option* set_default_value(uint64_t defval);
+  Option* set_default_value(double defval);
+  // Other number types, e.g. long long or float, as the widest of their
+  // kind above.
+  template<typename T>
+  typename std::enable_if<std::is_arithmetic<T>::value &&
+                              !std::is_same<T, bool>::value,
+                          Option*>::type
+  set_default_value(T defval) {
+    if (std::is_floating_point<T>::value) {
+      return set_default_value(static_cast<double>(defval));
+    }
+    if (std::is_signed<T>::value) {
+      return set_default_value(static_cast<int64_t>(defval));
+    }
+    return set_default_value(static_cast<uint64_t>(defval));
+  }
   Option* set_hidden();
   Option* set_multi_args();
 
@@ -141,6 +166,21 @@ bool AppendStringVector(const sfu::strings::cord& str,
                         std::vector<std::string>* value);
 // std::bind(parser::AppendStringVector, std::placeholders::_1, value);
 
+// Set an enum (or any value) from one of a table of keywords, ignoring case.
+// The table must outlive the parser, e.g.:
+//
+// static constexpr sfu::strings::Keyword<Mode> kModes[] = {
+//     {"fast", FAST}, {"safe", SAFE}};
+// parser.add("--mode", "m", "Mode.", parser::SetKeyword(kModes, &mode));
+template<typename T, size_t N>
+std::function<bool(const sfu::strings::cord&)> SetKeyword(
+    const sfu::strings::Keyword<T> (&keywords)[N], T* value) {
+  const sfu::strings::Keyword<T> (*table)[N] = &keywords;
+  return [table, value](const sfu::strings::cord& str) {
+    return sfu::strings::match_keyword(str, *table, value);
+  };
+}
+
 }  // namespace parser
 }  // namespace console
 }  // namespace sfu
@@ -20,6 +20,61 @@ TEST(ArgumentParserTest, TestBasics) {
   EXPECT_TRUE(parser.show_help());
 }
 
+TEST(ArgumentParserTest, TestDefaultValue) {
+  Option opt("timeout", "t", "Timeout in seconds.", NULL);
+
+  EXPECT_EQ("2.5", opt.set_default_value(2.5)->default_value());
+  EXPECT_EQ("0.1", opt.set_default_value(0.1)->default_value());
+  EXPECT_EQ("-17", opt.set_default_value(-17)->default_value());
+  EXPECT_EQ("18446744073709551615",
+            opt.set_default_value(UINT64_MAX)->default_value());
+  EXPECT_EQ("forever", opt.set_default_value("forever")->default_value());
+
+  // Types without an overload of their own.
+  EXPECT_EQ("5", opt.set_default_value(5LL)->default_value());
+  const long long ll = -9000000000LL;
+  EXPECT_EQ("-9000000000", opt.set_default_value(ll)->default_value());
+  EXPECT_EQ("18446744073709551615",
+            opt.set_default_value(~0ULL)->default_value());
+  const short s = -3;
+  EXPECT_EQ("-3", opt.set_default_value(s)->default_value());
+  EXPECT_EQ("0.5", opt.set_default_value(0.5f)->default_value());
+  EXPECT_EQ("1.5", opt.set_default_value(1.5L)->default_value());
+}
+
+namespace {
+
+typedef enum { MODE_FAST = 0, MODE_SAFE, MODE_INTERACTIVE } Mode;
+
+constexpr sfu::strings::Keyword<Mode> kModes[] = {
+  {"fast", MODE_FAST},
+  {"safe", MODE_SAFE},
+  {"interactive", MODE_INTERACTIVE},
+};
+
+}  // namespace
+
+TEST(ArgumentParserTest, TestKeywordArgument) {
+  ArgumentParser parser("gt", "Small command.");
+  Mode mode = MODE_FAST;
+  parser.add("--mode", "m", "The mode.", parser::SetKeyword(kModes, &mode));
+
+  vector<string> test;
+  test.push_back("test");
+  test.push_back("--mode=Interactive");
+  EXPECT_TRUE(parser.Apply(test));
+  EXPECT_EQ(MODE_INTERACTIVE, mode);
+
+  test[1] = "-m";
+  test.push_back("SAFE");
+  EXPECT_TRUE(parser.Apply(test));
+  EXPECT_EQ(MODE_SAFE, mode);
+
+  test[2] = "slow";
+  EXPECT_FALSE(parser.Apply(test));
+  EXPECT_EQ(MODE_SAFE, mode);
+}
+
 TEST(ArgumentParserTest, TestLongArguments) {
   int32_t u32 = 0;
   bool b = false;
@@ -2,7 +2,7 @@
 #include <cstdarg>
 
 #include "sfu/console/char.h"
-#include "sfu/strings/format.h"
+#include "sfu/numbers.h"
 #include "sfu/utf8.h"
 
 #include "sfu/encoding.h"
@@ -210,53 +210,65 @@ const std::string Char::as_string(bool printable) const {
 
 const Char Char::mkcolor(uint8_t col, ...) {
   char buffer[MAX_CHAR_LENGTH + 1] = {kESC, '[', 0, };
-
-  size_t p = 2;
+  char* const end = buffer + MAX_CHAR_LENGTH;
 
   uint8_t num = col;
-  size_t s = snprintf(buffer + p, MAX_CHAR_LENGTH - 1,
-                      "%i", num);
-  if (s < 0) return Char();
-  p += s;
+  char* p = sfu::to_chars(buffer + 2, end, static_cast<uint32_t>(num));
   if (num) {
     va_list pa;
     va_start(pa, col);
 
-    while (p < MAX_CHAR_LENGTH - 4) {
+    while (p < end - 5) {
       num = va_arg(pa, int);
       if (!num) break;
 
-      s = snprintf(buffer + p, MAX_CHAR_LENGTH - 1,
-                   ";%i", num);
-      if (s < 0) break;
-      p += s;
+      *p++ = ';';
+      p = sfu::to_chars(p, end, static_cast<uint32_t>(num));
     }
 
     va_end(pa);
   }
 
-  buffer[p++] = 'm';
-  return Char(buffer, p);
+  *p++ = 'm';
+  return Char(buffer, p - buffer);
+}
+
+namespace {
+
+// "ESC [ <num> <cmd>", the cursor movement escape sequences.
+const Char CursorMove(int num, char cmd) {
+  char buffer[kMaxIntegerChars + 3] = {kESC, '[', 0, };
+  char* p = sfu::to_chars(buffer + 2, buffer + sizeof(buffer), num);
+  *p++ = cmd;
+  return Char(buffer, p - buffer);
 }
 
+}  // namespace
+
 const Char Char::cursor_setpos(int line, int column) {
-  return Char(sfu::strings::format("\x1b[%d;%dH", line, column));
+  char buffer[2 * kMaxIntegerChars + 4] = {kESC, '[', 0, };
+  char* const end = buffer + sizeof(buffer);
+  char* p = sfu::to_chars(buffer + 2, end, line);
+  *p++ = ';';
+  p = sfu::to_chars(p, end, column);
+  *p++ = 'H';
+  return Char(buffer, p - buffer);
 }
 const Char Char::cursor_up(int num) {
   if (num == 1) return Char::UP;
-  return Char(sfu::strings::format("\x1b[%iA", num));
+  return CursorMove(num, 'A');
 }
 const Char Char::cursor_down(int num) {
   if (num == 1) return Char::DOWN;
-  return Char(sfu::strings::format("\x1b[%iB", num));
+  return CursorMove(num, 'B');
 }
 const Char Char::cursor_right(int num) {
   if (num == 1) return Char::RIGHT;
-  return Char(sfu::strings::format("\x1b[%iD", num));
+  return CursorMove(num, 'C');
 }
 const Char Char::cursor_left(int num) {
   if (num == 1) return Char::LEFT;
-  return Char(sfu::strings::format("\x1b[%iD", num));
+  return CursorMove(num, 'D');
 }
 
 const Char Char::numeric(int num) {
@@ -289,9 +301,9 @@ bool Char::FromString(const char* str, size_t maxlen, Char* ch) {
     }
   } else if (str[0] < 0) {
     // Utf8 encoded char.
-    size_t len = sfu::Utf8LengthFromBuffer(str, maxlen);
-    if (len > 0) {
-      *ch = Char(str, len);
+    sfu::utf8_iterator it(str, str + maxlen, str);
+    if (it.valid()) {
+      *ch = Char(str, it.length());
       return true;
     }
   } else {
@@ -306,11 +318,24 @@ bool Char::LastFromString(const char* str, size_t maxlen, Char* ch) {
     return false;
   }
 
-  // Otherwise iterate over string to find the last character.
-  // TODO(steineldar): Make faster version for printable strings only (where
-  // the char would either be ASCII (1 byte always) or UTF-8, which can be
-  // back-tracked).
-  size_t pos = 0;
+  // Escape sequences never contain kESC except as the first byte, and are at
+  // most MAX_CHAR_LENGTH long. So if there is no kESC near the end, the last
+  // char is either ASCII or UTF-8, which can be back-tracked.
+  size_t window = std::min(maxlen, MAX_CHAR_LENGTH);
+  const char* esc = static_cast<const char*>(
+      memrchr(str + maxlen - window, kESC, window));
+  if (esc == NULL) {
+    sfu::utf8_iterator it(str, str + maxlen, str + maxlen);
+    --it;
+    if (!it.valid()) {
+      return false;
+    }
+    *ch = Char(it.ptr(), it.length());
+    return true;
+  }
+
+  // Otherwise iterate from the last escape char to find the last character.
+  size_t pos = esc - str;
   Char last;
   while (pos < maxlen) {
     if (!FromString(str + pos, maxlen - pos, &last)) {
@@ -33,3 +33,30 @@ TEST(CharTest, TestConstructor) {
 
 TEST(CharTest, TestColors) {
 }
+
+TEST(CharTest, TestCursorMove) {
+  EXPECT_EQ("\x1b[12;3H", Char::cursor_setpos(12, 3).as_string());
+  EXPECT_EQ("\x1b[5A", Char::cursor_up(5).as_string());
+  EXPECT_EQ("\x1b[17C", Char::cursor_right(17).as_string());
+  EXPECT_EQ("\x1b[2D", Char::cursor_left(2).as_string());
+  EXPECT_EQ("\x1b[1;31m", Char::mkcolor(1, 31, 0).as_string());
+  EXPECT_EQ("\x1b[0m", Char::mkcolor(0).as_string());
+}
+
+TEST(CharTest, TestLastFromString) {
+  Char c;
+  string str("ab‘");
+  EXPECT_TRUE(Char::LastFromString(str.c_str(), str.size(), &c));
+  EXPECT_EQ(0x2018, c.codepoint());
+
+  str = "a‘\x1b[1;31mb";
+  EXPECT_TRUE(Char::LastFromString(str.c_str(), str.size(), &c));
+  EXPECT_TRUE(c == 'b');
+  EXPECT_TRUE(Char::LastFromString(str.c_str(), str.size() - 1, &c));
+  EXPECT_EQ("\x1b[1;31m", c.as_string());
+
+  // Truncated utf8 sequence.
+  str = "a\xe2\x80";
+  EXPECT_FALSE(Char::LastFromString(str.c_str(), str.size(), &c));
+  EXPECT_FALSE(Char::FromString(str.c_str() + 1, str.size() - 1, &c));
+}
@@ -153,7 +153,7 @@ bool LineReader::handle_delete_(const Char& c) {
     if (Char::FromString(after_cursor_.c_str(), after_cursor_.size(), &tmp)) {
       after_cursor_.erase(after_cursor_.begin(),
                           after_cursor_.begin() + tmp.length());
-      after_length_ = Char::DisplayWidth(after_cursor_);
+      after_length_ -= tmp.display_width();
     }
     return true;
   } else if (c == Char::BACKSPACE) {
@@ -172,7 +172,7 @@ bool LineReader::handle_direction_(const Char& c) {
   if (c == Char::HOME) {
     after_cursor_.insert(after_cursor_.begin(),
         before_cursor_.begin(), before_cursor_.end());
-    after_length_ = Char::DisplayWidth(after_cursor_);
+    after_length_ += Char::DisplayWidth(before_cursor_);
     before_cursor_.clear();
     return true;
   } else if (c == Char::END) {
@@ -187,9 +187,8 @@ bool LineReader::handle_direction_(const Char& c) {
                              &tmp)) {
       before_cursor_.erase(before_cursor_.end() - tmp.length(),
                            before_cursor_.end());
-      std::string str(tmp.as_string());
-      after_cursor_.insert(after_cursor_.begin(), str.begin(), str.end());
-      after_length_ = Char::DisplayWidth(after_cursor_);
+      after_cursor_.insert(0, tmp.c_str(), tmp.length());
+      after_length_ += tmp.display_width();
     }
     return true;
   } else if (c == Char::RIGHT) {
@@ -198,7 +197,7 @@ bool LineReader::handle_direction_(const Char& c) {
     if (Char::FromString(after_cursor_.c_str(), after_cursor_.size(), &tmp)) {
       after_cursor_.erase(after_cursor_.begin(),
                           after_cursor_.begin() + tmp.length());
-      after_length_ = Char::DisplayWidth(after_cursor_);
+      after_length_ -= tmp.display_width();
       before_cursor_.append(tmp.c_str(), tmp.length());
     }
     return true;
@@ -370,15 +370,15 @@ bool UrlDecode(const strings::cord& encoded, string *str) {
         // Not enough chars to parse.
         return false;
       }
-      strings::cord tmp(encoded.ptr() + i + 1, 2);
-      string out;
       // URL percent encoded values require uppercase letters.
-      if (!AppendHexDecodeInternal(tmp, &out, true)) {
+      char c1 = HexToByte(encoded[i + 1], true);
+      char c2 = HexToByte(encoded[i + 2], true);
+      if (c1 < 0 || c2 < 0) {
         // not valid hex.
         return false;
       }
       i += 2;
-      str->append(out);
+      str->push_back((c1 << 4) + c2);
     } else if (!IsPrintable(encoded[i]) ||
         IsUrlReservedChar(encoded[i])) {
       return false;
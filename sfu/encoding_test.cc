@@ -1,4 +1,5 @@
 #include "sfu/encoding.h"
+#include "sfu/testing/alloc_counter.h"
 #include "gtest/gtest.h"
 
 using namespace sfu;
@@ -61,3 +62,12 @@ TEST(EncodingTest, TestBase64Encode) {
 
   EXPECT_EQ(raw, decoded);
 }
+
+TEST(EncodingTest, TestUrlDecodeNoAlloc) {
+  string decoded;
+  decoded.reserve(64);
+  EXPECT_NO_ALLOC(UrlDecode("a%20b%2Fc+d%3F", &decoded));
+  EXPECT_EQ("a b/c d?", decoded);
+  EXPECT_FALSE(UrlDecode("a%2", &decoded));
+  EXPECT_FALSE(UrlDecode("a%2f", &decoded));
+}
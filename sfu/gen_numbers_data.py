@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+#
+# Generates numbers_data.cc, the tables used for number parsing and
+# formatting.
+#
+#   python3 sfu/gen_numbers_data.py > sfu/numbers_data.cc
+
+import sys
+
+SMALLEST_POWER_OF_FIVE = -342
+LARGEST_POWER_OF_FIVE = 308
+
+# Ryu shortest formatting tables.
+POW5_INV_COUNT = 342
+POW5_COUNT = 326
+POW5_BITCOUNT = 125
+
+
+def power_of_five_128(q):
+    """The 128 most significant bits of 5^q, rounded up for negative q."""
+    if q < 0:
+        power5 = 5 ** -q
+        z = power5.bit_length()
+        if q >= -27:
+            c = 2 ** (z + 127) // power5 + 1
+        else:
+            c = 2 ** (2 * z + 2 * 64) // power5 + 1
+            while c >= (1 << 128):
+                c //= 2
+        return c
+    power5 = 5 ** q
+    while power5 < (1 << 127):
+        power5 *= 2
+    while power5 >= (1 << 128):
+        power5 //= 2
+    return power5
+
+
+def pow5_inv_split(i):
+    """ceil(2^(bits(5^i) - 1 + 125) / 5^i), slightly above 2^125 / 5^i."""
+    power5 = 5 ** i
+    return 2 ** (power5.bit_length() - 1 + POW5_BITCOUNT) // power5 + 1
+
+
+def pow5_split(i):
+    """5^i truncated to its 125 most significant bits."""
+    power5 = 5 ** i
+    shift = power5.bit_length() - POW5_BITCOUNT
+    return power5 >> shift if shift >= 0 else power5 << -shift
+
+
+def write_split_table(out, name, count, fn):
+    out.write('const uint64_t %s[%d] = {\n' % (name, 2 * count))
+    for i in range(count):
+        v = fn(i)
+        out.write('  0x%016x, 0x%016x,  // %d\n' % (v >> 64, v & ((1 << 64) - 1), i))
+    out.write('};\n\n')
+
+
+def main():
+    out = sys.stdout
+    out.write('// Generated by sfu/gen_numbers_data.py.\n')
+    out.write('// DO NOT EDIT.\n\n')
+    out.write('#include "sfu/numbers_data.h"\n\n')
+    out.write('namespace sfu {\nnamespace numbers_internal {\n\n')
+
+    count = LARGEST_POWER_OF_FIVE - SMALLEST_POWER_OF_FIVE + 1
+    out.write('const uint64_t kPowerOfFive128[%d] = {\n' % (2 * count))
+    for q in range(SMALLEST_POWER_OF_FIVE, LARGEST_POWER_OF_FIVE + 1):
+        v = power_of_five_128(q)
+        out.write('  0x%016x, 0x%016x,  // 5^%d\n' % (v >> 64, v & ((1 << 64) - 1), q))
+    out.write('};\n\n')
+
+    write_split_table(out, 'kPow5InvSplit', POW5_INV_COUNT, pow5_inv_split)
+    write_split_table(out, 'kPow5Split', POW5_COUNT, pow5_split)
+
+    out.write('}  // namespace numbers_internal\n}  // namespace sfu\n')
+
+
+if __name__ == '__main__':
+    main()
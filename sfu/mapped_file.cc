@@ -0,0 +1,127 @@
+#include "sfu/mapped_file.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace sfu {
+namespace {
+
+const size_t kHugePageSize = 2 * 1024 * 1024;
+
+size_t PageSize() {
+  static const size_t page_size = sysconf(_SC_PAGESIZE);
+  return page_size;
+}
+
+}  // namespace
+
+MappedFile::MappedFile() : open_(false), error_(0) {}
+
+MappedFile::~MappedFile() {
+  Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other)
+    : data_(other.data_), open_(other.open_), error_(other.error_) {
+  other.data_ = strings::cord();
+  other.open_ = false;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) {
+  if (this != &other) {
+    Close();
+    data_ = other.data_;
+    open_ = other.open_;
+    error_ = other.error_;
+    other.data_ = strings::cord();
+    other.open_ = false;
+  }
+  return *this;
+}
+
+bool MappedFile::Open(const std::string& path, int flags) {
+  Close();
+
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    error_ = errno;
+    return false;
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    error_ = errno;
+    ::close(fd);
+    return false;
+  }
+  if (!S_ISREG(st.st_mode)) {
+    error_ = S_ISDIR(st.st_mode) ? EISDIR : EINVAL;
+    ::close(fd);
+    return false;
+  }
+
+  const size_t size = static_cast<size_t>(st.st_size);
+  if (size == 0) {
+    // Nothing to map, mmap() does not allow empty mappings.
+    ::close(fd);
+    error_ = 0;
+    open_ = true;
+    return true;
+  }
+
+  int map_flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+  if (flags & POPULATE) map_flags |= MAP_POPULATE;
+#endif
+  void* addr = mmap(NULL, size, PROT_READ, map_flags, fd, 0);
+  int mmap_errno = errno;
+  // The mapping keeps its own reference to the file.
+  ::close(fd);
+  if (addr == MAP_FAILED) {
+    error_ = mmap_errno;
+    return false;
+  }
+
+  // The hints are only advice, so failures are ignored.
+  if (flags & SEQUENTIAL) madvise(addr, size, MADV_SEQUENTIAL);
+  if (flags & RANDOM) madvise(addr, size, MADV_RANDOM);
+  if (flags & WILLNEED) madvise(addr, size, MADV_WILLNEED);
+#ifdef MADV_HUGEPAGE
+  if ((flags & HUGE_PAGES) && size >= kHugePageSize) {
+    madvise(addr, size, MADV_HUGEPAGE);
+  }
+#endif
+
+  data_.reset(static_cast<const char*>(addr), size);
+  error_ = 0;
+  open_ = true;
+  return true;
+}
+
+void MappedFile::Close() {
+  if (data_.length() > 0) {
+    munmap(const_cast<char*>(data_.ptr()), data_.length());
+  }
+  data_ = strings::cord();
+  open_ = false;
+}
+
+void MappedFile::DontNeed(size_t offset, size_t length) {
+  if (offset >= data_.length()) return;
+  if (length > data_.length() - offset) length = data_.length() - offset;
+
+  // madvise() needs page aligned ranges, so only whole pages are dropped.
+  const size_t page = PageSize();
+  const size_t begin = (offset + page - 1) / page * page;
+  const size_t end = offset + length == data_.length()
+      ? offset + length : (offset + length) / page * page;
+  if (end > begin) {
+    madvise(const_cast<char*>(data_.ptr()) + begin, end - begin,
+            MADV_DONTNEED);
+  }
+}
+
+}  // namespace sfu
@@ -0,0 +1,72 @@
+#ifndef SFU_MAPPED_FILE_H_
+#define SFU_MAPPED_FILE_H_
+
+#include <cstddef>
+#include <string>
+
+#include "sfu/strings/cord.h"
+
+namespace sfu {
+
+// Read-only memory mapped view of a whole file, so it can be handled as a
+// cord without reading it into memory first. The mapping is removed when the
+// MappedFile is closed or destroyed, which invalidates all cords into it.
+//
+// MappedFile file;
+// if (!file.Open("/var/log/big.log")) { ... file.error() ... }
+// strings::cord data = file.data();
+class MappedFile {
+  public:
+    typedef enum {
+      // Expect the file to be read front to back, so the kernel reads ahead
+      // aggressively and drops pages behind.
+      SEQUENTIAL = 0x01,
+      // Expect random access, do not read ahead.
+      RANDOM = 0x02,
+      // Start reading the file in the background right away.
+      WILLNEED = 0x04,
+      // Read the whole file in before Open() returns, so later access does
+      // not page fault (MAP_POPULATE).
+      POPULATE = 0x08,
+      // Ask for transparent huge pages, to reduce TLB misses on very large
+      // files. Only has an effect where the kernel and file system supports
+      // it, and is otherwise ignored.
+      HUGE_PAGES = 0x10
+    } Flags;
+
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other);
+    MappedFile& operator=(MappedFile&& other);
+
+    // Map the file at path, closing any previously mapped file. Returns false
+    // on failure, with the errno value in error().
+    bool Open(const std::string& path, int flags = SEQUENTIAL);
+    void Close();
+
+    inline bool is_open() const { return open_; }
+    inline int error() const { return error_; }
+
+    inline const strings::cord& data() const { return data_; }
+    inline const char* ptr() const { return data_.ptr(); }
+    inline size_t size() const { return data_.length(); }
+
+    // Tell the kernel the given range will not be needed soon, so its pages
+    // can be dropped, e.g. behind the read position when scanning a file
+    // much larger than memory.
+    void DontNeed(size_t offset, size_t length);
+
+  private:
+    strings::cord data_;
+    bool open_;
+    int error_;
+
+    // DISALLOW_COPY_AND_ASSIGN
+    MappedFile(const MappedFile& other);
+    void operator=(const MappedFile& other);
+};
+
+}  // namespace sfu
+
+#endif  // SFU_MAPPED_FILE_H_
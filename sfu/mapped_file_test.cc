@@ -0,0 +1,76 @@
+#include <errno.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <string>
+#include <utility>
+
+#include "sfu/mapped_file.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+using namespace sfu;
+
+namespace {
+
+string WriteTempFile(const string& content) {
+  char path[] = "/tmp/mapped_file_test.XXXXXX";
+  int fd = mkstemp(path);
+  EXPECT_LE(0, fd);
+  EXPECT_EQ(static_cast<ssize_t>(content.size()),
+            write(fd, content.c_str(), content.size()));
+  close(fd);
+  return path;
+}
+
+}  // namespace
+
+TEST(MappedFileTest, TestOpen) {
+  string content;
+  for (int i = 0; i < 10000; ++i) {
+    content += "line " + to_string(i) + "\n";
+  }
+  string path = WriteTempFile(content);
+
+  MappedFile file;
+  EXPECT_FALSE(file.is_open());
+  ASSERT_TRUE(file.Open(path, MappedFile::SEQUENTIAL | MappedFile::POPULATE |
+                              MappedFile::HUGE_PAGES));
+  EXPECT_TRUE(file.is_open());
+  EXPECT_EQ(content.size(), file.size());
+  EXPECT_TRUE(file.data().string_equals(content));
+  EXPECT_EQ(content.find("line 9999"), file.data().find("line 9999"));
+
+  // Still readable after dropping pages, they are read back in.
+  file.DontNeed(0, file.size() / 2);
+  EXPECT_TRUE(file.data().string_equals(content));
+
+  MappedFile other(std::move(file));
+  EXPECT_FALSE(file.is_open());
+  EXPECT_EQ(0UL, file.size());
+  EXPECT_TRUE(other.data().string_equals(content));
+
+  other.Close();
+  EXPECT_FALSE(other.is_open());
+  EXPECT_EQ(0UL, other.size());
+  unlink(path.c_str());
+}
+
+TEST(MappedFileTest, TestEmptyFile) {
+  string path = WriteTempFile("");
+  MappedFile file;
+  EXPECT_TRUE(file.Open(path, MappedFile::RANDOM));
+  EXPECT_TRUE(file.is_open());
+  EXPECT_EQ(0UL, file.size());
+  unlink(path.c_str());
+}
+
+TEST(MappedFileTest, TestOpenFails) {
+  MappedFile file;
+  EXPECT_FALSE(file.Open("/no/such/file"));
+  EXPECT_EQ(ENOENT, file.error());
+  EXPECT_FALSE(file.is_open());
+
+  EXPECT_FALSE(file.Open("/tmp"));
+  EXPECT_EQ(EISDIR, file.error());
+}
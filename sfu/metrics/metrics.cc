@@ -0,0 +1,254 @@
+#include "sfu/metrics/metrics.h"
+
+#include <stdlib.h>
+
+#include <atomic>
+#include <cmath>
+#include <new>
+
+#include "sfu/numbers.h"
+
+namespace sfu {
+namespace metrics {
+namespace metrics_internal {
+
+int thread_shard() {
+  static std::atomic<int> next(0);
+  static thread_local int shard = -1;
+  if (shard < 0) {
+    shard = next.fetch_add(1, std::memory_order_relaxed) & (kShards - 1);
+  }
+  return shard;
+}
+
+void* cache_line_new(size_t size) {
+  void* ptr = NULL;
+  if (posix_memalign(&ptr, kCacheLine, size) != 0) throw std::bad_alloc();
+  return ptr;
+}
+
+void cache_line_delete(void* ptr) {
+  free(ptr);
+}
+
+bool valid_name(const std::string& name) {
+  if (name.empty()) return false;
+  for (size_t i = 0; i < name.size(); ++i) {
+    const char c = name[i];
+    if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' ||
+        c == ':') {
+      continue;
+    }
+    if (i > 0 && c >= '0' && c <= '9') continue;
+    return false;
+  }
+  return true;
+}
+
+template<typename T>
+void append_number(T value, std::string* out) {
+  char buffer[kMaxDoubleChars];
+  out->append(buffer, to_chars(buffer, buffer + sizeof(buffer), value));
+}
+
+const char* const kQuantiles[] = { "0.5", "0.9", "0.99", "0.999" };
+const double kQuantileValues[] = { 0.5, 0.9, 0.99, 0.999 };
+
+}  // namespace metrics_internal
+
+using namespace metrics_internal;
+
+// ---- Counter ----
+
+Counter::Counter() {
+  for (int i = 0; i < kShards; ++i) shards_[i].value.store(0);
+}
+
+int64_t Counter::value() const {
+  int64_t sum = 0;
+  for (int i = 0; i < kShards; ++i) {
+    sum += shards_[i].value.load(std::memory_order_relaxed);
+  }
+  return sum;
+}
+
+// ---- HistogramSnapshot ----
+
+HistogramSnapshot::HistogramSnapshot()
+    : buckets_(Histogram::kBuckets, 0), count_(0), sum_(0) {}
+
+double HistogramSnapshot::mean() const {
+  if (count_ == 0) return 0;
+  return static_cast<double>(sum_) / count_;
+}
+
+int64_t HistogramSnapshot::Quantile(double quantile) const {
+  if (count_ == 0) return 0;
+  if (quantile < 0) quantile = 0;
+  if (quantile > 1) quantile = 1;
+  // The rank of the value, from 1 to count.
+  uint64_t rank = static_cast<uint64_t>(std::ceil(quantile * count_));
+  if (rank == 0) rank = 1;
+  uint64_t seen = 0;
+  for (int i = 0; i < Histogram::kBuckets; ++i) {
+    seen += buckets_[i];
+    if (seen >= rank) return Histogram::bucket_upper(i);
+  }
+  return Histogram::kMaxValue;
+}
+
+int64_t HistogramSnapshot::min() const {
+  for (int i = 0; i < Histogram::kBuckets; ++i) {
+    if (buckets_[i] > 0) return Histogram::bucket_lower(i);
+  }
+  return 0;
+}
+
+int64_t HistogramSnapshot::max() const {
+  for (int i = Histogram::kBuckets - 1; i >= 0; --i) {
+    if (buckets_[i] > 0) return Histogram::bucket_upper(i);
+  }
+  return 0;
+}
+
+void HistogramSnapshot::Merge(const HistogramSnapshot& snapshot) {
+  for (int i = 0; i < Histogram::kBuckets; ++i) {
+    buckets_[i] += snapshot.buckets_[i];
+  }
+  count_ += snapshot.count_;
+  sum_ += snapshot.sum_;
+}
+
+void HistogramSnapshot::Clear() {
+  buckets_.assign(Histogram::kBuckets, 0);
+  count_ = 0;
+  sum_ = 0;
+}
+
+// ---- Histogram ----
+
+const int Histogram::kSubBucketBits;
+const int Histogram::kMaxBits;
+const int64_t Histogram::kMaxValue;
+const int Histogram::kBuckets;
+
+Histogram::Histogram() : shards_(new Shard[kShards]) {
+  for (int s = 0; s < kShards; ++s) {
+    for (int i = 0; i < kBuckets; ++i) shards_[s].buckets[i].store(0);
+    shards_[s].sum.store(0);
+  }
+}
+
+void Histogram::Snapshot(HistogramSnapshot* snapshot) const {
+  snapshot->Clear();
+  for (int s = 0; s < kShards; ++s) {
+    const Shard& shard = shards_[s];
+    for (int i = 0; i < kBuckets; ++i) {
+      const uint64_t count =
+          shard.buckets[i].load(std::memory_order_relaxed);
+      snapshot->buckets_[i] += count;
+      snapshot->count_ += count;
+    }
+    snapshot->sum_ += shard.sum.load(std::memory_order_relaxed);
+  }
+}
+
+// static
+int64_t Histogram::bucket_lower(int bucket) {
+  if (bucket < (1 << kSubBucketBits)) return bucket;
+  const int shift = (bucket >> kSubBucketBits) - 1;
+  const int64_t sub = bucket & ((1 << kSubBucketBits) - 1);
+  return ((INT64_C(1) << kSubBucketBits) + sub) << shift;
+}
+
+// static
+int64_t Histogram::bucket_upper(int bucket) {
+  if (bucket < (1 << kSubBucketBits)) return bucket;
+  const int shift = (bucket >> kSubBucketBits) - 1;
+  return bucket_lower(bucket) + (INT64_C(1) << shift) - 1;
+}
+
+// ---- Registry ----
+
+Registry::Registry() {}
+
+Registry::~Registry() {}
+
+Counter* Registry::GetCounter(const std::string& name) {
+  if (!valid_name(name)) return NULL;
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (histograms_.count(name) > 0) return NULL;
+  std::unique_ptr<Counter>& counter = counters_[name];
+  if (!counter) counter.reset(new Counter());
+  return counter.get();
+}
+
+Histogram* Registry::GetHistogram(const std::string& name) {
+  if (!valid_name(name)) return NULL;
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (counters_.count(name) > 0) return NULL;
+  std::unique_ptr<Histogram>& histogram = histograms_[name];
+  if (!histogram) histogram.reset(new Histogram());
+  return histogram.get();
+}
+
+void Registry::ExportText(std::string* out) const {
+  // Snapshots are taken under the lock, and formatted after.
+  std::vector<std::pair<std::string, int64_t>> counters;
+  std::vector<std::pair<std::string, HistogramSnapshot>> histograms;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& counter : counters_) {
+      counters.push_back(std::make_pair(counter.first,
+                                        counter.second->value()));
+    }
+    histograms.resize(histograms_.size());
+    size_t i = 0;
+    for (const auto& histogram : histograms_) {
+      histograms[i].first = histogram.first;
+      histogram.second->Snapshot(&histograms[i].second);
+      ++i;
+    }
+  }
+
+  // Both are ordered by name, and the names are unique over both.
+  size_t c = 0, h = 0;
+  while (c < counters.size() || h < histograms.size()) {
+    if (h == histograms.size() ||
+        (c < counters.size() && counters[c].first < histograms[h].first)) {
+      const std::string& name = counters[c].first;
+      out->append("# TYPE ").append(name).append(" counter\n");
+      out->append(name).push_back(' ');
+      append_number(counters[c].second, out);
+      out->push_back('\n');
+      ++c;
+    } else {
+      const std::string& name = histograms[h].first;
+      const HistogramSnapshot& snapshot = histograms[h].second;
+      out->append("# TYPE ").append(name).append(" summary\n");
+      for (size_t q = 0; q < sizeof(kQuantiles) / sizeof(kQuantiles[0]);
+           ++q) {
+        out->append(name).append("{quantile=\"").append(kQuantiles[q]);
+        out->append("\"} ");
+        append_number(snapshot.Quantile(kQuantileValues[q]), out);
+        out->push_back('\n');
+      }
+      out->append(name).append("_sum ");
+      append_number(snapshot.sum(), out);
+      out->push_back('\n');
+      out->append(name).append("_count ");
+      append_number(snapshot.count(), out);
+      out->push_back('\n');
+      ++h;
+    }
+  }
+}
+
+// static
+Registry* Registry::Default() {
+  static Registry* registry = new Registry();
+  return registry;
+}
+
+}  // namespace metrics
+}  // namespace sfu
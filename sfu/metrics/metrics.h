@@ -0,0 +1,219 @@
+#ifndef SFU_METRICS_METRICS_H_
+#define SFU_METRICS_METRICS_H_
+
+#include <sched.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace sfu {
+namespace metrics {
+
+// Counters and histograms that are cheap enough to update in inner loops:
+//
+//   static metrics::Counter* const lines =
+//       metrics::Registry::Default()->GetCounter("parsed_lines");
+//   static metrics::Histogram* const latency =
+//       metrics::Registry::Default()->GetHistogram("parse_latency_ns");
+//   ...
+//   lines->Increment();
+//   latency->Record(time::monotonic_ns() - start);
+//
+// Updates are a relaxed atomic add into one of kShards cache lines picked by
+// the CPU the thread runs on, so threads on different CPUs rarely contend.
+// Reading sums up the shards, which is left to the exporter.
+
+// Number of shards per metric. A power of 2.
+static const int kShards = 8;
+// Size and alignment of a shard, the cache line size of x86-64 and most
+// ARM64 CPUs.
+static const int kCacheLine = 64;
+
+namespace metrics_internal {
+
+// The shard for the calling thread: by CPU where the kernel tells, which
+// is a few ns with rseq (glibc 2.35+) or the vDSO, else by thread.
+int thread_shard();
+
+// Memory aligned to kCacheLine, for types that are so aligned: plain
+// operator new only honours that as of C++17. Throws std::bad_alloc.
+void* cache_line_new(size_t size);
+void cache_line_delete(void* ptr);
+
+inline int shard() {
+#ifdef __linux__
+  const int cpu = sched_getcpu();
+  if (cpu >= 0) return cpu & (kShards - 1);
+#endif
+  return thread_shard();
+}
+
+}  // namespace metrics_internal
+
+// A sum of increments, e.g. requests served or bytes read.
+class Counter {
+  public:
+    Counter();
+
+    static void* operator new(size_t size) {
+      return metrics_internal::cache_line_new(size);
+    }
+    static void operator delete(void* ptr) {
+      metrics_internal::cache_line_delete(ptr);
+    }
+
+    inline void Increment(int64_t delta = 1) {
+      shards_[metrics_internal::shard()].value.fetch_add(
+          delta, std::memory_order_relaxed);
+    }
+
+    // The sum of the increments, of which those made at the same time may
+    // or may not be counted.
+    int64_t value() const;
+
+  private:
+    // Not copyable.
+    Counter(const Counter& counter);
+    Counter& operator=(const Counter& counter);
+
+    struct alignas(kCacheLine) Shard {
+      std::atomic<int64_t> value;
+    };
+    static_assert(sizeof(Shard) == kCacheLine, "a shard is a cache line");
+    Shard shards_[kShards];
+};
+
+// The counts of a histogram at one time, as merged from its shards. Can be
+// merged with other snapshots, e.g. of other processes or time periods.
+class HistogramSnapshot {
+  public:
+    HistogramSnapshot();
+
+    uint64_t count() const { return count_; }
+    int64_t sum() const { return sum_; }
+    double mean() const;
+    // The value at the quantile, 0 to 1, as the highest value of its bucket.
+    // 0 if the histogram is empty.
+    int64_t Quantile(double quantile) const;
+    // Lowest and highest value recorded, within the precision of a bucket.
+    int64_t min() const;
+    int64_t max() const;
+
+    // Count per bucket, see Histogram::bucket_lower().
+    const std::vector<uint64_t>& buckets() const { return buckets_; }
+
+    void Merge(const HistogramSnapshot& snapshot);
+    void Clear();
+
+  private:
+    friend class Histogram;
+
+    std::vector<uint64_t> buckets_;
+    uint64_t count_;
+    int64_t sum_;
+};
+
+// The distribution of non-negative integer values, e.g. latencies in ns or
+// sizes in bytes, in log-linear buckets as of HdrHistogram: every value
+// below 2^kSubBucketBits has its own bucket, and each power of 2 above is
+// split in 2^kSubBucketBits buckets, so that a bucket is within 6.25% of
+// its values. Negative values are recorded as 0, and values above kMaxValue
+// (some 18 minutes in ns) as kMaxValue.
+class Histogram {
+  public:
+    static const int kSubBucketBits = 4;
+    static const int kMaxBits = 40;
+    static const int64_t kMaxValue = (INT64_C(1) << kMaxBits) - 1;
+    static const int kBuckets =
+        (kMaxBits - kSubBucketBits + 1) << kSubBucketBits;
+
+    Histogram();
+
+    inline void Record(int64_t value) {
+      if (value < 0) value = 0;
+      if (value > kMaxValue) value = kMaxValue;
+      Shard& shard = shards_[metrics_internal::shard()];
+      shard.buckets[bucket(value)].fetch_add(1, std::memory_order_relaxed);
+      shard.sum.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    // The counts so far, merged from the shards.
+    void Snapshot(HistogramSnapshot* snapshot) const;
+
+    // The bucket of a value in [0, kMaxValue].
+    static inline int bucket(int64_t value) {
+      const uint64_t v = static_cast<uint64_t>(value);
+      if (v < (1u << kSubBucketBits)) return static_cast<int>(v);
+      const int shift = 63 - __builtin_clzll(v) - kSubBucketBits;
+      return ((shift + 1) << kSubBucketBits) +
+             static_cast<int>((v >> shift) & ((1u << kSubBucketBits) - 1));
+    }
+    // The lowest and highest value of a bucket.
+    static int64_t bucket_lower(int bucket);
+    static int64_t bucket_upper(int bucket);
+
+  private:
+    // Not copyable.
+    Histogram(const Histogram& histogram);
+    Histogram& operator=(const Histogram& histogram);
+
+    struct alignas(kCacheLine) Shard {
+      std::atomic<uint64_t> buckets[kBuckets];
+      std::atomic<int64_t> sum;
+
+      static void* operator new[](size_t size) {
+        return metrics_internal::cache_line_new(size);
+      }
+      static void operator delete[](void* ptr) {
+        metrics_internal::cache_line_delete(ptr);
+      }
+    };
+    std::unique_ptr<Shard[]> shards_;
+};
+
+// Metrics by name, which live as long as the registry.
+class Registry {
+  public:
+    Registry();
+    ~Registry();
+
+    // The metric of the name, added on first use. Names are as of
+    // Prometheus: [a-zA-Z_:][a-zA-Z0-9_:]*. Returns NULL if the name is not
+    // valid, or is already used by a metric of the other kind.
+    Counter* GetCounter(const std::string& name);
+    Histogram* GetHistogram(const std::string& name);
+
+    // Append all metrics, ordered by name, in the Prometheus text format.
+    // Counters are a line with the value, and histograms a summary of the
+    // 0.5, 0.9, 0.99 and 0.999 quantiles with the sum and count:
+    //
+    //   # TYPE parse_latency_ns summary
+    //   parse_latency_ns{quantile="0.5"} 1087
+    //   ...
+    //   parse_latency_ns_sum 1843276
+    //   parse_latency_ns_count 1502
+    void ExportText(std::string* out) const;
+
+    // The registry of the process, never deleted.
+    static Registry* Default();
+
+  private:
+    // Not copyable.
+    Registry(const Registry& registry);
+    Registry& operator=(const Registry& registry);
+
+    mutable std::mutex mutex_;
+    std::map<std::string, std::unique_ptr<Counter>> counters_;
+    std::map<std::string, std::unique_ptr<Histogram>> histograms_;
+};
+
+}  // namespace metrics
+}  // namespace sfu
+
+#endif  // SFU_METRICS_METRICS_H_
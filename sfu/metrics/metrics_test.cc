@@ -0,0 +1,184 @@
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sfu/metrics/metrics.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+using namespace sfu::metrics;
+
+TEST(CounterTest, TestIncrement) {
+  Counter counter;
+  EXPECT_EQ(0, counter.value());
+  counter.Increment();
+  counter.Increment(10);
+  counter.Increment(-3);
+  EXPECT_EQ(8, counter.value());
+}
+
+TEST(CounterTest, TestThreads) {
+  Counter counter;
+  vector<thread> threads;
+  for (int t = 0; t < 8; ++t) {
+    threads.push_back(thread([&counter] {
+      for (int i = 0; i < 100000; ++i) counter.Increment();
+    }));
+  }
+  for (thread& t : threads) t.join();
+  EXPECT_EQ(800000, counter.value());
+}
+
+TEST(CounterTest, TestAlignment) {
+  // Each shard is its own cache line, wherever the counter lives.
+  Counter on_stack;
+  unique_ptr<Counter> on_heap(new Counter());
+  Registry registry;
+  const Counter* const counters[] = {
+      &on_stack, on_heap.get(), registry.GetCounter("aligned")};
+  for (const Counter* counter : counters) {
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(counter) % kCacheLine);
+  }
+  EXPECT_EQ(static_cast<size_t>(kShards * kCacheLine), sizeof(Counter));
+}
+
+TEST(HistogramTest, TestBuckets) {
+  for (int64_t v = 0; v < 16; ++v) {
+    EXPECT_EQ(v, Histogram::bucket(v));
+    EXPECT_EQ(v, Histogram::bucket_lower(v));
+    EXPECT_EQ(v, Histogram::bucket_upper(v));
+  }
+  EXPECT_EQ(16, Histogram::bucket(16));
+  EXPECT_EQ(31, Histogram::bucket(31));
+  // 32-33 share a bucket, as do 64-67.
+  EXPECT_EQ(32, Histogram::bucket(32));
+  EXPECT_EQ(32, Histogram::bucket(33));
+  EXPECT_EQ(33, Histogram::bucket(34));
+  EXPECT_EQ(32, Histogram::bucket_lower(32));
+  EXPECT_EQ(33, Histogram::bucket_upper(32));
+  EXPECT_EQ(64, Histogram::bucket_lower(48));
+  EXPECT_EQ(67, Histogram::bucket_upper(48));
+  EXPECT_EQ(Histogram::kBuckets - 1, Histogram::bucket(Histogram::kMaxValue));
+  EXPECT_EQ(Histogram::kMaxValue,
+            Histogram::bucket_upper(Histogram::kBuckets - 1));
+
+  // Buckets are contiguous, and within 1/16 of their values.
+  for (int b = 1; b < Histogram::kBuckets; ++b) {
+    EXPECT_EQ(Histogram::bucket_upper(b - 1) + 1, Histogram::bucket_lower(b));
+    const int64_t lower = Histogram::bucket_lower(b);
+    const int64_t upper = Histogram::bucket_upper(b);
+    EXPECT_EQ(b, Histogram::bucket(lower));
+    EXPECT_EQ(b, Histogram::bucket(upper));
+    EXPECT_LE(upper - lower, lower / 16);
+  }
+}
+
+TEST(HistogramTest, TestSnapshot) {
+  Histogram histogram;
+  HistogramSnapshot snapshot;
+  histogram.Snapshot(&snapshot);
+  EXPECT_EQ(0u, snapshot.count());
+  EXPECT_EQ(0, snapshot.Quantile(0.5));
+  EXPECT_EQ(0, snapshot.min());
+  EXPECT_EQ(0, snapshot.max());
+
+  for (int64_t v = 1; v <= 1000; ++v) histogram.Record(v);
+  histogram.Record(-5);
+  histogram.Record(INT64_C(1) << 50);
+  histogram.Snapshot(&snapshot);
+  EXPECT_EQ(1002u, snapshot.count());
+  EXPECT_EQ(500500 + Histogram::kMaxValue, snapshot.sum());
+  EXPECT_EQ(0, snapshot.min());
+  EXPECT_EQ(Histogram::kMaxValue, snapshot.max());
+
+  // Within the bucket precision.
+  EXPECT_NEAR(500, snapshot.Quantile(0.5), 500 / 16);
+  EXPECT_NEAR(900, snapshot.Quantile(0.9), 900 / 16);
+  EXPECT_NEAR(990, snapshot.Quantile(0.99), 990 / 16);
+  EXPECT_EQ(0, snapshot.Quantile(0));
+  EXPECT_EQ(Histogram::kMaxValue, snapshot.Quantile(1));
+
+  HistogramSnapshot merged;
+  merged.Merge(snapshot);
+  merged.Merge(snapshot);
+  EXPECT_EQ(2004u, merged.count());
+  EXPECT_EQ(2 * snapshot.sum(), merged.sum());
+  EXPECT_EQ(snapshot.Quantile(0.5), merged.Quantile(0.5));
+  merged.Clear();
+  EXPECT_EQ(0u, merged.count());
+}
+
+TEST(HistogramTest, TestThreads) {
+  Histogram histogram;
+  vector<thread> threads;
+  for (int t = 0; t < 8; ++t) {
+    threads.push_back(thread([&histogram, t] {
+      mt19937 rng(t);
+      for (int i = 0; i < 100000; ++i) histogram.Record(rng() % 1000000);
+    }));
+  }
+  for (thread& t : threads) t.join();
+  HistogramSnapshot snapshot;
+  histogram.Snapshot(&snapshot);
+  EXPECT_EQ(800000u, snapshot.count());
+  EXPECT_NEAR(500000, snapshot.Quantile(0.5), 500000 / 16 + 5000);
+}
+
+TEST(RegistryTest, TestGet) {
+  Registry registry;
+  Counter* counter = registry.GetCounter("requests_total");
+  ASSERT_TRUE(counter != NULL);
+  EXPECT_EQ(counter, registry.GetCounter("requests_total"));
+  EXPECT_NE(counter, registry.GetCounter("errors_total"));
+  Histogram* histogram = registry.GetHistogram("latency_ns");
+  ASSERT_TRUE(histogram != NULL);
+  EXPECT_EQ(histogram, registry.GetHistogram("latency_ns"));
+
+  // Used by the other kind.
+  EXPECT_TRUE(registry.GetCounter("latency_ns") == NULL);
+  EXPECT_TRUE(registry.GetHistogram("requests_total") == NULL);
+  // Invalid names.
+  EXPECT_TRUE(registry.GetCounter("") == NULL);
+  EXPECT_TRUE(registry.GetCounter("1st") == NULL);
+  EXPECT_TRUE(registry.GetCounter("with space") == NULL);
+  EXPECT_TRUE(registry.GetHistogram("dash-ed") == NULL);
+  EXPECT_TRUE(registry.GetCounter("ns:name_2") != NULL);
+
+  EXPECT_EQ(Registry::Default(), Registry::Default());
+}
+
+TEST(RegistryTest, TestExportText) {
+  Registry registry;
+  string text;
+  registry.ExportText(&text);
+  EXPECT_EQ("", text);
+
+  registry.GetCounter("b_requests")->Increment(42);
+  registry.GetCounter("z_errors");
+  Histogram* latency = registry.GetHistogram("c_latency_ns");
+  for (int v = 1; v <= 10; ++v) latency->Record(v);
+  registry.GetHistogram("a_empty");
+
+  registry.ExportText(&text);
+  EXPECT_EQ("# TYPE a_empty summary\n"
+            "a_empty{quantile=\"0.5\"} 0\n"
+            "a_empty{quantile=\"0.9\"} 0\n"
+            "a_empty{quantile=\"0.99\"} 0\n"
+            "a_empty{quantile=\"0.999\"} 0\n"
+            "a_empty_sum 0\n"
+            "a_empty_count 0\n"
+            "# TYPE b_requests counter\n"
+            "b_requests 42\n"
+            "# TYPE c_latency_ns summary\n"
+            "c_latency_ns{quantile=\"0.5\"} 5\n"
+            "c_latency_ns{quantile=\"0.9\"} 9\n"
+            "c_latency_ns{quantile=\"0.99\"} 10\n"
+            "c_latency_ns{quantile=\"0.999\"} 10\n"
+            "c_latency_ns_sum 55\n"
+            "c_latency_ns_count 10\n"
+            "# TYPE z_errors counter\n"
+            "z_errors 0\n", text);
+}
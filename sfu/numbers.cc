@@ -1,118 +1,1130 @@
-#include "sfu/strings/cord.h"
+#include "sfu/numbers.h"
 
-#include <algorithm>
-#include <string>
+#include <locale.h>
+#include <stdlib.h>
+
+#include <cctype>
 #include <cmath>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#include "sfu/numbers_data.h"
+#include "sfu/strings/cord.h"
+#include "sfu/strings/keyword.h"
 
 using namespace sfu;
 
 namespace sfu {
 namespace {
 
+// Digit value of each char for bases up to 36, -1 if not a digit.
+const char kDigitValue[256] = {
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  // 0 .. 15
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  //   .. 31
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  //   .. 47
+   0,  1,  2,  3,  4,  5,  6,  7,  8,  9, -1, -1, -1, -1, -1, -1,  //   .. 63
+  -1, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,  //   .. 79
+  25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, -1, -1, -1, -1, -1,  //   .. 95
+  -1, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,  //  .. 111
+  25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, -1, -1, -1, -1, -1,  //  .. 127
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  //  .. 143
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  //  .. 159
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  //  .. 175
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  //  .. 191
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  //  .. 207
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  //  .. 223
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  //  .. 239
+  -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  //  .. 255
+};
+
+// Any 19 digit decimal number fits in an uint64_t.
+const int kMaxSafeDecimalDigits = 19;
+
+// Gives 255 for non-digits, so it is never less than the base.
+inline unsigned DigitValue(char c) {
+  return static_cast<uint8_t>(kDigitValue[static_cast<uint8_t>(c)]);
+}
+
+// Load 8 chars so that the first char is in the lowest byte.
+inline uint64_t LoadEightChars(const char* p) {
+  uint64_t val;
+  memcpy(&val, p, sizeof(val));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  val = __builtin_bswap64(val);
+#endif
+  return val;
+}
+
+// If all 8 chars are in '0' .. '9'.
+inline bool IsEightDigits(uint64_t val) {
+  return (((val & 0xf0f0f0f0f0f0f0f0) |
+           (((val + 0x0606060606060606) & 0xf0f0f0f0f0f0f0f0) >> 4)) ==
+          0x3333333333333333);
+}
+
+// Combine 8 digits in 3 multiplications instead of 8.
+inline uint32_t ParseEightDigits(uint64_t val) {
+  const uint64_t mask = 0x000000ff000000ff;
+  const uint64_t mul1 = 0x000f424000000064;  // 100 + (1000000 << 32)
+  const uint64_t mul2 = 0x0000271000000001;  // 1 + (10000 << 32)
+  val -= 0x3030303030303030;
+  val = (val * 10) + (val >> 8);
+  val = (((val & mask) * mul1) + (((val >> 16) & mask) * mul2)) >> 32;
+  return static_cast<uint32_t>(val);
+}
+
+// Each ParseMagnitude* parses the digits at p, and returns the first char
+// after the digits. Overflow is flagged, but the digits are still consumed.
+
+const char* ParseMagnitudeDecimal(const char* p, const char* last,
+                                  uint64_t* value, bool* overflow) {
+  // Leading zeros does not count towards overflow.
+  while (p < last && *p == '0') ++p;
+  const char* digits = p;
+  uint64_t val = 0;
+
+  while (last - p >= 8 && (p - digits) + 8 <= kMaxSafeDecimalDigits) {
+    uint64_t chunk = LoadEightChars(p);
+    if (!IsEightDigits(chunk)) break;
+    val = val * 100000000 + ParseEightDigits(chunk);
+    p += 8;
+  }
+  for (; p < last; ++p) {
+    unsigned d = static_cast<unsigned>(*p) - '0';
+    if (d > 9) break;
+    if (p - digits < kMaxSafeDecimalDigits) {
+      val = val * 10 + d;
+    } else if (p - digits == kMaxSafeDecimalDigits &&
+               val <= (UINT64_MAX - d) / 10) {
+      val = val * 10 + d;
+    } else {
+      *overflow = true;
+    }
+  }
+  *value = val;
+  return p;
+}
+
+const char* ParseMagnitudePow2(const char* p, const char* last, int shift,
+                               uint64_t* value, bool* overflow) {
+  const unsigned base = 1u << shift;
+  uint64_t val = 0;
+  for (; p < last; ++p) {
+    unsigned d = DigitValue(*p);
+    if (d >= base) break;
+    if ((val >> (64 - shift)) != 0) *overflow = true;
+    val = (val << shift) | d;
+  }
+  *value = val;
+  return p;
+}
+
+const char* ParseMagnitudeGeneric(const char* p, const char* last,
+                                  unsigned base,
+                                  uint64_t* value, bool* overflow) {
+  uint64_t val = 0;
+  for (; p < last; ++p) {
+    unsigned d = DigitValue(*p);
+    if (d >= base) break;
+    if (val > (UINT64_MAX - d) / base) *overflow = true;
+    val = val * base + d;
+  }
+  *value = val;
+  return p;
+}
+
+inline const char* ParseMagnitude(const char* p, const char* last, int base,
+                                  uint64_t* value, bool* overflow) {
+  switch (base) {
+    case 10: return ParseMagnitudeDecimal(p, last, value, overflow);
+    case 16: return ParseMagnitudePow2(p, last, 4, value, overflow);
+    case 8:  return ParseMagnitudePow2(p, last, 3, value, overflow);
+    case 2:  return ParseMagnitudePow2(p, last, 1, value, overflow);
+    default: return ParseMagnitudeGeneric(p, last, base, value, overflow);
+  }
+}
+
 template<typename T>
-inline bool safe_parse_int(const strings::cord& str, T* num, int base) {
+inline from_chars_result parse_int(const char* first, const char* last,
+                                   T* num, int base) {
+  from_chars_result res = {first, PARSE_INVALID};
+  if (base < 2 || base > 36 || first >= last) return res;
+
+  const char* p = first;
   bool neg = false;
-  if (base < 2 || base > 36) {
-    return false;
-  }
-  if (str.length() == 0) return false;
-  if (str[0] == '-') neg = true;
-  if (neg && str.length() == 1) return false;
-  T val = 0;
-  for (size_t i = (neg ? 1 : 0); i < str.length(); ++i) {
-    char c = str[i];
-    int tmp = 0;
-    if (c >= '0' && c <= '9') {
-      tmp = c - '0';
-    } else if (c >= 'a' && c <= 'z') {
-      tmp = c + 10 - 'a';
-    } else if (c >= 'A' && c <= 'Z') {
-      tmp = c + 10 - 'A';
+  if (std::numeric_limits<T>::is_signed && *p == '-') {
+    neg = true;
+    ++p;
+  }
+
+  uint64_t val = 0;
+  bool overflow = false;
+  const char* end = ParseMagnitude(p, last, base, &val, &overflow);
+  if (end == p) return res;
+
+  res.ptr = end;
+  uint64_t limit = static_cast<uint64_t>(std::numeric_limits<T>::max());
+  if (neg) ++limit;
+  if (overflow || val > limit) {
+    res.error = PARSE_OVERFLOW;
+    return res;
+  }
+
+  // Avoid negating the unsigned value, as -val overflows on the minimum.
+  if (neg) {
+    *num = val == 0 ? 0 : static_cast<T>(-static_cast<int64_t>(val - 1) - 1);
+  } else {
+    *num = static_cast<T>(val);
+  }
+  res.error = PARSE_OK;
+  return res;
+}
+
+template<typename T>
+inline bool safe_parse_int(const strings::cord& str, T* num, int base) {
+  T tmp;
+  from_chars_result res = parse_int(str.begin(), str.end(), &tmp, base);
+  if (res.error != PARSE_OK || res.ptr != str.end()) return false;
+  *num = tmp;
+  return true;
+}
+
+// ---------------------------------------------------------------------------
+// Floating point parsing. Decimal numbers are converted with the Clinger fast
+// path when exact, and otherwise with the Eisel-Lemire algorithm using 128 bit
+// approximations of 5^q. The rare cases that can not be decided that way
+// (more than 19 significant digits that straddle a rounding boundary, and
+// some hex floats) fall back to the C library in the "C" locale.
+
+// IEEE binary format parameters.
+template<typename T> struct FloatFormat;
+
+template<> struct FloatFormat<double> {
+  typedef uint64_t bits_type;
+  static const int kMantissaBits = 52;
+  static const int kMinExponent = -1023;
+  static const int kInfinitePower = 0x7ff;
+  static const int kSmallestPowerOfTen = -342;
+  static const int kLargestPowerOfTen = 308;
+  static const int kMinExponentRoundToEven = -4;
+  static const int kMaxExponentRoundToEven = 23;
+  static const int kMaxExponentFastPath = 22;
+
+  static double ExactPowerOfTen(int e) {
+    static const double kPowers[] = {
+      1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+    };
+    return kPowers[e];
+  }
+  static double SlowParse(const char* str, locale_t loc) {
+    return strtod_l(str, NULL, loc);
+  }
+};
+
+template<> struct FloatFormat<float> {
+  typedef uint32_t bits_type;
+  static const int kMantissaBits = 23;
+  static const int kMinExponent = -127;
+  static const int kInfinitePower = 0xff;
+  static const int kSmallestPowerOfTen = -65;
+  static const int kLargestPowerOfTen = 38;
+  static const int kMinExponentRoundToEven = -17;
+  static const int kMaxExponentRoundToEven = 10;
+  static const int kMaxExponentFastPath = 10;
+
+  static float ExactPowerOfTen(int e) {
+    static const float kPowers[] = {
+      1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f,
+    };
+    return kPowers[e];
+  }
+  static float SlowParse(const char* str, locale_t loc) {
+    return strtof_l(str, NULL, loc);
+  }
+};
+
+// The C library parsers are correctly rounded, but depend on the locale.
+locale_t CLocale() {
+  static locale_t loc = newlocale(LC_ALL_MASK, "C", static_cast<locale_t>(0));
+  return loc;
+}
+
+template<typename T>
+T SlowParseFloat(const char* first, const char* last) {
+  std::string tmp(first, last);
+  return FloatFormat<T>::SlowParse(tmp.c_str(), CLocale());
+}
+
+template<>
+long double SlowParseFloat<long double>(const char* first, const char* last) {
+  std::string tmp(first, last);
+  return strtold_l(tmp.c_str(), NULL, CLocale());
+}
+
+inline void FullMultiplication(uint64_t a, uint64_t b,
+                               uint64_t* high, uint64_t* low) {
+#if defined(__SIZEOF_INT128__)
+  unsigned __int128 r = static_cast<unsigned __int128>(a) * b;
+  *high = static_cast<uint64_t>(r >> 64);
+  *low = static_cast<uint64_t>(r);
+#else
+  uint64_t a_lo = a & 0xffffffff, a_hi = a >> 32;
+  uint64_t b_lo = b & 0xffffffff, b_hi = b >> 32;
+  uint64_t lo_lo = a_lo * b_lo;
+  uint64_t hi_lo = a_hi * b_lo;
+  uint64_t lo_hi = a_lo * b_hi;
+  uint64_t hi_hi = a_hi * b_hi;
+  uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xffffffff) + lo_hi;
+  *high = (hi_lo >> 32) + (cross >> 32) + hi_hi;
+  *low = (cross << 32) | (lo_lo & 0xffffffff);
+#endif
+}
+
+inline int LeadingZeros(uint64_t val) {
+  return __builtin_clzll(val);
+}
+
+// floor(log2(10^q)) - 63, for q in the supported power of ten range.
+inline int32_t Power2OfPower10(int32_t q) {
+  return (((152170 + 65536) * q) >> 16) + 63;
+}
+
+// Binary mantissa (without the implicit bit) and biased exponent.
+struct AdjustedMantissa {
+  uint64_t mantissa;
+  int32_t power2;
+
+  bool operator==(const AdjustedMantissa& o) const {
+    return mantissa == o.mantissa && power2 == o.power2;
+  }
+};
+
+// Eisel-Lemire: compute the binary float closest to w * 10^q.
+template<typename T>
+AdjustedMantissa ComputeFloat(int64_t q, uint64_t w) {
+  typedef FloatFormat<T> F;
+  AdjustedMantissa answer = {0, 0};
+  if (w == 0 || q < F::kSmallestPowerOfTen) {
+    return answer;
+  }
+  if (q > F::kLargestPowerOfTen) {
+    answer.power2 = F::kInfinitePower;
+    return answer;
+  }
+
+  int lz = LeadingZeros(w);
+  w <<= lz;
+
+  // Multiply with the 128 bit approximation of 5^q. Only if the bits that
+  // decide the rounding are all ones do we need the second half.
+  const int bit_precision = F::kMantissaBits + 3;
+  const uint64_t precision_mask = UINT64_MAX >> bit_precision;
+  const int index =
+      2 * static_cast<int>(q - numbers_internal::kSmallestPowerOfFive);
+  uint64_t high, low;
+  FullMultiplication(w, numbers_internal::kPowerOfFive128[index], &high, &low);
+  if ((high & precision_mask) == precision_mask) {
+    uint64_t high2, low2;
+    FullMultiplication(w, numbers_internal::kPowerOfFive128[index + 1],
+                       &high2, &low2);
+    low += high2;
+    if (high2 > low) ++high;
+  }
+
+  int upperbit = static_cast<int>(high >> 63);
+  int shift = upperbit + 64 - F::kMantissaBits - 3;
+  answer.mantissa = high >> shift;
+  answer.power2 = Power2OfPower10(static_cast<int32_t>(q)) + upperbit - lz -
+                  F::kMinExponent;
+
+  if (answer.power2 <= 0) {
+    // Subnormal.
+    if (-answer.power2 + 1 >= 64) {
+      answer.mantissa = 0;
+      answer.power2 = 0;
+      return answer;
+    }
+    answer.mantissa >>= -answer.power2 + 1;
+    answer.mantissa += (answer.mantissa & 1);
+    answer.mantissa >>= 1;
+    answer.power2 =
+        answer.mantissa < (uint64_t(1) << F::kMantissaBits) ? 0 : 1;
+    return answer;
+  }
+
+  // Exactly half way between two floats: round to even.
+  if (low <= 1 && q >= F::kMinExponentRoundToEven &&
+      q <= F::kMaxExponentRoundToEven && (answer.mantissa & 3) == 1 &&
+      (answer.mantissa << shift) == high) {
+    answer.mantissa &= ~uint64_t(1);
+  }
+
+  answer.mantissa += (answer.mantissa & 1);
+  answer.mantissa >>= 1;
+  if (answer.mantissa >= (uint64_t(2) << F::kMantissaBits)) {
+    answer.mantissa = uint64_t(1) << F::kMantissaBits;
+    ++answer.power2;
+  }
+  answer.mantissa &= ~(uint64_t(1) << F::kMantissaBits);
+  if (answer.power2 >= F::kInfinitePower) {
+    answer.power2 = F::kInfinitePower;
+    answer.mantissa = 0;
+  }
+  return answer;
+}
+
+template<typename T>
+inline T ToFloat(const AdjustedMantissa& am, bool neg) {
+  typedef typename FloatFormat<T>::bits_type bits_type;
+  bits_type bits = static_cast<bits_type>(am.mantissa) |
+      (static_cast<bits_type>(am.power2) << FloatFormat<T>::kMantissaBits);
+  if (neg) bits |= bits_type(1) << (sizeof(bits_type) * 8 - 1);
+  T value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+// The decimal digits of a number, as at most 19 significant digits and a
+// power of 10.
+struct DecimalNumber {
+  uint64_t mantissa;
+  int64_t exponent;
+  bool too_many_digits;
+};
+
+// Accumulate digits at p into *val, 8 at a time when possible. The value
+// wraps if there are more than 19 digits.
+inline const char* ConsumeDigits(const char* p, const char* last,
+                                 uint64_t* val) {
+  uint64_t v = *val;
+  while (last - p >= 8) {
+    uint64_t chunk = LoadEightChars(p);
+    if (!IsEightDigits(chunk)) break;
+    v = v * 100000000 + ParseEightDigits(chunk);
+    p += 8;
+  }
+  for (; p < last; ++p) {
+    unsigned d = static_cast<unsigned>(*p) - '0';
+    if (d > 9) break;
+    v = v * 10 + d;
+  }
+  *val = v;
+  return p;
+}
+
+inline bool IsDigit(char c) {
+  return c >= '0' && c <= '9';
+}
+
+// Parse "digits[.digits][(e|E)[+-]digits]", or with no integer digits
+// ".digits". Returns the end of the number, or p if there is no number.
+const char* ParseDecimal(const char* p, const char* last, DecimalNumber* out) {
+  const uint64_t kMinNineteenDigits = 1000000000000000000ULL;
+
+  uint64_t mantissa = 0;
+  const char* int_begin = p;
+  p = ConsumeDigits(p, last, &mantissa);
+  const char* int_end = p;
+  int64_t digit_count = int_end - int_begin;
+  int64_t exponent = 0;
+
+  const char* frac_begin = p;
+  const char* frac_end = p;
+  if (p < last && *p == '.') {
+    frac_begin = ++p;
+    p = ConsumeDigits(p, last, &mantissa);
+    frac_end = p;
+    exponent = frac_begin - frac_end;
+    digit_count += frac_end - frac_begin;
+  }
+  if (digit_count == 0) return int_begin;
+
+  int64_t exp_number = 0;
+  if (p < last && (*p == 'e' || *p == 'E')) {
+    const char* e = p + 1;
+    bool exp_neg = false;
+    if (e < last && (*e == '-' || *e == '+')) {
+      exp_neg = *e == '-';
+      ++e;
+    }
+    // Without digits the 'e' is not part of the number.
+    if (e < last && IsDigit(*e)) {
+      for (; e < last && IsDigit(*e); ++e) {
+        // Anything beyond this is 0 or infinite anyway.
+        if (exp_number < 0x10000000) {
+          exp_number = exp_number * 10 + (*e - '0');
+        }
+      }
+      if (exp_neg) exp_number = -exp_number;
+      exponent += exp_number;
+      p = e;
+    }
+  }
+
+  out->too_many_digits = false;
+  if (digit_count > 19) {
+    // Leading zeros are not significant.
+    for (const char* s = int_begin; s < frac_end && (*s == '0' || *s == '.');
+         ++s) {
+      if (*s == '0') --digit_count;
+    }
+    if (digit_count > 19) {
+      out->too_many_digits = true;
+      mantissa = 0;
+      const char* s = int_begin;
+      for (; mantissa < kMinNineteenDigits && s < int_end; ++s) {
+        mantissa = mantissa * 10 + (*s - '0');
+      }
+      if (mantissa >= kMinNineteenDigits) {
+        exponent = (int_end - s) + exp_number;
+      } else {
+        s = frac_begin;
+        for (; mantissa < kMinNineteenDigits && s < frac_end; ++s) {
+          mantissa = mantissa * 10 + (*s - '0');
+        }
+        exponent = (frac_begin - s) + exp_number;
+      }
+    }
+  }
+
+  out->mantissa = mantissa;
+  out->exponent = exponent;
+  return p;
+}
+
+inline bool IsHexDigit(char c) {
+  return DigitValue(c) < 16;
+}
+
+// Parse "0x" hex digits [. hex digits] [(p|P)[+-]digits]. Returns the end of
+// the number, or p if it is not a hex float.
+const char* ParseHex(const char* p, const char* last,
+                     uint64_t* mantissa, int64_t* exponent, bool* inexact) {
+  const char* start = p;
+  if (last - p < 3 || p[0] != '0' || (p[1] != 'x' && p[1] != 'X')) {
+    return start;
+  }
+  p += 2;
+  uint64_t m = 0;
+  int64_t e = 0;
+  bool sticky = false;
+  bool any = false;
+  for (; p < last && IsHexDigit(*p); ++p, any = true) {
+    if (m >> 60) {
+      sticky |= *p != '0';
+      e += 4;
     } else {
-      return false;
+      m = (m << 4) | DigitValue(*p);
     }
-    if (tmp >= base) return false;
+  }
+  if (p < last && *p == '.') {
+    const char* dot = p++;
+    for (; p < last && IsHexDigit(*p); ++p, any = true) {
+      if (m >> 60) {
+        sticky |= *p != '0';
+      } else {
+        m = (m << 4) | DigitValue(*p);
+        e -= 4;
+      }
+    }
+    if (!any) p = dot;
+  }
+  if (!any) return start;
 
-    val *= base;
-    val += tmp;
+  if (p < last && (*p == 'p' || *p == 'P')) {
+    const char* x = p + 1;
+    bool exp_neg = false;
+    if (x < last && (*x == '-' || *x == '+')) {
+      exp_neg = *x == '-';
+      ++x;
+    }
+    if (x < last && IsDigit(*x)) {
+      int64_t exp_number = 0;
+      for (; x < last && IsDigit(*x); ++x) {
+        if (exp_number < 0x10000000) {
+          exp_number = exp_number * 10 + (*x - '0');
+        }
+      }
+      e += exp_neg ? -exp_number : exp_number;
+      p = x;
+    }
   }
+  *mantissa = m;
+  *exponent = e;
+  *inexact = sticky;
+  return p;
+}
 
-  (*num) = neg ? -val : val;
+// Case insensitive match of an ASCII lower case word.
+inline bool MatchWord(const char* p, const char* last, const char* word) {
+  for (; *word; ++p, ++word) {
+    if (p >= last || (*p | 0x20) != *word) return false;
+  }
   return true;
 }
 
+// Parse "inf", "infinity", "nan" and "nan(chars)". Returns the end, or p if
+// none match.
+template<typename T>
+const char* ParseInfNan(const char* p, const char* last, bool neg, T* value) {
+  if (MatchWord(p, last, "nan")) {
+    *value = neg ? -std::numeric_limits<T>::quiet_NaN()
+                 : std::numeric_limits<T>::quiet_NaN();
+    const char* end = p + 3;
+    if (end < last && *end == '(') {
+      for (const char* q = end + 1; q < last; ++q) {
+        if (*q == ')') return q + 1;
+        if (!isalnum(static_cast<unsigned char>(*q)) && *q != '_') break;
+      }
+    }
+    return end;
+  }
+  if (MatchWord(p, last, "inf")) {
+    *value = neg ? -std::numeric_limits<T>::infinity()
+                 : std::numeric_limits<T>::infinity();
+    return MatchWord(p, last, "infinity") ? p + 8 : p + 3;
+  }
+  return p;
+}
+
 template<typename T>
-inline bool safe_parse_uint(const strings::cord& str, T* num, int base) {
-  if (base < 2 || base > 36) {
-    return false;
-  }
-  if (str.length() == 0) return false;
-  T val = 0;
-  for (size_t i = 0; i < str.length(); ++i) {
-    char c = str[i];
-    int tmp = 0;
-    if (c >= '0' && c <= '9') {
-      tmp = c - '0';
-    } else if (c >= 'a' && c <= 'z') {
-      tmp = c + 10 - 'a';
-    } else if (c >= 'A' && c <= 'Z') {
-      tmp = c + 10 - 'A';
+T DecimalToFloat(const DecimalNumber& num, bool neg,
+                 const char* first, const char* last) {
+  typedef FloatFormat<T> F;
+  // Clinger: both the mantissa and the power of ten are exact, so a single
+  // multiplication or division is correctly rounded.
+  if (!num.too_many_digits &&
+      num.exponent >= -F::kMaxExponentFastPath &&
+      num.exponent <= F::kMaxExponentFastPath &&
+      num.mantissa <= (uint64_t(2) << F::kMantissaBits)) {
+    T value = static_cast<T>(num.mantissa);
+    if (num.exponent < 0) {
+      value = value / F::ExactPowerOfTen(-num.exponent);
     } else {
-      return false;
+      value = value * F::ExactPowerOfTen(num.exponent);
     }
-    if (tmp >= base) return false;
+    return neg ? -value : value;
+  }
 
-    val *= base;
-    val += tmp;
+  AdjustedMantissa am = ComputeFloat<T>(num.exponent, num.mantissa);
+  if (num.too_many_digits &&
+      !(am == ComputeFloat<T>(num.exponent, num.mantissa + 1))) {
+    // The truncated digits decide the rounding.
+    return SlowParseFloat<T>(first, last);
   }
+  return ToFloat<T>(am, neg);
+}
 
-  (*num) = val;
-  return true;
+template<typename T>
+T HexToFloat(uint64_t mantissa, int64_t exponent, bool inexact, bool neg,
+             const char* first, const char* last) {
+  // A mantissa that fits the float is exact, so ldexp is the only rounding.
+  if (!inexact &&
+      mantissa <= (uint64_t(1) << (FloatFormat<T>::kMantissaBits + 1)) &&
+      exponent > -100000 && exponent < 100000) {
+    T value = std::ldexp(static_cast<T>(mantissa), static_cast<int>(exponent));
+    return neg ? -value : value;
+  }
+  return SlowParseFloat<T>(first, last);
 }
 
 template<typename T>
-inline bool safe_parse_float(const strings::cord& str, T* dbl) {
-  strings::cord strp(str);
-  if (str.length() == 0) return false;
-  bool neg = false;
-  if (str[0] == '-') {
-    strp.reset(str.ptr() + 1, str.length() - 1);
-    neg = true;
+inline from_chars_result parse_float(const char* first, const char* last,
+                                     T* value) {
+  from_chars_result res = {first, PARSE_INVALID};
+  if (first >= last) return res;
+
+  const char* p = first;
+  bool neg = *p == '-';
+  if (neg) ++p;
+
+  T tmp;
+  const char* end = ParseInfNan(p, last, neg, &tmp);
+  if (end != p) {
+    res.ptr = end;
+    res.error = PARSE_OK;
+    *value = tmp;
+    return res;
   }
-  size_t pt = strp.find('.');
 
-  T result = 0;
-  if (pt != strings::cord::npos) {
-    strings::cord decimal(strp.ptr(), pt);
-    strings::cord fraction(strp.ptr() + pt + 1, strp.length() - pt - 1);
+  uint64_t hex_mantissa;
+  int64_t hex_exponent;
+  bool inexact;
+  end = ParseHex(p, last, &hex_mantissa, &hex_exponent, &inexact);
+  if (end != p) {
+    tmp = HexToFloat<T>(hex_mantissa, hex_exponent, inexact, neg, first, end);
+  } else {
+    DecimalNumber num;
+    end = ParseDecimal(p, last, &num);
+    if (end == p) return res;
+    tmp = DecimalToFloat<T>(num, neg, first, end);
+  }
+
+  res.ptr = end;
+  if (std::isinf(tmp)) {
+    res.error = PARSE_OVERFLOW;
+    return res;
+  }
+  res.error = PARSE_OK;
+  *value = tmp;
+  return res;
+}
 
-    uint64_t dec = 0;
-    uint64_t f = 0;
-    if (decimal.length() > 0 && !safe_parse_uint(decimal, &dec, 10)) return false;
-    if (fraction.length() > 0 && !safe_parse_uint(fraction, &f, 10)) return false;
+// There is no fast conversion for the 80 or 128 bit long double formats, so
+// the syntax is checked as for double, and the value left to the C library.
+template<>
+inline from_chars_result parse_float<long double>(const char* first,
+                                                  const char* last,
+                                                  long double* value) {
+  double syntax = 0;
+  from_chars_result res = parse_float(first, last, &syntax);
+  if (res.error == PARSE_INVALID) return res;
 
-    result = (static_cast<T>(dec) + (static_cast<T>(f) / std::pow(10, fraction.length())));
+  const char* p = first + (*first == '-' ? 1 : 0);
+  long double tmp;
+  if (ParseInfNan(p, res.ptr, false, &tmp) == p) {
+    tmp = SlowParseFloat<long double>(first, res.ptr);
+    if (std::isinf(tmp)) {
+      res.error = PARSE_OVERFLOW;
+      return res;
+    }
+  } else {
+    tmp = syntax;
   }
-  (*dbl) = neg ? -result : result;
+  res.error = PARSE_OK;
+  *value = tmp;
+  return res;
+}
+
+template<typename T>
+inline bool safe_parse_float(const strings::cord& str, T* dbl) {
+  T tmp;
+  from_chars_result res = parse_float(str.begin(), str.end(), &tmp);
+  if (res.error != PARSE_OK || res.ptr != str.end()) return false;
+  *dbl = tmp;
   return true;
 }
 
+// ---------------------------------------------------------------------------
+// Number formatting. Integers are written two digits at a time from a table,
+// and floating point numbers use Ryu to find the shortest digits that parse
+// back to the same value.
+
+const char kDigitPairs[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+inline int CountDigits(uint64_t v) {
+  int n = 1;
+  for (;;) {
+    if (v < 10) return n;
+    if (v < 100) return n + 1;
+    if (v < 1000) return n + 2;
+    if (v < 10000) return n + 3;
+    v /= 10000;
+    n += 4;
+  }
+}
+
+// Write the digits of v backwards, ending just before end.
+inline void WriteDigits(char* end, uint64_t v) {
+  while (v >= 100) {
+    const uint64_t pair = v % 100;
+    v /= 100;
+    end -= 2;
+    memcpy(end, kDigitPairs + 2 * pair, 2);
+  }
+  if (v >= 10) {
+    memcpy(end - 2, kDigitPairs + 2 * v, 2);
+  } else {
+    end[-1] = static_cast<char>('0' + v);
+  }
+}
+
+inline char* write_uint(char* first, char* last, uint64_t v) {
+  const int n = CountDigits(v);
+  if (last - first < n) return NULL;
+  WriteDigits(first + n, v);
+  return first + n;
+}
+
+inline char* write_int(char* first, char* last, int64_t v) {
+  if (v < 0) {
+    if (first >= last) return NULL;
+    *first = '-';
+    return write_uint(first + 1, last, 0 - static_cast<uint64_t>(v));
+  }
+  return write_uint(first, last, static_cast<uint64_t>(v));
+}
+
+// ceil(log2(5^e)), or 1 for e == 0.
+inline int32_t Pow5Bits(int32_t e) {
+  return static_cast<int32_t>((static_cast<uint32_t>(e) * 1217359) >> 19) + 1;
+}
+
+// floor(log10(2^e))
+inline uint32_t Log10Pow2(int32_t e) {
+  return (static_cast<uint32_t>(e) * 78913) >> 18;
+}
+
+// floor(log10(5^e))
+inline uint32_t Log10Pow5(int32_t e) {
+  return (static_cast<uint32_t>(e) * 732923) >> 20;
+}
+
+inline bool MultipleOfPowerOf5(uint64_t v, uint32_t p) {
+  uint32_t count = 0;
+  while (v % 5 == 0) {
+    v /= 5;
+    ++count;
+  }
+  return count >= p;
+}
+
+inline bool MultipleOfPowerOf2(uint64_t v, uint32_t p) {
+  return (v & ((uint64_t(1) << p) - 1)) == 0;
+}
+
+// (m * mul) >> j, where mul is a 128 bit (high, low) pair and j >= 64.
+inline uint64_t MulShift64(uint64_t m, const uint64_t* mul, int32_t j) {
+  uint64_t high1, low1, high0, low0;
+  FullMultiplication(m, mul[0], &high1, &low1);
+  FullMultiplication(m, mul[1], &high0, &low0);
+  uint64_t sum = high0 + low1;
+  if (sum < high0) ++high1;
+  const int32_t shift = j - 64;
+  if (shift == 0) return sum;
+  if (shift >= 64) return high1 >> (shift - 64);
+  return (high1 << (64 - shift)) | (sum >> shift);
+}
+
+// Digits and power of 10 of a floating point number.
+struct DecimalDigits {
+  uint64_t mantissa;
+  int32_t exponent;
+};
+
+// Ryu: the shortest decimal in the interval of values that round to the
+// number, and the closest one to the exact value if there are several.
+template<typename T>
+DecimalDigits ShortestDecimal(uint64_t ieee_mantissa,
+                              uint32_t ieee_exponent) {
+  typedef FloatFormat<T> F;
+  const int32_t bias = -F::kMinExponent;
+
+  int32_t e2;
+  uint64_t m2;
+  if (ieee_exponent == 0) {
+    e2 = 1 - bias - F::kMantissaBits - 2;
+    m2 = ieee_mantissa;
+  } else {
+    e2 = static_cast<int32_t>(ieee_exponent) - bias - F::kMantissaBits - 2;
+    m2 = (uint64_t(1) << F::kMantissaBits) | ieee_mantissa;
+  }
+  const bool accept_bounds = (m2 & 1) == 0;
+
+  // The interval is [mm, mp] around mv, all times 4 to keep them integers.
+  // The lower bound is closer on powers of 2.
+  const uint64_t mv = 4 * m2;
+  const uint32_t mm_shift = ieee_mantissa != 0 || ieee_exponent <= 1;
+  const uint64_t mp = mv + 2;
+  const uint64_t mm = mv - 1 - mm_shift;
+
+  uint64_t vr, vp, vm;
+  int32_t e10;
+  bool vm_trailing_zeros = false;
+  bool vr_trailing_zeros = false;
+  if (e2 >= 0) {
+    const uint32_t q = Log10Pow2(e2) - (e2 > 3);
+    e10 = static_cast<int32_t>(q);
+    const int32_t k = numbers_internal::kPow5BitCount +
+                      Pow5Bits(static_cast<int32_t>(q)) - 1;
+    const int32_t i = -e2 + static_cast<int32_t>(q) + k;
+    const uint64_t* mul = numbers_internal::kPow5InvSplit + 2 * q;
+    vr = MulShift64(mv, mul, i);
+    vp = MulShift64(mp, mul, i);
+    vm = MulShift64(mm, mul, i);
+    if (q <= 21) {
+      // Only one of mp, mv and mm can be a multiple of 5, if any.
+      if (mv % 5 == 0) {
+        vr_trailing_zeros = MultipleOfPowerOf5(mv, q);
+      } else if (accept_bounds) {
+        vm_trailing_zeros = MultipleOfPowerOf5(mm, q);
+      } else {
+        vp -= MultipleOfPowerOf5(mp, q);
+      }
+    }
+  } else {
+    const uint32_t q = Log10Pow5(-e2) - (-e2 > 1);
+    e10 = static_cast<int32_t>(q) + e2;
+    const int32_t i = -e2 - static_cast<int32_t>(q);
+    const int32_t k = Pow5Bits(i) - numbers_internal::kPow5BitCount;
+    const int32_t j = static_cast<int32_t>(q) - k;
+    const uint64_t* mul = numbers_internal::kPow5Split + 2 * i;
+    vr = MulShift64(mv, mul, j);
+    vp = MulShift64(mp, mul, j);
+    vm = MulShift64(mm, mul, j);
+    if (q <= 1) {
+      // mv has at least q trailing 0 bits, and so does mp or mm.
+      vr_trailing_zeros = true;
+      if (accept_bounds) {
+        vm_trailing_zeros = mm_shift == 1;
+      } else {
+        --vp;
+      }
+    } else if (q < 63) {
+      vr_trailing_zeros = MultipleOfPowerOf2(mv, q);
+    }
+  }
+
+  // Remove digits while the interval still holds a number.
+  int32_t removed = 0;
+  uint32_t last_removed = 0;
+  uint64_t output;
+  if (vm_trailing_zeros || vr_trailing_zeros) {
+    // Exact bounds or ties, rare.
+    while (vp / 10 > vm / 10) {
+      vm_trailing_zeros &= vm % 10 == 0;
+      vr_trailing_zeros &= last_removed == 0;
+      last_removed = static_cast<uint32_t>(vr % 10);
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      ++removed;
+    }
+    if (vm_trailing_zeros) {
+      while (vm % 10 == 0) {
+        vr_trailing_zeros &= last_removed == 0;
+        last_removed = static_cast<uint32_t>(vr % 10);
+        vr /= 10;
+        vp /= 10;
+        vm /= 10;
+        ++removed;
+      }
+    }
+    if (vr_trailing_zeros && last_removed == 5 && vr % 2 == 0) {
+      // Exactly half way, round to even.
+      last_removed = 4;
+    }
+    output = vr + ((vr == vm && (!accept_bounds || !vm_trailing_zeros)) ||
+                   last_removed >= 5);
+  } else {
+    bool round_up = false;
+    if (vp / 100 > vm / 100) {
+      round_up = vr % 100 >= 50;
+      vr /= 100;
+      vp /= 100;
+      vm /= 100;
+      removed += 2;
+    }
+    while (vp / 10 > vm / 10) {
+      round_up = vr % 10 >= 5;
+      vr /= 10;
+      vp /= 10;
+      vm /= 10;
+      ++removed;
+    }
+    output = vr + (vr == vm || round_up);
+  }
+
+  DecimalDigits result = {output, e10 + removed};
+  return result;
+}
+
+// Write mantissa * 10^exponent in fixed or scientific notation, whichever is
+// shorter, as std::to_chars does.
+inline char* WriteDecimal(char* p, char* last, const DecimalDigits& d) {
+  const int32_t n = CountDigits(d.mantissa);
+  const int32_t e = d.exponent;
+  const int32_t sci_exponent = e + n - 1;
+  const int32_t abs_sci = sci_exponent < 0 ? -sci_exponent : sci_exponent;
+  const int32_t sci_length = n + (n > 1 ? 1 : 0) + 2 + (abs_sci >= 100 ? 3 : 2);
+  int32_t fixed_length;
+  if (e >= 0) {
+    fixed_length = n + e;
+  } else if (-e < n) {
+    fixed_length = n + 1;
+  } else {
+    fixed_length = 2 - e;
+  }
+
+  if (fixed_length <= sci_length) {
+    if (last - p < fixed_length) return NULL;
+    if (e >= 0) {
+      WriteDigits(p + n, d.mantissa);
+      memset(p + n, '0', e);
+    } else if (-e < n) {
+      const int32_t int_digits = n + e;
+      WriteDigits(p + n + 1, d.mantissa);
+      memmove(p, p + 1, int_digits);
+      p[int_digits] = '.';
+    } else {
+      p[0] = '0';
+      p[1] = '.';
+      memset(p + 2, '0', -e - n);
+      WriteDigits(p + fixed_length, d.mantissa);
+    }
+    return p + fixed_length;
+  }
+
+  if (last - p < sci_length) return NULL;
+  WriteDigits(p + n + 1, d.mantissa);
+  p[0] = p[1];
+  char* out = p + 1;
+  if (n > 1) {
+    p[1] = '.';
+    out = p + n + 1;
+  }
+  *out++ = 'e';
+  *out++ = sci_exponent < 0 ? '-' : '+';
+  if (abs_sci >= 100) {
+    *out++ = static_cast<char>('0' + abs_sci / 100);
+  }
+  memcpy(out, kDigitPairs + 2 * (abs_sci % 100), 2);
+  return out + 2;
+}
+
+template<typename T>
+char* write_float(char* first, char* last, T value) {
+  typedef FloatFormat<T> F;
+  typedef typename F::bits_type bits_type;
+  bits_type bits;
+  memcpy(&bits, &value, sizeof(bits));
+
+  const uint64_t ieee_mantissa =
+      bits & ((bits_type(1) << F::kMantissaBits) - 1);
+  const uint32_t ieee_exponent = static_cast<uint32_t>(
+      (bits >> F::kMantissaBits) & F::kInfinitePower);
+
+  char* p = first;
+  if (bits >> (sizeof(bits) * 8 - 1)) {
+    if (p >= last) return NULL;
+    *p++ = '-';
+  }
+  if (ieee_exponent == static_cast<uint32_t>(F::kInfinitePower)) {
+    if (last - p < 3) return NULL;
+    memcpy(p, ieee_mantissa ? "nan" : "inf", 3);
+    return p + 3;
+  }
+  if (ieee_exponent == 0 && ieee_mantissa == 0) {
+    if (p >= last) return NULL;
+    *p = '0';
+    return p + 1;
+  }
+  return WriteDecimal(p, last,
+                      ShortestDecimal<T>(ieee_mantissa, ieee_exponent));
+}
+
 }  // namespace
 
+from_chars_result from_chars(const char* first, const char* last,
+                             int8_t* num, int base) {
+  return parse_int(first, last, num, base);
+}
+
+from_chars_result from_chars(const char* first, const char* last,
+                             uint8_t* num, int base) {
+  return parse_int(first, last, num, base);
+}
+
+from_chars_result from_chars(const char* first, const char* last,
+                             int16_t* num, int base) {
+  return parse_int(first, last, num, base);
+}
+
+from_chars_result from_chars(const char* first, const char* last,
+                             uint16_t* num, int base) {
+  return parse_int(first, last, num, base);
+}
+
+from_chars_result from_chars(const char* first, const char* last,
+                             int32_t* num, int base) {
+  return parse_int(first, last, num, base);
+}
+
+from_chars_result from_chars(const char* first, const char* last,
+                             uint32_t* num, int base) {
+  return parse_int(first, last, num, base);
+}
+
+from_chars_result from_chars(const char* first, const char* last,
+                             int64_t* num, int base) {
+  return parse_int(first, last, num, base);
+}
+
+from_chars_result from_chars(const char* first, const char* last,
+                             uint64_t* num, int base) {
+  return parse_int(first, last, num, base);
+}
+
+from_chars_result from_chars(const char* first, const char* last,
+                             float* num) {
+  return parse_float(first, last, num);
+}
+
+from_chars_result from_chars(const char* first, const char* last,
+                             double* num) {
+  return parse_float(first, last, num);
+}
+
+from_chars_result from_chars(const char* first, const char* last,
+                             long double* num) {
+  return parse_float(first, last, num);
+}
+
+char* to_chars(char* first, char* last, int32_t value) {
+  return write_int(first, last, value);
+}
+
+char* to_chars(char* first, char* last, uint32_t value) {
+  return write_uint(first, last, value);
+}
+
+char* to_chars(char* first, char* last, int64_t value) {
+  return write_int(first, last, value);
+}
+
+char* to_chars(char* first, char* last, uint64_t value) {
+  return write_uint(first, last, value);
+}
+
+char* to_chars(char* first, char* last, float value) {
+  return write_float(first, last, value);
+}
+
+char* to_chars(char* first, char* last, double value) {
+  return write_float(first, last, value);
+}
 
 bool safe_str2bool(const strings::cord& str, bool* value) {
-  std::string val(str.ptr(), str.length());
-  std::transform(val.begin(), val.end(), val.begin(), ::tolower);
-  // Name don't matter now.
-  if (val == "1" || val == "true" || val == "yes" || val == "y" || val == "t") {
-    *value = true;
-    return true;
-  } else if (val == "0" || val == "false" || val == "no" || val == "n" || val == "f") {
-    *value = false;
-    return true;
+  switch (strings::keyword_code(str)) {
+    case strings::keyword_code("1"):
+    case strings::keyword_code("true"):
+    case strings::keyword_code("yes"):
+    case strings::keyword_code("y"):
+    case strings::keyword_code("t"):
+      *value = true;
+      return true;
+    case strings::keyword_code("0"):
+    case strings::keyword_code("false"):
+    case strings::keyword_code("no"):
+    case strings::keyword_code("n"):
+    case strings::keyword_code("f"):
+      *value = false;
+      return true;
+    default:
+      return false;
   }
-
-  return false;
 }
 
 bool safe_str2int8(const strings::cord& str, int8_t *num, int base) {
@@ -120,7 +1132,7 @@ bool safe_str2int8(const strings::cord& str, int8_t *num, int base) {
 }
 
 bool safe_str2uint8(const strings::cord& str, uint8_t *num, int base) {
-  return safe_parse_uint(str, num, base);
+  return safe_parse_int(str, num, base);
 }
 
 bool safe_str2int16(const strings::cord& str, int16_t *num, int base) {
@@ -128,7 +1140,7 @@ bool safe_str2int16(const strings::cord& str, int16_t *num, int base) {
 }
 
 bool safe_str2uint16(const strings::cord& str, uint16_t *num, int base) {
-  return safe_parse_uint(str, num, base);
+  return safe_parse_int(str, num, base);
 }
 
 bool safe_str2int32(const strings::cord& str, int32_t *num, int base) {
@@ -136,7 +1148,7 @@ bool safe_str2int32(const strings::cord& str, int32_t *num, int base) {
 }
 
 bool safe_str2uint32(const strings::cord& str, uint32_t *num, int base) {
-  return safe_parse_uint(str, num, base);
+  return safe_parse_int(str, num, base);
 }
 
 bool safe_str2int64(const strings::cord& str, int64_t *num, int base) {
@@ -144,7 +1156,7 @@ bool safe_str2int64(const strings::cord& str, int64_t *num, int base) {
 }
 
 bool safe_str2uint64(const strings::cord& str, uint64_t *num, int base) {
-  return safe_parse_uint(str, num, base);
+  return safe_parse_int(str, num, base);
 }
 
 bool safe_str2f(const strings::cord& str, float* dbl) {
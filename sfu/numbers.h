@@ -1,13 +1,90 @@
 #ifndef SFU_NUMBERS_H_
 #define SFU_NUMBERS_H_
 
+#include <cstddef>
 #include <cstdint>
 #include "sfu/strings/cord.h"
 
 namespace sfu {
 
+typedef enum {
+  PARSE_OK = 0,
+  // There is no number at the start of the buffer.
+  PARSE_INVALID,
+  // The number does not fit in the value type.
+  PARSE_OVERFLOW
+} ParseError;
+
+struct from_chars_result {
+  // The first char after the parsed number. On PARSE_INVALID this is the
+  // start of the buffer, on PARSE_OVERFLOW it is after all the digits.
+  const char* ptr;
+  ParseError error;
+};
+
+// Parse a number from the start of [first, last), and give back where the
+// number ended. This makes it possible to parse numbers embedded in larger
+// buffers without making a cord or string of each. Like std::from_chars there
+// is no leading whitespace, '+' or base prefix ("0x") allowed, and '-' only
+// for signed types. On error *num is not modified.
+//
+// Base 10 parses 8 digits at a time, and bases 8 and 16 use shifts instead of
+// multiplication.
+from_chars_result from_chars(const char* first, const char* last,
+                             int8_t* num, int base = 10);
+from_chars_result from_chars(const char* first, const char* last,
+                             uint8_t* num, int base = 10);
+from_chars_result from_chars(const char* first, const char* last,
+                             int16_t* num, int base = 10);
+from_chars_result from_chars(const char* first, const char* last,
+                             uint16_t* num, int base = 10);
+from_chars_result from_chars(const char* first, const char* last,
+                             int32_t* num, int base = 10);
+from_chars_result from_chars(const char* first, const char* last,
+                             uint32_t* num, int base = 10);
+from_chars_result from_chars(const char* first, const char* last,
+                             int64_t* num, int base = 10);
+from_chars_result from_chars(const char* first, const char* last,
+                             uint64_t* num, int base = 10);
+
+// Parse a floating point number, correctly rounded to nearest even. Accepts
+// decimal numbers with an optional exponent, hex floats ("0x1.8p3"), "inf",
+// "infinity", "nan" and "nan(...)", all case insensitive. A finite number
+// too large for the type gives PARSE_OVERFLOW, while too small numbers
+// become 0.
+//
+// Most numbers are converted with the Clinger fast path or Eisel-Lemire, and
+// never touch the locale dependent strtod. Long double always uses strtold.
+from_chars_result from_chars(const char* first, const char* last,
+                             float* num);
+from_chars_result from_chars(const char* first, const char* last,
+                             double* num);
+from_chars_result from_chars(const char* first, const char* last,
+                             long double* num);
+
+// Write a number at the start of [first, last) and return the end of it, or
+// NULL if it does not fit. Nothing is NUL-terminated. Floating point
+// numbers are written with the fewest digits that parse back to the same
+// value, in fixed or scientific notation ("1e+22") whichever is shorter,
+// like std::to_chars. Unlike std::to_chars large integral values are padded
+// with zeros after the shortest digits ("1e+15" and "123456780000" for
+// float), not written out exactly. Buffers of the kMax*Chars sizes always
+// fit.
+static const size_t kMaxIntegerChars = 20;
+static const size_t kMaxFloatChars = 15;
+static const size_t kMaxDoubleChars = 24;
+
+char* to_chars(char* first, char* last, int32_t value);
+char* to_chars(char* first, char* last, uint32_t value);
+char* to_chars(char* first, char* last, int64_t value);
+char* to_chars(char* first, char* last, uint64_t value);
+char* to_chars(char* first, char* last, float value);
+char* to_chars(char* first, char* last, double value);
+
 bool safe_str2bool(const strings::cord& str, bool* value);
 
+// The safe_str2* functions require the whole string to be the number, and
+// fail on values that does not fit in the type.
 bool safe_str2int8(const strings::cord& str, int8_t *num, int base = 10);
 bool safe_str2uint8(const strings::cord& str, uint8_t *num, int base = 10);
 
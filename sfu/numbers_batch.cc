@@ -0,0 +1,128 @@
+#include "sfu/numbers_batch.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include <cstring>
+
+#include "sfu/numbers.h"
+
+namespace sfu {
+namespace {
+
+// Call fn(pos) for each delimiter in [p, end), in order.
+template<typename F>
+inline void ForEachDelimiter(const char* p, const char* end, char delimiter,
+                             F& fn) {
+#if defined(__SSE2__)
+  const __m128i needle = _mm_set1_epi8(delimiter);
+  for (; end - p >= 16; p += 16) {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    uint32_t mask = static_cast<uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle)));
+    while (mask) {
+      fn(p + __builtin_ctz(mask));
+      mask &= mask - 1;
+    }
+  }
+#else
+  // Set the high bit of each byte equal to the delimiter, 8 at a time.
+  const uint64_t kOnes = 0x0101010101010101ULL;
+  const uint64_t kHigh = 0x8080808080808080ULL;
+  const uint64_t needle = kOnes * static_cast<uint8_t>(delimiter);
+  for (; end - p >= 8; p += 8) {
+    uint64_t chunk;
+    memcpy(&chunk, p, 8);
+    chunk ^= needle;
+    uint64_t mask = ~(((chunk & ~kHigh) + ~kHigh) | chunk) & kHigh;
+    while (mask) {
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+      const int byte = __builtin_clzll(mask) / 8;
+      mask &= ~(uint64_t(0x80) << (56 - 8 * byte));
+#else
+      const int byte = __builtin_ctzll(mask) / 8;
+      mask &= mask - 1;
+#endif
+      fn(p + byte);
+    }
+  }
+#endif
+  for (; p < end; ++p) {
+    if (*p == delimiter) fn(p);
+  }
+}
+
+struct CountFields {
+  size_t* count;
+  void operator()(const char*) const { ++*count; }
+};
+
+template<typename T>
+struct ParseField {
+  const char* start;
+  bool strip_cr;
+  T* values;
+  uint64_t* errors;
+  size_t row;
+
+  void operator()(const char* pos) {
+    const char* last = pos;
+    if (strip_cr && last > start && last[-1] == '\r') --last;
+    T value;
+    from_chars_result res = from_chars(start, last, &value);
+    if (res.error == PARSE_OK && res.ptr == last) {
+      values[row] = value;
+    } else {
+      values[row] = 0;
+      errors[row / 64] |= uint64_t(1) << (row % 64);
+    }
+    ++row;
+    start = pos + 1;
+  }
+};
+
+template<typename T>
+bool parse_column_impl(const strings::cord& buffer, char delimiter,
+                       std::vector<T>* values, std::vector<uint64_t>* errors) {
+  const char* begin = buffer.begin();
+  const char* end = buffer.end();
+  values->clear();
+  errors->clear();
+  if (begin == end) return true;
+
+  // A trailing delimiter ends the last field instead of starting one.
+  const bool trailing = end[-1] == delimiter;
+  size_t rows = trailing ? 0 : 1;
+  CountFields count = {&rows};
+  ForEachDelimiter(begin, end, delimiter, count);
+
+  values->resize(rows);
+  errors->assign((rows + 63) / 64, 0);
+
+  ParseField<T> parse = {begin, delimiter == '\n', values->data(),
+                         errors->data(), 0};
+  ForEachDelimiter(begin, end, delimiter, parse);
+  if (!trailing) parse(end);
+
+  for (size_t i = 0; i < errors->size(); ++i) {
+    if ((*errors)[i]) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+bool parse_column(const strings::cord& buffer, char delimiter,
+                  std::vector<int64_t>* values,
+                  std::vector<uint64_t>* errors) {
+  return parse_column_impl(buffer, delimiter, values, errors);
+}
+
+bool parse_column(const strings::cord& buffer, char delimiter,
+                  std::vector<double>* values,
+                  std::vector<uint64_t>* errors) {
+  return parse_column_impl(buffer, delimiter, values, errors);
+}
+
+}  // namespace sfu
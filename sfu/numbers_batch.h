@@ -0,0 +1,37 @@
+#ifndef SFU_NUMBERS_BATCH_H_
+#define SFU_NUMBERS_BATCH_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "sfu/strings/cord.h"
+
+namespace sfu {
+
+// Parse a whole column of numbers separated by delimiter, e.g. a file with
+// one number per line, in one call. Every field gives one value, and a
+// delimiter at the very end of the buffer does not start a new field. When
+// the delimiter is '\n', a "\r" before it is ignored.
+//
+// Fields that are not a valid number (see from_chars in sfu/numbers.h) get
+// the value 0, and their bit set in errors: bit (row % 64) of
+// errors[row / 64]. Returns true if all fields parsed.
+//
+// The delimiters are located 16 bytes at a time with SSE2 where available,
+// and the values and error bitmap are sized once up front.
+bool parse_column(const strings::cord& buffer, char delimiter,
+                  std::vector<int64_t>* values,
+                  std::vector<uint64_t>* errors);
+bool parse_column(const strings::cord& buffer, char delimiter,
+                  std::vector<double>* values,
+                  std::vector<uint64_t>* errors);
+
+// If row failed to parse according to the errors from parse_column.
+inline bool column_error(const std::vector<uint64_t>& errors, size_t row) {
+  return row / 64 < errors.size() && (errors[row / 64] >> (row % 64)) & 1;
+}
+
+}  // namespace sfu
+
+#endif  // SFU_NUMBERS_BATCH_H_
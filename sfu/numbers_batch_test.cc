@@ -0,0 +1,81 @@
+#include <string>
+#include <vector>
+
+#include "sfu/numbers_batch.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+using namespace sfu;
+
+TEST(NumbersBatchTest, TestParseIntColumn) {
+  vector<int64_t> values;
+  vector<uint64_t> errors;
+
+  EXPECT_TRUE(parse_column("12\n-7\n9223372036854775807\n", '\n',
+                           &values, &errors));
+  ASSERT_EQ(3UL, values.size());
+  EXPECT_EQ(12, values[0]);
+  EXPECT_EQ(-7, values[1]);
+  EXPECT_EQ(INT64_MAX, values[2]);
+  EXPECT_FALSE(column_error(errors, 0));
+
+  EXPECT_TRUE(parse_column("1\r\n2\r\n3", '\n', &values, &errors));
+  ASSERT_EQ(3UL, values.size());
+  EXPECT_EQ(3, values[2]);
+
+  EXPECT_TRUE(parse_column("", ',', &values, &errors));
+  EXPECT_EQ(0UL, values.size());
+  EXPECT_EQ(0UL, errors.size());
+}
+
+TEST(NumbersBatchTest, TestParseColumnErrors) {
+  vector<int64_t> values;
+  vector<uint64_t> errors;
+
+  EXPECT_FALSE(parse_column("1,x,,3,99999999999999999999,4 ", ',',
+                            &values, &errors));
+  ASSERT_EQ(6UL, values.size());
+  ASSERT_EQ(1UL, errors.size());
+  EXPECT_EQ(0x36UL, errors[0]);
+  EXPECT_EQ(1, values[0]);
+  EXPECT_EQ(0, values[1]);
+  EXPECT_EQ(3, values[3]);
+  EXPECT_TRUE(column_error(errors, 5));
+  EXPECT_FALSE(column_error(errors, 6));
+}
+
+TEST(NumbersBatchTest, TestParseLongColumn) {
+  // Long enough to cross many 16 byte blocks, and the 64 row error words.
+  string buffer;
+  for (int i = 0; i < 1000; ++i) {
+    if (i % 97 == 0) {
+      buffer += "bad;";
+    } else {
+      buffer += to_string(i * 1001) + ";";
+    }
+  }
+
+  vector<int64_t> values;
+  vector<uint64_t> errors;
+  EXPECT_FALSE(parse_column(buffer, ';', &values, &errors));
+  ASSERT_EQ(1000UL, values.size());
+  EXPECT_EQ(16UL, errors.size());
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(i % 97 == 0, column_error(errors, i)) << i;
+    EXPECT_EQ(i % 97 == 0 ? 0 : i * 1001, values[i]) << i;
+  }
+}
+
+TEST(NumbersBatchTest, TestParseDoubleColumn) {
+  vector<double> values;
+  vector<uint64_t> errors;
+
+  EXPECT_FALSE(parse_column("0.5\t-1e3\tnan\t1.5.2\t7", '\t',
+                            &values, &errors));
+  ASSERT_EQ(5UL, values.size());
+  EXPECT_EQ(0.5, values[0]);
+  EXPECT_EQ(-1000.0, values[1]);
+  EXPECT_TRUE(values[2] != values[2]);
+  EXPECT_TRUE(column_error(errors, 3));
+  EXPECT_EQ(7.0, values[4]);
+}
@@ -0,0 +1,30 @@
+#ifndef SFU_NUMBERS_DATA_H_
+#define SFU_NUMBERS_DATA_H_
+
+#include <cstdint>
+
+namespace sfu {
+namespace numbers_internal {
+
+// Generated tables, see gen_numbers_data.py. Not part of the public API.
+
+static const int kSmallestPowerOfFive = -342;
+static const int kLargestPowerOfFive = 308;
+
+// The 128 most significant bits of 5^q for q in [kSmallestPowerOfFive,
+// kLargestPowerOfFive], as (high, low) pairs.
+extern const uint64_t kPowerOfFive128[];
+
+static const int kPow5InvCount = 342;
+static const int kPow5Count = 326;
+static const int kPow5BitCount = 125;
+
+// Ryu multipliers as (high, low) pairs: 2^(bits(5^i) - 1 + 125) / 5^i
+// rounded up, and 5^i truncated to 125 bits.
+extern const uint64_t kPow5InvSplit[];
+extern const uint64_t kPow5Split[];
+
+}  // namespace numbers_internal
+}  // namespace sfu
+
+#endif  // SFU_NUMBERS_DATA_H_
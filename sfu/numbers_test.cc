@@ -1,5 +1,9 @@
 
+#include <cfloat>
+#include <cmath>
+
 #include "sfu/numbers.h"
+#include "sfu/testing/alloc_counter.h"
 #include "gtest/gtest.h"
 
 using namespace std;
@@ -45,6 +49,10 @@ TEST(NumbersTest, TestParseBoolFail) {
   EXPECT_FALSE(safe_str2bool("falser", &b));
   EXPECT_FALSE(safe_str2bool("-1", &b));
   EXPECT_FALSE(safe_str2bool("0000", &b));
+  EXPECT_FALSE(safe_str2bool("tru", &b));
+  EXPECT_FALSE(safe_str2bool(" true", &b));
+  EXPECT_FALSE(safe_str2bool(string("y\0", 2), &b));
+  EXPECT_FALSE(safe_str2bool("yesyesyes", &b));
   EXPECT_FALSE(safe_str2bool("1000", &b));
 }
 
@@ -58,4 +66,256 @@ TEST(NumbersTest, TestParseDouble) {
 
   EXPECT_TRUE(safe_str2d("4755667788.8000002", &d));
   EXPECT_DOUBLE_EQ(4755667788.8000002, d);
+
+  // Exact, not just close.
+  EXPECT_TRUE(safe_str2d("42", &d));
+  EXPECT_EQ(42.0, d);
+  EXPECT_TRUE(safe_str2d("0.1", &d));
+  EXPECT_EQ(0.1, d);
+  EXPECT_TRUE(safe_str2d("1.7976931348623157e308", &d));
+  EXPECT_EQ(1.7976931348623157e308, d);
+  EXPECT_TRUE(safe_str2d("4.9406564584124654e-324", &d));
+  EXPECT_EQ(4.9406564584124654e-324, d);
+  EXPECT_TRUE(safe_str2d("1e-400", &d));
+  EXPECT_EQ(0.0, d);
+  EXPECT_TRUE(safe_str2d(".5E+1", &d));
+  EXPECT_EQ(5.0, d);
+  EXPECT_TRUE(safe_str2f("3.4028235e38", &f));
+  EXPECT_EQ(3.4028235e38f, f);
+
+  // Half way cases decided by digits past the 19th.
+  EXPECT_TRUE(safe_str2d("9007199254740993", &d));
+  EXPECT_EQ(9007199254740992.0, d);
+  EXPECT_TRUE(safe_str2d("9007199254740993.0000000000000000001", &d));
+  EXPECT_EQ(9007199254740994.0, d);
+  EXPECT_TRUE(safe_str2d(
+      "0.1000000000000000055511151231257827021181583404541015625", &d));
+  EXPECT_EQ(0.1, d);
+
+  EXPECT_TRUE(safe_str2d("0x1.8p3", &d));
+  EXPECT_EQ(12.0, d);
+  EXPECT_TRUE(safe_str2d("-0X10", &d));
+  EXPECT_EQ(-16.0, d);
+
+  EXPECT_TRUE(safe_str2d("-Infinity", &d));
+  EXPECT_TRUE(std::isinf(d) && d < 0);
+  EXPECT_TRUE(safe_str2f("nan", &f));
+  EXPECT_TRUE(std::isnan(f));
+  EXPECT_TRUE(safe_str2d("NaN(0x1f)", &d));
+  EXPECT_TRUE(std::isnan(d));
+
+  d = 7.0;
+  EXPECT_FALSE(safe_str2d("", &d));
+  EXPECT_FALSE(safe_str2d("+1", &d));
+  EXPECT_FALSE(safe_str2d(" 1", &d));
+  EXPECT_FALSE(safe_str2d("1e", &d));
+  EXPECT_FALSE(safe_str2d(".", &d));
+  EXPECT_FALSE(safe_str2d("1e400", &d));
+  EXPECT_FALSE(safe_str2f("1e39", &f));
+  EXPECT_EQ(7.0, d);
+}
+
+TEST(NumbersTest, TestParseLongDouble) {
+  long double ld = 0;
+
+  EXPECT_TRUE(safe_str2ld("0.25", &ld));
+  EXPECT_EQ(0.25L, ld);
+  EXPECT_TRUE(safe_str2ld("-inf", &ld));
+  EXPECT_TRUE(std::isinf(ld));
+  EXPECT_FALSE(safe_str2ld("1.0x", &ld));
+}
+
+TEST(NumbersTest, TestParseInt) {
+  int8_t i8 = 0;
+  uint8_t u8 = 0;
+  int64_t i64 = 0;
+  uint64_t u64 = 0;
+
+  EXPECT_TRUE(safe_str2uint8("255", &u8));
+  EXPECT_EQ(255, u8);
+  EXPECT_FALSE(safe_str2uint8("300", &u8));
+  EXPECT_FALSE(safe_str2uint8("256", &u8));
+  EXPECT_EQ(255, u8);
+  EXPECT_FALSE(safe_str2uint8("-1", &u8));
+
+  EXPECT_TRUE(safe_str2int8("-128", &i8));
+  EXPECT_EQ(-128, i8);
+  EXPECT_TRUE(safe_str2int8("127", &i8));
+  EXPECT_EQ(127, i8);
+  EXPECT_FALSE(safe_str2int8("128", &i8));
+  EXPECT_FALSE(safe_str2int8("-129", &i8));
+  EXPECT_FALSE(safe_str2int8("-", &i8));
+  EXPECT_FALSE(safe_str2int8("", &i8));
+  EXPECT_FALSE(safe_str2int8("+1", &i8));
+  EXPECT_FALSE(safe_str2int8("1 ", &i8));
+
+  EXPECT_TRUE(safe_str2int64("-9223372036854775808", &i64));
+  EXPECT_EQ(INT64_MIN, i64);
+  EXPECT_TRUE(safe_str2int64("9223372036854775807", &i64));
+  EXPECT_EQ(INT64_MAX, i64);
+  EXPECT_FALSE(safe_str2int64("9223372036854775808", &i64));
+  EXPECT_TRUE(safe_str2int64("000000000000000000000000000012345678901", &i64));
+  EXPECT_EQ(12345678901, i64);
+
+  EXPECT_TRUE(safe_str2uint64("18446744073709551615", &u64));
+  EXPECT_EQ(UINT64_MAX, u64);
+  EXPECT_FALSE(safe_str2uint64("18446744073709551616", &u64));
+  EXPECT_FALSE(safe_str2uint64("99999999999999999999", &u64));
+  EXPECT_TRUE(safe_str2uint64("1234567890123456", &u64));
+  EXPECT_EQ(1234567890123456, u64);
+}
+
+TEST(NumbersTest, TestParseIntBase) {
+  uint64_t u64 = 0;
+  int32_t i32 = 0;
+
+  EXPECT_TRUE(safe_str2uint64("ffffffffffffffff", &u64, 16));
+  EXPECT_EQ(UINT64_MAX, u64);
+  EXPECT_FALSE(safe_str2uint64("10000000000000000", &u64, 16));
+  EXPECT_TRUE(safe_str2uint64("1777777777777777777777", &u64, 8));
+  EXPECT_EQ(UINT64_MAX, u64);
+  EXPECT_FALSE(safe_str2uint64("2000000000000000000000", &u64, 8));
+  EXPECT_FALSE(safe_str2uint64("8", &u64, 8));
+
+  EXPECT_TRUE(safe_str2int32("-7fffffff", &i32, 16));
+  EXPECT_EQ(-0x7fffffff, i32);
+  EXPECT_TRUE(safe_str2int32("zik0zj", &i32, 36));
+  EXPECT_EQ(INT32_MAX, i32);
+  EXPECT_FALSE(safe_str2int32("zik0zk", &i32, 36));
+  EXPECT_FALSE(safe_str2int32("1", &i32, 37));
+}
+
+TEST(NumbersTest, TestFromChars) {
+  string buffer("1234,-56,x,99999999999999999999;");
+  const char* p = buffer.c_str();
+  const char* end = p + buffer.size();
+  int64_t i64 = 0;
+
+  from_chars_result res = from_chars(p, end, &i64);
+  EXPECT_EQ(PARSE_OK, res.error);
+  EXPECT_EQ(1234, i64);
+  EXPECT_EQ(',', *res.ptr);
+
+  res = from_chars(res.ptr + 1, end, &i64);
+  EXPECT_EQ(PARSE_OK, res.error);
+  EXPECT_EQ(-56, i64);
+  EXPECT_EQ(',', *res.ptr);
+
+  p = res.ptr + 1;
+  res = from_chars(p, end, &i64);
+  EXPECT_EQ(PARSE_INVALID, res.error);
+  EXPECT_EQ(p, res.ptr);
+  EXPECT_EQ(-56, i64);
+
+  res = from_chars(p + 2, end, &i64);
+  EXPECT_EQ(PARSE_OVERFLOW, res.error);
+  EXPECT_EQ(';', *res.ptr);
+}
+
+TEST(NumbersTest, TestFromCharsDouble) {
+  string buffer("1.5e3,2e,-0.25x,e5");
+  const char* end = buffer.c_str() + buffer.size();
+  double d = 0;
+
+  from_chars_result res = from_chars(buffer.c_str(), end, &d);
+  EXPECT_EQ(PARSE_OK, res.error);
+  EXPECT_EQ(1500.0, d);
+  EXPECT_EQ(',', *res.ptr);
+
+  // The 'e' without digits is not part of the number.
+  res = from_chars(res.ptr + 1, end, &d);
+  EXPECT_EQ(PARSE_OK, res.error);
+  EXPECT_EQ(2.0, d);
+  EXPECT_EQ('e', *res.ptr);
+
+  res = from_chars(res.ptr + 2, end, &d);
+  EXPECT_EQ(PARSE_OK, res.error);
+  EXPECT_EQ(-0.25, d);
+  EXPECT_EQ('x', *res.ptr);
+
+  const char* p = res.ptr + 2;
+  res = from_chars(p, end, &d);
+  EXPECT_EQ(PARSE_INVALID, res.error);
+  EXPECT_EQ(p, res.ptr);
+}
+
+TEST(NumbersTest, TestToChars) {
+  char buffer[32];
+  char* end = buffer + sizeof(buffer);
+
+  EXPECT_EQ("0", string(buffer, to_chars(buffer, end, 0)));
+  EXPECT_EQ("-2147483648", string(buffer, to_chars(buffer, end, INT32_MIN)));
+  EXPECT_EQ("1234567", string(buffer, to_chars(buffer, end, 1234567u)));
+  EXPECT_EQ("-9223372036854775808",
+            string(buffer, to_chars(buffer, end, INT64_MIN)));
+  EXPECT_EQ("18446744073709551615",
+            string(buffer, to_chars(buffer, end, UINT64_MAX)));
+
+  // Does not fit.
+  EXPECT_EQ(NULL, to_chars(buffer, buffer + 3, 1234));
+  EXPECT_EQ(NULL, to_chars(buffer, buffer + 3, -123));
+  EXPECT_EQ(NULL, to_chars(buffer, buffer + 3, 0.125));
+  EXPECT_EQ(buffer + 3, to_chars(buffer, buffer + 3, 123));
+}
+
+TEST(NumbersTest, TestToCharsDouble) {
+  char buffer[kMaxDoubleChars];
+  char* end = buffer + sizeof(buffer);
+
+  EXPECT_EQ("0", string(buffer, to_chars(buffer, end, 0.0)));
+  EXPECT_EQ("-0", string(buffer, to_chars(buffer, end, -0.0)));
+  EXPECT_EQ("42", string(buffer, to_chars(buffer, end, 42.0)));
+  EXPECT_EQ("0.1", string(buffer, to_chars(buffer, end, 0.1)));
+  EXPECT_EQ("0.30000000000000004",
+            string(buffer, to_chars(buffer, end, 0.1 + 0.2)));
+  EXPECT_EQ("-22.76", string(buffer, to_chars(buffer, end, -22.76)));
+  EXPECT_EQ("1e+22", string(buffer, to_chars(buffer, end, 1e22)));
+  EXPECT_EQ("1e+05", string(buffer, to_chars(buffer, end, 1e5)));
+  EXPECT_EQ("12345", string(buffer, to_chars(buffer, end, 12345.0)));
+  EXPECT_EQ("0.001", string(buffer, to_chars(buffer, end, 0.001)));
+  EXPECT_EQ("1e-07", string(buffer, to_chars(buffer, end, 1e-7)));
+  EXPECT_EQ("5e-324", string(buffer, to_chars(buffer, end, 5e-324)));
+  EXPECT_EQ("-2.2250738585072014e-308",
+            string(buffer, to_chars(buffer, end, -2.2250738585072014e-308)));
+  EXPECT_EQ("1.7976931348623157e+308",
+            string(buffer, to_chars(buffer, end, 1.7976931348623157e308)));
+  EXPECT_EQ("inf", string(buffer, to_chars(buffer, end, HUGE_VAL)));
+  EXPECT_EQ("-inf", string(buffer, to_chars(buffer, end, -HUGE_VAL)));
+  EXPECT_EQ("nan", string(buffer, to_chars(buffer, end, NAN)));
+
+  EXPECT_EQ("0.1", string(buffer, to_chars(buffer, end, 0.1f)));
+  EXPECT_EQ("3.4028235e+38", string(buffer, to_chars(buffer, end, FLT_MAX)));
+  EXPECT_EQ("1e-45", string(buffer, to_chars(buffer, end, 1e-45f)));
+
+  // What is written parses back to the same value.
+  const double values[] = {1.0 / 3, 2.0 / 3, 1e23, 9007199254740993.0,
+                           123.456e-300, 6.02214076e23};
+  for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i) {
+    char* p = to_chars(buffer, end, values[i]);
+    double back = 0;
+    EXPECT_TRUE(safe_str2d(strings::cord(buffer, p - buffer), &back));
+    EXPECT_EQ(values[i], back);
+  }
+}
+
+TEST(NumbersTest, TestNoAlloc) {
+  const strings::cord number("-1234567890");
+  int64_t i64 = 0;
+  EXPECT_NO_ALLOC(from_chars(number.ptr(), number.ptr() + number.length(),
+                             &i64));
+  EXPECT_NO_ALLOC(safe_str2int64(number, &i64));
+  EXPECT_EQ(-1234567890, i64);
+
+  const strings::cord real("3.14159e-7");
+  double d = 0;
+  EXPECT_NO_ALLOC(from_chars(real.ptr(), real.ptr() + real.length(), &d));
+  EXPECT_NO_ALLOC(safe_str2d(real, &d));
+
+  bool b = false;
+  EXPECT_NO_ALLOC(safe_str2bool(strings::cord("yes"), &b));
+  EXPECT_TRUE(b);
+
+  char buffer[32];
+  EXPECT_NO_ALLOC(to_chars(buffer, buffer + sizeof(buffer), i64));
+  EXPECT_NO_ALLOC(to_chars(buffer, buffer + sizeof(buffer), d));
 }
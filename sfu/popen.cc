@@ -1,7 +1,20 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
 #include <sys/wait.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
 #include "sfu/popen.h"
+#include "sfu/trace/trace.h"
 
 using namespace std;
 
@@ -17,70 +30,466 @@ void close_pipe(int p[2]) {
   close_pipefd(p[1]);
 }
 
-void replace_fd(int fileno, int pipeno) {
-  close(fileno);
-  dup(pipeno);
+// The environment for the process: this process' environment with the
+// options' changes applied. Points into environ and options.
+vector<const char*> make_env(const Popen::Options& options) {
+  vector<const char*> envp;
+  if (!options.clear_env) {
+    for (char** e = environ; *e; ++e) {
+      const char* eq = strchr(*e, '=');
+      const size_t name_len = eq ? eq - *e : strlen(*e);
+      bool changed = false;
+      for (const string& var : options.env) {
+        const size_t len = min(var.find('='), var.size());
+        if (len == name_len && memcmp(var.c_str(), *e, len) == 0) {
+          changed = true;
+          break;
+        }
+      }
+      if (!changed) envp.push_back(*e);
+    }
+  }
+  for (const string& var : options.env) {
+    // "NAME" without a value only unsets it.
+    if (var.find('=') != string::npos) envp.push_back(var.c_str());
+  }
+  envp.push_back(NULL);
+  return envp;
+}
+
+// posix_spawn uses vfork or clone(CLONE_VM), so starting a process does not
+// copy the page tables, and takes the same time regardless of the size of
+// this process. Returns ENOSYS if the options can not be done this way.
+int spawn(const char* const* argv, const char* const* envp,
+          const Popen::Options& options,
+          int in_fd, int out_fd, int err_fd, int* pid) {
+#if defined(__GLIBC__) && \
+    (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 34))
+  if (!options.limits.empty() || !options.cgroup.empty()) {
+    return ENOSYS;
+  }
+
+  posix_spawn_file_actions_t actions;
+  posix_spawnattr_t attr;
+  posix_spawn_file_actions_init(&actions);
+  posix_spawnattr_init(&attr);
+
+  posix_spawn_file_actions_adddup2(&actions, in_fd, 0);
+  if (out_fd >= 0) posix_spawn_file_actions_adddup2(&actions, out_fd, 1);
+  if (err_fd >= 0) posix_spawn_file_actions_adddup2(&actions, err_fd, 2);
+  if (!options.cwd.empty()) {
+    posix_spawn_file_actions_addchdir_np(&actions, options.cwd.c_str());
+  }
+  if (options.close_fds) {
+    posix_spawn_file_actions_addclosefrom_np(&actions, 3);
+  }
+
+  // Start with no blocked signals, and default SIGPIPE handling.
+  sigset_t mask;
+  sigemptyset(&mask);
+  posix_spawnattr_setsigmask(&attr, &mask);
+  sigaddset(&mask, SIGPIPE);
+  posix_spawnattr_setsigdefault(&attr, &mask);
+  posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETSIGMASK |
+                                  POSIX_SPAWN_SETSIGDEF);
+
+  int ret = posix_spawnp(pid, argv[0], &actions, &attr,
+                         const_cast<char* const*>(argv),
+                         const_cast<char* const*>(envp));
+  posix_spawnattr_destroy(&attr);
+  posix_spawn_file_actions_destroy(&actions);
+  return ret;
+#else
+  return ENOSYS;
+#endif
+}
+
+#if defined(__GLIBC__) && defined(__USE_GNU)
+typedef __rlimit_resource_t rlimit_resource;
+#else
+typedef int rlimit_resource;
+#endif
+
+// Start the process with fork() and exec(). Returns 0 or the errno value.
+int fork_exec(const char* const* argv, const char* const* envp,
+              const Popen::Options& options,
+              int in_fd, int out_fd, int err_fd, int* pid) {
+  // Writing "0" to this moves the writing process to the cgroup.
+  int cgroup_fd = -1;
+  if (!options.cgroup.empty()) {
+    const string procs = options.cgroup + "/cgroup.procs";
+    cgroup_fd = open(procs.c_str(), O_WRONLY | O_CLOEXEC);
+    if (cgroup_fd < 0) return errno;
+  }
+  // The child reports a failed exec over this, closed on a successful one.
+  int status_pipe[2];
+  if (pipe2(status_pipe, O_CLOEXEC) < 0) {
+    int error = errno;
+    close_pipefd(cgroup_fd);
+    return error;
+  }
+
+  *pid = fork();
+  if (*pid < 0) {
+    int error = errno;
+    close_pipe(status_pipe);
+    close_pipefd(cgroup_fd);
+    return error;
+  }
+  if (*pid == 0) {
+    // Child process, only async-signal-safe calls from here.
+    close(status_pipe[0]);
+    dup2(in_fd, 0);
+    if (out_fd >= 0) dup2(out_fd, 1);
+    if (err_fd >= 0) dup2(err_fd, 2);
+    int error = 0;
+    if (cgroup_fd >= 0 && write(cgroup_fd, "0", 1) != 1) {
+      error = errno;
+    } else if (!options.cwd.empty() && chdir(options.cwd.c_str()) != 0) {
+      error = errno;
+    } else {
+      if (options.close_fds) {
+        const int max_fd = static_cast<int>(sysconf(_SC_OPEN_MAX));
+        for (int fd = 3; fd < max_fd; ++fd) {
+          if (fd != status_pipe[1]) close(fd);
+        }
+      }
+      // After closing, as a lower RLIMIT_NOFILE hides the fds above it.
+      for (const Popen::ResourceLimit& limit : options.limits) {
+        struct rlimit rl;
+        rl.rlim_cur = limit.soft;
+        rl.rlim_max = limit.hard;
+        if (setrlimit(static_cast<rlimit_resource>(limit.resource),
+                      &rl) != 0) {
+          error = errno;
+          break;
+        }
+      }
+      if (error != 0) {
+        if (write(status_pipe[1], &error, sizeof(error))) {}
+        _exit(127);
+      }
+      sigset_t mask;
+      sigemptyset(&mask);
+      sigprocmask(SIG_SETMASK, &mask, NULL);
+      signal(SIGPIPE, SIG_DFL);
+
+      environ = const_cast<char**>(envp);
+      execvp(argv[0], const_cast<char* const*>(argv));
+      error = errno;
+    }
+    if (write(status_pipe[1], &error, sizeof(error))) {}
+    _exit(127);
+  }
+
+  close(status_pipe[1]);
+  close_pipefd(cgroup_fd);
+  int error = 0;
+  ssize_t n;
+  do {
+    n = read(status_pipe[0], &error, sizeof(error));
+  } while (n < 0 && errno == EINTR);
+  close(status_pipe[0]);
+  if (n > 0) {
+    waitpid(*pid, NULL, 0);
+    return error ? error : ECHILD;
+  }
+  return 0;
+}
+
+// Large reads means few syscalls for large outputs. This is also the default
+// pipe buffer size on Linux.
+const size_t kReadSize = 64 * 1024;
+
+// Read what is available from fd, appended to out or discarded if out is
+// NULL. Returns as read().
+ssize_t read_into(int fd, std::string* out, char* scratch) {
+  if (out == NULL) {
+    return read(fd, scratch, kReadSize);
+  }
+  const size_t size = out->size();
+  out->resize(size + kReadSize);
+  ssize_t n = read(fd, &(*out)[size], kReadSize);
+  out->resize(size + (n > 0 ? n : 0));
+  return n;
+}
+
+bool write_all(int fd, const char* buffer, size_t len) {
+  while (len > 0) {
+    ssize_t n = write(fd, buffer, len);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      return false;
+    }
+    buffer += n;
+    len -= n;
+  }
+  return true;
+}
+
+// Move what is available from fd to out_fd. Returns as read().
+ssize_t splice_into(int fd, int out_fd, char* scratch, bool* use_splice) {
+#ifdef __linux__
+  if (*use_splice) {
+    ssize_t n = splice(fd, NULL, out_fd, NULL, kReadSize, SPLICE_F_MOVE);
+    if (n >= 0 || (errno != EINVAL && errno != ENOSYS)) return n;
+    // Not supported for out_fd, e.g. a file opened with O_APPEND.
+    *use_splice = false;
+  }
+#endif
+  ssize_t n = read(fd, scratch, kReadSize);
+  if (n > 0 && !write_all(out_fd, scratch, n)) return -1;
+  return n;
+}
+
+// If the process exits without reading all input, writing to stdin raises
+// SIGPIPE, which would kill this process. Block it on this thread while
+// writing, and throw away any SIGPIPE we caused.
+class ScopedBlockSigpipe {
+  public:
+    ScopedBlockSigpipe() {
+      sigemptyset(&sigpipe_);
+      sigaddset(&sigpipe_, SIGPIPE);
+      sigset_t pending;
+      sigpending(&pending);
+      was_pending_ = sigismember(&pending, SIGPIPE) == 1;
+      pthread_sigmask(SIG_BLOCK, &sigpipe_, &old_);
+    }
+    ~ScopedBlockSigpipe() {
+      sigset_t pending;
+      sigpending(&pending);
+      if (!was_pending_ && sigismember(&pending, SIGPIPE) == 1) {
+        struct timespec zero = {0, 0};
+        sigtimedwait(&sigpipe_, NULL, &zero);
+      }
+      pthread_sigmask(SIG_SETMASK, &old_, NULL);
+    }
+
+  private:
+    sigset_t sigpipe_;
+    sigset_t old_;
+    bool was_pending_;
+};
+
+int open_pidfd(int pid) {
+#ifdef SYS_pidfd_open
+  // Always close-on-exec.
+  return static_cast<int>(syscall(SYS_pidfd_open, pid, 0));
+#else
+  return -1;
+#endif
+}
+
+// Milliseconds left until deadline, as a poll() timeout. Rounded up, so poll()
+// does not return just before the deadline.
+int ms_until(chrono::steady_clock::time_point deadline) {
+  chrono::steady_clock::duration left = deadline - chrono::steady_clock::now();
+  if (left <= chrono::steady_clock::duration::zero()) return 0;
+  return static_cast<int>(chrono::duration_cast<chrono::milliseconds>(
+      left + chrono::milliseconds(1) - chrono::steady_clock::duration(1))
+          .count());
+}
+
+int64_t to_us(const struct timeval& tv) {
+  return static_cast<int64_t>(tv.tv_sec) * 1000000 + tv.tv_usec;
+}
+
+// Write in to *pin, and read *pout and *perr into out, or out_fd, and err
+// until all are closed, or until deadline if not NULL. The fds are closed and
+// set to -1 as they are done with. Returns false on I/O errors.
+bool pump(const strings::cord& in, int* pin, int* pout, std::string* out,
+          int out_fd, int* perr, std::string* err,
+          const chrono::steady_clock::time_point* deadline,
+          bool* timed_out) {
+  std::unique_ptr<ScopedBlockSigpipe> block_sigpipe;
+  size_t written = 0;
+  if (in.length() == 0) {
+    close_pipefd(*pin);
+    *pin = -1;
+  } else if (*pin > 0) {
+    block_sigpipe.reset(new ScopedBlockSigpipe());
+    fcntl(*pin, F_SETFL, fcntl(*pin, F_GETFL) | O_NONBLOCK);
+  }
+
+  std::unique_ptr<char[]> scratch;
+  if (out == NULL || err == NULL || out_fd >= 0) {
+    scratch.reset(new char[kReadSize]);
+  }
+
+  bool ok = true;
+  bool use_splice = true;
+  for (;;) {
+    struct pollfd fds[3];
+    nfds_t nfds = 0;
+    int in_i = -1, out_i = -1, err_i = -1;
+    if (*pin > 0) {
+      fds[nfds].fd = *pin;
+      fds[nfds].events = POLLOUT;
+      in_i = nfds++;
+    }
+    if (*pout > 0) {
+      fds[nfds].fd = *pout;
+      fds[nfds].events = POLLIN;
+      out_i = nfds++;
+    }
+    if (*perr > 0) {
+      fds[nfds].fd = *perr;
+      fds[nfds].events = POLLIN;
+      err_i = nfds++;
+    }
+    if (nfds == 0) break;
+
+    int timeout_ms = -1;
+    if (deadline != NULL) {
+      timeout_ms = ms_until(*deadline);
+      if (timeout_ms == 0) {
+        *timed_out = true;
+        break;
+      }
+    }
+    int ready = poll(fds, nfds, timeout_ms);
+    if (ready < 0) {
+      if (errno == EINTR) continue;
+      ok = false;
+      break;
+    }
+    if (ready == 0) continue;
+
+    if (in_i >= 0 && fds[in_i].revents) {
+      ssize_t n = write(*pin, in.ptr() + written, in.length() - written);
+      if (n > 0) written += n;
+      bool failed = n < 0 && errno != EAGAIN && errno != EINTR;
+      if (failed || written == in.length()) {
+        // A process that exits without reading all input is not an error.
+        if (failed && errno != EPIPE) ok = false;
+        close_pipefd(*pin);
+        *pin = -1;
+      }
+    }
+    if (out_i >= 0 && fds[out_i].revents) {
+      ssize_t n = out_fd >= 0
+          ? splice_into(*pout, out_fd, scratch.get(), &use_splice)
+          : read_into(*pout, out, scratch.get());
+      if (n == 0 || (n < 0 && errno != EAGAIN && errno != EINTR)) {
+        if (n < 0) ok = false;
+        close_pipefd(*pout);
+        *pout = -1;
+      }
+    }
+    if (err_i >= 0 && fds[err_i].revents) {
+      ssize_t n = read_into(*perr, err, scratch.get());
+      if (n == 0 || (n < 0 && errno != EAGAIN && errno != EINTR)) {
+        if (n < 0) ok = false;
+        close_pipefd(*perr);
+        *perr = -1;
+      }
+    }
+  }
+  return ok;
 }
 
 }  // namespace popen_internal
 
+Popen::ResourceLimit::ResourceLimit(int resource, uint64_t limit)
+    : resource(resource),
+      soft(limit),
+      hard(limit) {}
+
+Popen::ResourceLimit::ResourceLimit(int resource, uint64_t soft, uint64_t hard)
+    : resource(resource),
+      soft(soft),
+      hard(hard) {}
+
+Popen::Usage::Usage()
+    : user_us(0),
+      system_us(0),
+      max_rss_kb(0) {}
+
+Popen::Options::Options()
+    : out_mode(Popen::TIE),
+      err_mode(Popen::TIE),
+      clear_env(false),
+      close_fds(true),
+      in_fd(-1),
+      out_fd(-1),
+      err_fd(-1),
+      timeout_ms(0),
+      kill_grace_ms(1000) {}
+
 Popen::Popen(const vector<string>& cmd,
     OutputMode out_mode, OutputMode err_mode) : pid_(0), status_(0), cmd_(cmd),
-    pin_(-1), pout_(-1), perr_(-1) {
+    pin_(-1), pout_(-1), perr_(-1), pidfd_(-1), has_deadline_(false),
+    kill_grace_ms_(0), timed_out_(false) {
+  Options options;
+  options.out_mode = out_mode;
+  options.err_mode = err_mode;
+  Start(options);
+}
+
+Popen::Popen(const vector<string>& cmd, const Options& options)
+    : pid_(0), status_(0), cmd_(cmd), pin_(-1), pout_(-1), perr_(-1),
+      pidfd_(-1), has_deadline_(false), kill_grace_ms_(0), timed_out_(false) {
+  Start(options);
+}
+
+void Popen::Start(const Options& options) {
+  SFU_TRACE_SCOPE("Popen::Start");
   int pin_a[2] = {-1, -1};
   int pout_a[2] = {-1, -1};
   int perr_a[2] = {-1, -1};
 
-  if (pipe(pin_a) < 0) {
+  // The pipes are close-on-exec, so this end of them is never inherited by
+  // this or any other process started.
+  if (options.in_fd < 0 && pipe2(pin_a, O_CLOEXEC) < 0) {
     return;
   }
 
-  if (out_mode == Popen::PIPE && pipe(pout_a) < 0) {
+  if (options.out_fd < 0 && options.out_mode == Popen::PIPE &&
+      pipe2(pout_a, O_CLOEXEC) < 0) {
     popen_internal::close_pipe(pin_a);
     return;
   }
 
-  if (err_mode == Popen::PIPE && pipe(perr_a) < 0) {
+  if (options.err_fd < 0 && options.err_mode == Popen::PIPE &&
+      pipe2(perr_a, O_CLOEXEC) < 0) {
     popen_internal::close_pipe(pin_a);
     popen_internal::close_pipe(pout_a);
     return;
   }
+  const int in_fd = options.in_fd >= 0 ? options.in_fd : pin_a[0];
+  const int out_fd = options.out_fd >= 0 ? options.out_fd : pout_a[1];
+  const int err_fd = options.err_fd >= 0 ? options.err_fd : perr_a[1];
+
+  // parse cmd to char** argv.
+  vector<const char*> argv;
+  for (const string& arg : cmd_) {
+    argv.push_back(arg.c_str());
+  }
+  argv.push_back(NULL);
+  vector<const char*> envp = popen_internal::make_env(options);
+
+  pid_ = -1;
+  int ret = popen_internal::spawn(argv.data(), envp.data(), options,
+                                  in_fd, out_fd, err_fd, &pid_);
+  if (ret == ENOSYS) {
+    ret = popen_internal::fork_exec(argv.data(), envp.data(), options,
+                                    in_fd, out_fd, err_fd, &pid_);
+  }
 
-  pid_ = fork();
-  if (pid_ > 0) {  // Parent process
+  if (ret == 0) {
     popen_internal::close_pipefd(pin_a[0]);
     popen_internal::close_pipefd(pout_a[1]);
     popen_internal::close_pipefd(perr_a[1]);
     pin_  = pin_a[1];
     pout_ = pout_a[0];
     perr_ = perr_a[0];
-  } else if (pid_ == 0) {  // Child process
-    popen_internal::close_pipefd(pin_a[1]);
-    popen_internal::replace_fd(0, pin_a[0]);
-
-    if (out_mode == Popen::PIPE) {
-      popen_internal::close_pipefd(pout_a[0]);
-      popen_internal::replace_fd(1, pout_a[1]);
-    }
-
-    if (err_mode == Popen::PIPE) {
-      popen_internal::close_pipefd(perr_a[0]);
-      popen_internal::replace_fd(2, perr_a[1]);
-    }
-
-    // parse cmd to char** argv.
-    const char **argv = static_cast<const char**>(
-        alloca((cmd_.size() + 1) * sizeof(char*)));
-    argv[cmd_.size()] = NULL;
-    for (size_t i = 0; i < cmd_.size(); ++i) {
-      argv[i] = cmd_[i].c_str();
-    }
-
-    // parse cmd to char** argv.
-    execvp(cmd_[0].c_str(), const_cast<char**>(argv));
-    exit(1);  // If execvp fails.
+    // Opened before the process is reaped, so the pid can not be reused.
+    pidfd_ = popen_internal::open_pidfd(pid_);
+    has_deadline_ = options.timeout_ms > 0;
+    deadline_ = Clock::now() + chrono::milliseconds(options.timeout_ms);
+    kill_grace_ms_ = options.kill_grace_ms;
   } else {
-    // Fork error.
+    // Spawn or fork error.
     popen_internal::close_pipe(pin_a);
     popen_internal::close_pipe(pout_a);
     popen_internal::close_pipe(perr_a);
@@ -95,6 +504,7 @@ Popen::~Popen() {
 int Popen::wait() {
   if (pid_ == 0) return status_;
   if (pid_ < 0) return -1;
+  SFU_TRACE_SCOPE("Popen::wait");
 
   popen_internal::close_pipefd(pin_);
   popen_internal::close_pipefd(pout_);
@@ -102,65 +512,305 @@ int Popen::wait() {
 
   pin_ = pout_ = perr_ = 0;
 
-  if (waitpid(pid_, &status_, 0) < 0) {
+  if (has_deadline_ && !WaitUntil(deadline_)) {
+    timed_out_ = true;
+    return terminate(kill_grace_ms_);
+  }
+  if (pid_ > 0) Reap(0);
+  return status_;
+}
+
+bool Popen::try_wait() {
+  if (pid_ <= 0) return true;
+  return Reap(WNOHANG);
+}
+
+bool Popen::wait_for(int timeout_ms) {
+  return WaitUntil(Clock::now() + chrono::milliseconds(timeout_ms));
+}
+
+int Popen::terminate(int grace_ms) {
+  if (pid_ <= 0) return wait();
+  kill(pid_, SIGTERM);
+  if (!wait_for(grace_ms)) {
+    kill(pid_, SIGKILL);
+    Reap(0);
+  }
+  return status_;
+}
+
+bool Popen::Reap(int flags) {
+  struct rusage usage;
+  int ret;
+  do {
+    ret = wait4(pid_, &status_, flags, &usage);
+  } while (ret < 0 && errno == EINTR);
+  if (ret == 0) return false;
+  if (ret < 0) {
     // something failed???
-    pid_ = 0;
-    return -1;
+    status_ = -1;
+  } else {
+    usage_.user_us = popen_internal::to_us(usage.ru_utime);
+    usage_.system_us = popen_internal::to_us(usage.ru_stime);
+    usage_.max_rss_kb = usage.ru_maxrss;
   }
+
+  popen_internal::close_pipefd(pin_);
+  popen_internal::close_pipefd(pout_);
+  popen_internal::close_pipefd(perr_);
+  pin_ = pout_ = perr_ = 0;
+  if (pidfd_ >= 0) close(pidfd_);
+  pidfd_ = -1;
   pid_ = 0;
-  return status_;
+  return true;
+}
+
+bool Popen::WaitUntil(Clock::time_point deadline) {
+  // Without a pidfd, check back with a growing interval.
+  int backoff_ms = 1;
+  for (;;) {
+    if (pid_ <= 0 || Reap(WNOHANG)) return true;
+    int left_ms = popen_internal::ms_until(deadline);
+    if (left_ms == 0) return false;
+    if (pidfd_ >= 0) {
+      struct pollfd fd;
+      fd.fd = pidfd_;
+      fd.events = POLLIN;
+      poll(&fd, 1, left_ms);
+    } else {
+      usleep(1000 * min(left_ms, backoff_ms));
+      backoff_ms = min(2 * backoff_ms, 50);
+    }
+  }
+}
+
+void Popen::close_in() {
+  popen_internal::close_pipefd(pin_);
+  pin_ = -1;
+}
+
+bool Popen::communicate(const strings::cord& in,
+                        std::string* out,
+                        std::string* err) {
+  return communicate_internal(in, out, -1, err);
+}
+
+bool Popen::communicate(const strings::cord& in,
+                        int out_fd,
+                        std::string* err) {
+  return communicate_internal(in, NULL, out_fd, err);
+}
+
+bool Popen::communicate_internal(const strings::cord& in,
+                                 std::string* out,
+                                 int out_fd,
+                                 std::string* err) {
+  if (pid_ <= 0) return false;
+  SFU_TRACE_SCOPE("Popen::communicate");
+
+  bool timed_out = false;
+  bool ok = popen_internal::pump(in, &pin_, &pout_, out, out_fd, &perr_, err,
+                                 has_deadline_ ? &deadline_ : NULL,
+                                 &timed_out);
+  if (timed_out) {
+    // Output read so far is kept.
+    timed_out_ = true;
+    terminate(kill_grace_ms_);
+  }
+  return ok;
 }
 
 int Popen::run(const std::vector<std::string> cmd,
                std::string *out,
                std::string *err) {
-  char buffer[256] = {0, };
-  size_t p = 0;
+  Popen popen(cmd, Popen::PIPE, Popen::PIPE);
+  if (popen.pid() <= 0) {
+    return -1;
+  }
+  // Reading the output buffer, even if no output is needed from the command
+  // may ensure that it completes instead of running out of write buffer, and
+  // halting that way.
+  popen.communicate(strings::cord(), out, err);
+  return popen.wait();
+}
 
+int Popen::run(const std::vector<std::string>& cmd,
+               const strings::cord& in,
+               std::string *out,
+               std::string *err) {
   Popen popen(cmd, Popen::PIPE, Popen::PIPE);
   if (popen.pid() <= 0) {
     return -1;
   }
+  popen.communicate(in, out, err);
+  return popen.wait();
+}
 
-  fd_set fs;
-  bool outend = false;
-  bool errend = false;
+int Popen::run(const std::vector<std::string>& cmd,
+               const strings::cord& in,
+               int out_fd,
+               std::string *err) {
+  Popen popen(cmd, Popen::PIPE, Popen::PIPE);
+  if (popen.pid() <= 0) {
+    return -1;
+  }
+  popen.communicate(in, out_fd, err);
+  return popen.wait();
+}
+
+int Popen::run(const std::vector<std::string>& cmd,
+               const Options& options,
+               const strings::cord& in,
+               std::string *out,
+               std::string *err,
+               Usage *usage) {
+  Options piped = options;
+  piped.out_mode = Popen::PIPE;
+  piped.err_mode = Popen::PIPE;
+  Popen popen(cmd, piped);
+  if (popen.pid() <= 0) {
+    return -1;
+  }
+  popen.communicate(in, out, err);
+  int status = popen.wait();
+  if (usage != NULL) *usage = popen.usage();
+  return status;
+}
 
-  FD_ZERO(&fs);
-  FD_SET(popen.pout(), &fs);
-  FD_SET(popen.perr(), &fs);
-  int max_fd = std::max(popen.pout(), popen.perr());
+struct Pipeline::Stage {
+  vector<string> cmd;
+  Popen::Options options;
+  // Declared after cmd, which it refers to.
+  unique_ptr<Popen> popen;
+};
 
-  // Reading the output buffer, even if no output is needed from the command
-  // may ensure that it completes instead of running out of write buffer, and
-  // halting that way.
-  while (select(max_fd + 1, &fs, NULL, NULL, NULL) > 0) {
-    if (FD_ISSET(popen.pout(), &fs)) {
-      p = read(popen.pout(), buffer, 255);
-      if (p <= 0) {
-        FD_CLR(popen.pout(), &fs);
-        outend = true;
-      } else if (out != NULL) {
-        out->append(buffer, p);
-      }
+Pipeline::Pipeline()
+    : pin_(-1), pout_(-1), perr_(-1), has_deadline_(false),
+      timed_out_(false) {}
+
+Pipeline::~Pipeline() {
+  wait();
+}
+
+void Pipeline::Add(const vector<string>& cmd, const Popen::Options& options) {
+  unique_ptr<Stage> stage(new Stage());
+  stage->cmd = cmd;
+  stage->options = options;
+  stages_.push_back(std::move(stage));
+}
+
+bool Pipeline::Start(Popen::OutputMode out_mode, Popen::OutputMode err_mode) {
+  if (stages_.empty() || stages_.front()->popen) return false;
+
+  int pin_a[2] = {-1, -1};
+  int pout_a[2] = {-1, -1};
+  int perr_a[2] = {-1, -1};
+  if (pipe2(pin_a, O_CLOEXEC) < 0 ||
+      (out_mode == Popen::PIPE && pipe2(pout_a, O_CLOEXEC) < 0) ||
+      (err_mode == Popen::PIPE && pipe2(perr_a, O_CLOEXEC) < 0)) {
+    popen_internal::close_pipe(pin_a);
+    popen_internal::close_pipe(pout_a);
+    popen_internal::close_pipe(perr_a);
+    return false;
+  }
+
+  // Each process gets the read end of the pipe from the one before it. This
+  // process closes its copies of the ends as soon as they are passed on, so
+  // each pipe is only held open by the two processes using it.
+  bool ok = true;
+  int next_in = pin_a[0];
+  for (size_t i = 0; i < stages_.size(); ++i) {
+    Stage& stage = *stages_[i];
+    const bool last = i + 1 == stages_.size();
+    int link[2] = {-1, -1};
+    if (!last && pipe2(link, O_CLOEXEC) < 0) {
+      ok = false;
+      break;
     }
-    if (FD_ISSET(popen.perr(), &fs)) {
-      p = read(popen.perr(), buffer, 255);
-      if (p <= 0) {
-        FD_CLR(popen.perr(), &fs);
-        errend = true;
-      } else if (err != NULL) {
-        err->append(buffer, p);
-      }
+
+    Popen::Options options = stage.options;
+    options.out_mode = Popen::TIE;
+    options.err_mode = Popen::TIE;
+    options.in_fd = next_in;
+    options.out_fd = last ? pout_a[1] : link[1];
+    options.err_fd = perr_a[1];
+    stage.popen.reset(new Popen(stage.cmd, options));
+    if (stage.popen->pid() <= 0) ok = false;
+    if (options.timeout_ms > 0) {
+      chrono::steady_clock::time_point deadline =
+          chrono::steady_clock::now() +
+          chrono::milliseconds(options.timeout_ms);
+      if (!has_deadline_ || deadline < deadline_) deadline_ = deadline;
+      has_deadline_ = true;
     }
 
-    if (outend && errend) break;
+    popen_internal::close_pipefd(next_in);
+    popen_internal::close_pipefd(link[1]);
+    next_in = link[0];
+  }
+  popen_internal::close_pipefd(next_in);
+  popen_internal::close_pipefd(pout_a[1]);
+  popen_internal::close_pipefd(perr_a[1]);
+
+  pin_ = pin_a[1];
+  pout_ = pout_a[0];
+  perr_ = perr_a[0];
+  return ok;
+}
+
+bool Pipeline::communicate(const strings::cord& in,
+                           std::string* out,
+                           std::string* err) {
+  bool timed_out = false;
+  bool ok = popen_internal::pump(in, &pin_, &pout_, out, -1, &perr_, err,
+                                 has_deadline_ ? &deadline_ : NULL,
+                                 &timed_out);
+  if (timed_out) Terminate();
+  return ok;
+}
+
+bool Pipeline::communicate(const strings::cord& in,
+                           int out_fd,
+                           std::string* err) {
+  bool timed_out = false;
+  bool ok = popen_internal::pump(in, &pin_, &pout_, NULL, out_fd, &perr_, err,
+                                 has_deadline_ ? &deadline_ : NULL,
+                                 &timed_out);
+  if (timed_out) Terminate();
+  return ok;
+}
 
-    if (!outend) FD_SET(popen.pout(), &fs);
-    if (!errend) FD_SET(popen.perr(), &fs);
+int Pipeline::wait() {
+  popen_internal::close_pipefd(pin_);
+  popen_internal::close_pipefd(pout_);
+  popen_internal::close_pipefd(perr_);
+  pin_ = pout_ = perr_ = -1;
+
+  statuses_.clear();
+  for (const unique_ptr<Stage>& stage : stages_) {
+    statuses_.push_back(stage->popen ? stage->popen->wait() : -1);
   }
+  return statuses_.empty() ? -1 : statuses_.back();
+}
 
-  return popen.wait();
+int Pipeline::run(const strings::cord& in,
+                  std::string *out,
+                  std::string *err) {
+  if (!Start(Popen::PIPE, Popen::PIPE)) {
+    // Reap the processes that did start.
+    wait();
+    return -1;
+  }
+  communicate(in, out, err);
+  return wait();
+}
+
+void Pipeline::Terminate() {
+  // Output read so far is kept.
+  timed_out_ = true;
+  for (const unique_ptr<Stage>& stage : stages_) {
+    if (stage->popen) stage->popen->terminate(stage->options.kill_grace_ms);
+  }
 }
 
 }  // namespace sfu
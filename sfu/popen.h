@@ -1,9 +1,14 @@
 #ifndef SFU_POPEN_H_
 #define SFU_POPEN_H_
 
+#include <chrono>
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "sfu/strings/cord.h"
+
 namespace sfu {
 
 class Popen {
@@ -13,17 +18,117 @@ class Popen {
       PIPE
     } OutputMode;
 
+    // A limit set with setrlimit() in the process, e.g. RLIMIT_AS or
+    // RLIMIT_CPU from <sys/resource.h>.
+    struct ResourceLimit {
+      ResourceLimit(int resource, uint64_t limit);
+      ResourceLimit(int resource, uint64_t soft, uint64_t hard);
+
+      int resource;
+      uint64_t soft;
+      uint64_t hard;
+    };
+
+    // Resources used by the process, from wait4().
+    struct Usage {
+      Usage();
+
+      // CPU time spent in user and kernel mode, in microseconds.
+      int64_t user_us;
+      int64_t system_us;
+      // Largest resident set size, in kilobytes.
+      int64_t max_rss_kb;
+    };
+
+    struct Options {
+      Options();
+
+      OutputMode out_mode;
+      OutputMode err_mode;
+      // Changes to the environment: "NAME=value" sets a variable, and "NAME"
+      // removes it.
+      std::vector<std::string> env;
+      // Start from an empty environment instead of this process' one.
+      bool clear_env;
+      // Working directory of the process, if not empty.
+      std::string cwd;
+      // Close all file descriptors but stdin, stdout and stderr in the
+      // process, also those inherited without close-on-exec.
+      bool close_fds;
+      // Use these as stdin, stdout and stderr of the process instead of
+      // pipes or the ones of this process, if not -1. The fds are not closed,
+      // and the corresponding pin(), pout() or perr() is -1.
+      int in_fd;
+      int out_fd;
+      int err_fd;
+      // Stop the process if it runs for longer than this many milliseconds
+      // after it is started, 0 for no limit. Honored by communicate(),
+      // wait() and run(), which terminate() the process at the deadline.
+      int timeout_ms;
+      // How long terminate() gives the process to exit after SIGTERM, before
+      // it is killed with SIGKILL.
+      int kill_grace_ms;
+      // Resource limits of the process.
+      std::vector<ResourceLimit> limits;
+      // A cgroup v2 directory to start the process in, e.g.
+      // "/sys/fs/cgroup/helpers". Must be writable by this process.
+      std::string cgroup;
+    };
+
+    // The process is started with posix_spawn, which does not copy this
+    // process' page tables, and falls back to fork() where it can not handle
+    // the options. If the process could not be started, e.g. the command does
+    // not exist, pid() is -1. Resource limits and cgroups are only handled by
+    // fork().
     Popen(const std::vector<std::string>& cmd,
         OutputMode out_mode = TIE,
         OutputMode err_mode = TIE);
+    Popen(const std::vector<std::string>& cmd, const Options& options);
     ~Popen();
 
     inline int pid() { return pid_; }
     inline int pin() { return pin_; }
     inline int pout() { return pout_; }
     inline int perr() { return perr_; }
+    // A pidfd for the process, which polls readable when it exits, or -1
+    // where pidfds are not supported.
+    inline int pidfd() { return pidfd_; }
 
     int wait();
+    // Check if the process has exited without blocking. If it has, the pipes
+    // are closed and wait() gives the status right away.
+    bool try_wait();
+    // Wait at most timeout_ms for the process to exit, as try_wait().
+    bool wait_for(int timeout_ms);
+    // Ask the process to stop with SIGTERM, and kill it with SIGKILL if it
+    // has not exited after grace_ms. Returns the status as wait().
+    int terminate(int grace_ms);
+    // Close stdin of the process, so it sees the end of input.
+    void close_in();
+
+    // Write in to the process' stdin, and read stdout and stderr (when
+    // PIPE'd) until the process closes them. Output that is not PIPE'd, or
+    // given a NULL string, is discarded. stdin is closed when all input is
+    // written, so the process sees the end of input. Returns false on I/O
+    // errors.
+    //
+    // All pipes are multiplexed with poll() and read 64KB at a time directly
+    // into the output strings.
+    bool communicate(const strings::cord& in,
+                     std::string* out,
+                     std::string* err);
+    // Same, but stdout is moved to out_fd with splice(), so the output never
+    // passes through this process' memory. Falls back to read() and write()
+    // where splice() is not supported for out_fd.
+    bool communicate(const strings::cord& in,
+                     int out_fd,
+                     std::string* err);
+
+    // True if the process was stopped because of the timeout in Options.
+    inline bool timed_out() const { return timed_out_; }
+    // Resources used by the process, set once it has exited and wait() or
+    // try_wait() has seen it.
+    inline const Usage& usage() const { return usage_; }
 
     // Convenience method that fills two strings with the output of stdout and
     // stderr from the process. Expects input-less commands, and will never
@@ -31,8 +136,38 @@ class Popen {
     static int run(const std::vector<std::string> cmd,
                    std::string *out = NULL,
                    std::string *err = NULL);
+    // Run with in as the stdin of the process.
+    static int run(const std::vector<std::string>& cmd,
+                   const strings::cord& in,
+                   std::string *out,
+                   std::string *err = NULL);
+    // Run with the stdout of the process written to out_fd.
+    static int run(const std::vector<std::string>& cmd,
+                   const strings::cord& in,
+                   int out_fd,
+                   std::string *err = NULL);
+    // Run with options, e.g. a timeout or resource limits. Output is PIPE'd
+    // whatever the output modes of options are. If usage is not NULL, it is
+    // set to the resources used by the process.
+    static int run(const std::vector<std::string>& cmd,
+                   const Options& options,
+                   const strings::cord& in,
+                   std::string *out,
+                   std::string *err = NULL,
+                   Usage *usage = NULL);
 
   private:
+    typedef std::chrono::steady_clock Clock;
+
+    void Start(const Options& options);
+    // Reap the process with wait4() with the given flags. Returns true if it
+    // has exited, and then closes the pipes.
+    bool Reap(int flags);
+    // Wait for the process to exit until deadline. Returns true if it has.
+    bool WaitUntil(Clock::time_point deadline);
+    bool communicate_internal(const strings::cord& in, std::string* out,
+                              int out_fd, std::string* err);
+
     int pid_;
     int status_;
     const std::vector<std::string>& cmd_;
@@ -40,6 +175,89 @@ class Popen {
     int pin_;   // pipe tied to 'stdin' in subprocess.
     int pout_;  // pipe tied to 'stdout'.
     int perr_;  // pipe tied to 'stderr'.
+    int pidfd_;
+
+    bool has_deadline_;
+    Clock::time_point deadline_;
+    int kill_grace_ms_;
+    bool timed_out_;
+    Usage usage_;
+};
+
+// Runs a pipeline of commands, like "cmd1 | cmd2 | cmd3" in a shell but
+// without one. The stdout of each process is tied directly to the stdin of
+// the next with a pipe, so data between them never passes through this
+// process:
+//
+// Pipeline pipeline;
+// pipeline.Add({"zcat", path});
+// pipeline.Add({"sort"});
+// std::string out;
+// int status = pipeline.run(strings::cord(), &out);
+class Pipeline {
+  public:
+    Pipeline();
+    ~Pipeline();
+
+    // Add a process to the end of the pipeline. The output modes, and the
+    // in_fd, out_fd and err_fd of options are not used. When the earliest
+    // timeout_ms of all processes passes in communicate(), all are stopped.
+    void Add(const std::vector<std::string>& cmd,
+             const Popen::Options& options = Popen::Options());
+    inline size_t size() const { return stages_.size(); }
+
+    // Start all processes. stdin of the first process is pin(), stdout of
+    // the last is pout() if PIPE'd, and stderr of all processes goes to
+    // perr() if PIPE'd. Returns false if any process could not be started,
+    // and the others then see their input or output closed.
+    bool Start(Popen::OutputMode out_mode = Popen::TIE,
+               Popen::OutputMode err_mode = Popen::TIE);
+
+    inline int pin() { return pin_; }
+    inline int pout() { return pout_; }
+    inline int perr() { return perr_; }
+
+    // As Popen::communicate(), for the ends of the pipeline.
+    bool communicate(const strings::cord& in,
+                     std::string* out,
+                     std::string* err);
+    bool communicate(const strings::cord& in,
+                     int out_fd,
+                     std::string* err);
+
+    // Wait for all processes to exit. Returns the status of the last, as a
+    // shell does.
+    int wait();
+    // True if the processes were stopped because of a timeout in Options.
+    inline bool timed_out() const { return timed_out_; }
+    // The status of each process, as from Popen::wait(), when waited for.
+    inline const std::vector<int>& statuses() const { return statuses_; }
+
+    // Start the pipeline with in as its input, read the output of the last
+    // process into out, and stderr of all into err, and wait for it. Returns
+    // the status of the last process, or -1 if any could not be started.
+    int run(const strings::cord& in,
+            std::string *out,
+            std::string *err = NULL);
+
+  private:
+    struct Stage;
+
+    // Stop all processes, after the deadline has passed.
+    void Terminate();
+
+    std::vector<std::unique_ptr<Stage>> stages_;
+    std::vector<int> statuses_;
+    int pin_;
+    int pout_;
+    int perr_;
+
+    bool has_deadline_;
+    std::chrono::steady_clock::time_point deadline_;
+    bool timed_out_;
+
+    Pipeline(const Pipeline&);
+    Pipeline& operator=(const Pipeline&);
 };
 
 }  // namespace sfu
@@ -1,3 +1,11 @@
+#include <fcntl.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
 
 #include "sfu/popen.h"
 #include "gtest/gtest.h"
@@ -70,3 +78,375 @@ TEST(PopenTest, TestPopenRun) {
   EXPECT_EQ(out.size(), 0);
   EXPECT_GT(err.size(), 40);
 }
+
+TEST(PopenTest, TestPopenRunWithInput) {
+  // Larger than the pipe buffers, so input and output must be interleaved.
+  string in;
+  for (int i = 0; i < 100000; ++i) {
+    in += "line " + to_string(i) + "\n";
+  }
+
+  vector<string> cmd;
+  cmd.push_back("cat");
+  string out, err;
+  EXPECT_EQ(0, Popen::run(cmd, in, &out, &err));
+  EXPECT_EQ(in, out);
+  EXPECT_EQ("", err);
+
+  // Exits without reading the input.
+  cmd[0] = "true";
+  EXPECT_EQ(0, Popen::run(cmd, in, &out, &err));
+}
+
+TEST(PopenTest, TestPopenRunLargeOutput) {
+  vector<string> cmd;
+  cmd.push_back("head");
+  cmd.push_back("-c");
+  cmd.push_back("5000000");
+  cmd.push_back("/dev/zero");
+
+  string out;
+  EXPECT_EQ(0, Popen::run(cmd, &out));
+  EXPECT_EQ(5000000UL, out.size());
+  EXPECT_EQ(string(5000000, '\0'), out);
+
+  // The output is discarded, but still read.
+  EXPECT_EQ(0, Popen::run(cmd));
+}
+
+TEST(PopenTest, TestPopenRunToFd) {
+  char path[] = "/tmp/popen_test.XXXXXX";
+  int fd = mkstemp(path);
+  ASSERT_LE(0, fd);
+
+  vector<string> cmd;
+  cmd.push_back("tr");
+  cmd.push_back("a-z");
+  cmd.push_back("A-Z");
+  EXPECT_EQ(0, Popen::run(cmd, "spliced output\n", fd));
+
+  char buffer[64] = {0, };
+  EXPECT_EQ(15, pread(fd, buffer, sizeof(buffer), 0));
+  EXPECT_EQ(string("SPLICED OUTPUT\n"), buffer);
+  close(fd);
+
+  // Appending files does not support splice on all kernels.
+  fd = open(path, O_WRONLY | O_APPEND);
+  ASSERT_LE(0, fd);
+  EXPECT_EQ(0, Popen::run(cmd, "more\n", fd));
+  close(fd);
+
+  fd = open(path, O_RDONLY);
+  EXPECT_EQ(20, read(fd, buffer, sizeof(buffer)));
+  EXPECT_EQ(string("SPLICED OUTPUT\nMORE\n"), string(buffer, 20));
+  close(fd);
+  unlink(path);
+}
+
+TEST(PopenTest, TestPopenOptions) {
+  setenv("SFU_POPEN_TEST_A", "a", 1);
+  setenv("SFU_POPEN_TEST_B", "b", 1);
+
+  vector<string> cmd;
+  cmd.push_back("sh");
+  cmd.push_back("-c");
+  cmd.push_back(
+      "echo \"$SFU_POPEN_TEST_A,$SFU_POPEN_TEST_B,$SFU_POPEN_TEST_C\"; pwd");
+
+  Popen::Options options;
+  options.out_mode = Popen::PIPE;
+  options.env.push_back("SFU_POPEN_TEST_B");
+  options.env.push_back("SFU_POPEN_TEST_C=c");
+  options.cwd = "/tmp";
+
+  Popen popen(cmd, options);
+  string out;
+  EXPECT_TRUE(popen.communicate("", &out, NULL));
+  EXPECT_EQ(0, popen.wait());
+  EXPECT_EQ("a,,c\n/tmp\n", out);
+
+  options.clear_env = true;
+  options.env.clear();
+  options.env.push_back("PATH=/bin:/usr/bin");
+  Popen popen2(cmd, options);
+  out.clear();
+  EXPECT_TRUE(popen2.communicate("", &out, NULL));
+  EXPECT_EQ(0, popen2.wait());
+  EXPECT_EQ(",,\n/tmp\n", out);
+
+  unsetenv("SFU_POPEN_TEST_A");
+  unsetenv("SFU_POPEN_TEST_B");
+}
+
+TEST(PopenTest, TestPopenCloseFds) {
+  // Opened without close-on-exec.
+  int fd = open("/dev/null", O_WRONLY);
+  ASSERT_LT(2, fd);
+
+  vector<string> cmd;
+  cmd.push_back("sh");
+  cmd.push_back("-c");
+  cmd.push_back("echo test 2>/dev/null >&" + to_string(fd));
+
+  Popen::Options options;
+  Popen closed(cmd, options);
+  EXPECT_NE(0, closed.wait());
+
+  options.close_fds = false;
+  Popen inherited(cmd, options);
+  EXPECT_EQ(0, inherited.wait());
+  close(fd);
+}
+
+TEST(PopenTest, TestPopenNoSuchCommand) {
+  vector<string> cmd;
+  cmd.push_back("/no/such/command");
+  Popen popen(cmd);
+  EXPECT_EQ(-1, popen.pid());
+  EXPECT_EQ(-1, popen.wait());
+  EXPECT_EQ(-1, Popen::run(cmd));
+}
+
+TEST(PopenTest, TestPopenWaitFor) {
+  vector<string> cmd;
+  cmd.push_back("sleep");
+  cmd.push_back("0.2");
+  Popen popen(cmd);
+  EXPECT_FALSE(popen.wait_for(10));
+  EXPECT_GT(popen.pid(), 0);
+  EXPECT_TRUE(popen.wait_for(5000));
+  EXPECT_EQ(0, popen.pid());
+  EXPECT_EQ(0, popen.wait());
+}
+
+TEST(PopenTest, TestPopenTerminate) {
+  vector<string> cmd;
+  cmd.push_back("sleep");
+  cmd.push_back("10");
+  Popen popen(cmd);
+  int status = popen.terminate(1000);
+  EXPECT_TRUE(WIFSIGNALED(status));
+  EXPECT_EQ(SIGTERM, WTERMSIG(status));
+
+  // Ignores SIGTERM, so is killed after the grace period.
+  vector<string> stubborn;
+  stubborn.push_back("sh");
+  stubborn.push_back("-c");
+  stubborn.push_back("trap '' TERM; exec sleep 10");
+  Popen popen2(stubborn);
+  // Let the shell set up the trap first.
+  EXPECT_FALSE(popen2.wait_for(100));
+  status = popen2.terminate(100);
+  EXPECT_TRUE(WIFSIGNALED(status));
+  EXPECT_EQ(SIGKILL, WTERMSIG(status));
+}
+
+TEST(PopenTest, TestPopenTimeout) {
+  vector<string> cmd;
+  cmd.push_back("sh");
+  cmd.push_back("-c");
+  cmd.push_back("echo started; exec sleep 10");
+
+  Popen::Options options;
+  options.timeout_ms = 200;
+  string out;
+  auto start = chrono::steady_clock::now();
+  int status = Popen::run(cmd, options, strings::cord(), &out);
+  EXPECT_LT(chrono::steady_clock::now() - start, chrono::seconds(5));
+  EXPECT_TRUE(WIFSIGNALED(status));
+  EXPECT_EQ("started\n", out);
+
+  // Also when only waiting.
+  Popen popen(cmd, options);
+  EXPECT_FALSE(popen.timed_out());
+  EXPECT_TRUE(WIFSIGNALED(popen.wait()));
+  EXPECT_TRUE(popen.timed_out());
+
+  cmd.back() = "echo done";
+  out.clear();
+  EXPECT_EQ(0, Popen::run(cmd, options, strings::cord(), &out));
+  EXPECT_EQ("done\n", out);
+}
+
+TEST(PopenTest, TestPopenLimits) {
+  vector<string> cmd;
+  cmd.push_back("sh");
+  cmd.push_back("-c");
+  cmd.push_back("ulimit -n");
+
+  Popen::Options options;
+  options.limits.push_back(Popen::ResourceLimit(RLIMIT_NOFILE, 42));
+  string out;
+  EXPECT_EQ(0, Popen::run(cmd, options, strings::cord(), &out));
+  EXPECT_EQ("42\n", out);
+
+  options.cgroup = "/no/such/cgroup";
+  Popen popen(cmd, options);
+  EXPECT_EQ(-1, popen.pid());
+}
+
+TEST(PopenTest, TestPopenUsage) {
+  vector<string> cmd;
+  cmd.push_back("sh");
+  cmd.push_back("-c");
+  cmd.push_back("i=0; while [ $i -lt 100000 ]; do i=$((i+1)); done");
+
+  Popen::Usage usage;
+  EXPECT_EQ(0, Popen::run(cmd, Popen::Options(), strings::cord(), NULL, NULL,
+                          &usage));
+  EXPECT_LT(0, usage.user_us + usage.system_us);
+  EXPECT_LT(0, usage.max_rss_kb);
+}
+
+TEST(PopenTest, TestPipeline) {
+  vector<string> cmd;
+  cmd.push_back("printf");
+  cmd.push_back("b\\na\\nc\\na\\n");
+  Pipeline pipeline;
+  pipeline.Add(cmd);
+  cmd.clear();
+  cmd.push_back("sort");
+  pipeline.Add(cmd);
+  cmd.clear();
+  cmd.push_back("uniq");
+  pipeline.Add(cmd);
+  EXPECT_EQ(3u, pipeline.size());
+
+  string out;
+  EXPECT_EQ(0, pipeline.run(strings::cord(), &out));
+  EXPECT_EQ("a\nb\nc\n", out);
+  ASSERT_EQ(3u, pipeline.statuses().size());
+  EXPECT_EQ(0, pipeline.statuses()[0]);
+  EXPECT_EQ(0, pipeline.statuses()[1]);
+  EXPECT_EQ(0, pipeline.statuses()[2]);
+}
+
+TEST(PopenTest, TestPipelineWithInput) {
+  // Larger than the pipe buffers, so all processes must run concurrently.
+  string in;
+  for (int i = 0; i < 100000; ++i) {
+    in.append(to_string(i));
+    in.push_back('\n');
+  }
+
+  vector<string> cmd;
+  cmd.push_back("cat");
+  Pipeline pipeline;
+  pipeline.Add(cmd);
+  cmd.clear();
+  cmd.push_back("grep");
+  cmd.push_back("7");
+  pipeline.Add(cmd);
+  cmd.clear();
+  cmd.push_back("wc");
+  cmd.push_back("-l");
+  pipeline.Add(cmd);
+
+  string out;
+  EXPECT_EQ(0, pipeline.run(strings::cord(in), &out));
+  EXPECT_EQ("40951\n", out);
+}
+
+TEST(PopenTest, TestPipelineStatuses) {
+  vector<string> cmd;
+  cmd.push_back("sh");
+  cmd.push_back("-c");
+  cmd.push_back("echo one; echo two >&2; exit 3");
+  Pipeline pipeline;
+  pipeline.Add(cmd);
+  cmd.pop_back();
+  cmd.push_back("cat; echo three >&2");
+  pipeline.Add(cmd);
+
+  string out;
+  string err;
+  EXPECT_EQ(0, pipeline.run(strings::cord(), &out, &err));
+  EXPECT_EQ("one\n", out);
+  EXPECT_EQ("two\nthree\n", err);
+  ASSERT_EQ(2u, pipeline.statuses().size());
+  EXPECT_TRUE(WIFEXITED(pipeline.statuses()[0]));
+  EXPECT_EQ(3, WEXITSTATUS(pipeline.statuses()[0]));
+  EXPECT_EQ(0, pipeline.statuses()[1]);
+}
+
+TEST(PopenTest, TestPipelineNoSuchCommand) {
+  vector<string> cmd;
+  cmd.push_back("echo");
+  cmd.push_back("test");
+  Pipeline pipeline;
+  pipeline.Add(cmd);
+  cmd.clear();
+  cmd.push_back("/no/such/command");
+  pipeline.Add(cmd);
+  cmd.clear();
+  cmd.push_back("cat");
+  pipeline.Add(cmd);
+  EXPECT_FALSE(pipeline.Start(Popen::PIPE));
+
+  string out;
+  EXPECT_TRUE(pipeline.communicate(strings::cord(), &out, NULL));
+  EXPECT_EQ(0, pipeline.wait());
+  EXPECT_EQ("", out);
+  EXPECT_EQ(-1, pipeline.statuses()[1]);
+
+  // run() fails, but waits for the processes that did start.
+  Pipeline failed;
+  failed.Add(cmd);
+  cmd.clear();
+  cmd.push_back("/no/such/command");
+  failed.Add(cmd);
+  EXPECT_EQ(-1, failed.run(strings::cord(), &out));
+  ASSERT_EQ(2u, failed.statuses().size());
+  EXPECT_EQ(0, failed.statuses()[0]);
+  EXPECT_EQ(-1, failed.statuses()[1]);
+}
+
+TEST(PopenTest, TestPipelineTimeout) {
+  vector<string> cmd;
+  cmd.push_back("sleep");
+  cmd.push_back("3");
+  Popen::Options options;
+  options.timeout_ms = 200;
+  Pipeline pipeline;
+  pipeline.Add(cmd, options);
+  cmd.clear();
+  cmd.push_back("cat");
+  pipeline.Add(cmd);
+
+  auto start = chrono::steady_clock::now();
+  string out;
+  int status = pipeline.run(strings::cord(), &out);
+  EXPECT_LT(chrono::steady_clock::now() - start, chrono::seconds(2));
+  EXPECT_TRUE(pipeline.timed_out());
+  ASSERT_EQ(2u, pipeline.statuses().size());
+  EXPECT_TRUE(WIFSIGNALED(pipeline.statuses()[0]));
+  EXPECT_EQ(SIGTERM, WTERMSIG(pipeline.statuses()[0]));
+  // cat sees the end of its input, and exits.
+  EXPECT_EQ(0, status);
+}
+
+TEST(PopenTest, TestPipelineToFd) {
+  char path[] = "/tmp/sfu_pipeline_test_XXXXXX";
+  int fd = mkstemp(path);
+  ASSERT_LT(0, fd);
+  unlink(path);
+
+  vector<string> cmd;
+  cmd.push_back("echo");
+  cmd.push_back("hello");
+  Pipeline pipeline;
+  pipeline.Add(cmd);
+  cmd.clear();
+  cmd.push_back("tr");
+  cmd.push_back("a-z");
+  cmd.push_back("A-Z");
+  pipeline.Add(cmd);
+  EXPECT_TRUE(pipeline.Start(Popen::PIPE));
+  EXPECT_TRUE(pipeline.communicate(strings::cord(), fd, NULL));
+  EXPECT_EQ(0, pipeline.wait());
+
+  char buffer[16] = {0, };
+  EXPECT_EQ(6, pread(fd, buffer, sizeof(buffer) - 1, 0));
+  EXPECT_STREQ("HELLO\n", buffer);
+  close(fd);
+}
@@ -0,0 +1,312 @@
+#include "sfu/process_pool.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+
+using namespace std;
+
+namespace sfu {
+namespace process_pool_internal {
+
+typedef chrono::steady_clock Clock;
+
+const size_t kReadSize = 64 * 1024;
+// How often to check for exited processes which have closed their output,
+// where there are no pidfds to poll.
+const int kReapIntervalMs = 10;
+
+void set_nonblocking(int fd) {
+  if (fd > 0) fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+}
+
+// Read what is available from fd into out, keeping at most max_output bytes
+// in total if not 0. Returns as read().
+ssize_t read_capped(int fd, string* out, size_t max_output, char* scratch,
+                    bool* truncated) {
+  ssize_t n = read(fd, scratch, kReadSize);
+  if (n > 0) {
+    size_t keep = n;
+    if (max_output > 0) {
+      keep = min(keep, max_output - min(max_output, out->size()));
+      if (keep < static_cast<size_t>(n)) *truncated = true;
+    }
+    out->append(scratch, keep);
+  }
+  return n;
+}
+
+bool is_closed(ssize_t n) {
+  return n == 0 || (n < 0 && errno != EAGAIN && errno != EINTR);
+}
+
+}  // namespace process_pool_internal
+
+using namespace process_pool_internal;
+
+struct ProcessPool::Task {
+  vector<string> cmd;
+  TaskOptions options;
+  Callback done;
+
+  // Declared after cmd, which it refers to.
+  unique_ptr<Popen> popen;
+  Result result;
+  size_t written;
+  bool in_open;
+  bool out_open;
+  bool err_open;
+  bool has_deadline;
+  Clock::time_point deadline;
+
+  bool output_done() const { return !in_open && !out_open && !err_open; }
+};
+
+ProcessPool::TaskOptions::TaskOptions()
+    : timeout_ms(0),
+      max_output(0) {}
+
+ProcessPool::Result::Result()
+    : status(-1),
+      timed_out(false),
+      truncated(false) {}
+
+ProcessPool::ProcessPool(size_t max_running)
+    : max_running_(max_running > 0
+                   ? max_running
+                   : max(1u, thread::hardware_concurrency())),
+      pending_(0),
+      stop_(false) {
+  if (pipe2(wake_, O_CLOEXEC | O_NONBLOCK) < 0) {
+    wake_[0] = wake_[1] = -1;
+  }
+  thread_ = thread(&ProcessPool::Loop, this);
+}
+
+ProcessPool::~ProcessPool() {
+  {
+    lock_guard<mutex> lock(mutex_);
+    stop_ = true;
+  }
+  Wake();
+  thread_.join();
+  close(wake_[0]);
+  close(wake_[1]);
+}
+
+future<ProcessPool::Result> ProcessPool::Submit(const vector<string>& cmd,
+                                                const TaskOptions& options) {
+  shared_ptr<promise<Result>> result(new promise<Result>());
+  Submit(cmd, options, [result](Result r) {
+    result->set_value(std::move(r));
+  });
+  return result->get_future();
+}
+
+void ProcessPool::Submit(const vector<string>& cmd,
+                         const TaskOptions& options,
+                         const Callback& done) {
+  unique_ptr<Task> task(new Task());
+  task->cmd = cmd;
+  task->options = options;
+  task->options.popen.out_mode = Popen::PIPE;
+  task->options.popen.err_mode = Popen::PIPE;
+  task->done = done;
+  {
+    lock_guard<mutex> lock(mutex_);
+    queue_.push_back(std::move(task));
+    ++pending_;
+  }
+  Wake();
+}
+
+void ProcessPool::Wait() {
+  unique_lock<mutex> lock(mutex_);
+  idle_.wait(lock, [this] { return pending_ == 0; });
+}
+
+void ProcessPool::Wake() {
+  char c = 0;
+  if (write(wake_[1], &c, 1)) {}
+}
+
+void ProcessPool::Loop() {
+  // Writing to the stdin of a process that has exited raises SIGPIPE, which
+  // would kill this process. Keep it blocked on this thread instead.
+  sigset_t sigpipe;
+  sigemptyset(&sigpipe);
+  sigaddset(&sigpipe, SIGPIPE);
+  pthread_sigmask(SIG_BLOCK, &sigpipe, NULL);
+
+  unique_ptr<char[]> scratch(new char[kReadSize]);
+  vector<unique_ptr<Task>> running;
+  vector<unique_ptr<Task>> completed;
+  vector<struct pollfd> fds;
+
+  for (;;) {
+    vector<unique_ptr<Task>> started;
+    {
+      lock_guard<mutex> lock(mutex_);
+      while (running.size() + started.size() < max_running_ &&
+             !queue_.empty()) {
+        started.push_back(std::move(queue_.front()));
+        queue_.pop_front();
+      }
+      if (stop_ && queue_.empty() && running.empty() && started.empty()) {
+        break;
+      }
+    }
+
+    for (auto& task : started) {
+      task->popen.reset(new Popen(task->cmd, task->options.popen));
+      if (task->popen->pid() <= 0) {
+        completed.push_back(std::move(task));
+        continue;
+      }
+      task->written = 0;
+      task->in_open = !task->options.input.empty();
+      task->out_open = true;
+      task->err_open = true;
+      if (!task->in_open) task->popen->close_in();
+      set_nonblocking(task->popen->pin());
+      set_nonblocking(task->popen->pout());
+      set_nonblocking(task->popen->perr());
+      task->has_deadline = task->options.timeout_ms > 0;
+      if (task->has_deadline) {
+        task->deadline = Clock::now() +
+            chrono::milliseconds(task->options.timeout_ms);
+      }
+      running.push_back(std::move(task));
+    }
+
+    // Poll the wake pipe and the open pipes of all running processes, until
+    // the next deadline, or a bit while waiting for processes to exit.
+    fds.clear();
+    fds.push_back(pollfd());
+    fds.back().fd = wake_[0];
+    fds.back().events = POLLIN;
+    int timeout_ms = -1;
+    const Clock::time_point now = Clock::now();
+    for (auto& task : running) {
+      Popen& popen = *task->popen;
+      if (task->in_open) {
+        fds.push_back(pollfd());
+        fds.back().fd = popen.pin();
+        fds.back().events = POLLOUT;
+      }
+      if (task->out_open) {
+        fds.push_back(pollfd());
+        fds.back().fd = popen.pout();
+        fds.back().events = POLLIN;
+      }
+      if (task->err_open) {
+        fds.push_back(pollfd());
+        fds.back().fd = popen.perr();
+        fds.back().events = POLLIN;
+      }
+      int wait_ms = -1;
+      if (task->output_done()) {
+        if (popen.pidfd() >= 0) {
+          fds.push_back(pollfd());
+          fds.back().fd = popen.pidfd();
+          fds.back().events = POLLIN;
+        } else {
+          wait_ms = kReapIntervalMs;
+        }
+      }
+      // Also when output is done, as the process may keep running after
+      // closing it.
+      if (task->has_deadline && !task->result.timed_out) {
+        auto left = chrono::duration_cast<chrono::milliseconds>(
+            task->deadline - now).count() + 1;
+        int deadline_ms = static_cast<int>(max<decltype(left)>(0, left));
+        if (wait_ms < 0 || deadline_ms < wait_ms) wait_ms = deadline_ms;
+      }
+      if (wait_ms >= 0 && (timeout_ms < 0 || wait_ms < timeout_ms)) {
+        timeout_ms = wait_ms;
+      }
+    }
+    if (!completed.empty()) timeout_ms = 0;
+
+    if (poll(fds.data(), fds.size(), timeout_ms) < 0 && errno != EINTR) {
+      // Should not happen, but do not spin on it.
+      usleep(kReapIntervalMs * 1000);
+      continue;
+    }
+    if (fds[0].revents) {
+      while (read(wake_[0], scratch.get(), kReadSize) > 0) {}
+    }
+
+    // The fds are in the same order as the tasks and their open pipes.
+    size_t i = 1;
+    for (auto& task : running) {
+      Popen& popen = *task->popen;
+      const TaskOptions& options = task->options;
+      Result& result = task->result;
+      if (task->output_done() && popen.pidfd() >= 0) ++i;
+      if (task->in_open && fds[i++].revents) {
+        ssize_t n = write(popen.pin(),
+                          options.input.data() + task->written,
+                          options.input.size() - task->written);
+        if (n > 0) task->written += n;
+        // A process that exits without reading all input is not an error.
+        if (is_closed(n) || task->written == options.input.size()) {
+          popen.close_in();
+          task->in_open = false;
+        }
+      }
+      if (task->out_open && fds[i++].revents) {
+        ssize_t n = read_capped(popen.pout(), &result.out,
+                                options.max_output, scratch.get(),
+                                &result.truncated);
+        if (is_closed(n)) task->out_open = false;
+      }
+      if (task->err_open && fds[i++].revents) {
+        ssize_t n = read_capped(popen.perr(), &result.err,
+                                options.max_output, scratch.get(),
+                                &result.truncated);
+        if (is_closed(n)) task->err_open = false;
+      }
+    }
+
+    const Clock::time_point after = Clock::now();
+    for (auto& task : running) {
+      if (task->has_deadline && !task->result.timed_out &&
+          after >= task->deadline) {
+        // Only a process that is still running is timed out. Output may be
+        // held open by children of the process, so stop reading it either
+        // way.
+        if (!task->popen->try_wait()) {
+          kill(task->popen->pid(), SIGKILL);
+          task->result.timed_out = true;
+        }
+        task->in_open = task->out_open = task->err_open = false;
+      }
+      if (task->output_done() && task->popen->try_wait()) {
+        task->result.status = task->popen->wait();
+        task->result.usage = task->popen->usage();
+        completed.push_back(std::move(task));
+      }
+    }
+    running.erase(remove(running.begin(), running.end(), nullptr),
+                  running.end());
+
+    for (auto& task : completed) {
+      task->done(std::move(task->result));
+    }
+    if (!completed.empty()) {
+      lock_guard<mutex> lock(mutex_);
+      pending_ -= completed.size();
+      if (pending_ == 0) idle_.notify_all();
+    }
+    completed.clear();
+  }
+}
+
+}  // namespace sfu
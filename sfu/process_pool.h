@@ -0,0 +1,112 @@
+#ifndef SFU_PROCESS_POOL_H_
+#define SFU_PROCESS_POOL_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sfu/popen.h"
+
+namespace sfu {
+
+// Runs external commands, up to max_running at a time, and collects their
+// output:
+//
+// ProcessPool pool;
+// std::vector<std::future<ProcessPool::Result>> results;
+// for (const auto& zone : zones) {
+//   results.push_back(pool.Submit({"zdump", "-v", zone}));
+// }
+// for (auto& result : results) { ... result.get().out ... }
+//
+// A single background thread starts the processes, and multiplexes the pipes
+// of all running processes with poll(), so there is no thread per process.
+class ProcessPool {
+  public:
+    struct TaskOptions {
+      TaskOptions();
+
+      // How to start the process. Output is always PIPE'd.
+      Popen::Options popen;
+      // Written to stdin of the process, which is then closed.
+      std::string input;
+      // Kill the process if it has not exited after this many milliseconds,
+      // counted from when it is started. 0 for no timeout.
+      int timeout_ms;
+      // Keep at most this many bytes of stdout and of stderr. The rest is
+      // read and thrown away, so the process does not block. 0 for no limit.
+      size_t max_output;
+    };
+
+    struct Result {
+      Result();
+
+      // The status as from Popen::wait(), or -1 if the process could not be
+      // started.
+      int status;
+      // The process was killed because it ran out of time.
+      bool timed_out;
+      // Some output was thrown away because of max_output.
+      bool truncated;
+      std::string out;
+      std::string err;
+      // Resources used by the process.
+      Popen::Usage usage;
+    };
+
+    typedef std::function<void(Result)> Callback;
+
+    // Run at most max_running processes at the same time, 0 for one per
+    // core.
+    explicit ProcessPool(size_t max_running = 0);
+    // Waits for all submitted commands to complete.
+    ~ProcessPool();
+
+    // Queue cmd to be run. The future is ready when the process has exited
+    // and all output is read.
+    std::future<Result> Submit(const std::vector<std::string>& cmd,
+                               const TaskOptions& options = TaskOptions());
+    // Queue cmd to be run, and call done with the result. The callback is
+    // called on the pool thread, so it should be quick, and must not throw.
+    void Submit(const std::vector<std::string>& cmd,
+                const TaskOptions& options,
+                const Callback& done);
+
+    // Wait until all submitted commands have completed.
+    void Wait();
+
+    inline size_t max_running() const { return max_running_; }
+
+  private:
+    struct Task;
+
+    void Loop();
+    void Wake();
+
+    const size_t max_running_;
+
+    std::mutex mutex_;
+    std::condition_variable idle_;
+    std::deque<std::unique_ptr<Task>> queue_;
+    // Submitted and not yet completed.
+    size_t pending_;
+    bool stop_;
+
+    // Written to, to wake the pool thread up from poll().
+    int wake_[2];
+    std::thread thread_;
+
+    ProcessPool(const ProcessPool&);
+    ProcessPool& operator=(const ProcessPool&);
+};
+
+}  // namespace sfu
+
+#endif  // SFU_PROCESS_POOL_H_
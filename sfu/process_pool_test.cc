@@ -0,0 +1,141 @@
+#include <sys/wait.h>
+
+#include <atomic>
+#include <chrono>
+
+#include "sfu/process_pool.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+using namespace sfu;
+
+TEST(ProcessPoolTest, TestSubmit) {
+  ProcessPool pool(4);
+  EXPECT_EQ(pool.max_running(), 4u);
+
+  vector<future<ProcessPool::Result>> results;
+  for (int i = 0; i < 50; ++i) {
+    results.push_back(pool.Submit({"echo", to_string(i)}));
+  }
+  for (int i = 0; i < 50; ++i) {
+    ProcessPool::Result result = results[i].get();
+    EXPECT_EQ(result.status, 0);
+    EXPECT_EQ(result.out, to_string(i) + "\n");
+    EXPECT_EQ(result.err, "");
+    EXPECT_FALSE(result.timed_out);
+    EXPECT_FALSE(result.truncated);
+  }
+}
+
+TEST(ProcessPoolTest, TestDefaultMaxRunning) {
+  ProcessPool pool;
+  EXPECT_GT(pool.max_running(), 0u);
+}
+
+TEST(ProcessPoolTest, TestConcurrent) {
+  // Each sleeps 200ms, so these would take 2s one at a time.
+  ProcessPool pool(10);
+  auto start = chrono::steady_clock::now();
+  vector<future<ProcessPool::Result>> results;
+  for (int i = 0; i < 10; ++i) {
+    results.push_back(pool.Submit({"sleep", "0.2"}));
+  }
+  for (auto& result : results) {
+    EXPECT_EQ(result.get().status, 0);
+  }
+  EXPECT_LT(chrono::steady_clock::now() - start, chrono::milliseconds(1500));
+}
+
+TEST(ProcessPoolTest, TestInputAndStderr) {
+  ProcessPool pool(2);
+  ProcessPool::TaskOptions options;
+  // Larger than the pipe buffer, so input and output must be interleaved.
+  options.input.assign(1000000, 'a');
+  ProcessPool::Result result = pool.Submit({"cat"}, options).get();
+  EXPECT_EQ(result.status, 0);
+  EXPECT_EQ(result.out, options.input);
+
+  result = pool.Submit({"sh", "-c", "echo oops >&2; exit 3"}).get();
+  EXPECT_TRUE(WIFEXITED(result.status));
+  EXPECT_EQ(WEXITSTATUS(result.status), 3);
+  EXPECT_EQ(result.out, "");
+  EXPECT_EQ(result.err, "oops\n");
+}
+
+TEST(ProcessPoolTest, TestTimeout) {
+  ProcessPool pool(2);
+  ProcessPool::TaskOptions options;
+  options.timeout_ms = 100;
+  auto start = chrono::steady_clock::now();
+  ProcessPool::Result result = pool.Submit({"sleep", "10"}, options).get();
+  EXPECT_LT(chrono::steady_clock::now() - start, chrono::seconds(5));
+  EXPECT_TRUE(result.timed_out);
+  EXPECT_TRUE(WIFSIGNALED(result.status));
+  EXPECT_EQ(WTERMSIG(result.status), SIGKILL);
+
+  result = pool.Submit({"true"}, options).get();
+  EXPECT_FALSE(result.timed_out);
+  EXPECT_EQ(result.status, 0);
+}
+
+TEST(ProcessPoolTest, TestTimeoutAfterOutput) {
+  // The process keeps running after closing its output.
+  ProcessPool pool(2);
+  ProcessPool::TaskOptions options;
+  options.timeout_ms = 200;
+  auto start = chrono::steady_clock::now();
+  ProcessPool::Result result =
+      pool.Submit({"sh", "-c", "exec >&- 2>&-; sleep 3"}, options).get();
+  EXPECT_LT(chrono::steady_clock::now() - start, chrono::seconds(2));
+  EXPECT_TRUE(result.timed_out);
+  EXPECT_TRUE(WIFSIGNALED(result.status));
+  EXPECT_EQ(WTERMSIG(result.status), SIGKILL);
+}
+
+TEST(ProcessPoolTest, TestMaxOutput) {
+  ProcessPool pool(2);
+  ProcessPool::TaskOptions options;
+  options.max_output = 10;
+  ProcessPool::Result result =
+      pool.Submit({"head", "-c", "1000000", "/dev/zero"}, options).get();
+  EXPECT_EQ(result.status, 0);
+  EXPECT_TRUE(result.truncated);
+  EXPECT_EQ(result.out, string(10, '\0'));
+
+  result = pool.Submit({"echo", "short"}, options).get();
+  EXPECT_FALSE(result.truncated);
+  EXPECT_EQ(result.out, "short\n");
+}
+
+TEST(ProcessPoolTest, TestCallback) {
+  atomic<int> done(0);
+  atomic<int> failed(0);
+  {
+    ProcessPool pool(3);
+    for (int i = 0; i < 20; ++i) {
+      pool.Submit({"echo", "x"}, ProcessPool::TaskOptions(),
+                  [&](ProcessPool::Result result) {
+        if (result.status != 0 || result.out != "x\n") ++failed;
+        ++done;
+      });
+    }
+    pool.Wait();
+    EXPECT_EQ(done, 20);
+
+    // The rest are completed before the pool is gone.
+    for (int i = 0; i < 5; ++i) {
+      pool.Submit({"true"}, ProcessPool::TaskOptions(),
+                  [&](ProcessPool::Result) { ++done; });
+    }
+  }
+  EXPECT_EQ(done, 25);
+  EXPECT_EQ(failed, 0);
+}
+
+TEST(ProcessPoolTest, TestNoSuchCommand) {
+  ProcessPool pool(2);
+  ProcessPool::Result result =
+      pool.Submit({"sfu-no-such-command-for-test"}).get();
+  EXPECT_EQ(result.status, -1);
+  EXPECT_EQ(result.out, "");
+}
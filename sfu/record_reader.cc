@@ -0,0 +1,90 @@
+#include "sfu/record_reader.h"
+
+#include <errno.h>
+#include <unistd.h>
+
+#include <cstring>
+
+namespace sfu {
+
+const size_t RecordReader::kDefaultBlockSize;
+
+RecordReader::RecordReader(int fd, char delimiter, size_t block_size)
+    : fd_(fd),
+      delimiter_(delimiter),
+      block_size_(block_size > 0 ? block_size : kDefaultBlockSize),
+      // Room for a partial record and a full block, so the buffer does not
+      // need to grow for records shorter than a block.
+      buffer_(new char[2 * block_size_]),
+      capacity_(2 * block_size_),
+      begin_(0),
+      scanned_(0),
+      end_(0),
+      eof_(false),
+      error_(0) {}
+
+RecordReader::~RecordReader() {}
+
+bool RecordReader::Next(strings::cord* record) {
+  for (;;) {
+    // memchr is vectorized in any modern libc.
+    const char* found = static_cast<const char*>(
+        memchr(buffer_.get() + scanned_, delimiter_, end_ - scanned_));
+    if (found) {
+      const size_t pos = found - buffer_.get();
+      record->reset(buffer_.get() + begin_, pos - begin_);
+      begin_ = scanned_ = pos + 1;
+      return true;
+    }
+    scanned_ = end_;
+
+    if (!Fill()) {
+      if (begin_ < end_) {
+        record->reset(buffer_.get() + begin_, end_ - begin_);
+        begin_ = scanned_ = end_;
+        return true;
+      }
+      return false;
+    }
+  }
+}
+
+bool RecordReader::Fill() {
+  if (eof_ || error_) return false;
+
+  if (capacity_ - end_ < block_size_) {
+    const size_t partial = end_ - begin_;
+    if (capacity_ - partial >= block_size_) {
+      // Move the partial record to the front.
+      memmove(buffer_.get(), buffer_.get() + begin_, partial);
+    } else {
+      // The record is larger than the buffer.
+      const size_t capacity = 2 * capacity_;
+      std::unique_ptr<char[]> buffer(new char[capacity]);
+      memcpy(buffer.get(), buffer_.get() + begin_, partial);
+      buffer_.swap(buffer);
+      capacity_ = capacity;
+    }
+    scanned_ -= begin_;
+    begin_ = 0;
+    end_ = partial;
+  }
+
+  for (;;) {
+    ssize_t n = read(fd_, buffer_.get() + end_, capacity_ - end_);
+    if (n > 0) {
+      end_ += n;
+      return true;
+    }
+    if (n == 0) {
+      eof_ = true;
+      return false;
+    }
+    if (errno != EINTR) {
+      error_ = errno;
+      return false;
+    }
+  }
+}
+
+}  // namespace sfu
@@ -0,0 +1,70 @@
+#ifndef SFU_RECORD_READER_H_
+#define SFU_RECORD_READER_H_
+
+#include <cstddef>
+#include <memory>
+
+#include "sfu/strings/cord.h"
+
+namespace sfu {
+
+// Reads delimiter separated records (lines by default) from a file
+// descriptor, e.g. a file, pipe or socket, without copying each record out:
+//
+// RecordReader reader(fd);
+// strings::cord line;
+// while (reader.Next(&line)) { ... }
+// if (reader.error()) { ... }
+//
+// Data is read in large blocks into one buffer that is reused for the whole
+// stream. A record that straddles two blocks is moved to the front of the
+// buffer before the next read, and the buffer only grows if a single record
+// is larger than it.
+class RecordReader {
+  public:
+    static const size_t kDefaultBlockSize = 64 * 1024;
+
+    // The fd is not closed by the reader.
+    RecordReader(int fd, char delimiter = '\n',
+                 size_t block_size = kDefaultBlockSize);
+    ~RecordReader();
+
+    // Get the next record, without the delimiter. The last record does not
+    // need to end with the delimiter. The record is only valid until the
+    // next call to Next(). Returns false at end of input or on error.
+    bool Next(strings::cord* record);
+
+    // True when all input is read.
+    inline bool eof() const { return eof_; }
+    // The errno value of a failed read, or 0.
+    inline int error() const { return error_; }
+
+  private:
+    // Make room for, and read one more block. Returns false if nothing more
+    // can be read.
+    bool Fill();
+
+    int fd_;
+    char delimiter_;
+    size_t block_size_;
+
+    std::unique_ptr<char[]> buffer_;
+    size_t capacity_;
+    // Start of the next record.
+    size_t begin_;
+    // Where to continue searching for the delimiter.
+    size_t scanned_;
+    // End of the read data.
+    size_t end_;
+
+    bool eof_;
+    int error_;
+
+    // DISALLOW_COPY_AND_ASSIGN
+    RecordReader(const RecordReader& other);
+    void operator=(const RecordReader& other);
+};
+
+}  // namespace sfu
+
+#endif  // SFU_RECORD_READER_H_
@@ -0,0 +1,80 @@
+#include <errno.h>
+#include <unistd.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sfu/record_reader.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+using namespace sfu;
+
+namespace {
+
+// Read all records of content written through a pipe in small writes.
+vector<string> ReadAll(const string& content, char delimiter,
+                       size_t block_size, size_t write_size) {
+  int fds[2];
+  EXPECT_EQ(0, pipe(fds));
+  thread writer([&]() {
+    for (size_t i = 0; i < content.size(); i += write_size) {
+      size_t n = min(write_size, content.size() - i);
+      EXPECT_EQ(static_cast<ssize_t>(n), write(fds[1], content.c_str() + i, n));
+    }
+    close(fds[1]);
+  });
+
+  vector<string> records;
+  RecordReader reader(fds[0], delimiter, block_size);
+  strings::cord record;
+  while (reader.Next(&record)) {
+    records.push_back(record.as_string());
+  }
+  EXPECT_TRUE(reader.eof());
+  EXPECT_EQ(0, reader.error());
+
+  writer.join();
+  close(fds[0]);
+  return records;
+}
+
+}  // namespace
+
+TEST(RecordReaderTest, TestLines) {
+  vector<string> lines = ReadAll("first\nsecond\n\nlast", '\n', 1024, 1024);
+  ASSERT_EQ(4UL, lines.size());
+  EXPECT_EQ("first", lines[0]);
+  EXPECT_EQ("second", lines[1]);
+  EXPECT_EQ("", lines[2]);
+  EXPECT_EQ("last", lines[3]);
+
+  lines = ReadAll("one\ntwo\n", '\n', 1024, 1024);
+  ASSERT_EQ(2UL, lines.size());
+  EXPECT_EQ("two", lines[1]);
+
+  lines = ReadAll("", '\n', 1024, 1024);
+  EXPECT_EQ(0UL, lines.size());
+}
+
+TEST(RecordReaderTest, TestStraddlingRecords) {
+  string content;
+  vector<string> expected;
+  for (int i = 0; i < 500; ++i) {
+    // Some records are longer than the whole buffer.
+    expected.push_back(string(i % 37, 'a' + i % 26) + to_string(i));
+    content += expected.back() + ";";
+  }
+
+  EXPECT_EQ(expected, ReadAll(content, ';', 8, 3));
+  EXPECT_EQ(expected, ReadAll(content, ';', 16, 100));
+  EXPECT_EQ(expected, ReadAll(content, ';', 4096, 7));
+}
+
+TEST(RecordReaderTest, TestReadError) {
+  RecordReader reader(-1);
+  strings::cord record;
+  EXPECT_FALSE(reader.Next(&record));
+  EXPECT_EQ(EBADF, reader.error());
+}
@@ -64,8 +64,8 @@ size_t cord::find(char c) const {
 }
 
 size_t cord::find_last(char c) const {
-  for (size_t i = len_ - 1; i >= 0; ++i) {
-    if (*(ptr_ + i) == c) return i;
+  for (size_t i = len_; i > 0; --i) {
+    if (*(ptr_ + i - 1) == c) return i - 1;
   }
   return npos;
 }
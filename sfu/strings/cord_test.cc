@@ -18,3 +18,14 @@ TEST(CordTest, TestBasics) {
   EXPECT_EQ("abcdefgh", c.as_string());
   EXPECT_EQ("cde", b.as_string());
 }
+
+TEST(CordTest, TestFindChar) {
+  sfu::strings::cord a("abcabc");
+  EXPECT_EQ(1u, a.find('b'));
+  EXPECT_EQ(4u, a.find_last('b'));
+  EXPECT_EQ(3u, a.find_last('a'));
+  EXPECT_EQ(0u, sfu::strings::cord("ab").find_last('a'));
+  EXPECT_EQ(sfu::strings::cord::npos, a.find('d'));
+  EXPECT_EQ(sfu::strings::cord::npos, a.find_last('d'));
+  EXPECT_EQ(sfu::strings::cord::npos, sfu::strings::cord("").find_last('a'));
+}
@@ -0,0 +1,46 @@
+#include "sfu/strings/keyword.h"
+
+#include <cstring>
+
+namespace sfu {
+namespace strings {
+namespace keyword_internal {
+
+uint64_t PrefixCode(const char* str, size_t len) {
+  const size_t n = len < kMaxKeywordCodeLength ? len : kMaxKeywordCodeLength;
+  uint64_t x = 0;
+  if (n > 0) memcpy(&x, str, n);
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  x = __builtin_bswap64(x);
+#endif
+  // Add 0x20 to each byte in 'A' to 'Z', 8 at a time. The high bit of each
+  // byte of ge_a is set if the byte is >= 'A', of gt_z if > 'Z', ignoring
+  // the high bit of the input which is checked with ~x.
+  const uint64_t kOnes = 0x0101010101010101ULL;
+  const uint64_t kHigh = 0x8080808080808080ULL;
+  const uint64_t low7 = x & ~kHigh;
+  const uint64_t ge_a = low7 + kOnes * (0x80 - 'A');
+  const uint64_t gt_z = low7 + kOnes * (0x80 - 'Z' - 1);
+  const uint64_t upper = ge_a & ~gt_z & ~x & kHigh;
+  return x | (upper >> 2);
+}
+
+bool TailEquals(const char* str, const char* keyword, size_t len) {
+  for (size_t i = kMaxKeywordCodeLength; i < len; ++i) {
+    if (Lower(str[i]) != Lower(keyword[i])) return false;
+  }
+  return true;
+}
+
+}  // namespace keyword_internal
+
+uint64_t keyword_code(const cord& str) {
+  if (str.length() > kMaxKeywordCodeLength ||
+      (str.length() > 0 && memchr(str.ptr(), '\0', str.length()) != NULL)) {
+    return kNotKeyword;
+  }
+  return keyword_internal::PrefixCode(str.ptr(), str.length());
+}
+
+}  // namespace strings
+}  // namespace sfu
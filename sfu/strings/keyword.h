@@ -0,0 +1,104 @@
+#ifndef SFU_STRINGS_KEYWORD_H_
+#define SFU_STRINGS_KEYWORD_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "sfu/strings/cord.h"
+
+namespace sfu {
+namespace strings {
+
+// Case insensitive keyword matching without allocation or locale. Keywords
+// of up to 8 chars are packed into a uint64_t, one ASCII lower cased byte
+// each, so a keyword can be matched with a switch over compile time codes:
+//
+// switch (keyword_code(str)) {
+//   case keyword_code("on"):  ...
+//   case keyword_code("off"): ...
+//   default: // not a keyword.
+// }
+//
+// Two keywords with the same code is a duplicate case compile error, so the
+// switch is a perfect hash. Only ASCII letters are case folded.
+
+// Code for anything that is not a valid keyword: longer than 8 chars or
+// containing a NUL char.
+static const uint64_t kNotKeyword = ~uint64_t(0);
+static const size_t kMaxKeywordCodeLength = 8;
+
+namespace keyword_internal {
+
+constexpr uint8_t Lower(char c) {
+  return static_cast<uint8_t>((c >= 'A' && c <= 'Z') ? (c | 0x20) : c);
+}
+
+constexpr size_t Length(const char* str) {
+  return *str ? 1 + Length(str + 1) : 0;
+}
+
+// The first up to 8 chars, lower cased, first char in the lowest byte.
+constexpr uint64_t Pack(const char* str, size_t i = 0) {
+  return (i == kMaxKeywordCodeLength || str[i] == '\0') ? 0 :
+      (static_cast<uint64_t>(Lower(str[i])) << (8 * i)) | Pack(str, i + 1);
+}
+
+// The code of the first up to 8 chars of str. Used both for matching short
+// keywords, and as a prefilter for the long ones.
+uint64_t PrefixCode(const char* str, size_t len);
+
+// If the chars after the first 8 are equal, ignoring ASCII case.
+bool TailEquals(const char* str, const char* keyword, size_t len);
+
+}  // namespace keyword_internal
+
+// The code of a keyword literal, use the cord version for input. Keywords
+// longer than 8 chars are a compile error when used as a constant expression.
+constexpr uint64_t keyword_code(const char* keyword) {
+  return keyword_internal::Length(keyword) <= kMaxKeywordCodeLength ?
+      keyword_internal::Pack(keyword) :
+      throw "keyword_code() only handles keywords of up to 8 chars";
+}
+
+// The code of str to match against, kNotKeyword if it can not be a keyword.
+uint64_t keyword_code(const cord& str);
+
+// A keyword and its value, for tables of keywords of any length, e.g.
+//
+// constexpr Keyword<Mode> kModes[] = {{"fast", FAST}, {"reliable", SAFE}};
+template<typename T>
+struct Keyword {
+  constexpr Keyword(const char* n, T v) :
+      name(n),
+      length(keyword_internal::Length(n)),
+      code(keyword_internal::Pack(n)),
+      value(v) {}
+
+  const char* name;
+  size_t length;
+  uint64_t code;
+  T value;
+};
+
+// Find str in the keywords, ignoring ASCII case. On match sets *value and
+// returns true.
+template<typename T, size_t N>
+bool match_keyword(const cord& str, const Keyword<T> (&keywords)[N],
+                   T* value) {
+  const size_t len = str.length();
+  const uint64_t code = keyword_internal::PrefixCode(str.ptr(), len);
+  for (size_t i = 0; i < N; ++i) {
+    if (keywords[i].length == len && keywords[i].code == code &&
+        (len <= kMaxKeywordCodeLength ||
+         keyword_internal::TailEquals(str.ptr(), keywords[i].name, len))) {
+      *value = keywords[i].value;
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace strings
+}  // namespace sfu
+
+#endif  // SFU_STRINGS_KEYWORD_H_
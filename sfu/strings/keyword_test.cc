@@ -0,0 +1,74 @@
+#include "sfu/strings/keyword.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+using namespace sfu::strings;
+
+namespace {
+
+typedef enum {
+  COLOR_RED = 0,
+  COLOR_GREEN,
+  COLOR_BLUE,
+  COLOR_ULTRAVIOLET
+} Color;
+
+constexpr Keyword<Color> kColors[] = {
+  {"red", COLOR_RED},
+  {"green", COLOR_GREEN},
+  {"blue", COLOR_BLUE},
+  {"ultraviolet", COLOR_ULTRAVIOLET},
+};
+
+int Level(const cord& str) {
+  switch (keyword_code(str)) {
+    case keyword_code("off"):     return 0;
+    case keyword_code("low"):     return 1;
+    case keyword_code("high"):    return 2;
+    case keyword_code("maximum"): return 3;
+    case keyword_code(""):        return 4;
+    default:                      return -1;
+  }
+}
+
+}  // namespace
+
+TEST(KeywordTest, TestKeywordCode) {
+  static_assert(keyword_code("a") == 'a', "first char in low byte");
+  static_assert(keyword_code("AbC") == keyword_code("abc"), "case folded");
+  static_assert(keyword_code("ab") == ('a' | ('b' << 8)), "packed");
+
+  EXPECT_EQ(keyword_code("12345678"), keyword_code(cord("12345678")));
+  EXPECT_EQ(keyword_code("a-z@[`{"), keyword_code(cord("A-Z@[`{")));
+  EXPECT_EQ(kNotKeyword, keyword_code(cord("123456789")));
+  EXPECT_EQ(kNotKeyword, keyword_code(cord("a\0b", 3)));
+
+  EXPECT_EQ(0, Level("OFF"));
+  EXPECT_EQ(1, Level("low"));
+  EXPECT_EQ(2, Level("High"));
+  EXPECT_EQ(3, Level("MAXimum"));
+  EXPECT_EQ(4, Level(""));
+  EXPECT_EQ(-1, Level("of"));
+  EXPECT_EQ(-1, Level("offf"));
+  EXPECT_EQ(-1, Level("maximums"));
+  // Not ASCII letters are not case folded.
+  EXPECT_EQ(-1, Level("\xc3\x96" "ff"));
+  EXPECT_NE(keyword_code(cord("\xc3\x80")), keyword_code(cord("\xc3\xa0")));
+}
+
+TEST(KeywordTest, TestMatchKeyword) {
+  Color c = COLOR_RED;
+  EXPECT_TRUE(match_keyword("GREEN", kColors, &c));
+  EXPECT_EQ(COLOR_GREEN, c);
+  EXPECT_TRUE(match_keyword("UltraViolet", kColors, &c));
+  EXPECT_EQ(COLOR_ULTRAVIOLET, c);
+  EXPECT_TRUE(match_keyword("blue", kColors, &c));
+  EXPECT_EQ(COLOR_BLUE, c);
+
+  EXPECT_FALSE(match_keyword("ultraviolat", kColors, &c));
+  EXPECT_FALSE(match_keyword("ultraviolet!", kColors, &c));
+  EXPECT_FALSE(match_keyword("gree", kColors, &c));
+  EXPECT_FALSE(match_keyword("", kColors, &c));
+  EXPECT_FALSE(match_keyword(cord("red\0", 4), kColors, &c));
+  EXPECT_EQ(COLOR_BLUE, c);
+}
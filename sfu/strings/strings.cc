@@ -15,9 +15,11 @@ size_t split_cb(function<bool(const string&)> out,
                 bool omit_empty) {
   size_t lastsep = 0, isep = 0;
   int i = 0;
+  // Reused for every field, so it only allocates when it has to grow.
+  string tmp;
   while (lastsep < str.size() &&
          (isep = str.find(sep, lastsep)) < str.size()) {
-    string tmp(str.substr(lastsep, isep - lastsep));
+    tmp.assign(str, lastsep, isep - lastsep);
     if (!omit_empty || tmp.size() > 0) {
       if (!out(tmp)) return string::npos;
       ++i;
@@ -26,7 +28,8 @@ size_t split_cb(function<bool(const string&)> out,
   }
 
   if (!omit_empty || lastsep < (str.size() - 1)) {
-    if (!out(str.substr(lastsep))) return string::npos;
+    tmp.assign(str, lastsep, string::npos);
+    if (!out(tmp)) return string::npos;
     ++i;
   }
   return i;
@@ -137,7 +140,8 @@ size_t trim(std::string* str, const std::function<bool(char)>& f) {
     ++ret;
   }
   if (ret > 0) {
-    *str = str->substr(begin, end - begin);
+    str->erase(end);
+    str->erase(0, begin);
     return ret;
   }
   return 0;
@@ -150,7 +154,7 @@ size_t trim_left(std::string* str, const std::function<bool(char)>& f) {
     ++begin;
   }
   if (begin > 0) {
-    *str = str->substr(begin, end - begin);
+    str->erase(0, begin);
   }
   return begin;
 }
@@ -163,7 +167,7 @@ size_t trim_right(std::string* str, const std::function<bool(char)>& f) {
     ++ret;
   }
   if (ret > 0) {
-    *str = str->substr(0, end);
+    str->erase(end);
   }
   return ret;
 }
@@ -182,7 +186,8 @@ size_t trim_whitespace(std::string* str) {
     ++ret;
   }
   if (ret > 0) {
-    *str = str->substr(begin, end - begin);
+    str->erase(end);
+    str->erase(0, begin);
   }
   return ret;
 }
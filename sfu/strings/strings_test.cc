@@ -4,6 +4,7 @@
 #include <deque>
 
 #include "sfu/strings/strings.h"
+#include "sfu/testing/alloc_counter.h"
 #include "gtest/gtest.h"
 
 using namespace sfu::strings;
@@ -191,3 +192,16 @@ TEST(StringsTest, TrimWhitespace) {
   EXPECT_EQ("a", inline_trim_whitespace("a\r\n\r\n"));
   EXPECT_EQ("a     a", inline_trim_whitespace("\n\n\n   a     a\r\n\r\n"));
 }
+
+TEST(StringsTest, TrimNoAlloc) {
+  // Trimmed in place.
+  string str("  \t some text with spaces \r\n");
+  EXPECT_NO_ALLOC(trim_whitespace(&str));
+  EXPECT_EQ("some text with spaces", str);
+  auto is_s = [](char c) { return c == 's'; };
+  EXPECT_NO_ALLOC(trim(&str, is_s));
+  EXPECT_EQ("ome text with space", str);
+  EXPECT_NO_ALLOC(trim_left(&str, [](char c) { return c == 'o'; }));
+  EXPECT_NO_ALLOC(trim_right(&str, [](char c) { return c == 'e'; }));
+  EXPECT_EQ("me text with spac", str);
+}
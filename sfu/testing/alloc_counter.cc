@@ -0,0 +1,198 @@
+#include "sfu/testing/alloc_counter.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+// Plain data, so that the thread local needs no constructor, and is usable
+// in operator new before anything else of the thread.
+struct ThreadCounts {
+  uint64_t allocations;
+  uint64_t deallocations;
+  uint64_t bytes;
+};
+
+#ifdef __GNUC__
+// Static TLS: never allocates, which the default model may do on first use
+// in a shared library.
+__thread ThreadCounts tls_counts __attribute__((tls_model("initial-exec")));
+#else
+thread_local ThreadCounts tls_counts;
+#endif
+
+inline void count_alloc(size_t size) {
+  ++tls_counts.allocations;
+  tls_counts.bytes += size;
+}
+
+inline void count_free(void* ptr) {
+  if (ptr) ++tls_counts.deallocations;
+}
+
+void* allocate(size_t size) {
+  if (size == 0) size = 1;
+  for (;;) {
+    void* ptr = malloc(size);
+    if (ptr) {
+      count_alloc(size);
+      return ptr;
+    }
+    std::new_handler handler = std::get_new_handler();
+    if (!handler) throw std::bad_alloc();
+    handler();
+  }
+}
+
+void* allocate_nothrow(size_t size) noexcept {
+  try {
+    return allocate(size);
+  } catch (...) {
+    return NULL;
+  }
+}
+
+void deallocate(void* ptr) noexcept {
+  count_free(ptr);
+  free(ptr);
+}
+
+#ifdef __cpp_aligned_new
+void* allocate_aligned(size_t size, std::align_val_t align) {
+  if (size == 0) size = 1;
+  size_t alignment = static_cast<size_t>(align);
+  if (alignment < sizeof(void*)) alignment = sizeof(void*);
+  for (;;) {
+    void* ptr = NULL;
+    if (posix_memalign(&ptr, alignment, size) == 0) {
+      count_alloc(size);
+      return ptr;
+    }
+    std::new_handler handler = std::get_new_handler();
+    if (!handler) throw std::bad_alloc();
+    handler();
+  }
+}
+
+void* allocate_aligned_nothrow(size_t size, std::align_val_t align) noexcept {
+  try {
+    return allocate_aligned(size, align);
+  } catch (...) {
+    return NULL;
+  }
+}
+#endif
+
+}  // namespace
+
+// ---- replacement global allocation functions ----
+
+void* operator new(size_t size) { return allocate(size); }
+void* operator new[](size_t size) { return allocate(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  return allocate_nothrow(size);
+}
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+  return allocate_nothrow(size);
+}
+
+void operator delete(void* ptr) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr) noexcept { deallocate(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+  deallocate(ptr);
+}
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+  deallocate(ptr);
+}
+
+#ifdef __cpp_sized_deallocation
+void operator delete(void* ptr, size_t) noexcept { deallocate(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { deallocate(ptr); }
+#endif
+
+#ifdef __cpp_aligned_new
+void* operator new(size_t size, std::align_val_t align) {
+  return allocate_aligned(size, align);
+}
+void* operator new[](size_t size, std::align_val_t align) {
+  return allocate_aligned(size, align);
+}
+void* operator new(size_t size, std::align_val_t align,
+                   const std::nothrow_t&) noexcept {
+  return allocate_aligned_nothrow(size, align);
+}
+void* operator new[](size_t size, std::align_val_t align,
+                     const std::nothrow_t&) noexcept {
+  return allocate_aligned_nothrow(size, align);
+}
+void operator delete(void* ptr, std::align_val_t) noexcept {
+  deallocate(ptr);
+}
+void operator delete[](void* ptr, std::align_val_t) noexcept {
+  deallocate(ptr);
+}
+void operator delete(void* ptr, std::align_val_t,
+                     const std::nothrow_t&) noexcept {
+  deallocate(ptr);
+}
+void operator delete[](void* ptr, std::align_val_t,
+                       const std::nothrow_t&) noexcept {
+  deallocate(ptr);
+}
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept {
+  deallocate(ptr);
+}
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept {
+  deallocate(ptr);
+}
+#endif
+
+namespace sfu {
+namespace testing {
+
+AllocationStats thread_allocations() {
+  AllocationStats stats;
+  stats.allocations = tls_counts.allocations;
+  stats.deallocations = tls_counts.deallocations;
+  stats.bytes = tls_counts.bytes;
+  return stats;
+}
+
+bool allocation_counting_enabled() {
+  const uint64_t before = tls_counts.allocations;
+  // Called directly, as a new-expression may be elided.
+  void* ptr = ::operator new(1);
+  const bool counted = tls_counts.allocations != before;
+  ::operator delete(ptr);
+  return counted;
+}
+
+AllocationCounter::AllocationCounter()
+    : start_(thread_allocations()) {}
+
+uint64_t AllocationCounter::allocations() const {
+  return tls_counts.allocations - start_.allocations;
+}
+
+uint64_t AllocationCounter::deallocations() const {
+  return tls_counts.deallocations - start_.deallocations;
+}
+
+uint64_t AllocationCounter::bytes() const {
+  return tls_counts.bytes - start_.bytes;
+}
+
+AllocationStats AllocationCounter::stats() const {
+  AllocationStats stats;
+  stats.allocations = allocations();
+  stats.deallocations = deallocations();
+  stats.bytes = bytes();
+  return stats;
+}
+
+void AllocationCounter::Reset() {
+  start_ = thread_allocations();
+}
+
+}  // namespace testing
+}  // namespace sfu
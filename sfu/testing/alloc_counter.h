@@ -0,0 +1,87 @@
+#ifndef SFU_TESTING_ALLOC_COUNTER_H_
+#define SFU_TESTING_ALLOC_COUNTER_H_
+
+#include <cstdint>
+
+namespace sfu {
+namespace testing {
+
+// Allocations with the global operator new and delete.
+struct AllocationStats {
+  AllocationStats() : allocations(0), deallocations(0), bytes(0) {}
+
+  uint64_t allocations;
+  uint64_t deallocations;
+  // Bytes asked for by the allocations.
+  uint64_t bytes;
+};
+
+// The allocations of the calling thread since it started. These are counted
+// by the replacement operator new and delete of alloc_counter.cc, which are
+// in every binary that links this library. Direct calls to malloc() and
+// free() are not counted.
+AllocationStats thread_allocations();
+
+// True if allocations are counted, i.e. no other library in the binary
+// replaces the global operator new, e.g. tcmalloc.
+bool allocation_counting_enabled();
+
+// Counts the allocations of the calling thread from construction. For
+// checking that a function does not allocate:
+//
+//   AllocationCounter counter;
+//   strings::trim(&str);
+//   EXPECT_EQ(0u, counter.allocations());
+//
+// or as EXPECT_NO_ALLOC() below. Counters may be nested, and allocations by
+// other threads are not counted. Note that since C++14 the compiler may
+// remove a new and delete pair if the memory is not needed.
+class AllocationCounter {
+  public:
+    AllocationCounter();
+
+    uint64_t allocations() const;
+    uint64_t deallocations() const;
+    uint64_t bytes() const;
+    // All of the above.
+    AllocationStats stats() const;
+
+    // Count from now.
+    void Reset();
+
+  private:
+    // Not copyable.
+    AllocationCounter(const AllocationCounter& counter);
+    AllocationCounter& operator=(const AllocationCounter& counter);
+
+    AllocationStats start_;
+};
+
+}  // namespace testing
+}  // namespace sfu
+
+// gtest assertions on the number of allocations made by a statement on the
+// calling thread, e.g. to keep the zero-allocation guarantee of a hot
+// function:
+//
+//   EXPECT_NO_ALLOC(from_chars(first, last, &value));
+//   EXPECT_ALLOCS(1, str = format("%d", 7));
+//
+// The file using them must include "gtest/gtest.h".
+#define SFU_ALLOCS_IMPL_(check, count, ...)                             \
+  do {                                                                  \
+    ::sfu::testing::AllocationCounter sfu_alloc_counter_;               \
+    __VA_ARGS__;                                                        \
+    const uint64_t sfu_allocs_ = sfu_alloc_counter_.allocations();      \
+    check(static_cast<uint64_t>(count), sfu_allocs_)                    \
+        << "Allocations in: " #__VA_ARGS__;                             \
+  } while (0)
+
+#define EXPECT_ALLOCS(count, ...) \
+  SFU_ALLOCS_IMPL_(EXPECT_EQ, count, __VA_ARGS__)
+#define ASSERT_ALLOCS(count, ...) \
+  SFU_ALLOCS_IMPL_(ASSERT_EQ, count, __VA_ARGS__)
+#define EXPECT_NO_ALLOC(...) EXPECT_ALLOCS(0, __VA_ARGS__)
+#define ASSERT_NO_ALLOC(...) ASSERT_ALLOCS(0, __VA_ARGS__)
+
+#endif  // SFU_TESTING_ALLOC_COUNTER_H_
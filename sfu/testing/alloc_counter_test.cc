@@ -0,0 +1,100 @@
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sfu/testing/alloc_counter.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+using namespace sfu::testing;
+
+namespace {
+
+void* volatile g_escaped;
+
+// Let the pointer escape, as the compiler may otherwise remove a new and
+// delete pair that is not needed.
+template<typename T>
+T* Escape(T* ptr) {
+  g_escaped = ptr;
+  return ptr;
+}
+
+}  // namespace
+
+TEST(AllocationCounterTest, TestEnabled) {
+  EXPECT_TRUE(allocation_counting_enabled());
+}
+
+TEST(AllocationCounterTest, TestCount) {
+  AllocationCounter counter;
+  EXPECT_EQ(0u, counter.allocations());
+
+  unique_ptr<int> value(Escape(new int(7)));
+  EXPECT_EQ(1u, counter.allocations());
+  EXPECT_EQ(sizeof(int), counter.bytes());
+  EXPECT_EQ(0u, counter.deallocations());
+  value.reset();
+  EXPECT_EQ(1u, counter.deallocations());
+
+  unique_ptr<char[]> buffer(Escape(new char[100]));
+  EXPECT_EQ(2u, counter.allocations());
+  EXPECT_EQ(sizeof(int) + 100, counter.bytes());
+  buffer.reset();
+
+  AllocationStats stats = counter.stats();
+  EXPECT_EQ(2u, stats.allocations);
+  EXPECT_EQ(2u, stats.deallocations);
+
+  counter.Reset();
+  EXPECT_EQ(0u, counter.allocations());
+  EXPECT_EQ(0u, counter.deallocations());
+  EXPECT_EQ(0u, counter.bytes());
+}
+
+TEST(AllocationCounterTest, TestNested) {
+  AllocationCounter outer;
+  vector<int> values;
+  values.reserve(10);
+  {
+    AllocationCounter inner;
+    values.push_back(1);
+    EXPECT_EQ(0u, inner.allocations());
+    string text(100, 'x');
+    EXPECT_EQ(1u, inner.allocations());
+  }
+  EXPECT_EQ(2u, outer.allocations());
+  EXPECT_EQ(1u, outer.deallocations());
+}
+
+TEST(AllocationCounterTest, TestOtherThreads) {
+  AllocationCounter counter;
+  uint64_t in_thread = 0;
+  // The thread state is allocated before the counter of the thread.
+  thread t([&in_thread] {
+    AllocationCounter thread_counter;
+    vector<string> strings;
+    for (int i = 0; i < 100; ++i) strings.push_back(string(100, 'x'));
+    in_thread = thread_counter.allocations();
+  });
+  const uint64_t before_join = counter.allocations();
+  t.join();
+  EXPECT_LE(100u, in_thread);
+  // Only the start of the thread, not its allocations.
+  EXPECT_GT(50u, before_join);
+}
+
+TEST(AllocationCounterTest, TestMacros) {
+  int value = 0;
+  EXPECT_NO_ALLOC(value += 1);
+  ASSERT_NO_ALLOC(value += 1);
+  EXPECT_EQ(2, value);
+
+  string text;
+  EXPECT_ALLOCS(1, text.assign(100, 'x'));
+  // Fits, so no new allocation.
+  EXPECT_NO_ALLOC(text.assign(50, 'y'));
+  vector<unique_ptr<int>> ints;
+  ASSERT_ALLOCS(2, ints.push_back(unique_ptr<int>(Escape(new int(1)))));
+}
@@ -0,0 +1,127 @@
+#include "sfu/testing/perf_counters.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <cstring>
+
+namespace sfu {
+namespace testing {
+
+namespace {
+
+#ifdef __linux__
+const uint64_t kEventConfig[PerfCounters::NUM_EVENTS] = {
+  PERF_COUNT_HW_CPU_CYCLES,
+  PERF_COUNT_HW_INSTRUCTIONS,
+  PERF_COUNT_HW_CACHE_MISSES,
+  PERF_COUNT_HW_BRANCH_MISSES,
+};
+
+// Open the disabled counter of the calling thread, or -1.
+int open_event(uint64_t config) {
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.config = config;
+  attr.disabled = 1;
+  // Allowed with the default perf_event_paranoid of 2.
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format =
+      PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+#endif
+
+}  // namespace
+
+PerfCounters::PerfCounters() {
+  for (int i = 0; i < NUM_EVENTS; ++i) {
+#ifdef __linux__
+    fds_[i] = open_event(kEventConfig[i]);
+#else
+    fds_[i] = -1;
+#endif
+  }
+  Reset();
+  Start();
+}
+
+PerfCounters::~PerfCounters() {
+#ifdef __linux__
+  for (int i = 0; i < NUM_EVENTS; ++i) {
+    if (fds_[i] >= 0) close(fds_[i]);
+  }
+#endif
+}
+
+bool PerfCounters::available() const {
+  for (int i = 0; i < NUM_EVENTS; ++i) {
+    if (fds_[i] >= 0) return true;
+  }
+  return false;
+}
+
+bool PerfCounters::available(Event event) const {
+  return event >= 0 && event < NUM_EVENTS && fds_[event] >= 0;
+}
+
+void PerfCounters::Stop() {
+#ifdef __linux__
+  for (int i = 0; i < NUM_EVENTS; ++i) {
+    if (fds_[i] >= 0) ioctl(fds_[i], PERF_EVENT_IOC_DISABLE, 0);
+  }
+#endif
+}
+
+void PerfCounters::Start() {
+#ifdef __linux__
+  for (int i = 0; i < NUM_EVENTS; ++i) {
+    if (fds_[i] >= 0) ioctl(fds_[i], PERF_EVENT_IOC_ENABLE, 0);
+  }
+#endif
+}
+
+void PerfCounters::Reset() {
+#ifdef __linux__
+  for (int i = 0; i < NUM_EVENTS; ++i) {
+    if (fds_[i] >= 0) ioctl(fds_[i], PERF_EVENT_IOC_RESET, 0);
+  }
+#endif
+}
+
+uint64_t PerfCounters::value(Event event) const {
+  if (!available(event)) return 0;
+#ifdef __linux__
+  // value, time enabled, time running.
+  uint64_t data[3];
+  if (read(fds_[event], data, sizeof(data)) != sizeof(data)) return 0;
+  if (data[2] == 0) return 0;
+  if (data[2] < data[1]) {
+    return static_cast<uint64_t>(
+        static_cast<double>(data[0]) * data[1] / data[2]);
+  }
+  return data[0];
+#else
+  return 0;
+#endif
+}
+
+const char* PerfCounters::name(Event event) {
+  switch (event) {
+    case CYCLES: return "cycles";
+    case INSTRUCTIONS: return "instructions";
+    case CACHE_MISSES: return "cache_misses";
+    case BRANCH_MISSES: return "branch_misses";
+    default: return "unknown";
+  }
+}
+
+}  // namespace testing
+}  // namespace sfu
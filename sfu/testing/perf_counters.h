@@ -0,0 +1,64 @@
+#ifndef SFU_TESTING_PERF_COUNTERS_H_
+#define SFU_TESTING_PERF_COUNTERS_H_
+
+#include <cstdint>
+
+namespace sfu {
+namespace testing {
+
+// Hardware event counters of the calling thread, from perf_event_open(2),
+// counting from construction in user space only:
+//
+//   PerfCounters counters;
+//   parse_column(buffer, '\n', &values, &errors);
+//   counters.Stop();
+//   cout << counters.value(PerfCounters::INSTRUCTIONS) << endl;
+//
+// The counters are not available in most containers and VMs without a
+// virtual PMU, with kernel.perf_event_paranoid above 2, or outside Linux.
+// Then available() is false and all values are 0, so the same code runs
+// everywhere.
+class PerfCounters {
+  public:
+    typedef enum {
+      CYCLES = 0,
+      INSTRUCTIONS,
+      CACHE_MISSES,
+      BRANCH_MISSES,
+      NUM_EVENTS
+    } Event;
+
+    PerfCounters();
+    ~PerfCounters();
+
+    // True if any of the events is counted.
+    bool available() const;
+    bool available(Event event) const;
+
+    // Stop and resume counting. The values are kept.
+    void Stop();
+    void Start();
+    // Count from 0.
+    void Reset();
+
+    // The count since construction or Reset(). If the kernel had to share
+    // the hardware counters with others, the count is scaled up for the
+    // time it was not counted.
+    uint64_t value(Event event) const;
+
+    // The name of the event, e.g. "cycles" or "cache_misses".
+    static const char* name(Event event);
+
+  private:
+    // Not copyable.
+    PerfCounters(const PerfCounters& counters);
+    PerfCounters& operator=(const PerfCounters& counters);
+
+    // File descriptor per event, or -1.
+    int fds_[NUM_EVENTS];
+};
+
+}  // namespace testing
+}  // namespace sfu
+
+#endif  // SFU_TESTING_PERF_COUNTERS_H_
@@ -0,0 +1,68 @@
+#include <iostream>
+
+#include "sfu/testing/perf_counters.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+using namespace sfu::testing;
+
+namespace {
+
+// A loop of a known number of iterations, that can not be removed.
+uint64_t Spin(int iterations) {
+  volatile uint64_t sum = 0;
+  for (int i = 0; i < iterations; ++i) sum += i;
+  return sum;
+}
+
+}  // namespace
+
+TEST(PerfCountersTest, TestCount) {
+  PerfCounters counters;
+  if (!counters.available()) {
+    // E.g. in a container or VM without hardware counters.
+    cerr << "No hardware counters, not checking values." << endl;
+    for (int i = 0; i < PerfCounters::NUM_EVENTS; ++i) {
+      const PerfCounters::Event event = static_cast<PerfCounters::Event>(i);
+      EXPECT_FALSE(counters.available(event));
+      EXPECT_EQ(0u, counters.value(event));
+    }
+    Spin(1000);
+    counters.Stop();
+    counters.Reset();
+    counters.Start();
+    return;
+  }
+
+  Spin(1000000);
+  counters.Stop();
+  if (counters.available(PerfCounters::INSTRUCTIONS)) {
+    const uint64_t instructions = counters.value(PerfCounters::INSTRUCTIONS);
+    EXPECT_LT(1000000u, instructions);
+    // Stopped.
+    Spin(1000000);
+    EXPECT_EQ(instructions, counters.value(PerfCounters::INSTRUCTIONS));
+  }
+  if (counters.available(PerfCounters::CYCLES)) {
+    EXPECT_LT(0u, counters.value(PerfCounters::CYCLES));
+  }
+
+  counters.Reset();
+  EXPECT_EQ(0u, counters.value(PerfCounters::INSTRUCTIONS));
+  counters.Start();
+  Spin(1000);
+  counters.Stop();
+  if (counters.available(PerfCounters::INSTRUCTIONS)) {
+    EXPECT_GT(1000000u, counters.value(PerfCounters::INSTRUCTIONS));
+  }
+}
+
+TEST(PerfCountersTest, TestName) {
+  EXPECT_STREQ("cycles", PerfCounters::name(PerfCounters::CYCLES));
+  EXPECT_STREQ("instructions",
+               PerfCounters::name(PerfCounters::INSTRUCTIONS));
+  EXPECT_STREQ("cache_misses",
+               PerfCounters::name(PerfCounters::CACHE_MISSES));
+  EXPECT_STREQ("branch_misses",
+               PerfCounters::name(PerfCounters::BRANCH_MISSES));
+}
@@ -0,0 +1,61 @@
+#ifndef SFU_TIME_CIVIL_H_
+#define SFU_TIME_CIVIL_H_
+
+#include <cstdint>
+
+namespace sfu {
+namespace time {
+
+// Conversion between days since 1970-01-01 and dates of the proleptic
+// Gregorian calendar, by Howard Hinnant's algorithms:
+// http://howardhinnant.github.io/date_algorithms.html
+//
+// Only integer arithmetic, with no libc calls, so these are safe and fast
+// from any thread, for any year that fits.
+
+static const int32_t kSecondsPerDay = 86400;
+
+// Days since 1970-01-01 of the date, where month is 1-12 and day 1-31.
+inline int64_t days_from_civil(int64_t year, unsigned month, unsigned day) {
+  year -= month <= 2;
+  const int64_t era = (year >= 0 ? year : year - 399) / 400;
+  const unsigned yoe = static_cast<unsigned>(year - era * 400);  // [0, 399]
+  const unsigned doy =
+      (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;  // [0, 146096]
+  return era * 146097 + static_cast<int64_t>(doe) - 719468;
+}
+
+// The date of the day since 1970-01-01.
+inline void civil_from_days(int64_t days,
+                            int64_t* year, unsigned* month, unsigned* day) {
+  days += 719468;
+  const int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+  const unsigned doe = static_cast<unsigned>(days - era * 146097);
+  const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);  // [0, 365]
+  const unsigned mp = (5 * doy + 2) / 153;                       // [0, 11]
+  *day = doy - (153 * mp + 2) / 5 + 1;
+  *month = mp < 10 ? mp + 3 : mp - 9;
+  *year = static_cast<int64_t>(yoe) + era * 400 + (*month <= 2);
+}
+
+// Day of week of the day since 1970-01-01, 0-6 for Sunday-Saturday.
+inline unsigned weekday_from_days(int64_t days) {
+  return static_cast<unsigned>(days >= -4 ? (days + 4) % 7
+                                          : (days + 5) % 7 + 6);
+}
+
+inline bool is_leap_year(int64_t year) {
+  return year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+}
+
+// Days since 1970-01-01 of the timestamp, rounded down also before 1970.
+inline int64_t days_from_timestamp(int64_t ts) {
+  return (ts >= 0 ? ts : ts - (kSecondsPerDay - 1)) / kSecondsPerDay;
+}
+
+}  // namespace time
+}  // namespace sfu
+
+#endif  // SFU_TIME_CIVIL_H_
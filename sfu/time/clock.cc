@@ -0,0 +1,169 @@
+#include "sfu/time/clock.h"
+
+#ifdef SFU_TIME_HAS_TSC
+#include <cpuid.h>
+#endif
+
+#include <chrono>
+
+namespace sfu {
+namespace time {
+namespace clock_internal {
+
+// How long to count ticks against CLOCK_MONOTONIC to calibrate the TSC.
+const int64_t kCalibrationNs = 10 * 1000 * 1000;
+
+// The TSC rate as 32.32 fixed point nanoseconds per tick, and a pair of
+// reads to line ticks up with CLOCK_MONOTONIC.
+struct TscCalibration {
+  bool invariant;
+  uint64_t ns_per_tick;
+  uint64_t base_ticks;
+  int64_t base_ns;
+  double frequency;
+};
+
+// A TSC read as close in time to a CLOCK_MONOTONIC read as can be had, by
+// keeping the tightest of a few tries.
+void read_pair(uint64_t* ticks, int64_t* ns) {
+  uint64_t best = ~0ULL;
+  for (int i = 0; i < 5; ++i) {
+    const uint64_t before = TscClock::ticks();
+    const int64_t mono = monotonic_ns();
+    const uint64_t after = TscClock::ticks();
+    if (after - before < best) {
+      best = after - before;
+      *ticks = before + (after - before) / 2;
+      *ns = mono;
+    }
+  }
+}
+
+bool tsc_invariant() {
+#ifdef SFU_TIME_HAS_TSC
+  unsigned int eax, ebx, ecx, edx;
+  if (__get_cpuid_max(0x80000000, NULL) < 0x80000007) return false;
+  __cpuid(0x80000007, eax, ebx, ecx, edx);
+  return (edx & (1 << 8)) != 0;
+#else
+  return true;
+#endif
+}
+
+TscCalibration calibrate() {
+  TscCalibration calibration;
+  calibration.invariant = tsc_invariant();
+#ifdef SFU_TIME_HAS_TSC
+  uint64_t start_ticks, end_ticks;
+  int64_t start_ns, end_ns;
+  read_pair(&start_ticks, &start_ns);
+  while (monotonic_ns() - start_ns < kCalibrationNs) {}
+  read_pair(&end_ticks, &end_ns);
+  const double ns_per_tick =
+      static_cast<double>(end_ns - start_ns) / (end_ticks - start_ticks);
+  calibration.ns_per_tick =
+      static_cast<uint64_t>(ns_per_tick * 4294967296.0 + 0.5);
+  calibration.base_ticks = end_ticks;
+  calibration.base_ns = end_ns;
+  calibration.frequency = 1e9 / ns_per_tick;
+#else
+  calibration.ns_per_tick = 1ULL << 32;
+  calibration.base_ticks = 0;
+  calibration.base_ns = 0;
+  calibration.frequency = 1e9;
+#endif
+  return calibration;
+}
+
+const TscCalibration& tsc_calibration() {
+  static const TscCalibration calibration = calibrate();
+  return calibration;
+}
+
+int64_t ticks_times(uint64_t ticks, uint64_t ns_per_tick) {
+  return static_cast<int64_t>(
+      (static_cast<unsigned __int128>(ticks) * ns_per_tick) >> 32);
+}
+
+}  // namespace clock_internal
+
+using namespace clock_internal;
+
+int64_t clock_resolution_ns(clockid_t clock) {
+  struct timespec ts;
+  if (clock_getres(clock, &ts) != 0) return 0;
+  return static_cast<int64_t>(ts.tv_sec) * kNanosPerSecond + ts.tv_nsec;
+}
+
+// static
+bool TscClock::available() {
+  static const bool invariant = tsc_invariant();
+  return invariant;
+}
+
+// static
+int64_t TscClock::to_ns(uint64_t ticks) {
+  return ticks_times(ticks, tsc_calibration().ns_per_tick);
+}
+
+// static
+int64_t TscClock::ticks_to_monotonic_ns(uint64_t ticks) {
+  const TscCalibration& calibration = tsc_calibration();
+  // Ticks read before the calibration are before base_ticks.
+  if (ticks >= calibration.base_ticks) {
+    return calibration.base_ns +
+           ticks_times(ticks - calibration.base_ticks,
+                       calibration.ns_per_tick);
+  }
+  return calibration.base_ns -
+         ticks_times(calibration.base_ticks - ticks, calibration.ns_per_tick);
+}
+
+// static
+int64_t TscClock::now_ns() {
+  return ticks_to_monotonic_ns(ticks());
+}
+
+// static
+double TscClock::frequency() {
+  return tsc_calibration().frequency;
+}
+
+CachedClock::CachedClock(int interval_ms)
+    : interval_ms_(interval_ms > 0 ? interval_ms : 1),
+      stop_(false) {
+  Update();
+  thread_ = std::thread(&CachedClock::Loop, this);
+}
+
+CachedClock::~CachedClock() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  stop_cv_.notify_all();
+  thread_.join();
+}
+
+// static
+const CachedClock& CachedClock::Default() {
+  // Never deleted, so that it can be used during static destruction.
+  static const CachedClock* clock = new CachedClock(1);
+  return *clock;
+}
+
+void CachedClock::Update() {
+  realtime_ns_.store(time::realtime_ns(), std::memory_order_relaxed);
+  monotonic_ns_.store(time::monotonic_ns(), std::memory_order_relaxed);
+}
+
+void CachedClock::Loop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (!stop_) {
+    stop_cv_.wait_for(lock, std::chrono::milliseconds(interval_ms_));
+    Update();
+  }
+}
+
+}  // namespace time
+}  // namespace sfu
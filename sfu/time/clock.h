@@ -0,0 +1,151 @@
+#ifndef SFU_TIME_CLOCK_H_
+#define SFU_TIME_CLOCK_H_
+
+#include <time.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <ctime>
+#include <mutex>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define SFU_TIME_HAS_TSC 1
+#endif
+
+namespace sfu {
+namespace time {
+
+static const int64_t kNanosPerSecond = 1000000000;
+
+// Nanoseconds of the clock, e.g. CLOCK_MONOTONIC. On Linux clock_gettime()
+// is served by the vDSO for these clocks, without a system call, in some
+// 20ns. The coarse clocks are updated once per kernel tick (1-4ms), and are
+// read in a few ns.
+inline int64_t clock_ns(clockid_t clock) {
+  struct timespec ts;
+  clock_gettime(clock, &ts);
+  return static_cast<int64_t>(ts.tv_sec) * kNanosPerSecond + ts.tv_nsec;
+}
+
+// Resolution of the clock in nanoseconds.
+int64_t clock_resolution_ns(clockid_t clock);
+
+// Wall clock time, nanoseconds since 1970-01-01 UTC. Can jump when the
+// system time is set.
+inline int64_t realtime_ns() {
+  return clock_ns(CLOCK_REALTIME);
+}
+
+// The wall clock time split into seconds and nanoseconds, e.g. for
+// Formatter::Format().
+inline void realtime(time_t* seconds, uint32_t* nanos) {
+  struct timespec ts;
+  clock_gettime(CLOCK_REALTIME, &ts);
+  *seconds = ts.tv_sec;
+  *nanos = static_cast<uint32_t>(ts.tv_nsec);
+}
+
+// Nanoseconds since some unspecified start, which never goes back. For
+// measuring durations.
+inline int64_t monotonic_ns() {
+  return clock_ns(CLOCK_MONOTONIC);
+}
+
+#ifdef CLOCK_REALTIME_COARSE
+inline int64_t realtime_coarse_ns() {
+  return clock_ns(CLOCK_REALTIME_COARSE);
+}
+inline int64_t monotonic_coarse_ns() {
+  return clock_ns(CLOCK_MONOTONIC_COARSE);
+}
+#else
+inline int64_t realtime_coarse_ns() {
+  return realtime_ns();
+}
+inline int64_t monotonic_coarse_ns() {
+  return monotonic_ns();
+}
+#endif
+
+// The CPU time stamp counter, which counts cycles at a constant rate on
+// modern x86 CPUs, and is read in a few ns without leaving user space. The
+// rate is calibrated against CLOCK_MONOTONIC once, on first use of the
+// conversions, which takes some 10ms.
+//
+// Where there is no TSC, the ticks are CLOCK_MONOTONIC nanoseconds.
+class TscClock {
+  public:
+    // True if the counter is invariant, i.e. does not change rate with
+    // power states, so that it can be used as a clock. Otherwise ticks()
+    // still works, but may drift.
+    static bool available();
+
+    static inline uint64_t ticks() {
+#ifdef SFU_TIME_HAS_TSC
+      return __rdtsc();
+#else
+      return static_cast<uint64_t>(time::monotonic_ns());
+#endif
+    }
+
+    // Nanoseconds for a number of ticks, e.g. the difference of two reads.
+    static int64_t to_ns(uint64_t ticks);
+    // Nanoseconds on the CLOCK_MONOTONIC scale for a ticks() read.
+    static int64_t ticks_to_monotonic_ns(uint64_t ticks);
+    // The current time on the CLOCK_MONOTONIC scale, from the counter.
+    static int64_t now_ns();
+    // The calibrated ticks per second.
+    static double frequency();
+
+  private:
+    TscClock() {}
+};
+
+// The time, as updated by a background thread at a fixed interval, for
+// callers that can take that much staleness. Reads are a relaxed atomic
+// load.
+class CachedClock {
+  public:
+    explicit CachedClock(int interval_ms = 1);
+    ~CachedClock();
+
+    inline int64_t realtime_ns() const {
+      return realtime_ns_.load(std::memory_order_relaxed);
+    }
+    inline int64_t monotonic_ns() const {
+      return monotonic_ns_.load(std::memory_order_relaxed);
+    }
+    inline time_t now() const {
+      return static_cast<time_t>(realtime_ns() / kNanosPerSecond);
+    }
+
+    // A clock updated every millisecond, started on first use and never
+    // stopped.
+    static const CachedClock& Default();
+
+  private:
+    // Not copyable.
+    CachedClock(const CachedClock& clock);
+    CachedClock& operator=(const CachedClock& clock);
+
+    const int interval_ms_;
+    std::atomic<int64_t> realtime_ns_;
+    std::atomic<int64_t> monotonic_ns_;
+
+    std::mutex mutex_;
+    std::condition_variable stop_cv_;
+    bool stop_;
+    std::thread thread_;
+
+    // ---- methods ----
+    void Update();
+    void Loop();
+};
+
+}  // namespace time
+}  // namespace sfu
+
+#endif  // SFU_TIME_CLOCK_H_
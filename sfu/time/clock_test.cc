@@ -0,0 +1,92 @@
+#include <unistd.h>
+
+#include <ctime>
+
+#include "sfu/time/clock.h"
+#include "sfu/time/time.h"
+#include "gtest/gtest.h"
+
+using namespace sfu::time;
+
+TEST(ClockTest, TestClocks) {
+  const int64_t before = ::time(NULL) * kNanosPerSecond;
+  const int64_t wall = realtime_ns();
+  EXPECT_LE(before, wall);
+  EXPECT_GT(before + 2 * kNanosPerSecond, wall);
+
+  time_t seconds;
+  uint32_t nanos;
+  realtime(&seconds, &nanos);
+  EXPECT_LE(wall / kNanosPerSecond, seconds);
+  EXPECT_GT(1000000000u, nanos);
+
+  // The coarse clocks lag by at most a tick.
+  const int64_t resolution = clock_resolution_ns(CLOCK_MONOTONIC_COARSE);
+  EXPECT_LT(0, resolution);
+  EXPECT_GE(kNanosPerSecond / 10, resolution);
+  const int64_t mono = monotonic_ns();
+  const int64_t coarse = monotonic_coarse_ns();
+  EXPECT_GE(mono + 1000, coarse);
+  EXPECT_LE(mono - 2 * resolution, coarse);
+  EXPECT_LE(realtime_ns() - 2 * resolution, realtime_coarse_ns());
+
+  int64_t last = monotonic_ns();
+  for (int i = 0; i < 10000; ++i) {
+    const int64_t next = monotonic_ns();
+    ASSERT_LE(last, next);
+    last = next;
+  }
+}
+
+TEST(ClockTest, TestNow) {
+  const time_t before = ::time(NULL);
+  const time_t ts = now();
+  EXPECT_LE(before, ts);
+  EXPECT_GE(::time(NULL), ts);
+}
+
+TEST(ClockTest, TestTscClock) {
+  EXPECT_LT(1e6, TscClock::frequency());
+
+  const uint64_t start = TscClock::ticks();
+  const int64_t start_ns = monotonic_ns();
+  usleep(50000);
+  const uint64_t end = TscClock::ticks();
+  const int64_t end_ns = monotonic_ns();
+  EXPECT_LT(start, end);
+  if (!TscClock::available()) return;
+
+  // Within 2% of the monotonic clock, to allow for busy test machines.
+  const int64_t elapsed = end_ns - start_ns;
+  EXPECT_NEAR(elapsed, TscClock::to_ns(end - start), elapsed / 50);
+  EXPECT_NEAR(end_ns, TscClock::ticks_to_monotonic_ns(end), elapsed / 50);
+  EXPECT_NEAR(monotonic_ns(), TscClock::now_ns(), 1000000);
+
+  int64_t last = TscClock::now_ns();
+  for (int i = 0; i < 10000; ++i) {
+    const int64_t next = TscClock::now_ns();
+    ASSERT_LE(last, next);
+    last = next;
+  }
+}
+
+TEST(ClockTest, TestCachedClock) {
+  CachedClock clock(2);
+  for (int i = 0; i < 10; ++i) {
+    const int64_t mono = monotonic_ns();
+    const int64_t cached = clock.monotonic_ns();
+    EXPECT_GE(mono, cached);
+    // Two intervals, and slack for a busy machine.
+    EXPECT_LT(mono - 100000000, cached);
+    EXPECT_LT(realtime_ns() - 100000000, clock.realtime_ns());
+    usleep(3000);
+  }
+  const int64_t first = clock.monotonic_ns();
+  usleep(20000);
+  EXPECT_LT(first, clock.monotonic_ns());
+
+  const CachedClock& global = CachedClock::Default();
+  EXPECT_EQ(&global, &CachedClock::Default());
+  EXPECT_GE(::time(NULL), global.now());
+  EXPECT_LE(::time(NULL) - 1, global.now());
+}
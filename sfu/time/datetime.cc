@@ -0,0 +1,191 @@
+#include "sfu/time/datetime.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "sfu/time/civil.h"
+#include "sfu/time/zoneinfo.h"
+
+namespace sfu {
+namespace time {
+namespace datetime_internal {
+
+const size_t kFormatBufferSize = 256;
+
+// Seconds since midnight of the local time.
+inline int32_t seconds_of_day(time_t local) {
+  return static_cast<int32_t>(local - days_from_timestamp(local) *
+                                      kSecondsPerDay);
+}
+
+}  // namespace datetime_internal
+
+using namespace datetime_internal;
+
+Datetime::Datetime()
+    : timestamp_(now()),
+      timezone_(LocalZone()),
+      local_(timezone_ ? timezone_->localtime(timestamp_) : timestamp_) {}
+
+Datetime::Datetime(time_t timestamp, const Zoneinfo* timezone)
+    : timestamp_(timestamp),
+      timezone_(timezone),
+      local_(timezone ? timezone->localtime(timestamp) : timestamp) {}
+
+Datetime::Datetime(const Datetime& dt)
+    : timestamp_(dt.timestamp_),
+      timezone_(dt.timezone_),
+      local_(dt.local_) {}
+
+Datetime::Datetime(Datetime&& dt)
+    : timestamp_(dt.timestamp_),
+      timezone_(dt.timezone_),
+      local_(dt.local_) {}
+
+Datetime::~Datetime() {}
+
+Datetime& Datetime::operator=(const Datetime& dt) {
+  timestamp_ = dt.timestamp_;
+  timezone_ = dt.timezone_;
+  local_ = dt.local_;
+  return *this;
+}
+
+// static
+const Zoneinfo* Datetime::LocalZone() {
+  const char* tz = getenv("TZ");
+  if (tz && *tz) {
+    // As glibc, ":name" and "name" both name a zone file.
+    if (*tz == ':') ++tz;
+    return Zoneinfo::GetZoneinfo(tz);
+  }
+  return Zoneinfo::GetZoneinfo("/etc/localtime");
+}
+
+time_t Datetime::timestamp() const {
+  return timestamp_;
+}
+
+time_t Datetime::localtime() const {
+  return local_;
+}
+
+int32_t Datetime::utcoffset() const {
+  return static_cast<int32_t>(local_ - timestamp_);
+}
+
+int32_t Datetime::year() const {
+  int64_t year;
+  unsigned month, day;
+  civil_from_days(days_from_timestamp(local_), &year, &month, &day);
+  return static_cast<int32_t>(year);
+}
+
+uint8_t Datetime::month() const {
+  int64_t year;
+  unsigned month, day;
+  civil_from_days(days_from_timestamp(local_), &year, &month, &day);
+  return static_cast<uint8_t>(month);
+}
+
+uint8_t Datetime::day() const {
+  int64_t year;
+  unsigned month, day;
+  civil_from_days(days_from_timestamp(local_), &year, &month, &day);
+  return static_cast<uint8_t>(day);
+}
+
+uint8_t Datetime::hour() const {
+  return static_cast<uint8_t>(seconds_of_day(local_) / 3600);
+}
+
+uint8_t Datetime::minute() const {
+  return static_cast<uint8_t>(seconds_of_day(local_) / 60 % 60);
+}
+
+uint8_t Datetime::second() const {
+  return static_cast<uint8_t>(seconds_of_day(local_) % 60);
+}
+
+uint8_t Datetime::weekday() const {
+  return static_cast<uint8_t>(weekday_from_days(days_from_timestamp(local_)));
+}
+
+uint8_t Datetime::clockHour() const {
+  const uint8_t h = hour() % 12;
+  return h == 0 ? 12 : h;
+}
+
+bool Datetime::clockIsPm() const {
+  return hour() >= 12;
+}
+
+const std::string Datetime::toString() const {
+  int64_t year;
+  unsigned month, day;
+  civil_from_days(days_from_timestamp(local_), &year, &month, &day);
+  const int32_t sod = seconds_of_day(local_);
+
+  char buffer[64];
+  snprintf(buffer, sizeof(buffer), "%04lld-%02u-%02u %02d:%02d:%02d %s",
+           static_cast<long long>(year), month, day,
+           sod / 3600, sod / 60 % 60, sod % 60,
+           timezone_ ? timezone_->zone(timestamp_).c_str() : "UTC");
+  return buffer;
+}
+
+const std::string Datetime::toISOString() const {
+  int64_t year;
+  unsigned month, day;
+  civil_from_days(days_from_timestamp(local_), &year, &month, &day);
+  const int32_t sod = seconds_of_day(local_);
+  const int32_t offset = utcoffset();
+  const int32_t abs_offset = offset < 0 ? -offset : offset;
+
+  char buffer[64];
+  if (offset == 0) {
+    snprintf(buffer, sizeof(buffer), "%04lld-%02u-%02uT%02d:%02d:%02dZ",
+             static_cast<long long>(year), month, day,
+             sod / 3600, sod / 60 % 60, sod % 60);
+  } else {
+    snprintf(buffer, sizeof(buffer),
+             "%04lld-%02u-%02uT%02d:%02d:%02d%c%02d:%02d",
+             static_cast<long long>(year), month, day,
+             sod / 3600, sod / 60 % 60, sod % 60,
+             offset < 0 ? '-' : '+', abs_offset / 3600,
+             abs_offset / 60 % 60);
+  }
+  return buffer;
+}
+
+const std::string Datetime::format(const char* format) const {
+  int64_t year;
+  unsigned month, day;
+  const int64_t days = days_from_timestamp(local_);
+  civil_from_days(days, &year, &month, &day);
+  const int32_t sod = seconds_of_day(local_);
+
+  struct tm tm;
+  memset(&tm, 0, sizeof(tm));
+  tm.tm_year = static_cast<int>(year - 1900);
+  tm.tm_mon = month - 1;
+  tm.tm_mday = day;
+  tm.tm_hour = sod / 3600;
+  tm.tm_min = sod / 60 % 60;
+  tm.tm_sec = sod % 60;
+  tm.tm_wday = weekday_from_days(days);
+  tm.tm_yday = static_cast<int>(days - days_from_civil(year, 1, 1));
+  tm.tm_isdst = 0;
+#ifdef __USE_MISC
+  tm.tm_gmtoff = utcoffset();
+  tm.tm_zone = timezone_ ? timezone_->zone(timestamp_).c_str() : "UTC";
+#endif
+
+  char buffer[kFormatBufferSize];
+  size_t len = strftime(buffer, sizeof(buffer), format, &tm);
+  return std::string(buffer, len);
+}
+
+};  // namespace time
+};  // namespace sfu
@@ -13,19 +13,34 @@ namespace time {
 class Zoneinfo;
 
 
+// A point in time in a timezone. All fields are computed with integer
+// arithmetic from the timestamp and the zone offset, without libc calls or
+// locks, so a Datetime can be used from any thread.
 class Datetime {
   public:
     // Default Datetime is initialized with the current time and local timezone.
     Datetime();
+    // The UTC timestamp in the timezone, where NULL means UTC.
+    explicit Datetime(time_t timestamp, const Zoneinfo* timezone = NULL);
     // Copy constructor
     Datetime(const Datetime& dt);
     // Move constructor
     Datetime(Datetime&& dt);
     ~Datetime();
 
+    Datetime& operator=(const Datetime& dt);
+
+    // The zone of $TZ, or /etc/localtime if not set. NULL if neither can be
+    // loaded, which means UTC.
+    static const Zoneinfo* LocalZone();
+
     // The unix timestamp.
-    time_t unix();
-    time_t localtime();
+    time_t timestamp() const;
+    // The timestamp shifted by the UTC offset, so that it counts local time.
+    time_t localtime() const;
+    // Seconds east of UTC.
+    int32_t utcoffset() const;
+    inline const Zoneinfo* timezone() const { return timezone_; }
 
     // The year according to the Gregorian calendar.
     int32_t year() const;
@@ -39,15 +54,20 @@ class Datetime {
     uint8_t minute() const;
     // The second of the minute. 0-60 (to accommodate for leap seconds).
     uint8_t second() const;
+    // The day of week, 0-6 for Sunday-Saturday.
+    uint8_t weekday() const;
 
     // The hour using clock counting: 1-12.
     uint8_t clockHour() const;
     // Whether the clock is on the PM round, If false is AM.
     bool    clockIsPm() const;
 
-    // Make a readable string from the
+    // Make a readable string from the time, e.g.
+    // "2014-05-31 22:46:50 CEST".
     const std::string toString() const;
+    // RFC-3339 time, e.g. "2014-05-31T22:46:50+02:00".
     const std::string toISOString() const;
+    // Format as strftime().
     const std::string format(const char* format) const;
 
   private:
@@ -55,6 +75,8 @@ class Datetime {
     time_t timestamp_;
     // Timezone 
     const Zoneinfo* timezone_;
+    // Local time, as timestamp_ plus the UTC offset.
+    time_t local_;
 };
 
 };  // namespace time
@@ -0,0 +1,143 @@
+#include <stdlib.h>
+
+#include <ctime>
+#include <random>
+
+#include "sfu/time/civil.h"
+#include "sfu/time/datetime.h"
+#include "sfu/time/zoneinfo.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+using namespace sfu::time;
+
+TEST(DatetimeTest, TestCivil) {
+  EXPECT_EQ(0, days_from_civil(1970, 1, 1));
+  EXPECT_EQ(-1, days_from_civil(1969, 12, 31));
+  EXPECT_EQ(11017, days_from_civil(2000, 3, 1));
+  EXPECT_EQ(-719468, days_from_civil(0, 3, 1));
+
+  // Every day from year -1000 to 3000 round trips.
+  int64_t days = days_from_civil(-1000, 1, 1);
+  unsigned weekday = weekday_from_days(days);
+  for (int64_t y = -1000; y <= 3000; ++y) {
+    for (unsigned m = 1; m <= 12; ++m) {
+      const unsigned kDays[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+      const unsigned month_days = kDays[m - 1] + (m == 2 && is_leap_year(y));
+      for (unsigned d = 1; d <= month_days; ++d) {
+        ASSERT_EQ(days, days_from_civil(y, m, d));
+        int64_t y2;
+        unsigned m2, d2;
+        civil_from_days(days, &y2, &m2, &d2);
+        ASSERT_EQ(y, y2);
+        ASSERT_EQ(m, m2);
+        ASSERT_EQ(d, d2);
+        ASSERT_EQ(weekday, weekday_from_days(days));
+        ++days;
+        weekday = (weekday + 1) % 7;
+      }
+    }
+  }
+
+  EXPECT_EQ(0, days_from_timestamp(0));
+  EXPECT_EQ(0, days_from_timestamp(86399));
+  EXPECT_EQ(-1, days_from_timestamp(-1));
+  EXPECT_EQ(-1, days_from_timestamp(-86400));
+  EXPECT_EQ(-2, days_from_timestamp(-86401));
+}
+
+TEST(DatetimeTest, TestFieldsUtc) {
+  mt19937_64 rng(7);
+  for (int i = 0; i < 100000; ++i) {
+    // Year 1 to 9999.
+    const time_t ts = static_cast<time_t>(rng() % 315537897600LL) -
+                      62135596800LL;
+    struct tm tm;
+    gmtime_r(&ts, &tm);
+
+    Datetime dt(ts);
+    ASSERT_EQ(tm.tm_year + 1900, dt.year()) << ts;
+    ASSERT_EQ(tm.tm_mon + 1, dt.month()) << ts;
+    ASSERT_EQ(tm.tm_mday, dt.day()) << ts;
+    ASSERT_EQ(tm.tm_hour, dt.hour()) << ts;
+    ASSERT_EQ(tm.tm_min, dt.minute()) << ts;
+    ASSERT_EQ(tm.tm_sec, dt.second()) << ts;
+    ASSERT_EQ(tm.tm_wday, dt.weekday()) << ts;
+  }
+}
+
+TEST(DatetimeTest, TestZone) {
+  const Zoneinfo* oslo = Zoneinfo::GetZoneinfo("Europe/Oslo");
+  ASSERT_TRUE(oslo != NULL);
+
+  // 2009-02-14 00:31:30 CET.
+  Datetime dt(1234567890, oslo);
+  EXPECT_EQ(1234567890, dt.timestamp());
+  EXPECT_EQ(1234567890 + 3600, dt.localtime());
+  EXPECT_EQ(3600, dt.utcoffset());
+  EXPECT_EQ(oslo, dt.timezone());
+  EXPECT_EQ(2009, dt.year());
+  EXPECT_EQ(2, dt.month());
+  EXPECT_EQ(14, dt.day());
+  EXPECT_EQ(0, dt.hour());
+  EXPECT_EQ(31, dt.minute());
+  EXPECT_EQ(30, dt.second());
+  EXPECT_EQ(6, dt.weekday());
+  EXPECT_EQ(12, dt.clockHour());
+  EXPECT_FALSE(dt.clockIsPm());
+  EXPECT_EQ("2009-02-14 00:31:30 CET", dt.toString());
+  EXPECT_EQ("2009-02-14T00:31:30+01:00", dt.toISOString());
+  EXPECT_EQ("Sat, 14 Feb 2009 00:31:30 +0100 CET",
+            dt.format("%a, %d %b %Y %H:%M:%S %z %Z"));
+
+  // 2009-07-01 14:00:00 CEST.
+  Datetime summer(1246449600, oslo);
+  EXPECT_EQ(14, summer.hour());
+  EXPECT_EQ(2, summer.clockHour());
+  EXPECT_TRUE(summer.clockIsPm());
+  EXPECT_EQ("2009-07-01 14:00:00 CEST", summer.toString());
+
+  Datetime utc(1234567890);
+  EXPECT_EQ("2009-02-13 23:31:30 UTC", utc.toString());
+  EXPECT_EQ("2009-02-13T23:31:30Z", utc.toISOString());
+
+  const Zoneinfo* st_johns = Zoneinfo::GetZoneinfo("America/St_Johns");
+  ASSERT_TRUE(st_johns != NULL);
+  EXPECT_EQ("2009-02-13T20:01:30-03:30",
+            Datetime(1234567890, st_johns).toISOString());
+
+  // Before 1970.
+  Datetime old(-1, oslo);
+  EXPECT_EQ("1970-01-01 00:59:59 CET", old.toString());
+}
+
+TEST(DatetimeTest, TestCopy) {
+  const Zoneinfo* oslo = Zoneinfo::GetZoneinfo("Europe/Oslo");
+  Datetime dt(1234567890, oslo);
+  Datetime copy(dt);
+  EXPECT_EQ(dt.toString(), copy.toString());
+  Datetime other(0);
+  other = dt;
+  EXPECT_EQ(dt.toISOString(), other.toISOString());
+}
+
+TEST(DatetimeTest, TestLocal) {
+  const char* old_tz = getenv("TZ");
+  setenv("TZ", "Asia/Kolkata", 1);
+  const Zoneinfo* kolkata = Datetime::LocalZone();
+  ASSERT_TRUE(kolkata != NULL);
+  EXPECT_EQ("Asia/Kolkata", kolkata->locale());
+  Datetime dt;
+  EXPECT_EQ(kolkata, dt.timezone());
+  EXPECT_EQ(19800, dt.utcoffset());
+  EXPECT_LT(1234567890, dt.timestamp());
+
+  setenv("TZ", ":Europe/Oslo", 1);
+  EXPECT_EQ(Zoneinfo::GetZoneinfo("Europe/Oslo"), Datetime::LocalZone());
+
+  if (old_tz) {
+    setenv("TZ", old_tz, 1);
+  } else {
+    unsetenv("TZ");
+  }
+}
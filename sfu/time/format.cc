@@ -1,32 +1,144 @@
 #include <string>
 #include <cstdarg>
 #include <cstdio>
+#include <cstring>
 #include <ctime>
 
+#include "sfu/numbers.h"
+#include "sfu/time/civil.h"
 #include "sfu/time/format.h"
+#include "sfu/time/zoneinfo.h"
 
 namespace sfu {
 namespace time {
-  
+namespace format_internal {
+
 static const size_t kFormatStringTimeBufferSize = 64;
+// Largest output tried by format_into(), and Formatter::FormatInto().
+static const size_t kMaxFormatSize = 64 * 1024;
 
-bool format_into(std::string* into, const char* fmt, time_t ts, bool utc) {
-  char buffer[kFormatStringTimeBufferSize] = {0, };
+static const char* const kWeekdays[] = {
+  "Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday",
+  "Saturday",
+};
+static const char* const kMonths[] = {
+  "January", "February", "March", "April", "May", "June", "July",
+  "August", "September", "October", "November", "December",
+};
+static const uint32_t kPow10[] = {
+  1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000,
+  1000000000,
+};
+
+enum OpKind {
+  kLiteral,
+  kWeekdayShort,   // %a
+  kWeekdayLong,    // %A
+  kMonthShort,     // %b %h
+  kMonthLong,      // %B
+  kCentury,        // %C
+  kDay,            // %d
+  kDaySpace,       // %e
+  kIsoYear,        // %G
+  kIsoYearShort,   // %g
+  kHour,           // %H
+  kHourSpace,      // %k
+  kClockHour,      // %I
+  kClockHourSpace, // %l
+  kYearDay,        // %j
+  kMonth,          // %m
+  kMinute,         // %M
+  kSubsecond,      // %N %3N
+  kAmPm,           // %p
+  kAmPmLower,      // %P
+  kSecond,         // %S
+  kEpoch,          // %s
+  kWeekdayMonday,  // %u
+  kWeekSunday,     // %U
+  kIsoWeek,        // %V
+  kWeekdaySunday,  // %w
+  kWeekMonday,     // %W
+  kYear,           // %Y
+  kYearShort,      // %y
+  kOffset,         // %z
+  kOffsetColon,    // %:z
+  kZone,           // %Z
+};
+
+// Writes to [p, last), and remembers if it did not fit.
+struct Writer {
+  char* p;
+  char* last;
+  bool fits;
+
+  Writer(char* first, char* end) : p(first), last(end), fits(true) {}
+
+  void put(const char* text, size_t length) {
+    if (static_cast<size_t>(last - p) < length) {
+      fits = false;
+      p = last;
+      return;
+    }
+    memcpy(p, text, length);
+    p += length;
+  }
+  void put(const char* text) { put(text, strlen(text)); }
+  void put(char c) { put(&c, 1); }
+  // The value with at least width digits, padded with pad.
+  void put(int64_t value, int width, char pad = '0') {
+    char buffer[kMaxIntegerChars + 1];
+    char* end = to_chars(buffer, buffer + sizeof(buffer), value);
+    const int length = static_cast<int>(end - buffer);
+    for (int i = length; i < width; ++i) put(pad);
+    put(buffer, length);
+  }
+};
+
+// The digits of the first digits of the nanoseconds.
+inline void put_subsecond(char* p, uint32_t nanos, uint8_t digits) {
+  uint32_t value = nanos / kPow10[9 - digits];
+  for (int i = digits - 1; i >= 0; --i) {
+    p[i] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  }
+}
+
+// ISO 8601 weeks of the year, 52 or 53.
+inline int64_t iso_weeks(int64_t year) {
+  const unsigned jan1 = weekday_from_days(days_from_civil(year, 1, 1));
+  return jan1 == 4 || (jan1 == 3 && is_leap_year(year)) ? 53 : 52;
+}
+
+inline int64_t floor_div(int64_t a, int64_t b) {
+  return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
 
+}  // namespace format_internal
+
+using namespace format_internal;
+
+bool format_into(std::string* into, const char* fmt, time_t ts, bool utc) {
   struct tm time;
   if (utc) {
     gmtime_r(static_cast<const time_t*>(&ts), &time);
   } else {
     localtime_r(static_cast<const time_t*>(&ts), &time);
   }
-  size_t p = strftime(buffer, kFormatStringTimeBufferSize, fmt, &time);
 
-  if (p >= kFormatStringTimeBufferSize) {
-    return false;
+  // strftime() gives 0 both for output that does not fit and for empty
+  // output, so try larger buffers up to a sane size.
+  std::string buffer;
+  for (size_t size = kFormatStringTimeBufferSize; size <= kMaxFormatSize;
+       size *= 4) {
+    buffer.resize(size);
+    size_t p = strftime(&buffer[0], size, fmt, &time);
+    if (p > 0 || *fmt == '\0') {
+      into->clear();
+      into->append(buffer.data(), p);
+      return true;
+    }
   }
-  into->clear();
-  into->append(buffer, p);
-  return true;
+  return false;
 }
 
 const std::string format(const char* fmt, time_t ts, bool utc) {
@@ -35,5 +147,375 @@ const std::string format(const char* fmt, time_t ts, bool utc) {
   return out;
 }
 
-}  // namespace strings
+Formatter::Formatter(const char* format, const Zoneinfo* zone)
+    : zone_(zone),
+      sequence_(0),
+      cached_second_(0),
+      cached_length_(0),
+      cached_positions_(0) {
+  for (size_t i = 0; i < kCacheWords; ++i) {
+    cached_text_[i].store(0, std::memory_order_relaxed);
+  }
+  Compile(format);
+}
+
+Formatter::~Formatter() {}
+
+void Formatter::AddLiteral(const char* text, size_t length) {
+  if (length == 0) return;
+  if (!ops_.empty() && ops_.back().kind == kLiteral) {
+    ops_.back().length += length;
+  } else {
+    Op op = { kLiteral, 0, static_cast<uint32_t>(literals_.size()),
+              static_cast<uint32_t>(length) };
+    ops_.push_back(op);
+  }
+  literals_.append(text, length);
+}
+
+void Formatter::Compile(const char* format) {
+  const char* p = format;
+  while (*p) {
+    if (*p != '%') {
+      const char* start = p;
+      while (*p && *p != '%') ++p;
+      AddLiteral(start, p - start);
+      continue;
+    }
+
+    const char* start = p++;
+    Op op = { kLiteral, 0, 0, 0 };
+    // GNU date sub-second digits, and colon offset.
+    if (*p >= '1' && *p <= '9' && p[1] == 'N') {
+      op.kind = kSubsecond;
+      op.digits = static_cast<uint8_t>(*p - '0');
+      ops_.push_back(op);
+      subsecond_digits_.push_back(op.digits);
+      p += 2;
+      continue;
+    }
+    if (*p == ':' && p[1] == 'z') {
+      op.kind = kOffsetColon;
+      ops_.push_back(op);
+      p += 2;
+      continue;
+    }
+    // The E and O modifiers change nothing in the "C" locale.
+    if ((*p == 'E' || *p == 'O') && p[1] != '\0') ++p;
+
+    switch (*p) {
+      case 'a': op.kind = kWeekdayShort; break;
+      case 'A': op.kind = kWeekdayLong; break;
+      case 'b': op.kind = kMonthShort; break;
+      case 'B': op.kind = kMonthLong; break;
+      case 'c': Compile("%a %b %e %H:%M:%S %Y"); break;
+      case 'C': op.kind = kCentury; break;
+      case 'd': op.kind = kDay; break;
+      case 'D': Compile("%m/%d/%y"); break;
+      case 'e': op.kind = kDaySpace; break;
+      case 'F': Compile("%Y-%m-%d"); break;
+      case 'G': op.kind = kIsoYear; break;
+      case 'g': op.kind = kIsoYearShort; break;
+      case 'h': op.kind = kMonthShort; break;
+      case 'H': op.kind = kHour; break;
+      case 'I': op.kind = kClockHour; break;
+      case 'j': op.kind = kYearDay; break;
+      case 'k': op.kind = kHourSpace; break;
+      case 'l': op.kind = kClockHourSpace; break;
+      case 'm': op.kind = kMonth; break;
+      case 'M': op.kind = kMinute; break;
+      case 'n': AddLiteral("\n", 1); break;
+      case 'N':
+        op.kind = kSubsecond;
+        op.digits = 9;
+        subsecond_digits_.push_back(op.digits);
+        break;
+      case 'p': op.kind = kAmPm; break;
+      case 'P': op.kind = kAmPmLower; break;
+      case 'r': Compile("%I:%M:%S %p"); break;
+      case 'R': Compile("%H:%M"); break;
+      case 's': op.kind = kEpoch; break;
+      case 'S': op.kind = kSecond; break;
+      case 't': AddLiteral("\t", 1); break;
+      case 'T': Compile("%H:%M:%S"); break;
+      case 'u': op.kind = kWeekdayMonday; break;
+      case 'U': op.kind = kWeekSunday; break;
+      case 'V': op.kind = kIsoWeek; break;
+      case 'w': op.kind = kWeekdaySunday; break;
+      case 'W': op.kind = kWeekMonday; break;
+      case 'x': Compile("%m/%d/%y"); break;
+      case 'X': Compile("%H:%M:%S"); break;
+      case 'y': op.kind = kYearShort; break;
+      case 'Y': op.kind = kYear; break;
+      case 'z': op.kind = kOffset; break;
+      case 'Z': op.kind = kZone; break;
+      case '%': AddLiteral("%", 1); break;
+      case '\0':
+        // A trailing '%'.
+        AddLiteral("%", 1);
+        continue;
+      default:
+        AddLiteral(start, p + 1 - start);
+        break;
+    }
+    if (op.kind != kLiteral) ops_.push_back(op);
+    ++p;
+  }
+}
+
+char* Formatter::FormatSecond(time_t ts, uint32_t nanos, char* first,
+                              char* last, uint64_t* positions) const {
+  const int32_t offset = zone_ ? static_cast<int32_t>(zone_->utcoffset(ts))
+                               : 0;
+  const int64_t local = static_cast<int64_t>(ts) + offset;
+  const int64_t days = days_from_timestamp(local);
+  int64_t year;
+  unsigned month, day;
+  civil_from_days(days, &year, &month, &day);
+  const int32_t sod = static_cast<int32_t>(local - days * kSecondsPerDay);
+  const int hour = sod / 3600;
+  const int clock_hour = hour % 12 == 0 ? 12 : hour % 12;
+  const unsigned weekday = weekday_from_days(days);
+  const int64_t yday = days - days_from_civil(year, 1, 1);
+
+  Writer out(first, last);
+  size_t subsecond = 0;
+  *positions = 0;
+  for (const Op& op : ops_) {
+    switch (op.kind) {
+      case kLiteral:
+        out.put(literals_.data() + op.offset, op.length);
+        break;
+      case kWeekdayShort:
+        out.put(kWeekdays[weekday], 3);
+        break;
+      case kWeekdayLong:
+        out.put(kWeekdays[weekday]);
+        break;
+      case kMonthShort:
+        out.put(kMonths[month - 1], 3);
+        break;
+      case kMonthLong:
+        out.put(kMonths[month - 1]);
+        break;
+      case kCentury:
+        out.put(floor_div(year, 100), 2);
+        break;
+      case kDay:
+        out.put(day, 2);
+        break;
+      case kDaySpace:
+        out.put(day, 2, ' ');
+        break;
+      case kIsoYear:
+      case kIsoYearShort:
+      case kIsoWeek: {
+        // Weeks start on Monday, and week 1 has the year's first Thursday.
+        const int64_t monday_based = (weekday + 6) % 7;
+        int64_t iso_year = year;
+        int64_t week = (yday - monday_based + 10) / 7;
+        if (week < 1) {
+          --iso_year;
+          week = iso_weeks(iso_year);
+        } else if (week > iso_weeks(year)) {
+          ++iso_year;
+          week = 1;
+        }
+        if (op.kind == kIsoWeek) {
+          out.put(week, 2);
+        } else if (op.kind == kIsoYear) {
+          out.put(iso_year, 4);
+        } else {
+          out.put(iso_year - floor_div(iso_year, 100) * 100, 2);
+        }
+        break;
+      }
+      case kHour:
+        out.put(hour, 2);
+        break;
+      case kHourSpace:
+        out.put(hour, 2, ' ');
+        break;
+      case kClockHour:
+        out.put(clock_hour, 2);
+        break;
+      case kClockHourSpace:
+        out.put(clock_hour, 2, ' ');
+        break;
+      case kYearDay:
+        out.put(yday + 1, 3);
+        break;
+      case kMonth:
+        out.put(month, 2);
+        break;
+      case kMinute:
+        out.put(sod / 60 % 60, 2);
+        break;
+      case kSubsecond:
+        if (subsecond < kMaxSubsecond) {
+          *positions |= static_cast<uint64_t>(out.p - first) <<
+                        (16 * subsecond);
+        }
+        ++subsecond;
+        if (static_cast<size_t>(out.last - out.p) < op.digits) {
+          out.fits = false;
+          out.p = out.last;
+        } else {
+          put_subsecond(out.p, nanos, op.digits);
+          out.p += op.digits;
+        }
+        break;
+      case kAmPm:
+        out.put(hour < 12 ? "AM" : "PM", 2);
+        break;
+      case kAmPmLower:
+        out.put(hour < 12 ? "am" : "pm", 2);
+        break;
+      case kSecond:
+        out.put(sod % 60, 2);
+        break;
+      case kEpoch:
+        out.put(static_cast<int64_t>(ts), 1);
+        break;
+      case kWeekdayMonday:
+        out.put(weekday == 0 ? 7 : weekday, 1);
+        break;
+      case kWeekSunday:
+        out.put((yday + 7 - weekday) / 7, 2);
+        break;
+      case kWeekdaySunday:
+        out.put(weekday, 1);
+        break;
+      case kWeekMonday:
+        out.put((yday + 7 - (weekday + 6) % 7) / 7, 2);
+        break;
+      case kYear:
+        if (year < 0) {
+          out.put('-');
+          out.put(-year, 4);
+        } else {
+          out.put(year, 4);
+        }
+        break;
+      case kYearShort:
+        out.put(year - floor_div(year, 100) * 100, 2);
+        break;
+      case kOffset:
+      case kOffsetColon: {
+        const int32_t abs_offset = offset < 0 ? -offset : offset;
+        out.put(offset < 0 ? '-' : '+');
+        out.put(abs_offset / 3600, 2);
+        if (op.kind == kOffsetColon) out.put(':');
+        out.put(abs_offset / 60 % 60, 2);
+        break;
+      }
+      case kZone:
+        if (zone_) {
+          const std::string& name = zone_->zone(ts);
+          out.put(name.data(), name.size());
+        } else {
+          out.put("UTC", 3);
+        }
+        break;
+    }
+  }
+  return out.fits ? out.p : NULL;
+}
+
+bool Formatter::ReadCache(time_t ts, char* buffer, size_t size,
+                          size_t* length, uint64_t* positions) const {
+  const uint64_t sequence = sequence_.load(std::memory_order_acquire);
+  // Odd while written, and 0 before the first write.
+  if ((sequence & 1) || sequence == 0) return false;
+  if (cached_second_.load(std::memory_order_relaxed) != ts) return false;
+  const size_t cached_length =
+      cached_length_.load(std::memory_order_relaxed);
+  const uint64_t cached_positions =
+      cached_positions_.load(std::memory_order_relaxed);
+  uint64_t words[kCacheWords];
+  const size_t num_words = (cached_length + 7) / 8;
+  if (num_words > kCacheWords) return false;
+  for (size_t i = 0; i < num_words; ++i) {
+    words[i] = cached_text_[i].load(std::memory_order_relaxed);
+  }
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (sequence_.load(std::memory_order_relaxed) != sequence) return false;
+
+  if (cached_length > size) return false;
+  memcpy(buffer, words, cached_length);
+  *length = cached_length;
+  *positions = cached_positions;
+  return true;
+}
+
+void Formatter::WriteCache(time_t ts, const char* text, size_t length,
+                           uint64_t positions) const {
+  if (length > kCacheWords * 8 ||
+      subsecond_digits_.size() > kMaxSubsecond) {
+    return;
+  }
+  // If another thread is writing, leave the cache to it.
+  uint64_t sequence = sequence_.load(std::memory_order_relaxed);
+  if ((sequence & 1) ||
+      !sequence_.compare_exchange_strong(sequence, sequence + 1,
+                                         std::memory_order_relaxed)) {
+    return;
+  }
+  std::atomic_thread_fence(std::memory_order_release);
+
+  uint64_t words[kCacheWords] = { 0, };
+  memcpy(words, text, length);
+  cached_second_.store(ts, std::memory_order_relaxed);
+  cached_length_.store(static_cast<uint32_t>(length),
+                       std::memory_order_relaxed);
+  cached_positions_.store(positions, std::memory_order_relaxed);
+  for (size_t i = 0; i < (length + 7) / 8; ++i) {
+    cached_text_[i].store(words[i], std::memory_order_relaxed);
+  }
+  sequence_.store(sequence + 2, std::memory_order_release);
+}
+
+size_t Formatter::Format(time_t ts, uint32_t nanos,
+                         char* buffer, size_t size) const {
+  if (nanos > 999999999) nanos = 999999999;
+
+  size_t length;
+  uint64_t positions;
+  if (ReadCache(ts, buffer, size, &length, &positions)) {
+    for (size_t i = 0; i < subsecond_digits_.size(); ++i) {
+      put_subsecond(buffer + ((positions >> (16 * i)) & 0xffff), nanos,
+                    subsecond_digits_[i]);
+    }
+    return length;
+  }
+
+  char* end = FormatSecond(ts, nanos, buffer, buffer + size, &positions);
+  if (end == NULL) return 0;
+  length = end - buffer;
+  WriteCache(ts, buffer, length, positions);
+  return length;
+}
+
+void Formatter::FormatInto(std::string* into, time_t ts,
+                           uint32_t nanos) const {
+  if (ops_.empty()) return;
+  const size_t start = into->size();
+  for (size_t size = 128; size <= kMaxFormatSize; size *= 4) {
+    into->resize(start + size);
+    const size_t length = Format(ts, nanos, &(*into)[start], size);
+    if (length > 0) {
+      into->resize(start + length);
+      return;
+    }
+  }
+  into->resize(start);
+}
+
+const std::string Formatter::Format(time_t ts, uint32_t nanos) const {
+  std::string out;
+  FormatInto(&out, ts, nanos);
+  return out;
+}
+
+}  // namespace time
 }  // namespace sfu
@@ -1,17 +1,98 @@
 #ifndef SFU_TIME_FORMAT_H_
 #define SFU_TIME_FORMAT_H_
 
+#include <atomic>
+#include <cstdint>
+#include <ctime>
 #include <string>
-#include <cstdarg>
+#include <vector>
 
 namespace sfu {
 namespace time {
 
+class Zoneinfo;
+
 // Format reference:
 // @url{http://www.cplusplus.com/reference/ctime/strftime/}
 const std::string format(const char* format, time_t ts, bool utc = false);
 bool format_into(std::string* into, const char* format, time_t ts, bool utc = false);
 
+// A strftime() style format compiled once, for formatting many timestamps,
+// e.g. stamping log lines. The text for the last second formatted is cached,
+// so formatting another time within the same second only copies it and
+// writes the sub-second digits.
+//
+// Supports the conversions of strftime() in the "C" locale, and of GNU date:
+//   %N    Nanoseconds, 9 digits.
+//   %3N   Milliseconds, and so on for 1-9 digits.
+//   %:z   UTC offset as +hh:mm.
+// Other conversions are written as is.
+//
+// Format() takes no locks and can be called from any thread.
+class Formatter {
+  public:
+    // Format times in the zone, or UTC if NULL. The zone must outlive the
+    // formatter, as the zones of Zoneinfo::GetZoneinfo() do.
+    explicit Formatter(const char* format, const Zoneinfo* zone = NULL);
+    ~Formatter();
+
+    // Write the time into the buffer, which is not NUL terminated. Returns
+    // the length written, or 0 if it does not fit in size bytes.
+    size_t Format(time_t ts, uint32_t nanos, char* buffer, size_t size) const;
+    // Append the time to into.
+    void FormatInto(std::string* into, time_t ts, uint32_t nanos = 0) const;
+    const std::string Format(time_t ts, uint32_t nanos = 0) const;
+
+  private:
+    Formatter(const Formatter& formatter) {}
+    Formatter& operator=(const Formatter& formatter) { return *this; }
+
+    // A conversion, or literal text.
+    struct Op {
+      uint8_t kind;
+      // Digits of a sub-second field.
+      uint8_t digits;
+      // Literal text in literals_.
+      uint32_t offset;
+      uint32_t length;
+    };
+    // The most sub-second fields, whose positions in the cached text fit
+    // into one word.
+    static const size_t kMaxSubsecond = 4;
+    // Cached texts are at most this many words.
+    static const size_t kCacheWords = 16;
+
+    std::vector<Op> ops_;
+    std::string literals_;
+    const Zoneinfo* zone_;
+    // Digits of each sub-second field, in order.
+    std::vector<uint8_t> subsecond_digits_;
+
+    // The text of the last second formatted, as a seqlock: sequence_ is odd
+    // while the text is written, and readers retry from scratch if it
+    // changes while they read. The words are atomic so reading while they
+    // are written is well defined, only discarded.
+    mutable std::atomic<uint64_t> sequence_;
+    mutable std::atomic<int64_t> cached_second_;
+    mutable std::atomic<uint32_t> cached_length_;
+    // Offsets of the sub-second fields in the text, 16 bits each.
+    mutable std::atomic<uint64_t> cached_positions_;
+    mutable std::atomic<uint64_t> cached_text_[kCacheWords];
+
+    // ---- methods ----
+    void Compile(const char* format);
+    void AddLiteral(const char* text, size_t length);
+    // Format the time into [first, last), and set the offsets of the
+    // sub-second fields. Returns the end of the text, or NULL if it does not
+    // fit.
+    char* FormatSecond(time_t ts, uint32_t nanos, char* first, char* last,
+                       uint64_t* positions) const;
+    bool ReadCache(time_t ts, char* buffer, size_t size, size_t* length,
+                   uint64_t* positions) const;
+    void WriteCache(time_t ts, const char* text, size_t length,
+                    uint64_t positions) const;
+};
+
 }  // namespace time
 }  // namespace sfu
 
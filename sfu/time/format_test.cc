@@ -1,24 +1,219 @@
+#include <stdlib.h>
+
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sfu/testing/alloc_counter.h"
 #include "sfu/time/format.h"
+#include "sfu/time/zoneinfo.h"
 #include "gtest/gtest.h"
 
+using namespace std;
 using namespace sfu::time;
 
+namespace {
+
+// Set $TZ for the life of the object.
+class ScopedTZ {
+  public:
+    explicit ScopedTZ(const char* tz) {
+      const char* old_tz = getenv("TZ");
+      had_tz_ = old_tz != NULL;
+      if (had_tz_) old_tz_ = old_tz;
+      setenv("TZ", tz, 1);
+      tzset();
+    }
+    ~ScopedTZ() {
+      if (had_tz_) {
+        setenv("TZ", old_tz_.c_str(), 1);
+      } else {
+        unsetenv("TZ");
+      }
+      tzset();
+    }
+  private:
+    bool had_tz_;
+    string old_tz_;
+};
+
+}  // namespace
 
 TEST(FormatStringTest, TestFormatStringTime) {
   time_t ts = 1234567890;
 
-  const char *old_tz = getenv("TZ");
-  setenv("TZ", "America/Los_Angeles", 1);
-  tzset();
+  {
+    ScopedTZ tz("America/Los_Angeles");
+    EXPECT_EQ("2009-02-13 15:31:30 PST", format("%F %T %Z", ts));
+    EXPECT_EQ("2009-02-13 23:31:30 GMT", format("%F %T %Z", ts, true));
+  }
+  {
+    ScopedTZ tz("Asia/Kolkata");
+    EXPECT_EQ("2009-02-14 05:01:30 IST", format("%F %T %Z", ts));
+  }
+}
+
+TEST(FormatStringTest, TestFormatLong) {
+  // Longer than the first buffer tried.
+  string fmt;
+  string expected;
+  for (int i = 0; i < 20; ++i) {
+    fmt += "%F %T ";
+    expected += "2009-02-13 23:31:30 ";
+  }
+  string out;
+  EXPECT_TRUE(format_into(&out, fmt.c_str(), 1234567890, true));
+  EXPECT_EQ(expected, out);
+  EXPECT_TRUE(format_into(&out, "", 1234567890, true));
+  EXPECT_EQ("", out);
+}
+
+TEST(FormatterTest, TestFormat) {
+  const time_t ts = 1234567890;
+  EXPECT_EQ("2009-02-13 23:31:30 UTC", Formatter("%F %T %Z").Format(ts));
+  EXPECT_EQ("2009-02-13T23:31:30.123+00:00",
+            Formatter("%FT%T.%3N%:z").Format(ts, 123456789));
+  EXPECT_EQ("23:31:30.123456789", Formatter("%T.%N").Format(ts, 123456789));
+  EXPECT_EQ("1234567890 100% %Q", Formatter("%s 100%% %Q").Format(ts));
+  EXPECT_EQ("x%", Formatter("x%").Format(ts));
+  EXPECT_EQ("", Formatter("").Format(ts));
+
+  const Zoneinfo* oslo = Zoneinfo::GetZoneinfo("Europe/Oslo");
+  ASSERT_TRUE(oslo != NULL);
+  Formatter local("%a %b %e %H:%M:%S.%6N %Z %z", oslo);
+  EXPECT_EQ("Sat Feb 14 00:31:30.000007 CET +0100", local.Format(ts, 7000));
+  // 2009-07-01 02:00:00 CEST.
+  EXPECT_EQ("Wed Jul  1 02:00:00.000000 CEST +0200",
+            local.Format(1246406400));
+
+  const Zoneinfo* kolkata = Zoneinfo::GetZoneinfo("Asia/Kolkata");
+  ASSERT_TRUE(kolkata != NULL);
+  EXPECT_EQ("2009-02-14 05:01:30 IST",
+            Formatter("%F %T %Z", kolkata).Format(ts));
+}
+
+TEST(FormatterTest, TestSubsecond) {
+  Formatter formatter("[%T.%3N] [%6N]");
+  char buffer[64];
+  for (uint32_t nanos = 0; nanos < 1000000000; nanos += 99999989) {
+    size_t length = formatter.Format(1234567890, nanos, buffer,
+                                     sizeof(buffer));
+    char expected[64];
+    snprintf(expected, sizeof(expected), "[23:31:30.%03u] [%06u]",
+             nanos / 1000000, nanos / 1000);
+    EXPECT_EQ(expected, string(buffer, length));
+  }
+  // The next second.
+  EXPECT_EQ("[23:31:31.001] [001000]", formatter.Format(1234567891, 1000000));
+  // Out of range nanoseconds.
+  EXPECT_EQ("[23:31:31.999] [999999]",
+            formatter.Format(1234567891, 2000000000));
+}
+
+TEST(FormatterTest, TestBuffer) {
+  Formatter formatter("%F %T.%3N");
+  char buffer[32];
+  memset(buffer, '#', sizeof(buffer));
+  EXPECT_EQ(0u, formatter.Format(1234567890, 0, buffer, 22));
+  EXPECT_EQ(23u, formatter.Format(1234567890, 0, buffer, 23));
+  EXPECT_EQ("2009-02-13 23:31:30.000", string(buffer, 23));
+  // Cached, but still does not fit.
+  EXPECT_EQ(0u, formatter.Format(1234567890, 0, buffer, 10));
+  EXPECT_EQ('#', buffer[23]);
+
+  // Appends to the string.
+  string out("at ");
+  formatter.FormatInto(&out, 1234567890, 5000000);
+  EXPECT_EQ("at 2009-02-13 23:31:30.005", out);
 
-  EXPECT_EQ("2009-02-13 15:31:30 PST", FormatStringTime("%F %T %Z", ts));
-  EXPECT_EQ("2009-02-13 23:31:30 GMT", FormatStringTime("%F %T %Z", ts, 1));
+  // Longer than the cache.
+  string fmt;
+  string expected;
+  for (int i = 0; i < 20; ++i) {
+    fmt += "%F %T.%N ";
+    expected += "2009-02-13 23:31:30.000000001 ";
+  }
+  Formatter long_formatter(fmt.c_str());
+  EXPECT_EQ(expected, long_formatter.Format(1234567890, 1));
+  EXPECT_EQ(expected, long_formatter.Format(1234567890, 1));
+}
+
+TEST(FormatterTest, TestSameAsStrftime) {
+  const char* kFormats[] = {
+    "%a %A %b %B %h %c",
+    "%C %d %D %e %F %g %G %H %I %j %k %l %m %M %n %p %P %r %R %s %S %t %T",
+    "%u %U %V %w %W %x %X %y %Y %z %Z %%",
+    "%Ey %OH %Ec",
+  };
+  const char* kZones[] = {
+    "UTC", "Europe/Oslo", "America/Los_Angeles", "Asia/Kolkata",
+    "Australia/Sydney", "America/St_Johns",
+  };
 
-  setenv("TZ", "Asia/Kolkata", 1);
-  tzset();
+  mt19937_64 rng(4711);
+  // 1902 to 2100.
+  uniform_int_distribution<int64_t> dist(-2145916800LL, 4102444800LL);
+  vector<time_t> times;
+  for (int i = 0; i < 500; ++i) times.push_back(dist(rng));
+  // Around new year, for the week numbers.
+  for (int64_t year_start : { 1230768000LL, 1262304000LL, 1293840000LL,
+                              1609459200LL, 1640995200LL }) {
+    for (int64_t day = -7; day <= 7; ++day) {
+      times.push_back(year_start + day * 86400 + 43200);
+    }
+  }
 
-  EXPECT_EQ("2009-02-14 05:01:30 IST", FormatStringTime("%F %T %Z", ts));
+  for (const char* name : kZones) {
+    const Zoneinfo* zone = Zoneinfo::GetZoneinfo(name);
+    ASSERT_TRUE(zone != NULL) << name;
+    ScopedTZ tz(name);
+    for (const char* fmt : kFormats) {
+      Formatter formatter(fmt, zone);
+      for (time_t ts : times) {
+        struct tm tm;
+        localtime_r(&ts, &tm);
+        char expected[256];
+        size_t length = strftime(expected, sizeof(expected), fmt, &tm);
+        ASSERT_EQ(string(expected, length), formatter.Format(ts))
+            << name << " " << fmt << " " << ts;
+      }
+    }
+  }
+}
+
+TEST(FormatterTest, TestThreads) {
+  Formatter formatter("%F %T.%6N");
+  vector<thread> threads;
+  vector<int> errors(4, 0);
+  for (int t = 0; t < 4; ++t) {
+    threads.push_back(thread([&, t] {
+      char buffer[64];
+      char expected[64];
+      for (int i = 0; i < 20000; ++i) {
+        const time_t ts = 1234567890 + (i + t) % 3;
+        const uint32_t nanos = i * 1000;
+        size_t length = formatter.Format(ts, nanos, buffer, sizeof(buffer));
+        snprintf(expected, sizeof(expected), "2009-02-13 23:31:%02d.%06u",
+                 static_cast<int>(30 + (i + t) % 3), nanos / 1000);
+        if (string(buffer, length) != expected) ++errors[t];
+      }
+    }));
+  }
+  for (thread& t : threads) t.join();
+  for (int t = 0; t < 4; ++t) EXPECT_EQ(0, errors[t]);
+}
 
-  setenv("TZ", old_tz, 1);
-  tzset();
+TEST(FormatterTest, TestNoAlloc) {
+  const Zoneinfo* oslo = Zoneinfo::GetZoneinfo("Europe/Oslo");
+  ASSERT_TRUE(oslo != NULL);
+  Formatter formatter("%a %F %T.%6N %Z", oslo);
+  char buffer[64];
+  size_t length = 0;
+  // Both the first format of a second and the cached ones.
+  EXPECT_NO_ALLOC(length = formatter.Format(1234567890, 0, buffer,
+                                            sizeof(buffer)));
+  EXPECT_NO_ALLOC(length = formatter.Format(1234567890, 5000, buffer,
+                                            sizeof(buffer)));
+  EXPECT_EQ("Sat 2009-02-14 00:31:30.000005 CET", string(buffer, length));
 }
@@ -0,0 +1,465 @@
+#include "sfu/time/parse.h"
+
+#include <cstring>
+
+#include "sfu/numbers.h"
+#include "sfu/time/civil.h"
+#include "sfu/time/zoneinfo.h"
+
+namespace sfu {
+namespace time {
+namespace parse_internal {
+
+static const uint32_t kPow10[] = {
+  1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000,
+  1000000000,
+};
+
+// The 8 chars at p as a word with p[0] in the lowest byte.
+inline uint64_t load8(const char* p) {
+  uint64_t word;
+  memcpy(&word, p, 8);
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  word = __builtin_bswap64(word);
+#endif
+  return word;
+}
+
+inline uint8_t byte_at(uint64_t word, int byte) {
+  return static_cast<uint8_t>(word >> (8 * byte));
+}
+
+// Each 8 chars of "YYYY-MM-DDTHH:MM" XOR'ed with a pattern of '0' for digits
+// and the separators, so digits become 0-9 and separators 0. Adding the
+// limit then sets the high bit of any byte out of range: 0x76 for digits
+// (> 9), and 0x7f for separators (> 0).
+const uint64_t kHigh = 0x8080808080808080ULL;
+const uint64_t kDatePattern = 0x2d30302d30303030ULL;   // "0000-00-"
+const uint64_t kDateLimit = 0x7f76767f76767676ULL;
+const uint64_t kTimePattern = 0x30303a3030543030ULL;   // "00T00:00"
+const uint64_t kTimeLimit = 0x76767f76767f7676ULL;
+
+// The digits of the XOR'ed word as numbers of two digits, in the even
+// bytes: byte k is 10 * digit k + digit k + 1.
+inline uint64_t digit_pairs(uint64_t digits) {
+  return digits * 10 + (digits >> 8);
+}
+
+inline bool is_digit(char c) {
+  return c >= '0' && c <= '9';
+}
+
+inline bool is_alpha(char c) {
+  return (c | 0x20) >= 'a' && (c | 0x20) <= 'z';
+}
+
+// The two digits at p, or -1.
+inline int digits2(const char* p) {
+  if (!is_digit(p[0]) || !is_digit(p[1])) return -1;
+  return (p[0] - '0') * 10 + (p[1] - '0');
+}
+
+// Three letters lowercased into one word, for comparing names.
+inline uint32_t name3(const char* p) {
+  return (static_cast<uint32_t>(p[0] | 0x20) << 16) |
+         (static_cast<uint32_t>(p[1] | 0x20) << 8) |
+         static_cast<uint32_t>(p[2] | 0x20);
+}
+
+// The month 1-12 of the English month abbreviation at p, or 0.
+int month_from_name(const char* p) {
+  static const char kMonths[][4] = {
+    "jan", "feb", "mar", "apr", "may", "jun",
+    "jul", "aug", "sep", "oct", "nov", "dec",
+  };
+  const uint32_t name = name3(p);
+  for (int i = 0; i < 12; ++i) {
+    if (name == name3(kMonths[i])) return i + 1;
+  }
+  return 0;
+}
+
+bool is_weekday_name(const char* p) {
+  static const char kWeekdays[][4] = {
+    "sun", "mon", "tue", "wed", "thu", "fri", "sat",
+  };
+  const uint32_t name = name3(p);
+  for (int i = 0; i < 7; ++i) {
+    if (name == name3(kWeekdays[i])) return true;
+  }
+  return false;
+}
+
+inline unsigned days_in_month(int64_t year, unsigned month) {
+  static const uint8_t kDays[] = {31, 28, 31, 30, 31, 30,
+                                  31, 31, 30, 31, 30, 31};
+  return kDays[month - 1] + (month == 2 && is_leap_year(year));
+}
+
+// The fraction after the '.' at p, as nanoseconds. Returns the end of the
+// digits, or NULL if there are none.
+const char* parse_fraction(const char* p, const char* last, uint32_t* nanos) {
+  const char* start = p;
+  uint32_t value = 0;
+  for (; p < last && p - start < 9 && is_digit(*p); ++p) {
+    value = value * 10 + (*p - '0');
+  }
+  if (p == start) return NULL;
+  *nanos = value * kPow10[9 - (p - start)];
+  while (p < last && is_digit(*p)) ++p;
+  return p;
+}
+
+// The UTC time for a local time in the zone. In a gap or overlap of local
+// times this picks one, as mktime() does.
+inline int64_t local_to_utc(int64_t local, const Zoneinfo* zone) {
+  if (zone == NULL) return local;
+  const int64_t guess = local - zone->utcoffset(local);
+  return local - zone->utcoffset(guess);
+}
+
+inline bool valid_time(int64_t year, unsigned month, unsigned day,
+                       int hour, int minute, int second) {
+  return month >= 1 && month <= 12 && day >= 1 &&
+         day <= days_in_month(year, month) && hour >= 0 && hour <= 23 &&
+         minute >= 0 && minute <= 59 && second >= 0 && second <= 60;
+}
+
+inline int64_t seconds_from_civil(int64_t year, unsigned month, unsigned day,
+                                  int hour, int minute, int second) {
+  return days_from_civil(year, month, day) * kSecondsPerDay +
+         hour * 3600 + minute * 60 + second;
+}
+
+// "+hh:mm", "+hhmm" or "+hh" at p. Returns the end, or NULL.
+const char* parse_offset(const char* p, const char* last, int32_t* offset) {
+  if (last - p < 3 || (*p != '+' && *p != '-')) return NULL;
+  const int hours = digits2(p + 1);
+  if (hours < 0 || hours > 23) return NULL;
+  const char* end = p + 3;
+  int minutes = 0;
+  if (last - end >= 3 && *end == ':') {
+    minutes = digits2(end + 1);
+    if (minutes < 0) return NULL;
+    end += 3;
+  } else if (last - end >= 2 && is_digit(*end)) {
+    minutes = digits2(end);
+    if (minutes < 0) return NULL;
+    end += 2;
+  }
+  if (minutes > 59) return NULL;
+  *offset = (hours * 3600 + minutes * 60) * (*p == '-' ? -1 : 1);
+  return end;
+}
+
+const char* parse_rfc3339(const char* first, const char* last,
+                          time_t* ts, uint32_t* nanos,
+                          const Zoneinfo* zone) {
+  if (last - first < 19) return NULL;
+
+  const uint64_t date = load8(first) ^ kDatePattern;
+  uint64_t time = load8(first + 8) ^ kTimePattern;
+  // ' ' and 't' also separate the date and time.
+  const uint8_t separator = byte_at(time, 2);
+  if (separator == (' ' ^ 'T') || separator == ('t' ^ 'T')) {
+    time &= ~(0xffULL << 16);
+  }
+  if ((((date + kDateLimit) | date) & kHigh) != 0 ||
+      (((time + kTimeLimit) | time) & kHigh) != 0 ||
+      first[16] != ':') {
+    return NULL;
+  }
+  const int second = digits2(first + 17);
+  if (second < 0) return NULL;
+
+  const uint64_t date_pairs = digit_pairs(date);
+  const uint64_t time_pairs = digit_pairs(time);
+  const int64_t year = byte_at(date_pairs, 0) * 100 + byte_at(date_pairs, 2);
+  const unsigned month = byte_at(date_pairs, 5);
+  const unsigned day = byte_at(time_pairs, 0);
+  const int hour = byte_at(time_pairs, 3);
+  const int minute = byte_at(time_pairs, 6);
+  if (!valid_time(year, month, day, hour, minute, second)) return NULL;
+
+  const char* p = first + 19;
+  uint32_t fraction = 0;
+  if (p < last && (*p == '.' || *p == ',')) {
+    p = parse_fraction(p + 1, last, &fraction);
+    if (p == NULL) return NULL;
+  }
+
+  const int64_t local =
+      seconds_from_civil(year, month, day, hour, minute, second);
+  int32_t offset = 0;
+  if (p < last && (*p == 'Z' || *p == 'z')) {
+    ++p;
+    *ts = local;
+  } else if (p < last && (*p == '+' || *p == '-')) {
+    p = parse_offset(p, last, &offset);
+    if (p == NULL) return NULL;
+    *ts = local - offset;
+  } else {
+    *ts = local_to_utc(local, zone);
+  }
+  if (nanos) *nanos = fraction;
+  return p;
+}
+
+// The RFC-822 zone name at p, as an offset. Returns the end, or NULL.
+const char* parse_zone_name(const char* p, const char* last,
+                            int32_t* offset) {
+  const char* end = p;
+  while (end < last && is_alpha(*end)) ++end;
+  const size_t length = end - p;
+  if (length == 1) {
+    // Military zones, which RFC-2822 says to take as unknown, i.e. UTC.
+    if ((*p | 0x20) == 'j') return NULL;
+    *offset = 0;
+    return end;
+  }
+  if (length == 2) {
+    if ((p[0] | 0x20) != 'u' || (p[1] | 0x20) != 't') return NULL;
+    *offset = 0;
+    return end;
+  }
+  if (length != 3) return NULL;
+
+  static const struct {
+    char name[4];
+    int32_t offset;
+  } kZones[] = {
+    {"gmt", 0}, {"utc", 0},
+    {"est", -5 * 3600}, {"edt", -4 * 3600},
+    {"cst", -6 * 3600}, {"cdt", -5 * 3600},
+    {"mst", -7 * 3600}, {"mdt", -6 * 3600},
+    {"pst", -8 * 3600}, {"pdt", -7 * 3600},
+  };
+  const uint32_t name = name3(p);
+  for (size_t i = 0; i < sizeof(kZones) / sizeof(kZones[0]); ++i) {
+    if (name == name3(kZones[i].name)) {
+      *offset = kZones[i].offset;
+      return end;
+    }
+  }
+  return NULL;
+}
+
+// "HH:MM[:SS]" at p. Returns the end, or NULL.
+const char* parse_clock(const char* p, const char* last, bool need_seconds,
+                        int* hour, int* minute, int* second) {
+  if (last - p < 5 || p[2] != ':') return NULL;
+  *hour = digits2(p);
+  *minute = digits2(p + 3);
+  if (*hour < 0 || *minute < 0) return NULL;
+  p += 5;
+  *second = 0;
+  if (last - p >= 3 && *p == ':') {
+    *second = digits2(p + 1);
+    if (*second < 0) return NULL;
+    p += 3;
+  } else if (need_seconds) {
+    return NULL;
+  }
+  return p;
+}
+
+inline const char* skip_spaces(const char* p, const char* last) {
+  while (p < last && *p == ' ') ++p;
+  return p;
+}
+
+// A number of 1 to max_digits digits at p. Returns the end, or NULL.
+const char* parse_small(const char* p, const char* last, int max_digits,
+                        int* value, int* digits) {
+  const char* start = p;
+  *value = 0;
+  for (; p < last && p - start < max_digits && is_digit(*p); ++p) {
+    *value = *value * 10 + (*p - '0');
+  }
+  *digits = static_cast<int>(p - start);
+  if (p == start || (p < last && is_digit(*p))) return NULL;
+  return p;
+}
+
+const char* parse_rfc822(const char* first, const char* last,
+                         time_t* ts, uint32_t* nanos,
+                         const Zoneinfo* zone) {
+  const char* p = first;
+  // Optional weekday, "Sat, " or as ctime() "Sat ".
+  if (last - p >= 4 && is_weekday_name(p) && (p[3] == ',' || p[3] == ' ')) {
+    p = skip_spaces(p + 4, last);
+  }
+
+  int day, day_digits, month, year, year_digits, hour, minute, second;
+  bool has_zone;
+  if (p < last && is_digit(*p)) {
+    // "31 May 2014 22:46:50 +0200"
+    p = parse_small(p, last, 2, &day, &day_digits);
+    if (p == NULL || last - p < 5 || *p != ' ') return NULL;
+    month = month_from_name(p + 1);
+    if (month == 0 || p[4] != ' ') return NULL;
+    p = skip_spaces(p + 5, last);
+    p = parse_small(p, last, 4, &year, &year_digits);
+    if (p == NULL || year_digits < 2 || p == last || *p != ' ') return NULL;
+    p = skip_spaces(p, last);
+    p = parse_clock(p, last, false, &hour, &minute, &second);
+    if (p == NULL) return NULL;
+    has_zone = true;
+  } else {
+    // "May 31 22:46:50 2014"
+    if (last - p < 4) return NULL;
+    month = month_from_name(p);
+    if (month == 0 || p[3] != ' ') return NULL;
+    p = skip_spaces(p + 4, last);
+    p = parse_small(p, last, 2, &day, &day_digits);
+    if (p == NULL || p == last || *p != ' ') return NULL;
+    p = parse_clock(p + 1, last, true, &hour, &minute, &second);
+    if (p == NULL || p == last || *p != ' ') return NULL;
+    p = parse_small(p + 1, last, 4, &year, &year_digits);
+    if (p == NULL || year_digits != 4) return NULL;
+    has_zone = false;
+  }
+
+  // Years of 2 or 3 digits, as RFC-2822 says.
+  if (year_digits == 2) {
+    year += year < 50 ? 2000 : 1900;
+  } else if (year_digits == 3) {
+    year += 1900;
+  }
+  if (!valid_time(year, month, day, hour, minute, second)) return NULL;
+  const int64_t local =
+      seconds_from_civil(year, month, day, hour, minute, second);
+
+  int32_t offset = 0;
+  const char* zone_start = skip_spaces(p, last);
+  const char* zone_end = NULL;
+  if (has_zone && zone_start > p && zone_start < last) {
+    zone_end = (*zone_start == '+' || *zone_start == '-')
+        ? parse_offset(zone_start, last, &offset)
+        : parse_zone_name(zone_start, last, &offset);
+  }
+  if (zone_end) {
+    *ts = local - offset;
+    p = zone_end;
+  } else {
+    *ts = local_to_utc(local, zone);
+  }
+  if (nanos) *nanos = 0;
+  return p;
+}
+
+const char* parse_epoch(const char* first, const char* last,
+                        time_t* ts, uint32_t* nanos) {
+  const char* p = first;
+  const bool negative = p < last && *p == '-';
+  if (negative) ++p;
+  uint64_t seconds;
+  from_chars_result res = from_chars(p, last, &seconds);
+  if (res.error != PARSE_OK ||
+      seconds > static_cast<uint64_t>(INT64_MAX) - 1) {
+    return NULL;
+  }
+  p = res.ptr;
+  uint32_t fraction = 0;
+  if (p < last && *p == '.') {
+    p = parse_fraction(p + 1, last, &fraction);
+    if (p == NULL) return NULL;
+  }
+  if (!negative) {
+    *ts = static_cast<time_t>(seconds);
+  } else if (fraction == 0) {
+    *ts = -static_cast<time_t>(seconds);
+  } else {
+    // Nanoseconds count forward from the second before.
+    *ts = -static_cast<time_t>(seconds) - 1;
+    fraction = 1000000000 - fraction;
+  }
+  if (nanos) *nanos = fraction;
+  return p;
+}
+
+TimeFormat detect_format(const char* first, const char* last) {
+  const char* p = first;
+  if (p < last && *p == '-') return TIME_EPOCH;
+  while (p < last && is_digit(*p)) ++p;
+  if (p == first) return TIME_RFC822;
+  if (p - first == 4 && p < last && *p == '-') return TIME_RFC3339;
+  if (p < last && *p == ' ') return TIME_RFC822;
+  return TIME_EPOCH;
+}
+
+}  // namespace parse_internal
+
+using namespace parse_internal;
+
+const char* parse_time(const char* first, const char* last, TimeFormat format,
+                       time_t* ts, uint32_t* nanos, const Zoneinfo* zone) {
+  if (format == TIME_AUTO) format = detect_format(first, last);
+  switch (format) {
+    case TIME_RFC3339:
+      return parse_rfc3339(first, last, ts, nanos, zone);
+    case TIME_RFC822:
+      return parse_rfc822(first, last, ts, nanos, zone);
+    case TIME_EPOCH:
+      return parse_epoch(first, last, ts, nanos);
+    default:
+      return NULL;
+  }
+}
+
+bool parse_datetime(const strings::cord& str, TimeFormat format,
+                    Datetime* datetime, uint32_t* nanos,
+                    const Zoneinfo* zone) {
+  time_t ts;
+  uint32_t fraction;
+  if (parse_time(str.begin(), str.end(), format, &ts, &fraction, zone) !=
+      str.end()) {
+    return false;
+  }
+  *datetime = Datetime(ts, zone);
+  if (nanos) *nanos = fraction;
+  return true;
+}
+
+bool parse_time_column(const strings::cord& buffer, char delimiter,
+                       TimeFormat format, std::vector<time_t>* timestamps,
+                       std::vector<uint32_t>* nanos,
+                       std::vector<uint64_t>* errors,
+                       const Zoneinfo* zone) {
+  timestamps->clear();
+  if (nanos) nanos->clear();
+  errors->clear();
+
+  const char* p = buffer.begin();
+  const char* end = buffer.end();
+  const bool strip_cr = delimiter == '\n';
+  bool ok = true;
+  size_t row = 0;
+  while (p < end) {
+    const char* next =
+        static_cast<const char*>(memchr(p, delimiter, end - p));
+    if (next == NULL) next = end;
+    const char* field_end = next;
+    if (strip_cr && field_end > p && field_end[-1] == '\r') --field_end;
+
+    time_t ts;
+    uint32_t fraction;
+    const bool parsed =
+        parse_time(p, field_end, format, &ts, &fraction, zone) == field_end;
+    if (row % 64 == 0) errors->push_back(0);
+    if (!parsed) {
+      ts = 0;
+      fraction = 0;
+      errors->back() |= uint64_t(1) << (row % 64);
+      ok = false;
+    }
+    timestamps->push_back(ts);
+    if (nanos) nanos->push_back(fraction);
+    ++row;
+    p = next + 1;
+  }
+  return ok;
+}
+
+}  // namespace time
+}  // namespace sfu
@@ -0,0 +1,68 @@
+#ifndef SFU_TIME_PARSE_H_
+#define SFU_TIME_PARSE_H_
+
+#include <cstdint>
+#include <ctime>
+#include <vector>
+
+#include "sfu/strings/cord.h"
+#include "sfu/time/datetime.h"
+
+namespace sfu {
+namespace time {
+
+class Zoneinfo;
+
+typedef enum {
+  // RFC-3339 / ISO-8601, e.g. "2014-05-31T22:46:50.123+02:00". A space or
+  // 't' may replace the 'T', ',' the '.', and the offset may be "Z", "z",
+  // "+hh:mm", "+hhmm", "+hh", or left out (as in kIso8601DateFormat) for
+  // local time in the zone. Leap seconds (":60") are the next second.
+  TIME_RFC3339 = 0,
+  // RFC-822 / RFC-1123 / RFC-2822, e.g. "Sat, 31 May 2014 22:46:50 +0200",
+  // where the weekday and seconds are optional and the zone may be a name
+  // of RFC-822 ("GMT", "EST", ...). Also the form of kRfc822DateFormat,
+  // "May 31 22:46:50 2014", which is local time in the zone.
+  TIME_RFC822,
+  // Seconds since 1970-01-01 UTC, e.g. "1401569210.123".
+  TIME_EPOCH,
+  // Any of the above, by the first few chars.
+  TIME_AUTO,
+} TimeFormat;
+
+// Parse a timestamp at the start of [first, last), with times without UTC
+// offset in the zone, or UTC if NULL. Returns the end of the timestamp, or
+// NULL if there is no valid timestamp. Nanoseconds past the second are set
+// if nanos is not NULL, and digits past the ninth are ignored.
+//
+// These do not depend on the locale or $TZ. The fixed RFC-3339 date and time
+// is checked and converted 8 chars at a time (SWAR), and days are counted
+// with the integer arithmetic of sfu/time/civil.h.
+const char* parse_time(const char* first, const char* last, TimeFormat format,
+                       time_t* ts, uint32_t* nanos = NULL,
+                       const Zoneinfo* zone = NULL);
+
+// Parse all of str as a timestamp, into a Datetime in the zone, or UTC if
+// NULL. On error *datetime is not modified.
+bool parse_datetime(const strings::cord& str, TimeFormat format,
+                    Datetime* datetime, uint32_t* nanos = NULL,
+                    const Zoneinfo* zone = NULL);
+
+// Parse a whole column of timestamps separated by delimiter, as the
+// parse_column() of sfu/numbers_batch.h: every field gives one value, a
+// delimiter at the very end does not start a new field, and with '\n' a
+// "\r" before it is ignored. Nanoseconds are only kept if nanos is not NULL.
+//
+// Fields that are not a valid timestamp get 0, and their bit set in errors:
+// bit (row % 64) of errors[row / 64], as column_error() of
+// sfu/numbers_batch.h reads it. Returns true if all fields parsed.
+bool parse_time_column(const strings::cord& buffer, char delimiter,
+                       TimeFormat format, std::vector<time_t>* timestamps,
+                       std::vector<uint32_t>* nanos,
+                       std::vector<uint64_t>* errors,
+                       const Zoneinfo* zone = NULL);
+
+}  // namespace time
+}  // namespace sfu
+
+#endif  // SFU_TIME_PARSE_H_
@@ -0,0 +1,284 @@
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "sfu/testing/alloc_counter.h"
+#include "sfu/time/format.h"
+#include "sfu/time/parse.h"
+#include "sfu/time/zoneinfo.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+using namespace sfu::time;
+
+namespace {
+
+// The timestamp of the whole string, or -1 if it does not parse.
+time_t parse(const string& str, TimeFormat format, uint32_t* nanos = NULL,
+             const Zoneinfo* zone = NULL) {
+  time_t ts;
+  const char* end = str.data() + str.size();
+  if (parse_time(str.data(), end, format, &ts, nanos, zone) != end) {
+    return -1;
+  }
+  return ts;
+}
+
+}  // namespace
+
+TEST(ParseTest, TestRfc3339) {
+  uint32_t nanos = 1;
+  EXPECT_EQ(1234567890, parse("2009-02-13T23:31:30Z", TIME_RFC3339, &nanos));
+  EXPECT_EQ(0u, nanos);
+  EXPECT_EQ(1234567890, parse("2009-02-14T00:31:30+01:00", TIME_RFC3339));
+  EXPECT_EQ(1234567890, parse("2009-02-14 00:31:30+0100", TIME_RFC3339));
+  EXPECT_EQ(1234567890, parse("2009-02-13t18:31:30-05", TIME_RFC3339));
+  EXPECT_EQ(1234567890, parse("2009-02-13T23:31:30z", TIME_RFC3339));
+  EXPECT_EQ(1234567890, parse("2009-02-13T23:31:30-00:00", TIME_RFC3339));
+
+  EXPECT_EQ(1234567890,
+            parse("2009-02-13T23:31:30.123456789Z", TIME_RFC3339, &nanos));
+  EXPECT_EQ(123456789u, nanos);
+  EXPECT_EQ(1234567890,
+            parse("2009-02-13T23:31:30,5+00:00", TIME_RFC3339, &nanos));
+  EXPECT_EQ(500000000u, nanos);
+  EXPECT_EQ(1234567890,
+            parse("2009-02-13T23:31:30.0000000019Z", TIME_RFC3339, &nanos));
+  EXPECT_EQ(1u, nanos);
+
+  // No offset is local time in the zone, as kIso8601DateFormat.
+  EXPECT_EQ(1234567890, parse("2009-02-13 23:31:30", TIME_RFC3339));
+  const Zoneinfo* oslo = Zoneinfo::GetZoneinfo("Europe/Oslo");
+  ASSERT_TRUE(oslo != NULL);
+  EXPECT_EQ(1234567890,
+            parse("2009-02-14 00:31:30", TIME_RFC3339, NULL, oslo));
+  EXPECT_EQ(1246406400,
+            parse("2009-07-01 02:00:00", TIME_RFC3339, NULL, oslo));
+  // An offset wins over the zone.
+  EXPECT_EQ(1234567890,
+            parse("2009-02-13T23:31:30Z", TIME_RFC3339, NULL, oslo));
+
+  // Leap seconds are the next second, and years before 1970 work.
+  EXPECT_EQ(915148800, parse("1998-12-31T23:59:60Z", TIME_RFC3339));
+  EXPECT_EQ(-1000000000, parse("1938-04-24T22:13:20Z", TIME_RFC3339));
+  EXPECT_EQ(951782400, parse("2000-02-29T00:00:00Z", TIME_RFC3339));
+}
+
+TEST(ParseTest, TestRfc3339Invalid) {
+  const char* kInvalid[] = {
+    "",
+    "2009-02-13T23:31",
+    "2009-02-13T23:31:3Z",
+    "2009-02-13X23:31:30Z",
+    "2009/02/13T23:31:30Z",
+    "2009-02-13T23-31:30Z",
+    "2009-02-13T23:31-30Z",
+    "20a9-02-13T23:31:30Z",
+    "2009-13-13T23:31:30Z",
+    "2009-00-13T23:31:30Z",
+    "2009-02-29T23:31:30Z",
+    "2009-02-00T23:31:30Z",
+    "2009-02-13T24:31:30Z",
+    "2009-02-13T23:60:30Z",
+    "2009-02-13T23:31:61Z",
+    "2009-02-13T23:31:30.Z",
+    "2009-02-13T23:31:30+1",
+    "2009-02-13T23:31:30+24:00",
+    "2009-02-13T23:31:30+01:60",
+    "2009-02-13T23:31:30+01:",
+    "2009-02-13T23:31:30ZZ",
+    "2009-02-13T23:31:30 ",
+    "2009-02-13T23:31:30\xff",
+  };
+  for (const char* str : kInvalid) {
+    EXPECT_EQ(-1, parse(str, TIME_RFC3339)) << str;
+  }
+  // A high bit in any position.
+  const string valid = "2009-02-13T23:31:30Z";
+  for (size_t i = 0; i < valid.size(); ++i) {
+    string str = valid;
+    str[i] = static_cast<char>(str[i] | 0x80);
+    EXPECT_EQ(-1, parse(str, TIME_RFC3339)) << i;
+  }
+}
+
+TEST(ParseTest, TestRfc3339SameAsFormatter) {
+  Formatter formatter("%FT%T.%N%:z");
+  mt19937_64 rng(4711);
+  // Year 0 to 9999.
+  uniform_int_distribution<int64_t> dist(-62167219200LL, 253402300799LL);
+  char buffer[64];
+  for (int i = 0; i < 100000; ++i) {
+    const time_t ts = dist(rng);
+    const uint32_t nanos = static_cast<uint32_t>(rng() % 1000000000);
+    size_t length = formatter.Format(ts, nanos, buffer, sizeof(buffer));
+    uint32_t parsed_nanos;
+    ASSERT_EQ(ts, parse(string(buffer, length), TIME_RFC3339,
+                        &parsed_nanos)) << string(buffer, length);
+    ASSERT_EQ(nanos, parsed_nanos);
+  }
+}
+
+TEST(ParseTest, TestRfc822) {
+  EXPECT_EQ(1234567890, parse("Sat, 14 Feb 2009 00:31:30 +0100", TIME_RFC822));
+  EXPECT_EQ(1234567890, parse("Fri, 13 Feb 2009 23:31:30 GMT", TIME_RFC822));
+  EXPECT_EQ(1234567890, parse("13 Feb 2009 23:31:30 UT", TIME_RFC822));
+  EXPECT_EQ(1234567890, parse("13 feb 2009 18:31:30 EST", TIME_RFC822));
+  EXPECT_EQ(1234567890, parse("13 Feb 2009 15:31:30 PST", TIME_RFC822));
+  EXPECT_EQ(1234567890, parse("13 Feb 2009 23:31:30 Z", TIME_RFC822));
+  EXPECT_EQ(1234567860, parse("13 Feb 09 23:31 +0000", TIME_RFC822));
+  EXPECT_EQ(1234567890, parse("13 Feb 109 23:31:30 -0000", TIME_RFC822));
+  EXPECT_EQ(1234567890, parse("Sat,  14 Feb 2009 00:31:30 +01:00",
+                              TIME_RFC822));
+  // Two digit years.
+  EXPECT_EQ(915148800, parse("1 Jan 99 00:00:00 GMT", TIME_RFC822));
+  EXPECT_EQ(1230768000, parse("1 Jan 09 00:00:00 GMT", TIME_RFC822));
+
+  // kRfc822DateFormat, and ctime().
+  EXPECT_EQ(1401576410, parse("May 31 22:46:50 2014", TIME_RFC822));
+  EXPECT_EQ(1401576410, parse("Sat May 31 22:46:50 2014", TIME_RFC822));
+  EXPECT_EQ(1398984410, parse("May  1 22:46:50 2014", TIME_RFC822));
+  const Zoneinfo* oslo = Zoneinfo::GetZoneinfo("Europe/Oslo");
+  ASSERT_TRUE(oslo != NULL);
+  EXPECT_EQ(1401569210,
+            parse("May 31 22:46:50 2014", TIME_RFC822, NULL, oslo));
+  // No zone is also local time.
+  EXPECT_EQ(1401569210,
+            parse("31 May 2014 22:46:50", TIME_RFC822, NULL, oslo));
+
+  const char* kInvalid[] = {
+    "",
+    "Sat, 14 Feb 2009",
+    "Sat, 14 Fob 2009 00:31:30 +0100",
+    "Sat, 30 Feb 2009 00:31:30 +0100",
+    "Sat, 14 Feb 2009 24:31:30 +0100",
+    "Sat, 14 Feb 2009 00:31:30 +010",
+    "Sat, 14 Feb 2009 00:31:30 XYZ",
+    "Sat, 14 Feb 2009 00:31:30 +0100 junk",
+    "Sat, 140 Feb 2009 00:31:30 +0100",
+    "Sat, 14 Feb 20090 00:31:30 +0100",
+    "May 31 22:46 2014",
+    "May 31 22:46:50 14",
+  };
+  for (const char* str : kInvalid) {
+    EXPECT_EQ(-1, parse(str, TIME_RFC822)) << str;
+  }
+}
+
+TEST(ParseTest, TestEpoch) {
+  uint32_t nanos = 1;
+  EXPECT_EQ(1234567890, parse("1234567890", TIME_EPOCH, &nanos));
+  EXPECT_EQ(0u, nanos);
+  EXPECT_EQ(1234567890, parse("1234567890.25", TIME_EPOCH, &nanos));
+  EXPECT_EQ(250000000u, nanos);
+  EXPECT_EQ(0, parse("0", TIME_EPOCH));
+  EXPECT_EQ(-12, parse("-12", TIME_EPOCH, &nanos));
+  EXPECT_EQ(0u, nanos);
+  EXPECT_EQ(-2, parse("-1.25", TIME_EPOCH, &nanos));
+  EXPECT_EQ(750000000u, nanos);
+
+  EXPECT_EQ(-1, parse("", TIME_EPOCH));
+  EXPECT_EQ(-1, parse("-", TIME_EPOCH));
+  EXPECT_EQ(-1, parse("12.", TIME_EPOCH));
+  EXPECT_EQ(-1, parse("+12", TIME_EPOCH));
+  EXPECT_EQ(-1, parse("12a", TIME_EPOCH));
+  EXPECT_EQ(-1, parse("99999999999999999999", TIME_EPOCH));
+}
+
+TEST(ParseTest, TestAuto) {
+  EXPECT_EQ(1234567890, parse("2009-02-13T23:31:30Z", TIME_AUTO));
+  EXPECT_EQ(1234567890, parse("Fri, 13 Feb 2009 23:31:30 GMT", TIME_AUTO));
+  EXPECT_EQ(1234567890, parse("13 Feb 2009 23:31:30 GMT", TIME_AUTO));
+  EXPECT_EQ(1401576410, parse("May 31 22:46:50 2014", TIME_AUTO));
+  EXPECT_EQ(1234567890, parse("1234567890", TIME_AUTO));
+  EXPECT_EQ(-12, parse("-12", TIME_AUTO));
+  EXPECT_EQ(2009, parse("2009", TIME_AUTO));
+}
+
+TEST(ParseTest, TestParseDatetime) {
+  const Zoneinfo* oslo = Zoneinfo::GetZoneinfo("Europe/Oslo");
+  ASSERT_TRUE(oslo != NULL);
+
+  Datetime dt(0);
+  uint32_t nanos = 0;
+  EXPECT_TRUE(parse_datetime("2009-02-13T23:31:30.5Z", TIME_RFC3339, &dt,
+                             &nanos, oslo));
+  EXPECT_EQ(1234567890, dt.timestamp());
+  EXPECT_EQ(oslo, dt.timezone());
+  EXPECT_EQ(500000000u, nanos);
+  EXPECT_EQ(0, dt.hour());
+
+  EXPECT_TRUE(parse_datetime("1234567891", TIME_EPOCH, &dt));
+  EXPECT_EQ(1234567891, dt.timestamp());
+  EXPECT_TRUE(dt.timezone() == NULL);
+
+  EXPECT_FALSE(parse_datetime("2009-02-13T23:31:30Z ", TIME_RFC3339, &dt));
+  EXPECT_FALSE(parse_datetime("", TIME_AUTO, &dt));
+  EXPECT_EQ(1234567891, dt.timestamp());
+}
+
+TEST(ParseTest, TestParseColumn) {
+  vector<time_t> timestamps;
+  vector<uint32_t> nanos;
+  vector<uint64_t> errors;
+  EXPECT_TRUE(parse_time_column(
+      "2009-02-13T23:31:30Z\n2009-02-13T23:31:31.5Z\r\n"
+      "2009-02-14T00:31:32+01:00\n",
+      '\n', TIME_RFC3339, &timestamps, &nanos, &errors));
+  ASSERT_EQ(3u, timestamps.size());
+  EXPECT_EQ(1234567890, timestamps[0]);
+  EXPECT_EQ(1234567891, timestamps[1]);
+  EXPECT_EQ(1234567892, timestamps[2]);
+  ASSERT_EQ(3u, nanos.size());
+  EXPECT_EQ(500000000u, nanos[1]);
+  ASSERT_EQ(1u, errors.size());
+  EXPECT_EQ(0u, errors[0]);
+
+  EXPECT_FALSE(parse_time_column("1,x,,3", ',', TIME_EPOCH, &timestamps,
+                                 NULL, &errors));
+  ASSERT_EQ(4u, timestamps.size());
+  EXPECT_EQ(1, timestamps[0]);
+  EXPECT_EQ(0, timestamps[1]);
+  EXPECT_EQ(0, timestamps[2]);
+  EXPECT_EQ(3, timestamps[3]);
+  ASSERT_EQ(1u, errors.size());
+  EXPECT_EQ(6u, errors[0]);
+
+  EXPECT_TRUE(parse_time_column("", '\n', TIME_EPOCH, &timestamps, NULL,
+                                &errors));
+  EXPECT_TRUE(timestamps.empty());
+  EXPECT_TRUE(errors.empty());
+
+  // More rows than one error word.
+  string column;
+  for (int i = 0; i < 100; ++i) {
+    column += i == 70 ? "bad" : to_string(i);
+    column += "\n";
+  }
+  EXPECT_FALSE(parse_time_column(column, '\n', TIME_EPOCH, &timestamps,
+                                 NULL, &errors));
+  ASSERT_EQ(100u, timestamps.size());
+  EXPECT_EQ(99, timestamps[99]);
+  ASSERT_EQ(2u, errors.size());
+  EXPECT_EQ(0u, errors[0]);
+  EXPECT_EQ(uint64_t(1) << 6, errors[1]);
+}
+
+TEST(ParseTimeTest, TestNoAlloc) {
+  const Zoneinfo* oslo = Zoneinfo::GetZoneinfo("Europe/Oslo");
+  ASSERT_TRUE(oslo != NULL);
+  const char* kTimes[] = {
+    "2014-05-31T22:46:50.123+02:00",
+    "Sat, 31 May 2014 22:46:50 GMT",
+    "2014-05-31 22:46:50",
+    "1401569210.123",
+  };
+  for (const char* str : kTimes) {
+    time_t ts = 0;
+    uint32_t nanos = 0;
+    const char* last = str + strlen(str);
+    EXPECT_NO_ALLOC(parse_time(str, last, TIME_AUTO, &ts, &nanos, oslo));
+    EXPECT_LT(0, ts) << str;
+  }
+}
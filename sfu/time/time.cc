@@ -1,10 +1,12 @@
+#include "sfu/time/time.h"
+
 #include <ctime>
 
 namespace sfu {
 namespace time {
 
 time_t now() {
-  return mktime(NULL);
+  return ::time(NULL);
 }
 
 };  // namespace time
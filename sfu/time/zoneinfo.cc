@@ -1,45 +1,365 @@
 #include "sfu/time/zoneinfo.h"
 
-#include "sfu/numbers.h"
-#include "sfu/popen.h"
-#include "sfu/strings/strings.h"
+#include "sfu/mapped_file.h"
+#include "sfu/strings/cord.h"
+#include "sfu/time/civil.h"
+#include "sfu/trace/trace.h"
 
-#include <regex>
-#include <ctime>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
 
 using namespace std;
 
 namespace sfu {
 namespace time {
 
-struct Zoneinfo_TZ {
-  // Timezone name (not locale name).
-  string name;
-  // True if this is a daylight saving time.
-  bool is_dst;
-  // UTC offset in seconds east of GMT.
-  int16_t gmtoff;
-  // The UTC timestamp it takes effect.
-  time_t start;
+// When a POSIX TZ rule changes between standard and daylight saving time.
+struct Zoneinfo_RuleDate {
+  // 'J' for Julian day 1-365 not counting Feb 29, 'D' for the zero based
+  // day of the year, counting Feb 29, and 'M' for day of week in month.
+  char kind;
+  // Day of year, or day of week 0-6 (Sunday-Saturday) for 'M'.
+  int day;
+  // Month 1-12 and week 1-5 for 'M', where 5 is the last in the month.
+  int month;
+  int week;
+  // Local time of day in seconds, may be negative or more than a day.
+  int32_t time;
+};
+
+// The POSIX TZ rule from the TZif footer, for timestamps after the last
+// transition in the file, e.g. "CET-1CEST,M3.5.0,M10.5.0/3".
+struct Zoneinfo_Rule {
+  Zoneinfo_TZ std;
+  Zoneinfo_TZ dst;
+  bool has_dst;
+  Zoneinfo_RuleDate start;
+  Zoneinfo_RuleDate end;
+};
+
+namespace zoneinfo_internal {
+
+const char kDefaultZoneinfoDir[] = "/usr/share/zoneinfo";
+const size_t kHeaderSize = 44;
+
+uint32_t read_uint32(const char* p) {
+  const unsigned char* u = reinterpret_cast<const unsigned char*>(p);
+  return (static_cast<uint32_t>(u[0]) << 24) |
+         (static_cast<uint32_t>(u[1]) << 16) |
+         (static_cast<uint32_t>(u[2]) << 8) |
+          static_cast<uint32_t>(u[3]);
+}
+
+int64_t read_int64(const char* p) {
+  return static_cast<int64_t>(
+      (static_cast<uint64_t>(read_uint32(p)) << 32) | read_uint32(p + 4));
+}
+
+struct Header {
+  char version;
+  uint32_t isutcnt;
+  uint32_t isstdcnt;
+  uint32_t leapcnt;
+  uint32_t timecnt;
+  uint32_t typecnt;
+  uint32_t charcnt;
+
+  // Size of the data block after the header, with time_size bytes per
+  // transition time (4 for version 1, 8 for later).
+  size_t DataSize(size_t time_size) const {
+    return timecnt * time_size + timecnt + typecnt * 6 + charcnt +
+           leapcnt * (time_size + 4) + isstdcnt + isutcnt;
+  }
+};
+
+bool ParseHeader(const char* p, const char* end, Header* header) {
+  if (end - p < static_cast<ptrdiff_t>(kHeaderSize) ||
+      memcmp(p, "TZif", 4) != 0) {
+    return false;
+  }
+  header->version = p[4];
+  header->isutcnt = read_uint32(p + 20);
+  header->isstdcnt = read_uint32(p + 24);
+  header->leapcnt = read_uint32(p + 28);
+  header->timecnt = read_uint32(p + 32);
+  header->typecnt = read_uint32(p + 36);
+  header->charcnt = read_uint32(p + 40);
+  // Sanity limits, so DataSize() can not overflow.
+  return header->typecnt > 0 && header->typecnt <= 256 &&
+         header->charcnt > 0 && header->charcnt <= (1 << 16) &&
+         header->timecnt <= (1 << 24) && header->leapcnt <= (1 << 24) &&
+         (header->isutcnt == 0 || header->isutcnt == header->typecnt) &&
+         (header->isstdcnt == 0 || header->isstdcnt == header->typecnt) &&
+         static_cast<size_t>(end - p - kHeaderSize) >= header->DataSize(4);
+}
+
+// Days since 1970-01-01 of the rule date in year y.
+int64_t rule_day(int64_t y, const Zoneinfo_RuleDate& date) {
+  const int64_t jan1 = days_from_civil(y, 1, 1);
+  switch (date.kind) {
+    case 'J':
+      return jan1 + date.day - 1 +
+             (is_leap_year(y) && date.day >= 60 ? 1 : 0);
+    case 'D':
+      return jan1 + date.day;
+    default: {
+      const int64_t first = days_from_civil(y, date.month, 1);
+      const int64_t next = date.month == 12
+          ? days_from_civil(y + 1, 1, 1)
+          : days_from_civil(y, date.month + 1, 1);
+      int64_t day = first + (date.day + 7 - weekday_from_days(first)) % 7 +
+                    (date.week - 1) * 7;
+      while (day >= next) day -= 7;
+      return day;
+    }
+  }
+}
+
+// ---- POSIX TZ rule ----
+
+bool parse_number(const char** p, const char* end, int min, int max,
+                  int* out) {
+  int value = 0;
+  const char* start = *p;
+  while (*p < end && **p >= '0' && **p <= '9' && *p - start < 3) {
+    value = value * 10 + (**p - '0');
+    ++*p;
+  }
+  *out = value;
+  return *p > start && value >= min && value <= max;
+}
+
+// [+-]hh[:mm[:ss]] with hours up to 167, as allowed for rule times in TZif
+// version 3.
+bool parse_hms(const char** p, const char* end, int32_t* seconds) {
+  int sign = 1;
+  if (*p < end && (**p == '+' || **p == '-')) {
+    sign = **p == '-' ? -1 : 1;
+    ++*p;
+  }
+  int h = 0, m = 0, s = 0;
+  if (!parse_number(p, end, 0, 167, &h)) return false;
+  if (*p < end && **p == ':') {
+    ++*p;
+    if (!parse_number(p, end, 0, 59, &m)) return false;
+    if (*p < end && **p == ':') {
+      ++*p;
+      if (!parse_number(p, end, 0, 59, &s)) return false;
+    }
+  }
+  *seconds = sign * (h * 3600 + m * 60 + s);
+  return true;
+}
+
+// Either "<+0330>" or alphabetic like "CET", of at least 3 characters.
+bool parse_name(const char** p, const char* end, string* name) {
+  const char* start = *p;
+  if (*p < end && **p == '<') {
+    ++start;
+    while (*p < end && **p != '>') ++*p;
+    if (*p == end) return false;
+    name->assign(start, *p - start);
+    ++*p;
+  } else {
+    while (*p < end && ((**p >= 'a' && **p <= 'z') ||
+                        (**p >= 'A' && **p <= 'Z'))) {
+      ++*p;
+    }
+    name->assign(start, *p - start);
+  }
+  return name->size() >= 3;
+}
+
+bool parse_rule_date(const char** p, const char* end,
+                     Zoneinfo_RuleDate* date) {
+  date->time = 2 * 3600;
+  date->month = date->week = 0;
+  if (*p < end && **p == 'J') {
+    ++*p;
+    date->kind = 'J';
+    if (!parse_number(p, end, 1, 365, &date->day)) return false;
+  } else if (*p < end && **p == 'M') {
+    ++*p;
+    date->kind = 'M';
+    if (!parse_number(p, end, 1, 12, &date->month) ||
+        *p == end || *(*p)++ != '.' ||
+        !parse_number(p, end, 1, 5, &date->week) ||
+        *p == end || *(*p)++ != '.' ||
+        !parse_number(p, end, 0, 6, &date->day)) {
+      return false;
+    }
+  } else {
+    date->kind = 'D';
+    if (!parse_number(p, end, 0, 365, &date->day)) return false;
+  }
+  if (*p < end && **p == '/') {
+    ++*p;
+    return parse_hms(p, end, &date->time);
+  }
+  return true;
+}
+
+bool ParseRule(const char* p, const char* end, Zoneinfo_Rule* rule) {
+  // POSIX offsets are west of GMT, so the sign is the opposite of gmtoff.
+  int32_t offset;
+  if (!parse_name(&p, end, &rule->std.name) ||
+      !parse_hms(&p, end, &offset)) {
+    return false;
+  }
+  rule->std.gmtoff = -offset;
+  rule->std.is_dst = false;
+  rule->has_dst = p < end;
+  if (!rule->has_dst) return true;
+
+  if (!parse_name(&p, end, &rule->dst.name)) return false;
+  rule->dst.gmtoff = rule->std.gmtoff + 3600;
+  rule->dst.is_dst = true;
+  if (p < end && *p != ',') {
+    if (!parse_hms(&p, end, &offset)) return false;
+    rule->dst.gmtoff = -offset;
+  }
+  if (p == end) {
+    // No dates given, use the US ones as glibc does.
+    static const char kDefaultDates[] = ",M3.2.0,M11.1.0";
+    p = kDefaultDates;
+    end = kDefaultDates + sizeof(kDefaultDates) - 1;
+  }
+  return *p++ == ',' &&
+         parse_rule_date(&p, end, &rule->start) &&
+         p < end && *p++ == ',' &&
+         parse_rule_date(&p, end, &rule->end) && p == end;
+}
+
+// The zone of the rule at the UTC timestamp ts.
+const Zoneinfo_TZ* RuleZone(const Zoneinfo_Rule& rule, time_t ts) {
+  if (!rule.has_dst) return &rule.std;
+
+  int64_t year;
+  unsigned month, day;
+  civil_from_days(days_from_timestamp(ts + rule.std.gmtoff),
+                  &year, &month, &day);
+  // The start is given in standard time, and the end in DST.
+  const int64_t start = rule_day(year, rule.start) * kSecondsPerDay +
+                        rule.start.time - rule.std.gmtoff;
+  const int64_t end = rule_day(year, rule.end) * kSecondsPerDay +
+                      rule.end.time - rule.dst.gmtoff;
+  const bool dst = start < end
+      ? ts >= start && ts < end
+      // Southern hemisphere, DST over new year.
+      : ts < end || ts >= start;
+  return dst ? &rule.dst : &rule.std;
+}
+
+// ---- Registry ----
+
+string zoneinfo_dir() {
+  const char* dir = getenv("TZDIR");
+  return dir && *dir ? dir : kDefaultZoneinfoDir;
+}
+
+// Add the names of all files under dir/prefix to names.
+void list_zones(const string& dir, const string& prefix,
+                vector<string>* names) {
+  DIR* d = opendir((dir + "/" + prefix).c_str());
+  if (!d) return;
+  while (struct dirent* entry = readdir(d)) {
+    const string name = entry->d_name;
+    // Skip the tables, and the posix/ and right/ copies of all zones.
+    if (name[0] == '.' || name.find('.') != string::npos ||
+        (prefix.empty() && (name == "posix" || name == "right"))) {
+      continue;
+    }
+    const string path = prefix.empty() ? name : prefix + "/" + name;
+    struct stat st;
+    if (stat((dir + "/" + path).c_str(), &st) != 0) continue;
+    if (S_ISDIR(st.st_mode)) {
+      list_zones(dir, path, names);
+    } else if (S_ISREG(st.st_mode)) {
+      names->push_back(path);
+    }
+  }
+  closedir(d);
+}
+
+// The shared zones by name. Lookups read an immutable map through an atomic
+// pointer. Adding zones copies the map under a lock, and replaces it. The old
+// maps are kept, as other threads may still be reading them, but zones are
+// loaded rarely enough for this to not matter.
+class Registry {
+  public:
+    // Never destroyed, so zones stay valid during static destruction.
+    static Registry* Get() {
+      static Registry* registry = new Registry();
+      return registry;
+    }
+
+    const Zoneinfo* Find(const string& name) const {
+      const Map* map = map_.load(memory_order_acquire);
+      Map::const_iterator it = map->find(name);
+      return it == map->end() ? NULL : it->second;
+    }
+
+    // Load the zones, and add the ones that are not already there. Returns
+    // the zone for the first name.
+    const Zoneinfo* Load(const vector<string>& names) {
+      lock_guard<mutex> lock(mutex_);
+      const Map* map = map_.load(memory_order_relaxed);
+      unique_ptr<Map> next;
+      for (const string& name : names) {
+        if (map->count(name)) continue;
+        const Zoneinfo* zone = Zoneinfo::Load(name);
+        if (!zone) continue;
+        if (!next) next.reset(new Map(*map));
+        next->insert(make_pair(name, zone));
+      }
+      if (next) {
+        retired_.push_back(unique_ptr<const Map>(map));
+        map_.store(next.release(), memory_order_release);
+      }
+      return names.empty() ? NULL : Find(names[0]);
+    }
+
+  private:
+    typedef unordered_map<string, const Zoneinfo*> Map;
+
+    Registry() : map_(new Map()) {}
+
+    atomic<const Map*> map_;
+    mutex mutex_;
+    vector<unique_ptr<const Map>> retired_;
 };
 
-Zoneinfo::Zoneinfo(const std::string& locale) : locale_(locale) {
+}  // namespace zoneinfo_internal
+
+using namespace zoneinfo_internal;
+
+Zoneinfo::Zoneinfo(const std::string& locale)
+    : locale_(locale), rule_(NULL), last_hit_(0) {
   LoadInfo();
 }
 
-Zoneinfo::Zoneinfo(const string& zone, int16_t gmtoff) : locale_(zone) {
-  db_.push_back(new Zoneinfo_TZ);
-  db_[0]->name = zone;
-  db_[0]->start = kNowTimestamp;
-  db_[0]->gmtoff = gmtoff;
+Zoneinfo::Zoneinfo(const string& zone, int32_t gmtoff)
+    : locale_(zone), rule_(NULL), last_hit_(0) {
+  Zoneinfo_TZ tz;
+  tz.name = zone;
+  tz.gmtoff = gmtoff;
   // TODO(steineldar): Look up the zone from a list of known DST names.
-  db_[0]->is_dst = false;
+  tz.is_dst = false;
+  types_.push_back(tz);
+  transitions_.push_back(numeric_limits<time_t>::min());
+  transition_types_.push_back(0);
 }
 
 Zoneinfo::~Zoneinfo() {
-  for (Zoneinfo_TZ* i : db_) {
-    delete i;
-  }
+  delete rule_;
 }
 
 // public methods
@@ -66,87 +386,176 @@ time_t Zoneinfo::localtime(time_t utc) const {
   else return utc + info->gmtoff;
 }
 
+const std::string& Zoneinfo::zone(time_t utc) const {
+  static const std::string kUtc("UTC");
+  if (utc == kNowTimestamp) {
+    utc = now();
+  }
+
+  const Zoneinfo_TZ *info = ZoneForTimestamp(utc);
+  if (!info) return kUtc;
+  else return info->name;
+}
+
 // static
 
 const Zoneinfo* Zoneinfo::GetZoneinfo(const std::string& name) {
-  return NULL;
+  Registry* registry = Registry::Get();
+  const Zoneinfo* zone = registry->Find(name);
+  if (zone) return zone;
+  return registry->Load(vector<string>(1, name));
+}
+
+size_t Zoneinfo::PreloadZoneinfo() {
+  vector<string> names;
+  list_zones(zoneinfo_dir(), "", &names);
+  Registry* registry = Registry::Get();
+  registry->Load(names);
+
+  size_t loaded = 0;
+  for (const string& name : names) {
+    if (registry->Find(name)) ++loaded;
+  }
+  return loaded;
+}
+
+Zoneinfo* Zoneinfo::Load(const std::string& name) {
+  unique_ptr<Zoneinfo> zone(new Zoneinfo(name));
+  if (zone->transitions_.empty()) return NULL;
+  return zone.release();
 }
 
 // private
 
-void Zoneinfo::LoadInfo() {
-  vector<string> zdump;
-  zdump.push_back("zdump");
-  zdump.push_back("-v");
-  zdump.push_back(locale_);
-
-  string out, err;
-  int ret = Popen::run(zdump, &out, &err);
-  if (ret == 0 && err.empty()) {
-    list<string> lines;
-    sfu::strings::split_into(&lines, out, "\n", true);
-
-    regex re("^"
-        "[a-zA-Z/]+  "
-        "\\w{3} (\\w{3} \\d\\d \\d\\d:\\d\\d:\\d\\d \\d{4}) UTC" // date
-        " = "
-        "\\w{3} \\w{3} \\d\\d \\d\\d:\\d\\d:\\d\\d  \\d{4} "
-        "(\\w*) "        // zone
-        "isdst=(\\d) "   // isdst
-        "gmtoff=(\\d*)"  // gmtoff
-        "$");
-
-    vector<Zoneinfo_TZ*> add;
-
-    for (string line : lines) {
-      smatch res;
-      regex_match(line, res, re);
-      if (res.size() == 5) {
-        string date_s  (res[1].first, res[1].second);
-        string zone    (res[2].first, res[2].second);
-        string isdst_s (res[3].first, res[3].second);
-        string gmtoff_s(res[4].first, res[4].second);
-
-        bool isdst;
-        int16_t gmtoff;
-        struct tm t;
-
-        if (!safe_str2bool(isdst_s, &isdst)) continue;
-        if (!safe_str2int16(gmtoff_s, &gmtoff)) continue;
-        if (!strptime(date_s.c_str(), kRfc822DateFormat, &t)) continue;
-        // The 59 second is always preceeded one second later with a new
-        // timezone. LMT is the pre-standardized time offset, and these usually
-        // have odd minute and second values.
-        if (t.tm_sec == 59 && zone != "LMT") continue;
-
-        time_t ts = mktime(&t);
-
-        Zoneinfo_TZ *tz = new Zoneinfo_TZ;
-        tz->name = zone;
-        tz->is_dst = isdst;
-        tz->gmtoff = gmtoff;
-        tz->start = ts;
-
-        db_.push_back(tz);
+bool Zoneinfo::LoadInfo() {
+  if (locale_.empty()) return false;
+  SFU_TRACE_SCOPE("Zoneinfo::LoadInfo");
+
+  string path;
+  if (locale_[0] != '/') {
+    path = zoneinfo_dir();
+    path.push_back('/');
+  }
+  path.append(locale_);
+
+  MappedFile file;
+  if (!file.Open(path, MappedFile::RANDOM)) return false;
+  return ParseInfo(file.data());
+}
+
+bool Zoneinfo::ParseInfo(const strings::cord& tzif) {
+  // See RFC 8536 for the format. Version 1 files have 32 bit transition
+  // times. Later versions have a second header and data block with 64 bit
+  // times after it, and then a POSIX TZ rule footer for times after the last
+  // transition.
+  const char* p = tzif.ptr();
+  const char* const end = tzif.ptr() + tzif.length();
+  Header header;
+  if (!ParseHeader(p, end, &header)) return false;
+  size_t time_size = 4;
+  p += kHeaderSize;
+  if (header.version >= '2') {
+    p += header.DataSize(4);
+    if (!ParseHeader(p, end, &header) || header.version < '2') return false;
+    p += kHeaderSize;
+    time_size = 8;
+    if (static_cast<size_t>(end - p) < header.DataSize(8)) return false;
+  }
+
+  const char* times = p;
+  const char* indices = times + header.timecnt * time_size;
+  const char* ttinfos = indices + header.timecnt;
+  const char* chars = ttinfos + header.typecnt * 6;
+  const char* footer = ttinfos + header.typecnt * 6 + header.charcnt +
+                       header.leapcnt * (time_size + 4) +
+                       header.isstdcnt + header.isutcnt;
+  // The abbreviations must be NUL terminated.
+  if (chars[header.charcnt - 1] != '\0') return false;
+
+  // Equal types are merged, so the types stay few and small.
+  vector<uint8_t> type_index(header.typecnt);
+  vector<Zoneinfo_TZ> types;
+  for (uint32_t i = 0; i < header.typecnt; ++i) {
+    const char* type = ttinfos + i * 6;
+    const uint8_t name = static_cast<uint8_t>(type[5]);
+    if (name >= header.charcnt) return false;
+    Zoneinfo_TZ tz;
+    tz.gmtoff = static_cast<int32_t>(read_uint32(type));
+    tz.is_dst = type[4] != 0;
+    tz.name = chars + name;
+    size_t j = 0;
+    while (j < types.size() &&
+           tie(types[j].gmtoff, types[j].is_dst, types[j].name) !=
+           tie(tz.gmtoff, tz.is_dst, tz.name)) {
+      ++j;
+    }
+    if (j == types.size()) types.push_back(tz);
+    type_index[i] = static_cast<uint8_t>(j);
+  }
+
+  // Time type 0 is in effect before the first transition. Transitions that
+  // do not change the type are skipped.
+  vector<time_t> transitions(1, numeric_limits<time_t>::min());
+  vector<uint8_t> transition_types(1, type_index[0]);
+  for (uint32_t i = 0; i < header.timecnt; ++i) {
+    const uint8_t type = static_cast<uint8_t>(indices[i]);
+    if (type >= header.typecnt) return false;
+    const time_t ts = time_size == 8
+        ? read_int64(times + i * 8)
+        : static_cast<int32_t>(read_uint32(times + i * 4));
+    if (ts <= transitions.back()) return false;
+    if (type_index[type] == transition_types.back()) continue;
+    transitions.push_back(ts);
+    transition_types.push_back(type_index[type]);
+  }
+
+  // The footer is "\n<rule>\n", where the rule may be empty.
+  if (time_size == 8 && end - footer >= 2 && *footer == '\n') {
+    const char* rule_end = static_cast<const char*>(
+        memchr(footer + 1, '\n', end - footer - 1));
+    if (rule_end && rule_end > footer + 1) {
+      unique_ptr<Zoneinfo_Rule> rule(new Zoneinfo_Rule());
+      if (ParseRule(footer + 1, rule_end, rule.get())) {
+        rule_ = rule.release();
       }
     }
   }
+
+  transitions_.swap(transitions);
+  transition_types_.swap(transition_types);
+  types_.swap(types);
+  return true;
 }
 
 const Zoneinfo_TZ* Zoneinfo::ZoneForTimestamp(time_t ts) const {
-  if (db_.empty()) {
+  const size_t size = transitions_.size();
+  if (size == 0) {
     return NULL;
   }
+  const time_t* const transitions = transitions_.data();
+  // After the last transition, the rule gives the zone.
+  if (rule_ && ts >= transitions[size - 1]) {
+    return RuleZone(*rule_, ts);
+  }
 
-  auto i = db_.begin();
-  const Zoneinfo_TZ* last = *i;
-  for (; i != db_.end(); ++i) {
-    if ((*i)->start > ts) {
-      return last;
+  // Timestamps usually come in order, so most often the zone is the same as
+  // the last one. The first transition is at the earliest time_t, so the
+  // zone for ts always starts at or before it.
+  size_t i = last_hit_.load(memory_order_relaxed);
+  if (!(transitions[i] <= ts && (i + 1 == size || ts < transitions[i + 1]))) {
+    // Binary search for the last transition at or before ts, where the
+    // comparison picks the half without a branch.
+    const time_t* base = transitions;
+    size_t n = size;
+    while (n > 1) {
+      const size_t half = n / 2;
+      base = base[half] <= ts ? base + half : base;
+      n -= half;
     }
-    last = *i;
+    i = base - transitions;
+    last_hit_.store(i, memory_order_relaxed);
   }
-  return last;
+  return &types_[transition_types_[i]];
 }
 
 };  // namespace time
@@ -1,23 +1,37 @@
 #ifndef SFU_TIME_ZONEINFO_H_
 #define SFU_TIME_ZONEINFO_H_
 
+#include <atomic>
+#include <cstdint>
 #include <string>
 #include <vector>
 
+#include "sfu/strings/cord.h"
 #include "sfu/time/time.h"
 
 namespace sfu {
 namespace time {
 
-struct Zoneinfo_TZ;
+struct Zoneinfo_Rule;
 
-// Simple Zoneinfo class that only cares for the "current" timezone.
+// A local time type, e.g. CEST.
+struct Zoneinfo_TZ {
+  // Timezone name (not locale name).
+  std::string name;
+  // True if this is a daylight saving time.
+  bool is_dst;
+  // UTC offset in seconds east of GMT.
+  int32_t gmtoff;
+};
+
+// Timezone info for a locale, e.g. "Europe/Zurich", read from the binary
+// TZif files of the system zoneinfo database (/usr/share/zoneinfo, or $TZDIR).
 class Zoneinfo {
   private:
     Zoneinfo() {}  // Disable default constructors.
     Zoneinfo(const Zoneinfo& zone) {}
     Zoneinfo(const std::string& locale);
-    Zoneinfo(const std::string& zone, int16_t gmtoff);
+    Zoneinfo(const std::string& zone, int32_t gmtoff);
 
   public:
     ~Zoneinfo();
@@ -31,17 +45,41 @@ class Zoneinfo {
     // The name of the timezone valid at given timestamp. If no timestamp use
     // "now".
     const std::string& zone(time_t utc = kNowTimestamp) const;
+    // The locale name, e.g. "Europe/Zurich".
+    inline const std::string& locale() const { return locale_; }
 
+    // Get the zone for the locale name, loaded on first use and shared by
+    // all callers. Zones are immutable and never freed, so the pointer can be
+    // kept and used from any thread. Once a zone is loaded, getting it takes
+    // no locks. Returns NULL if there is no such zone.
     static const Zoneinfo* GetZoneinfo(const std::string& name);
+    // Load all zones in the zoneinfo database into the GetZoneinfo() cache,
+    // e.g. at startup so no later call has to read a file. Returns the number
+    // of zones loaded.
+    static size_t PreloadZoneinfo();
+    // Load the zone from the zoneinfo database. Returns NULL if there is no
+    // such zone, or it could not be read. The caller owns the zone.
+    static Zoneinfo* Load(const std::string& name);
   private:
     // Locale name for the timezone. E.g. "Europe/Zurich"
     std::string locale_;
 
-    // The timezone info database.
-    std::vector<Zoneinfo_TZ*> db_;
+    // The timezone info database, as sorted transition times, and the index
+    // in types_ of the local time type from each. The first transition is at
+    // the earliest time_t.
+    std::vector<time_t> transitions_;
+    std::vector<uint8_t> transition_types_;
+    // Distinct local time types of the zone.
+    std::vector<Zoneinfo_TZ> types_;
+    // Rule for times after the last of transitions_, or NULL.
+    Zoneinfo_Rule* rule_;
 
     // ---- methods ----
-    void LoadInfo();
+    bool LoadInfo();
+    bool ParseInfo(const strings::cord& tzif);
+
+    // Index of the last transition found by ZoneForTimestamp().
+    mutable std::atomic<size_t> last_hit_;
     const Zoneinfo_TZ* ZoneForTimestamp(time_t ts) const;
 };
 
@@ -0,0 +1,150 @@
+#include <stdlib.h>
+
+#include <memory>
+#include <thread>
+
+#include "sfu/time/zoneinfo.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+using namespace sfu::time;
+
+TEST(ZoneinfoTest, TestLoad) {
+  unique_ptr<Zoneinfo> oslo(Zoneinfo::Load("Europe/Oslo"));
+  ASSERT_TRUE(oslo.get() != NULL);
+
+  // 2009-02-14 00:31:30 CET.
+  EXPECT_EQ(3600, oslo->utcoffset(1234567890));
+  EXPECT_EQ(1234567890 + 3600, oslo->localtime(1234567890));
+  EXPECT_EQ("CET", oslo->zone(1234567890));
+  // 2009-07-01 02:00:00 CEST.
+  EXPECT_EQ(7200, oslo->utcoffset(1246406400));
+  EXPECT_EQ("CEST", oslo->zone(1246406400));
+  // 1850-01-01, local mean time before standard time.
+  EXPECT_EQ(2580, oslo->utcoffset(-3786825600));
+  EXPECT_EQ("LMT", oslo->zone(-3786825600));
+
+  unique_ptr<Zoneinfo> kolkata(Zoneinfo::Load("Asia/Kolkata"));
+  ASSERT_TRUE(kolkata.get() != NULL);
+  EXPECT_EQ(19800, kolkata->utcoffset(1234567890));
+  EXPECT_EQ("IST", kolkata->zone(1234567890));
+
+  unique_ptr<Zoneinfo> utc(Zoneinfo::Load("UTC"));
+  ASSERT_TRUE(utc.get() != NULL);
+  EXPECT_EQ(0, utc->utcoffset(1234567890));
+  EXPECT_EQ("UTC", utc->zone(1234567890));
+}
+
+TEST(ZoneinfoTest, TestRule) {
+  // Times after the last transition in the file use the POSIX TZ rule.
+  unique_ptr<Zoneinfo> oslo(Zoneinfo::Load("Europe/Oslo"));
+  ASSERT_TRUE(oslo.get() != NULL);
+  // 2030-03-31 01:00:00 UTC and 2030-10-27 01:00:00 UTC.
+  EXPECT_EQ(3600, oslo->utcoffset(1901149200 - 1));
+  EXPECT_EQ(7200, oslo->utcoffset(1901149200));
+  EXPECT_EQ(7200, oslo->utcoffset(1919293200 - 1));
+  EXPECT_EQ(3600, oslo->utcoffset(1919293200));
+  // 2100-07-01.
+  EXPECT_EQ(7200, oslo->utcoffset(4118083200));
+  EXPECT_EQ("CEST", oslo->zone(4118083200));
+
+  // DST over new year.
+  unique_ptr<Zoneinfo> sydney(Zoneinfo::Load("Australia/Sydney"));
+  ASSERT_TRUE(sydney.get() != NULL);
+  EXPECT_EQ(39600, sydney->utcoffset(1893456000));
+  EXPECT_EQ("AEDT", sydney->zone(1893456000));
+  EXPECT_EQ(36000, sydney->utcoffset(1909094400));
+  EXPECT_EQ("AEST", sydney->zone(1909094400));
+
+  // Numeric zone names.
+  unique_ptr<Zoneinfo> sao_paulo(Zoneinfo::Load("America/Sao_Paulo"));
+  ASSERT_TRUE(sao_paulo.get() != NULL);
+  EXPECT_EQ(-7200, sao_paulo->utcoffset(1234567890));
+  EXPECT_EQ("-02", sao_paulo->zone(1234567890));
+  EXPECT_EQ(-10800, sao_paulo->utcoffset(1700000000));
+  EXPECT_EQ("-03", sao_paulo->zone(1700000000));
+}
+
+TEST(ZoneinfoTest, TestNoSuchZone) {
+  EXPECT_TRUE(Zoneinfo::Load("No/Such_Zone") == NULL);
+  EXPECT_TRUE(Zoneinfo::Load("") == NULL);
+  // Not a TZif file.
+  EXPECT_TRUE(Zoneinfo::Load("zone.tab") == NULL);
+
+  const char* old_dir = getenv("TZDIR");
+  setenv("TZDIR", "/no/such/dir", 1);
+  EXPECT_TRUE(Zoneinfo::Load("Europe/Oslo") == NULL);
+  if (old_dir) {
+    setenv("TZDIR", old_dir, 1);
+  } else {
+    unsetenv("TZDIR");
+  }
+}
+
+TEST(ZoneinfoTest, TestLookupOrder) {
+  unique_ptr<Zoneinfo> oslo(Zoneinfo::Load("Europe/Oslo"));
+  ASSERT_TRUE(oslo.get() != NULL);
+
+  // 2009-03-29 01:00:00 UTC and 2009-10-25 01:00:00 UTC, stepping across
+  // the transitions forwards and backwards.
+  const time_t kSpring = 1238288400;
+  const time_t kFall = 1256432400;
+  for (time_t ts = kSpring - 3; ts <= kSpring + 3; ++ts) {
+    EXPECT_EQ(ts < kSpring ? 3600 : 7200, oslo->utcoffset(ts));
+  }
+  for (time_t ts = kFall + 3; ts >= kFall - 3; --ts) {
+    EXPECT_EQ(ts < kFall ? 7200 : 3600, oslo->utcoffset(ts));
+  }
+  EXPECT_EQ(2580, oslo->utcoffset(-3786825600));
+  EXPECT_EQ(3600, oslo->utcoffset(1234567890));
+  EXPECT_EQ(3600, oslo->utcoffset(1234567890));
+}
+
+TEST(ZoneinfoTest, TestGetZoneinfo) {
+  const Zoneinfo* oslo = Zoneinfo::GetZoneinfo("Europe/Oslo");
+  ASSERT_TRUE(oslo != NULL);
+  EXPECT_EQ("Europe/Oslo", oslo->locale());
+  EXPECT_EQ(3600, oslo->utcoffset(1234567890));
+  EXPECT_EQ(oslo, Zoneinfo::GetZoneinfo("Europe/Oslo"));
+  EXPECT_TRUE(Zoneinfo::GetZoneinfo("No/Such_Zone") == NULL);
+}
+
+TEST(ZoneinfoTest, TestGetZoneinfoThreads) {
+  const char* kZones[] = {
+    "America/New_York", "Asia/Tokyo", "Australia/Sydney", "Europe/London",
+    "Europe/Paris", "Pacific/Auckland", "America/Los_Angeles", "Asia/Dubai",
+  };
+  const size_t kNumZones = sizeof(kZones) / sizeof(kZones[0]);
+  const Zoneinfo* found[8][kNumZones];
+
+  vector<thread> threads;
+  for (size_t t = 0; t < 8; ++t) {
+    threads.push_back(thread([&, t] {
+      for (int round = 0; round < 100; ++round) {
+        for (size_t i = 0; i < kNumZones; ++i) {
+          const size_t z = (i + t) % kNumZones;
+          found[t][z] = Zoneinfo::GetZoneinfo(kZones[z]);
+        }
+      }
+    }));
+  }
+  for (thread& t : threads) t.join();
+
+  for (size_t i = 0; i < kNumZones; ++i) {
+    ASSERT_TRUE(found[0][i] != NULL) << kZones[i];
+    EXPECT_EQ(kZones[i], found[0][i]->locale());
+    for (size_t t = 1; t < 8; ++t) {
+      EXPECT_EQ(found[0][i], found[t][i]);
+    }
+  }
+}
+
+TEST(ZoneinfoTest, TestPreloadZoneinfo) {
+  const Zoneinfo* oslo = Zoneinfo::GetZoneinfo("Europe/Oslo");
+  EXPECT_LT(300u, Zoneinfo::PreloadZoneinfo());
+  // Already loaded zones are kept.
+  EXPECT_EQ(oslo, Zoneinfo::GetZoneinfo("Europe/Oslo"));
+  const Zoneinfo* tokyo = Zoneinfo::GetZoneinfo("Asia/Tokyo");
+  ASSERT_TRUE(tokyo != NULL);
+  EXPECT_EQ(32400, tokyo->utcoffset(1234567890));
+}
@@ -0,0 +1,250 @@
+#include "sfu/trace/trace.h"
+
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+
+namespace sfu {
+namespace trace {
+namespace trace_internal {
+
+std::atomic<bool> g_enabled(false);
+
+// One event in a ring. The fields are atomic, as a snapshot may read a slot
+// while its thread writes it, and then throws it away.
+struct Slot {
+  std::atomic<const char*> name;
+  std::atomic<uint64_t> start;
+  std::atomic<uint64_t> end;
+  std::atomic<uint32_t> tid;
+};
+
+// The events of one thread at a time. Only the thread writes to it, and a
+// snapshot reads it without stopping the thread: the slots read are only
+// kept if head shows they were not written meanwhile.
+struct Ring {
+  Ring() : head(0), floor(0), slots(new Slot[kEventsPerThread]) {}
+
+  // Number of events ever written.
+  std::atomic<uint64_t> head;
+  // Events before this are cleared.
+  std::atomic<uint64_t> floor;
+  std::unique_ptr<Slot[]> slots;
+};
+
+// All rings, and the rings of threads that exited, to be reused by new
+// threads. Never deleted, so that threads can trace while the process exits.
+struct Registry {
+  std::mutex mutex;
+  std::vector<Ring*> rings;
+  std::vector<Ring*> free;
+};
+
+Registry* registry() {
+  static Registry* registry = new Registry();
+  return registry;
+}
+
+__thread Ring* tls_ring = NULL;
+__thread uint32_t tls_tid = 0;
+__thread bool tls_exited = false;
+
+// Gives the ring back when the thread exits.
+struct RingOwner {
+  RingOwner() : ring(NULL) {}
+  ~RingOwner() {
+    tls_exited = true;
+    tls_ring = NULL;
+    if (ring == NULL) return;
+    Registry* r = registry();
+    std::lock_guard<std::mutex> lock(r->mutex);
+    r->free.push_back(ring);
+  }
+
+  Ring* ring;
+};
+
+thread_local RingOwner tls_owner;
+
+Ring* acquire_ring() {
+  Registry* r = registry();
+  Ring* ring;
+  {
+    std::lock_guard<std::mutex> lock(r->mutex);
+    if (!r->free.empty()) {
+      ring = r->free.back();
+      r->free.pop_back();
+    } else {
+      ring = new Ring();
+      r->rings.push_back(ring);
+    }
+  }
+  tls_owner.ring = ring;
+  tls_ring = ring;
+  tls_tid = static_cast<uint32_t>(syscall(SYS_gettid));
+  return ring;
+}
+
+void Record(const char* name, uint64_t start_ticks, uint64_t end_ticks) {
+  Ring* ring = tls_ring;
+  if (ring == NULL) {
+    if (tls_exited) return;
+    ring = acquire_ring();
+  }
+  const uint64_t head = ring->head.load(std::memory_order_relaxed);
+  // A snapshot that sees any of the slot written, also sees the head of
+  // the event before, and so knows the slot was overwritten.
+  std::atomic_thread_fence(std::memory_order_release);
+  Slot& slot = ring->slots[head & (kEventsPerThread - 1)];
+  slot.name.store(name, std::memory_order_relaxed);
+  slot.start.store(start_ticks, std::memory_order_relaxed);
+  slot.end.store(end_ticks, std::memory_order_relaxed);
+  slot.tid.store(tls_tid, std::memory_order_relaxed);
+  ring->head.store(head + 1, std::memory_order_release);
+}
+
+void read_ring(const Ring& ring, std::vector<Event>* events) {
+  const uint64_t head = ring.head.load(std::memory_order_acquire);
+  uint64_t first = ring.floor.load(std::memory_order_relaxed);
+  if (head - first > kEventsPerThread) first = head - kEventsPerThread;
+  if (first >= head) return;
+
+  std::vector<Event> read;
+  std::vector<uint64_t> index;
+  read.reserve(head - first);
+  for (uint64_t i = first; i < head; ++i) {
+    const Slot& slot = ring.slots[i & (kEventsPerThread - 1)];
+    Event event;
+    event.name = slot.name.load(std::memory_order_relaxed);
+    const uint64_t start = slot.start.load(std::memory_order_relaxed);
+    const uint64_t end = slot.end.load(std::memory_order_relaxed);
+    event.tid = slot.tid.load(std::memory_order_relaxed);
+    // Converted later, this is the raw ticks for now.
+    event.start_ns = static_cast<int64_t>(start);
+    event.end_ns = static_cast<int64_t>(end);
+    read.push_back(event);
+  }
+  std::atomic_thread_fence(std::memory_order_acquire);
+  // Event i is in the slot of event i + kEventsPerThread, which is being
+  // written when head is there.
+  const uint64_t now = ring.head.load(std::memory_order_relaxed);
+  for (uint64_t i = first; i < head; ++i) {
+    if (i + kEventsPerThread <= now) continue;
+    Event event = read[i - first];
+    event.start_ns = time::TscClock::ticks_to_monotonic_ns(
+        static_cast<uint64_t>(event.start_ns));
+    event.end_ns = time::TscClock::ticks_to_monotonic_ns(
+        static_cast<uint64_t>(event.end_ns));
+    events->push_back(event);
+  }
+}
+
+bool by_start(const Event& a, const Event& b) {
+  if (a.start_ns != b.start_ns) return a.start_ns < b.start_ns;
+  // The outer of nested spans first.
+  return a.end_ns > b.end_ns;
+}
+
+void append_json_string(const char* str, std::string* out) {
+  out->push_back('"');
+  for (const char* c = str; *c != '\0'; ++c) {
+    switch (*c) {
+      case '"': out->append("\\\""); break;
+      case '\\': out->append("\\\\"); break;
+      default:
+        if (static_cast<unsigned char>(*c) < 0x20) {
+          char buffer[8];
+          snprintf(buffer, sizeof(buffer), "\\u%04x", *c);
+          out->append(buffer);
+        } else {
+          out->push_back(*c);
+        }
+    }
+  }
+  out->push_back('"');
+}
+
+// Nanoseconds as microseconds with 3 decimals, the unit of Chrome traces.
+void append_us(int64_t ns, std::string* out) {
+  char buffer[32];
+  const char* sign = ns < 0 ? "-" : "";
+  if (ns < 0) ns = -ns;
+  snprintf(buffer, sizeof(buffer), "%s%" PRId64 ".%03d", sign, ns / 1000,
+           static_cast<int>(ns % 1000));
+  out->append(buffer);
+}
+
+}  // namespace trace_internal
+
+using namespace trace_internal;
+
+void Start() {
+  g_enabled.store(true, std::memory_order_relaxed);
+}
+
+void Stop() {
+  g_enabled.store(false, std::memory_order_relaxed);
+}
+
+void Clear() {
+  Registry* r = registry();
+  std::lock_guard<std::mutex> lock(r->mutex);
+  for (Ring* ring : r->rings) {
+    ring->floor.store(ring->head.load(std::memory_order_acquire),
+                      std::memory_order_relaxed);
+  }
+}
+
+void Snapshot(std::vector<Event>* events) {
+  events->clear();
+  Registry* r = registry();
+  {
+    std::lock_guard<std::mutex> lock(r->mutex);
+    for (const Ring* ring : r->rings) read_ring(*ring, events);
+  }
+  std::sort(events->begin(), events->end(), by_start);
+}
+
+void WriteChromeTrace(std::string* out) {
+  std::vector<Event> events;
+  Snapshot(&events);
+
+  char pid[16];
+  snprintf(pid, sizeof(pid), "%d", static_cast<int>(getpid()));
+  out->append("{\"traceEvents\":[");
+  for (size_t i = 0; i < events.size(); ++i) {
+    const Event& event = events[i];
+    if (i > 0) out->push_back(',');
+    out->append("\n{\"name\":");
+    append_json_string(event.name, out);
+    out->append(",\"cat\":\"sfu\",\"ph\":\"X\",\"ts\":");
+    append_us(event.start_ns, out);
+    out->append(",\"dur\":");
+    append_us(event.end_ns - event.start_ns, out);
+    out->append(",\"pid\":");
+    out->append(pid);
+    out->append(",\"tid\":");
+    char tid[16];
+    snprintf(tid, sizeof(tid), "%u", event.tid);
+    out->append(tid);
+    out->push_back('}');
+  }
+  out->append("\n],\"displayTimeUnit\":\"ns\"}\n");
+}
+
+bool WriteChromeTraceFile(const std::string& path) {
+  std::string json;
+  WriteChromeTrace(&json);
+  FILE* file = fopen(path.c_str(), "w");
+  if (file == NULL) return false;
+  const bool written = fwrite(json.data(), 1, json.size(), file) == json.size();
+  return fclose(file) == 0 && written;
+}
+
+}  // namespace trace
+}  // namespace sfu
@@ -0,0 +1,115 @@
+#ifndef SFU_TRACE_TRACE_H_
+#define SFU_TRACE_TRACE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "sfu/time/clock.h"
+
+namespace sfu {
+namespace trace {
+
+// Spans of time in named parts of the program, recorded in process, to see
+// where the time goes without an external profiler:
+//
+//   void Popen::Start(const Options& options) {
+//     SFU_TRACE_SCOPE("Popen::Start");
+//     ...
+//   }
+//
+//   trace::Start();
+//   ...
+//   trace::WriteChromeTraceFile("/tmp/trace.json");
+//
+// and load the file in chrome://tracing or https://ui.perfetto.dev.
+//
+// Nothing is recorded until Start(). Then a span is two TSC reads and a
+// store into a ring of events of the thread, without locks, where the
+// oldest events are overwritten when the ring is full. Building with
+// -DSFU_TRACE_DISABLED removes the SFU_TRACE_SCOPE() spans altogether.
+
+// Size of the ring of events per thread, of which all but one are kept. A
+// power of 2.
+static const size_t kEventsPerThread = 1 << 13;
+
+// A span recorded.
+struct Event {
+  // The name given to the span.
+  const char* name;
+  // Thread ID, as of gettid().
+  uint32_t tid;
+  // Start and end on the CLOCK_MONOTONIC scale.
+  int64_t start_ns;
+  int64_t end_ns;
+};
+
+namespace trace_internal {
+
+extern std::atomic<bool> g_enabled;
+
+void Record(const char* name, uint64_t start_ticks, uint64_t end_ticks);
+
+}  // namespace trace_internal
+
+// Start and stop recording spans in all threads.
+void Start();
+void Stop();
+
+inline bool enabled() {
+  return trace_internal::g_enabled.load(std::memory_order_relaxed);
+}
+
+// Forget the events recorded so far.
+void Clear();
+
+// All events kept, ordered by start.
+void Snapshot(std::vector<Event>* events);
+
+// Append the events kept as a Chrome trace event JSON object to out.
+void WriteChromeTrace(std::string* out);
+// Write the Chrome trace event JSON to a file. Returns false if it could not
+// be written.
+bool WriteChromeTraceFile(const std::string& path);
+
+// Records the time from construction to destruction as a span, if tracing
+// is started at construction. The name must outlive the trace, e.g. a
+// string literal.
+class Span {
+  public:
+    explicit Span(const char* name)
+        : name_(enabled() ? name : NULL),
+          start_(name_ != NULL ? time::TscClock::ticks() : 0) {}
+
+    ~Span() {
+      if (name_ != NULL) {
+        trace_internal::Record(name_, start_, time::TscClock::ticks());
+      }
+    }
+
+  private:
+    // Not copyable.
+    Span(const Span& span);
+    Span& operator=(const Span& span);
+
+    const char* const name_;
+    const uint64_t start_;
+};
+
+}  // namespace trace
+}  // namespace sfu
+
+#define SFU_TRACE_CONCAT_INNER_(a, b) a##b
+#define SFU_TRACE_CONCAT_(a, b) SFU_TRACE_CONCAT_INNER_(a, b)
+
+// A span for the rest of the enclosing scope.
+#ifdef SFU_TRACE_DISABLED
+#define SFU_TRACE_SCOPE(name) \
+  do {} while (0)
+#else
+#define SFU_TRACE_SCOPE(name) \
+  ::sfu::trace::Span SFU_TRACE_CONCAT_(sfu_trace_span_, __LINE__)(name)
+#endif
+
+#endif  // SFU_TRACE_TRACE_H_
@@ -0,0 +1,145 @@
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sfu/trace/trace.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+using namespace sfu;
+
+namespace {
+
+// Starts from an empty trace, and stops when done.
+class TraceTest : public ::testing::Test {
+  protected:
+    void SetUp() override {
+      trace::Clear();
+      trace::Start();
+    }
+    void TearDown() override {
+      trace::Stop();
+      trace::Clear();
+    }
+};
+
+}  // namespace
+
+TEST_F(TraceTest, TestSpan) {
+  {
+    SFU_TRACE_SCOPE("outer");
+    usleep(1000);
+    {
+      SFU_TRACE_SCOPE("inner");
+      usleep(1000);
+    }
+  }
+  vector<trace::Event> events;
+  trace::Snapshot(&events);
+  ASSERT_EQ(2u, events.size());
+  EXPECT_STREQ("outer", events[0].name);
+  EXPECT_STREQ("inner", events[1].name);
+  EXPECT_EQ(events[0].tid, events[1].tid);
+  EXPECT_LE(events[0].start_ns, events[1].start_ns);
+  EXPECT_GE(events[0].end_ns, events[1].end_ns);
+  EXPECT_LE(2000000, events[0].end_ns - events[0].start_ns);
+  EXPECT_LE(1000000, events[1].end_ns - events[1].start_ns);
+
+  trace::Clear();
+  trace::Snapshot(&events);
+  EXPECT_TRUE(events.empty());
+}
+
+TEST_F(TraceTest, TestStopped) {
+  trace::Stop();
+  EXPECT_FALSE(trace::enabled());
+  {
+    SFU_TRACE_SCOPE("not recorded");
+  }
+  vector<trace::Event> events;
+  trace::Snapshot(&events);
+  EXPECT_TRUE(events.empty());
+}
+
+TEST_F(TraceTest, TestRingWraps) {
+  const size_t kSpans = trace::kEventsPerThread + 100;
+  for (size_t i = 0; i < kSpans; ++i) {
+    trace::Span span(i < 100 ? "old" : "new");
+  }
+  vector<trace::Event> events;
+  trace::Snapshot(&events);
+  // The oldest slot may be being written, so is left out.
+  ASSERT_EQ(trace::kEventsPerThread - 1, events.size());
+  for (const trace::Event& event : events) EXPECT_STREQ("new", event.name);
+}
+
+TEST_F(TraceTest, TestThreads) {
+  const int kThreads = 4;
+  const int kSpans = 1000;
+  vector<thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.push_back(thread([] {
+      for (int i = 0; i < kSpans; ++i) {
+        SFU_TRACE_SCOPE("thread");
+      }
+    }));
+  }
+  // Snapshots while the threads write.
+  vector<trace::Event> events;
+  for (int i = 0; i < 10; ++i) trace::Snapshot(&events);
+  for (thread& t : threads) t.join();
+
+  trace::Snapshot(&events);
+  ASSERT_EQ(static_cast<size_t>(kThreads * kSpans), events.size());
+  for (size_t i = 1; i < events.size(); ++i) {
+    EXPECT_LE(events[i - 1].start_ns, events[i].start_ns);
+  }
+  vector<uint32_t> tids;
+  for (const trace::Event& event : events) {
+    EXPECT_STREQ("thread", event.name);
+    if (find(tids.begin(), tids.end(), event.tid) == tids.end()) {
+      tids.push_back(event.tid);
+    }
+  }
+  EXPECT_EQ(static_cast<size_t>(kThreads), tids.size());
+}
+
+TEST_F(TraceTest, TestChromeTrace) {
+  {
+    SFU_TRACE_SCOPE("a \"quoted\"\\name");
+  }
+  string json;
+  trace::WriteChromeTrace(&json);
+  EXPECT_EQ(0u, json.find("{\"traceEvents\":[\n{\"name\":"
+                          "\"a \\\"quoted\\\"\\\\name\",\"cat\":\"sfu\","
+                          "\"ph\":\"X\",\"ts\":"));
+  ostringstream pid;
+  pid << ",\"pid\":" << getpid() << ",\"tid\":";
+  EXPECT_NE(string::npos, json.find(pid.str()));
+  EXPECT_NE(string::npos, json.find("\n],\"displayTimeUnit\":\"ns\"}\n"));
+
+  char path[] = "/tmp/sfu_trace_test_XXXXXX";
+  int fd = mkstemp(path);
+  ASSERT_LE(0, fd);
+  close(fd);
+  EXPECT_TRUE(trace::WriteChromeTraceFile(path));
+  ifstream in(path);
+  stringstream content;
+  content << in.rdbuf();
+  EXPECT_EQ(json, content.str());
+  unlink(path);
+
+  EXPECT_FALSE(trace::WriteChromeTraceFile("/no/such/dir/trace.json"));
+
+  trace::Clear();
+  json.clear();
+  trace::WriteChromeTrace(&json);
+  EXPECT_EQ("{\"traceEvents\":[\n],\"displayTimeUnit\":\"ns\"}\n", json);
+}
@@ -0,0 +1,139 @@
+#include "sfu/unicode/casefold.h"
+
+#include <algorithm>
+
+#include "sfu/unicode/unicode_data.h"
+#include "sfu/utf8.h"
+
+using namespace std;
+
+namespace sfu {
+namespace unicode {
+namespace {
+
+// No codepoint below this folds, except ASCII upper case.
+const int32_t kCaseFoldFloor = 0xb5;
+
+inline int32_t FoldAscii(int32_t cp) {
+  return (cp >= 'A' && cp <= 'Z') ? cp + ('a' - 'A') : cp;
+}
+
+inline bool NeedsFolding(int32_t cp) {
+  if (cp < kCaseFoldFloor) return cp >= 'A' && cp <= 'Z';
+  return (unicode_internal::GetProps(cp).flags &
+          unicode_internal::kFlagCaseFold) != 0;
+}
+
+// Get the folding of a codepoint that NeedsFolding.
+const unicode_internal::Mapping* FindFolding(int32_t cp) {
+  const unicode_internal::Mapping* begin = unicode_internal::kCaseFoldMappings;
+  const unicode_internal::Mapping* end =
+      begin + unicode_internal::kNumCaseFoldMappings;
+  const unicode_internal::Mapping* it = lower_bound(
+      begin, end, cp,
+      [](const unicode_internal::Mapping& m, int32_t c) { return m.cp < c; });
+  if (it == end || it->cp != cp) return NULL;
+  return it;
+}
+
+// Stream of case folded codepoints. Invalid bytes are given as negative
+// values, unique per byte value.
+class FoldStream {
+ public:
+  explicit FoldStream(const strings::cord& str)
+      : it_(str.begin(), str.end(), str.begin()),
+        end_(str.begin(), str.end(), str.end()),
+        data_(NULL), remaining_(0) {}
+
+  // Get the next folded codepoint, false at the end.
+  inline bool next(int32_t* cp) {
+    if (remaining_ > 0) {
+      *cp = *(data_++);
+      --remaining_;
+      return true;
+    }
+    if (it_ == end_) return false;
+
+    int32_t c = *it_;
+    if (!it_.valid()) {
+      c = -1 - static_cast<uint8_t>(*it_.ptr());
+    } else if (c < kCaseFoldFloor) {
+      c = FoldAscii(c);
+    } else if (NeedsFolding(c)) {
+      const unicode_internal::Mapping* m = FindFolding(c);
+      if (m) {
+        data_ = unicode_internal::kCaseFoldData + m->offset;
+        remaining_ = m->length;
+        c = *(data_++);
+        --remaining_;
+      }
+    }
+    ++it_;
+    *cp = c;
+    return true;
+  }
+
+ private:
+  utf8_iterator it_;
+  utf8_iterator end_;
+  const int32_t* data_;
+  size_t remaining_;
+};
+
+}  // namespace
+
+bool CaseFold(const strings::cord& str, string* out) {
+  out->clear();
+  out->reserve(str.length());
+  utf8_range range = codepoints(str);
+  for (utf8_iterator it = range.begin(); it != range.end(); ++it) {
+    if (!it.valid()) return false;
+    int32_t cp = *it;
+    if (cp < 0x80) {
+      out->push_back(static_cast<char>(FoldAscii(cp)));
+      continue;
+    }
+    if (NeedsFolding(cp)) {
+      const unicode_internal::Mapping* m = FindFolding(cp);
+      if (m) {
+        const int32_t* data = unicode_internal::kCaseFoldData + m->offset;
+        for (size_t i = 0; i < m->length; ++i) {
+          Utf8AppendCodepoint(data[i], out);
+        }
+        continue;
+      }
+    }
+    out->append(it.ptr(), it.length());
+  }
+  return true;
+}
+
+bool CaseFoldView(const strings::cord& str, string* buffer,
+                  strings::cord* out) {
+  utf8_range range = codepoints(str);
+  for (utf8_iterator it = range.begin(); it != range.end(); ++it) {
+    if (!it.valid()) return false;
+    if (NeedsFolding(*it)) {
+      if (!CaseFold(str, buffer)) return false;
+      out->reset(*buffer);
+      return true;
+    }
+  }
+  out->reset(str);
+  return true;
+}
+
+bool CaseFoldEquals(const strings::cord& a, const strings::cord& b) {
+  FoldStream fa(a);
+  FoldStream fb(b);
+  int32_t ca, cb;
+  while (true) {
+    bool has_a = fa.next(&ca);
+    bool has_b = fb.next(&cb);
+    if (!has_a || !has_b) return has_a == has_b;
+    if (ca != cb) return false;
+  }
+}
+
+}  // namespace unicode
+}  // namespace sfu
@@ -0,0 +1,30 @@
+#ifndef SFU_UNICODE_CASEFOLD_H_
+#define SFU_UNICODE_CASEFOLD_H_
+
+#include <string>
+
+#include "sfu/strings/cord.h"
+
+namespace sfu {
+namespace unicode {
+
+// Full case folding (CaseFolding.txt status C and F) of the string, e.g.
+// "Straße" -> "strasse". Returns false if the string is not valid utf8.
+bool CaseFold(const strings::cord& str, std::string* out);
+
+// Same as CaseFold, but if there is nothing to fold *out points to str
+// itself, and nothing is copied. Otherwise the folded string is written to
+// *buffer, and *out points to it.
+bool CaseFoldView(const strings::cord& str, std::string* buffer,
+                  strings::cord* out);
+
+// Case insensitive equality using full case folding. Does not allocate.
+// Invalid utf8 bytes are only equal to the same byte. Note that this does not
+// normalize, for canonical caseless matching normalize both strings to NFD
+// first.
+bool CaseFoldEquals(const strings::cord& a, const strings::cord& b);
+
+}  // namespace unicode
+}  // namespace sfu
+
+#endif  // SFU_UNICODE_CASEFOLD_H_
@@ -0,0 +1,44 @@
+#include <string>
+
+#include "sfu/unicode/casefold.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+using namespace sfu::unicode;
+
+TEST(CaseFoldTest, TestCaseFold) {
+  string out;
+  EXPECT_TRUE(CaseFold("Hello World", &out));
+  EXPECT_EQ("hello world", out);
+  EXPECT_TRUE(CaseFold("Stra\u00dfe", &out));
+  EXPECT_EQ("strasse", out);
+  EXPECT_TRUE(CaseFold("\u039a\u0391\u039b\u0397", &out));
+  EXPECT_EQ("\u03ba\u03b1\u03bb\u03b7", out);
+  EXPECT_TRUE(CaseFold("\u00b5\u1e9e", &out));
+  EXPECT_EQ("\u03bcss", out);
+  EXPECT_FALSE(CaseFold("A\xff", &out));
+}
+
+TEST(CaseFoldTest, TestCaseFoldView) {
+  string input("already folded \u00e6\u00f8\u00e5");
+  string buffer;
+  sfu::strings::cord out;
+  ASSERT_TRUE(CaseFoldView(input, &buffer, &out));
+  EXPECT_EQ(input.c_str(), out.ptr());
+
+  input = "\u00c6\u00d8\u00c5";
+  ASSERT_TRUE(CaseFoldView(input, &buffer, &out));
+  EXPECT_EQ(buffer.c_str(), out.ptr());
+  EXPECT_EQ("\u00e6\u00f8\u00e5", out.as_string());
+}
+
+TEST(CaseFoldTest, TestCaseFoldEquals) {
+  EXPECT_TRUE(CaseFoldEquals("", ""));
+  EXPECT_TRUE(CaseFoldEquals("Hello", "hELLO"));
+  EXPECT_TRUE(CaseFoldEquals("STRASSE", "stra\u00dfe"));
+  EXPECT_TRUE(CaseFoldEquals("\u00df", "ss"));
+  EXPECT_FALSE(CaseFoldEquals("\u00df", "s"));
+  EXPECT_FALSE(CaseFoldEquals("Hello", "Hell"));
+  EXPECT_TRUE(CaseFoldEquals("a\xff", "A\xff"));
+  EXPECT_FALSE(CaseFoldEquals("a\xff", "a\xfe"));
+}
@@ -0,0 +1,167 @@
+#!/usr/bin/env python3
+#
+# Generates unicode_data.cc from the unicode database shipped with python.
+#
+#   python3 sfu/unicode/gen_unicode_data.py > sfu/unicode/unicode_data.cc
+#
+# The per codepoint properties (combining class and quick check flags) are
+# stored in a two-stage trie of deduplicated blocks. Decompositions,
+# compositions and case foldings are stored as sorted tables that are only
+# consulted on the slow path.
+
+import sys
+import unicodedata
+
+MAX_CP = 0x110000
+BLOCK_SHIFT = 7
+BLOCK_SIZE = 1 << BLOCK_SHIFT
+
+FLAG_NFD_NO = 0x01
+FLAG_NFKD_NO = 0x02
+FLAG_NFC_NO = 0x04
+FLAG_NFKC_NO = 0x08
+FLAG_NFC_MAYBE = 0x10
+FLAG_CASEFOLD = 0x20
+
+HANGUL_S_BASE = 0xac00
+HANGUL_S_COUNT = 11172
+
+
+def is_hangul_syllable(cp):
+    return HANGUL_S_BASE <= cp < HANGUL_S_BASE + HANGUL_S_COUNT
+
+
+def is_surrogate(cp):
+    return 0xd800 <= cp < 0xe000
+
+
+def main():
+    ccc = [0] * MAX_CP
+    flags = [0] * MAX_CP
+    canonical = {}
+    compat = {}
+    casefold = {}
+    second = set()
+    compositions = []
+
+    for cp in range(MAX_CP):
+        if is_surrogate(cp):
+            continue
+        ch = chr(cp)
+        ccc[cp] = unicodedata.combining(ch)
+
+        nfd = unicodedata.normalize('NFD', ch)
+        nfkd = unicodedata.normalize('NFKD', ch)
+        if nfd != ch:
+            flags[cp] |= FLAG_NFD_NO
+            if not is_hangul_syllable(cp):
+                canonical[cp] = [ord(c) for c in nfd]
+        if nfkd != ch:
+            flags[cp] |= FLAG_NFKD_NO
+            if nfkd != nfd:
+                compat[cp] = [ord(c) for c in nfkd]
+        if unicodedata.normalize('NFC', ch) != ch:
+            flags[cp] |= FLAG_NFC_NO
+        if unicodedata.normalize('NFKC', ch) != ch:
+            flags[cp] |= FLAG_NFKC_NO
+
+        folded = ch.casefold()
+        if folded != ch:
+            flags[cp] |= FLAG_CASEFOLD
+            casefold[cp] = [ord(c) for c in folded]
+
+        # Primary composites: a canonical pair that NFC composes back.
+        d = unicodedata.decomposition(ch)
+        if d and not d.startswith('<') and not is_hangul_syllable(cp):
+            parts = [int(x, 16) for x in d.split()]
+            if (len(parts) == 2 and
+                    unicodedata.normalize('NFC', chr(parts[0]) + chr(parts[1])) == ch):
+                compositions.append((parts[0], parts[1], cp))
+                second.add(parts[1])
+
+    # Hangul vowels and trailing consonants compose algorithmically.
+    second.update(range(0x1161, 0x1176))
+    second.update(range(0x11a8, 0x11c3))
+    for cp in second:
+        flags[cp] |= FLAG_NFC_MAYBE
+
+    props = []
+    prop_index = {}
+    values = []
+    for cp in range(MAX_CP):
+        key = (ccc[cp], flags[cp])
+        if key not in prop_index:
+            prop_index[key] = len(props)
+            props.append(key)
+        values.append(prop_index[key])
+    assert len(props) < 256, len(props)
+
+    blocks = []
+    block_index = {}
+    stage1 = []
+    for start in range(0, MAX_CP, BLOCK_SIZE):
+        block = tuple(values[start:start + BLOCK_SIZE])
+        if block not in block_index:
+            block_index[block] = len(blocks)
+            blocks.append(block)
+        stage1.append(block_index[block])
+    assert len(blocks) < 65536
+
+    out = sys.stdout
+    out.write('// Generated by sfu/unicode/gen_unicode_data.py from unicode %s.\n'
+              % unicodedata.unidata_version)
+    out.write('// DO NOT EDIT.\n\n')
+    out.write('#include "sfu/unicode/unicode_data.h"\n\n')
+    out.write('namespace sfu {\nnamespace unicode {\nnamespace unicode_internal {\n\n')
+
+    out.write('const char* const kUnicodeVersion = "%s";\n\n'
+              % unicodedata.unidata_version)
+
+    stage1_type = 'uint8_t' if len(blocks) < 256 else 'uint16_t'
+    write_array(out, 'const %s kPropStage1[%d]' % (stage1_type, len(stage1)),
+                ['%d' % v for v in stage1])
+    write_array(out, 'const uint8_t kPropStage2[%d]' % (len(blocks) * BLOCK_SIZE),
+                ['%d' % v for b in blocks for v in b])
+    write_array(out, 'const Props kProps[%d]' % len(props),
+                ['{%d, 0x%02x}' % p for p in props], per_line=6)
+
+    write_mapping(out, 'Canonical', canonical)
+    write_mapping(out, 'Compat', compat)
+    write_mapping(out, 'CaseFold', casefold)
+
+    compositions.sort()
+    write_array(out, 'const Composition kCompositions[%d]' % len(compositions),
+                ['{0x%04x, 0x%04x, 0x%04x}' % c for c in compositions], per_line=3)
+    out.write('const size_t kNumCompositions = %d;\n\n' % len(compositions))
+
+    out.write('}  // namespace unicode_internal\n}  // namespace unicode\n'
+              '}  // namespace sfu\n')
+
+    if stage1_type != 'uint8_t':
+        sys.stderr.write('NOTE: stage 1 needs uint16_t, update unicode_data.h\n')
+
+
+def write_mapping(out, name, mapping):
+    data = []
+    entries = []
+    for cp in sorted(mapping):
+        seq = mapping[cp]
+        entries.append('{0x%04x, %d, %d}' % (cp, len(data), len(seq)))
+        data.extend(seq)
+    assert len(data) < 65536
+    write_array(out, 'const Mapping k%sMappings[%d]' % (name, len(entries)),
+                entries, per_line=4)
+    out.write('const size_t kNum%sMappings = %d;\n\n' % (name, len(entries)))
+    write_array(out, 'const int32_t k%sData[%d]' % (name, len(data)),
+                ['0x%04x' % v for v in data], per_line=8)
+
+
+def write_array(out, decl, items, per_line=16):
+    out.write('%s = {\n' % decl)
+    for i in range(0, len(items), per_line):
+        out.write('  ' + ', '.join(items[i:i + per_line]) + ',\n')
+    out.write('};\n\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,261 @@
+#include "sfu/unicode/normalize.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "sfu/unicode/unicode_data.h"
+#include "sfu/utf8.h"
+
+using namespace std;
+
+namespace sfu {
+namespace unicode {
+namespace {
+
+using unicode_internal::GetProps;
+
+// Hangul syllables are decomposed and composed algorithmically.
+const int32_t kHangulSBase  = 0xac00;
+const int32_t kHangulLBase  = 0x1100;
+const int32_t kHangulVBase  = 0x1161;
+const int32_t kHangulTBase  = 0x11a7;
+const int32_t kHangulLCount = 19;
+const int32_t kHangulVCount = 21;
+const int32_t kHangulTCount = 28;
+const int32_t kHangulNCount = kHangulVCount * kHangulTCount;
+const int32_t kHangulSCount = kHangulLCount * kHangulNCount;
+
+// All codepoints below this are normalized in all forms, and have combining
+// class 0.
+const int32_t kQuickCheckFloor = 0xa0;
+
+inline bool IsCompose(NormalizationForm form) {
+  return form == NFC || form == NFKC;
+}
+
+inline bool IsCompat(NormalizationForm form) {
+  return form == NFKC || form == NFKD;
+}
+
+inline uint8_t CombiningClass(int32_t cp) {
+  return cp < kQuickCheckFloor ? 0 : GetProps(cp).ccc;
+}
+
+inline const unicode_internal::Mapping* FindMapping(
+    const unicode_internal::Mapping* table, size_t size, int32_t cp) {
+  const unicode_internal::Mapping* end = table + size;
+  const unicode_internal::Mapping* it = lower_bound(
+      table, end, cp,
+      [](const unicode_internal::Mapping& m, int32_t c) { return m.cp < c; });
+  if (it == end || it->cp != cp) return NULL;
+  return it;
+}
+
+void Decompose(int32_t cp, bool compat, vector<int32_t>* buffer) {
+  if (cp < kQuickCheckFloor) {
+    buffer->push_back(cp);
+    return;
+  }
+  uint8_t flags = GetProps(cp).flags;
+  uint8_t flag = compat ? unicode_internal::kFlagNfkdNo
+                        : unicode_internal::kFlagNfdNo;
+  if (!(flags & flag)) {
+    buffer->push_back(cp);
+    return;
+  }
+
+  int32_t s = cp - kHangulSBase;
+  if (s >= 0 && s < kHangulSCount) {
+    buffer->push_back(kHangulLBase + s / kHangulNCount);
+    buffer->push_back(kHangulVBase + (s % kHangulNCount) / kHangulTCount);
+    if (s % kHangulTCount != 0) {
+      buffer->push_back(kHangulTBase + s % kHangulTCount);
+    }
+    return;
+  }
+
+  const unicode_internal::Mapping* m = NULL;
+  const int32_t* data = NULL;
+  if (compat) {
+    m = FindMapping(unicode_internal::kCompatMappings,
+                    unicode_internal::kNumCompatMappings, cp);
+    data = unicode_internal::kCompatData;
+  }
+  if (!m) {
+    m = FindMapping(unicode_internal::kCanonicalMappings,
+                    unicode_internal::kNumCanonicalMappings, cp);
+    data = unicode_internal::kCanonicalData;
+  }
+  if (!m) {
+    buffer->push_back(cp);
+    return;
+  }
+  buffer->insert(buffer->end(), data + m->offset, data + m->offset + m->length);
+}
+
+// Stable sort of each run of non-starters by combining class.
+void CanonicalOrder(vector<int32_t>* buffer) {
+  vector<int32_t>& b = *buffer;
+  for (size_t i = 1; i < b.size(); ++i) {
+    int32_t cp = b[i];
+    uint8_t ccc = CombiningClass(cp);
+    if (ccc == 0) continue;
+    size_t j = i;
+    while (j > 0 && CombiningClass(b[j - 1]) > ccc) {
+      b[j] = b[j - 1];
+      --j;
+    }
+    b[j] = cp;
+  }
+}
+
+// Get the primary composite of the pair, or -1 if there is none.
+int32_t ComposePair(int32_t first, int32_t second) {
+  int32_t l = first - kHangulLBase;
+  int32_t v = second - kHangulVBase;
+  if (l >= 0 && l < kHangulLCount && v >= 0 && v < kHangulVCount) {
+    return kHangulSBase + (l * kHangulVCount + v) * kHangulTCount;
+  }
+  int32_t s = first - kHangulSBase;
+  int32_t t = second - kHangulTBase;
+  if (s >= 0 && s < kHangulSCount && s % kHangulTCount == 0 &&
+      t > 0 && t < kHangulTCount) {
+    return first + t;
+  }
+
+  if (second < kQuickCheckFloor ||
+      !(GetProps(second).flags & unicode_internal::kFlagNfcMaybe)) {
+    return -1;
+  }
+  const unicode_internal::Composition* begin = unicode_internal::kCompositions;
+  const unicode_internal::Composition* end =
+      begin + unicode_internal::kNumCompositions;
+  const unicode_internal::Composition* it = lower_bound(
+      begin, end, make_pair(first, second),
+      [](const unicode_internal::Composition& c,
+         const pair<int32_t, int32_t>& p) {
+        return c.first < p.first || (c.first == p.first && c.second < p.second);
+      });
+  if (it == end || it->first != first || it->second != second) return -1;
+  return it->composite;
+}
+
+// Canonical composition of a decomposed and ordered buffer.
+void Compose(vector<int32_t>* buffer) {
+  vector<int32_t>& b = *buffer;
+  if (b.empty()) return;
+
+  size_t starter_pos = 0;
+  int32_t starter = b[0];
+  // Using 256 as "blocked" for a leading non-starter.
+  int last_ccc = CombiningClass(starter) == 0 ? 0 : 256;
+  size_t out = 1;
+  for (size_t i = 1; i < b.size(); ++i) {
+    int32_t cp = b[i];
+    int ccc = CombiningClass(cp);
+    if (last_ccc == 0 || last_ccc < ccc) {
+      int32_t composite = ComposePair(starter, cp);
+      if (composite >= 0) {
+        b[starter_pos] = composite;
+        starter = composite;
+        continue;
+      }
+    }
+    if (ccc == 0) {
+      starter_pos = out;
+      starter = cp;
+    }
+    last_ccc = ccc;
+    b[out++] = cp;
+  }
+  b.resize(out);
+}
+
+}  // namespace
+
+QuickCheckResult QuickCheck(const strings::cord& str, NormalizationForm form) {
+  uint8_t no_flag = 0;
+  uint8_t maybe_flag = 0;
+  switch (form) {
+    case NFC:
+      no_flag = unicode_internal::kFlagNfcNo;
+      maybe_flag = unicode_internal::kFlagNfcMaybe;
+      break;
+    case NFD:
+      no_flag = unicode_internal::kFlagNfdNo;
+      break;
+    case NFKC:
+      no_flag = unicode_internal::kFlagNfkcNo;
+      maybe_flag = unicode_internal::kFlagNfcMaybe;
+      break;
+    case NFKD:
+      no_flag = unicode_internal::kFlagNfkdNo;
+      break;
+  }
+
+  QuickCheckResult result = QC_YES;
+  uint8_t last_ccc = 0;
+  utf8_range range = codepoints(str);
+  for (utf8_iterator it = range.begin(); it != range.end(); ++it) {
+    int32_t cp = *it;
+    if (cp < kQuickCheckFloor) {
+      last_ccc = 0;
+      continue;
+    }
+    if (!it.valid()) return QC_NO;
+
+    const unicode_internal::Props& props = GetProps(cp);
+    if (props.ccc != 0 && last_ccc > props.ccc) return QC_NO;
+    if (props.flags & no_flag) return QC_NO;
+    if (props.flags & maybe_flag) result = QC_MAYBE;
+    last_ccc = props.ccc;
+  }
+  return result;
+}
+
+bool IsNormalized(const strings::cord& str, NormalizationForm form) {
+  QuickCheckResult qc = QuickCheck(str, form);
+  if (qc != QC_MAYBE) return qc == QC_YES;
+
+  string normalized;
+  if (!Normalize(str, form, &normalized)) return false;
+  return str.string_equals(normalized);
+}
+
+bool Normalize(const strings::cord& str, NormalizationForm form,
+               string* out) {
+  out->clear();
+  vector<int32_t> buffer;
+  buffer.reserve(str.length());
+
+  bool compat = IsCompat(form);
+  utf8_range range = codepoints(str);
+  for (utf8_iterator it = range.begin(); it != range.end(); ++it) {
+    if (!it.valid()) return false;
+    Decompose(*it, compat, &buffer);
+  }
+  CanonicalOrder(&buffer);
+  if (IsCompose(form)) {
+    Compose(&buffer);
+  }
+
+  out->reserve(str.length());
+  for (int32_t cp : buffer) {
+    Utf8AppendCodepoint(cp, out);
+  }
+  return true;
+}
+
+bool NormalizeView(const strings::cord& str, NormalizationForm form,
+                   string* buffer, strings::cord* out) {
+  if (QuickCheck(str, form) == QC_YES) {
+    out->reset(str);
+    return true;
+  }
+  if (!Normalize(str, form, buffer)) return false;
+  out->reset(*buffer);
+  return true;
+}
+
+}  // namespace unicode
+}  // namespace sfu
@@ -0,0 +1,48 @@
+#ifndef SFU_UNICODE_NORMALIZE_H_
+#define SFU_UNICODE_NORMALIZE_H_
+
+#include <string>
+
+#include "sfu/strings/cord.h"
+
+namespace sfu {
+namespace unicode {
+
+// Unicode normalization forms, see UAX #15.
+typedef enum {
+  NFC = 0,  // Canonical decomposition, followed by canonical composition.
+  NFD,      // Canonical decomposition.
+  NFKC,     // Compatibility decomposition, followed by canonical composition.
+  NFKD      // Compatibility decomposition.
+} NormalizationForm;
+
+typedef enum {
+  QC_YES = 0,
+  QC_NO,
+  QC_MAYBE
+} QuickCheckResult;
+
+// Quick check if the string is in the given normalization form. This never
+// allocates, and gives QC_MAYBE only if the string contains characters that
+// may compose with the preceding character. Invalid utf8 gives QC_NO.
+QuickCheckResult QuickCheck(const strings::cord& str, NormalizationForm form);
+
+// Check if the string is in the given normalization form. Only allocates if
+// the quick check is not conclusive.
+bool IsNormalized(const strings::cord& str, NormalizationForm form);
+
+// Normalize the string into the given form. Returns false if the string is not
+// valid utf8.
+bool Normalize(const strings::cord& str, NormalizationForm form,
+               std::string* out);
+
+// Same as Normalize, but if the string is already normalized *out points to
+// str itself, and nothing is copied. Otherwise the normalized string is
+// written to *buffer, and *out points to it.
+bool NormalizeView(const strings::cord& str, NormalizationForm form,
+                   std::string* buffer, strings::cord* out);
+
+}  // namespace unicode
+}  // namespace sfu
+
+#endif  // SFU_UNICODE_NORMALIZE_H_
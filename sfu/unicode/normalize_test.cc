@@ -0,0 +1,72 @@
+#include <string>
+
+#include "sfu/unicode/normalize.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+using namespace sfu::unicode;
+
+namespace {
+
+string normalize(const string& str, NormalizationForm form) {
+  string out;
+  EXPECT_TRUE(Normalize(str, form, &out));
+  return out;
+}
+
+}  // namespace
+
+TEST(NormalizeTest, TestDecompose) {
+  EXPECT_EQ("e\u0301", normalize("\u00e9", NFD));
+  // Angstrom sign is a singleton decomposition.
+  EXPECT_EQ("A\u030a", normalize("\u212b", NFD));
+  // Combining marks are ordered by combining class: dot below (220) before
+  // dot above (230).
+  EXPECT_EQ("q\u0323\u0307", normalize("q\u0307\u0323", NFD));
+  // Hangul syllable.
+  EXPECT_EQ("\u1100\u1161\u11a8", normalize("\uac01", NFD));
+  // Compatibility decomposition.
+  EXPECT_EQ("fi", normalize("\ufb01", NFKD));
+  EXPECT_EQ("\ufb01", normalize("\ufb01", NFD));
+  EXPECT_EQ("s\u0323\u0307", normalize("\u1e9b\u0323", NFKD));
+}
+
+TEST(NormalizeTest, TestCompose) {
+  EXPECT_EQ("\u00e9", normalize("e\u0301", NFC));
+  EXPECT_EQ("\u00c5", normalize("\u212b", NFC));
+  EXPECT_EQ("\uac01", normalize("\u1100\u1161\u11a8", NFC));
+  // The dot above is not blocked by the dot below, which composes first.
+  EXPECT_EQ("\u1e0d\u0307", normalize("d\u0307\u0323", NFC));
+  EXPECT_EQ("fi", normalize("\ufb01", NFKC));
+  EXPECT_EQ("\u1e69", normalize("\u1e9b\u0323", NFKC));
+  EXPECT_EQ("\u1e9b\u0323", normalize("\u1e9b\u0323", NFC));
+}
+
+TEST(NormalizeTest, TestQuickCheck) {
+  EXPECT_EQ(QC_YES, QuickCheck("plain ascii", NFC));
+  EXPECT_EQ(QC_YES, QuickCheck("\u00e9t\u00e9", NFC));
+  EXPECT_EQ(QC_NO, QuickCheck("\u00e9t\u00e9", NFD));
+  EXPECT_EQ(QC_MAYBE, QuickCheck("e\u0301", NFC));
+  EXPECT_EQ(QC_NO, QuickCheck("\ufb01", NFKC));
+  EXPECT_EQ(QC_NO, QuickCheck("q\u0307\u0323", NFD));
+  EXPECT_EQ(QC_NO, QuickCheck("a\xff", NFC));
+
+  EXPECT_FALSE(IsNormalized("e\u0301", NFC));
+  EXPECT_TRUE(IsNormalized("\u00e1\u0301", NFC));
+}
+
+TEST(NormalizeTest, TestNormalizeView) {
+  string input("already normalized \u00e9");
+  string buffer;
+  sfu::strings::cord out;
+  ASSERT_TRUE(NormalizeView(input, NFC, &buffer, &out));
+  EXPECT_EQ(input.c_str(), out.ptr());
+  EXPECT_TRUE(buffer.empty());
+
+  input = "e\u0301";
+  ASSERT_TRUE(NormalizeView(input, NFC, &buffer, &out));
+  EXPECT_EQ(buffer.c_str(), out.ptr());
+  EXPECT_EQ("\u00e9", out.as_string());
+
+  EXPECT_FALSE(NormalizeView("\xc0\xaf", NFC, &buffer, &out));
+}
@@ -0,0 +1,5399 @@
+// Generated by sfu/unicode/gen_unicode_data.py from unicode 14.0.0.
+// DO NOT EDIT.
+
+#include "sfu/unicode/unicode_data.h"
+
+namespace sfu {
+namespace unicode {
+namespace unicode_internal {
+
+const char* const kUnicodeVersion = "14.0.0";
+
+const uint8_t kPropStage1[8704] = {
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+  32, 33, 34, 35, 36, 36, 37, 38, 36, 36, 36, 36, 36, 36, 39, 40,
+  36, 41, 42, 36, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54,
+  55, 56, 57, 58, 59, 60, 61, 36, 62, 63, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 64, 65, 36, 36, 66, 67, 68, 69, 36, 70, 71, 72,
+  73, 74, 75, 76, 77, 71, 71, 71, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 78, 79, 80, 81,
+  82, 83, 84, 85, 36, 86, 87, 88, 89, 89, 89, 89, 89, 89, 89, 89,
+  89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+  89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+  89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+  89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+  89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 90,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 91, 91, 92, 93, 94, 95, 71, 71, 96, 97, 98, 99, 100, 101,
+  36, 36, 36, 102, 36, 103, 104, 36, 105, 106, 107, 108, 36, 36, 36, 109,
+  36, 36, 36, 36, 110, 111, 36, 36, 36, 112, 113, 36, 36, 114, 115, 116,
+  117, 118, 119, 120, 121, 122, 123, 36, 124, 125, 36, 126, 127, 128, 129, 36,
+  130, 131, 132, 133, 134, 135, 36, 36, 127, 36, 136, 137, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 138, 139, 36, 36, 36, 36, 36, 140, 36, 36, 141,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 142, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 143, 144, 145, 36, 36, 36, 146, 147, 148, 71, 71, 149, 71, 150,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  151, 36, 139, 36, 36, 152, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 153, 154, 36, 36, 36, 36, 36, 36, 36, 36, 36, 155, 156, 36, 36,
+  36, 36, 157, 158, 159, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 160, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  91, 91, 91, 91, 161, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+  36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+};
+
+const uint8_t kPropStage2[20736] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0, 2,
+  0, 0, 2, 2, 2, 3, 0, 0, 2, 2, 2, 0, 2, 2, 2, 0,
+  4, 4, 4, 4, 4, 4, 1, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  1, 4, 4, 4, 4, 4, 4, 0, 1, 4, 4, 4, 4, 4, 1, 1,
+  5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  0, 5, 5, 5, 5, 5, 5, 0, 0, 5, 5, 5, 5, 5, 0, 5,
+  4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5,
+  1, 0, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5,
+  4, 5, 4, 5, 4, 5, 1, 0, 4, 5, 4, 5, 4, 5, 4, 5,
+  4, 0, 3, 2, 4, 5, 4, 5, 0, 4, 5, 4, 5, 4, 5, 3,
+  2, 1, 0, 4, 5, 4, 5, 4, 5, 3, 1, 0, 4, 5, 4, 5,
+  4, 5, 1, 0, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5,
+  4, 5, 4, 5, 4, 5, 1, 0, 4, 5, 4, 5, 4, 5, 4, 5,
+  4, 5, 4, 5, 4, 5, 4, 5, 4, 4, 5, 4, 5, 4, 5, 3,
+  0, 1, 1, 0, 1, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 1,
+  1, 1, 0, 1, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 1,
+  4, 5, 1, 0, 1, 0, 1, 1, 0, 1, 0, 0, 1, 0, 1, 4,
+  5, 1, 1, 1, 0, 1, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0,
+  0, 0, 0, 0, 3, 3, 2, 3, 3, 2, 3, 3, 2, 4, 5, 4,
+  5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 0, 4, 5,
+  4, 5, 4, 5, 1, 0, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5,
+  4, 3, 3, 2, 4, 5, 1, 1, 4, 5, 4, 5, 4, 5, 4, 5,
+  4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5,
+  4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 1, 0, 4, 5,
+  1, 0, 1, 0, 1, 0, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5,
+  4, 5, 4, 5, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 1, 0,
+  0, 1, 0, 1, 1, 1, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0,
+  2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  6, 6, 6, 6, 6, 7, 6, 6, 6, 6, 6, 6, 6, 7, 7, 6,
+  7, 6, 7, 6, 6, 8, 9, 9, 9, 9, 8, 10, 9, 9, 9, 9,
+  9, 11, 11, 12, 12, 12, 12, 13, 13, 9, 9, 9, 9, 12, 12, 9,
+  12, 12, 9, 9, 14, 14, 14, 14, 15, 9, 9, 9, 9, 7, 7, 7,
+  16, 16, 6, 16, 16, 17, 7, 9, 9, 9, 7, 7, 7, 9, 9, 0,
+  7, 7, 7, 9, 9, 9, 9, 7, 8, 9, 9, 7, 18, 19, 19, 18,
+  19, 19, 18, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  1, 0, 1, 0, 20, 0, 1, 0, 0, 0, 2, 0, 0, 0, 20, 1,
+  0, 0, 0, 0, 2, 21, 4, 20, 4, 4, 4, 0, 4, 0, 4, 4,
+  4, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 4, 4, 5, 5, 5, 5,
+  4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5, 5, 5, 1,
+  3, 3, 2, 21, 21, 3, 3, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  3, 3, 2, 0, 3, 3, 0, 1, 0, 3, 1, 0, 0, 1, 1, 1,
+  4, 4, 1, 4, 1, 1, 1, 4, 1, 1, 1, 1, 4, 4, 4, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 4, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  5, 5, 0, 5, 0, 0, 0, 5, 0, 0, 0, 0, 5, 5, 5, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 4, 5, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 0, 7, 7, 7, 7, 7, 0, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 4, 5, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0,
+  4, 5, 4, 5, 1, 0, 4, 5, 1, 0, 4, 5, 4, 5, 4, 5,
+  1, 0, 4, 5, 4, 5, 4, 5, 1, 0, 4, 5, 4, 5, 4, 5,
+  4, 5, 4, 5, 4, 5, 1, 0, 4, 5, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 9, 7, 7, 7, 7, 9, 7, 7, 7, 22, 9, 7, 7, 7, 7,
+  7, 7, 9, 9, 9, 9, 9, 9, 7, 7, 9, 7, 7, 22, 23, 7,
+  24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 33, 34, 35, 36, 0, 37,
+  0, 38, 39, 0, 7, 9, 0, 32, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  7, 7, 7, 7, 7, 7, 7, 7, 40, 41, 42, 0, 0, 0, 0, 0,
+  0, 0, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 44, 45, 40, 41,
+  42, 46, 47, 6, 6, 12, 9, 7, 7, 7, 7, 7, 9, 7, 7, 9,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  48, 0, 0, 0, 0, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  5, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 5, 0, 0, 7, 7, 7, 7, 7, 7, 7, 0, 0, 7,
+  7, 7, 7, 9, 7, 0, 0, 7, 7, 0, 9, 7, 7, 9, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  7, 9, 7, 7, 9, 7, 7, 9, 9, 9, 7, 9, 9, 7, 9, 7,
+  7, 7, 9, 7, 9, 7, 9, 7, 9, 7, 7, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 7, 7,
+  7, 7, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 7, 7, 7, 7, 0, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 0, 7, 7, 7, 0, 7, 7, 7, 7, 7, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 7, 9, 9, 9, 7, 7, 7, 7,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 7, 7, 9,
+  9, 9, 9, 9, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 0, 9, 7, 7, 9, 7, 7, 9, 7, 7, 7, 9, 9, 9,
+  43, 44, 45, 7, 7, 7, 9, 7, 7, 9, 9, 7, 7, 7, 7, 7,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0,
+  0, 5, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 0,
+  0, 7, 9, 7, 7, 0, 0, 0, 20, 20, 20, 20, 20, 20, 20, 20,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 0, 53, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 51, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 20, 20, 0, 20,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 20, 0, 0, 20, 0, 0, 0, 0, 0, 52, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 20, 20, 0, 0, 20, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 0, 53, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 5, 5, 51, 0, 0,
+  0, 0, 0, 0, 0, 0, 53, 53, 0, 0, 0, 0, 20, 20, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5, 51, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 51, 0, 0,
+  0, 0, 0, 0, 0, 54, 55, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 0, 0, 0,
+  5, 0, 53, 0, 0, 0, 0, 5, 5, 0, 5, 5, 0, 51, 0, 0,
+  0, 0, 0, 0, 0, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 51, 0, 53, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5, 51, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 0, 0, 53,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 5, 5, 5, 53,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 2, 0, 0, 0, 0, 57, 57, 51, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 58, 58, 58, 58, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 2, 0, 0, 0, 0, 59, 59, 51, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 60, 60, 60, 60, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 9, 0, 9, 0, 61, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0,
+  0, 0, 20, 0, 0, 0, 0, 20, 0, 0, 0, 0, 20, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0,
+  0, 62, 63, 20, 64, 20, 20, 2, 20, 2, 63, 63, 63, 63, 0, 0,
+  63, 20, 7, 7, 51, 0, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0,
+  0, 0, 20, 0, 0, 0, 0, 20, 0, 0, 0, 0, 20, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 53, 0,
+  0, 0, 0, 0, 0, 0, 0, 52, 0, 51, 51, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+  53, 53, 53, 53, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 53, 53, 53, 53, 53, 53,
+  53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+  53, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 7,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 51, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 7, 9, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 7, 9, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 9,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  7, 7, 7, 7, 7, 9, 9, 9, 9, 9, 9, 7, 7, 9, 0, 9,
+  9, 7, 7, 9, 9, 7, 7, 7, 7, 7, 9, 7, 7, 7, 7, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0,
+  0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 52, 53, 0, 0, 0, 0, 0, 5, 0, 5, 0, 0,
+  5, 5, 0, 5, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 9, 7, 7, 7,
+  7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 51, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 51, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 52, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  7, 7, 7, 0, 14, 9, 9, 9, 9, 9, 7, 7, 9, 9, 9, 9,
+  7, 0, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 9, 0, 0,
+  0, 0, 0, 0, 7, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  7, 7, 9, 7, 7, 7, 7, 7, 7, 7, 9, 7, 7, 19, 65, 9,
+  11, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 8, 23, 23, 9, 66, 7, 18, 9, 7, 9,
+  4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5,
+  4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5,
+  4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5,
+  4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5,
+  4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5,
+  4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5,
+  4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5,
+  4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5,
+  4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5,
+  4, 5, 4, 5, 4, 5, 4, 4, 4, 4, 3, 67, 0, 0, 1, 0,
+  4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5,
+  4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5,
+  4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5,
+  4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5,
+  4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5,
+  4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 1, 0, 1, 0, 1, 0,
+  5, 5, 5, 5, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4,
+  5, 5, 5, 5, 5, 5, 0, 0, 4, 4, 4, 4, 4, 4, 0, 0,
+  5, 5, 5, 5, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4,
+  5, 5, 5, 5, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4,
+  5, 5, 5, 5, 5, 5, 0, 0, 4, 4, 4, 4, 4, 4, 0, 0,
+  4, 5, 4, 5, 4, 5, 4, 5, 0, 4, 0, 4, 0, 4, 0, 4,
+  5, 5, 5, 5, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4,
+  5, 20, 5, 20, 5, 20, 5, 20, 5, 20, 5, 20, 5, 20, 0, 0,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  5, 5, 4, 4, 4, 0, 4, 4, 4, 4, 4, 68, 4, 2, 68, 2,
+  2, 21, 4, 4, 4, 0, 4, 4, 4, 68, 4, 68, 4, 21, 21, 21,
+  5, 5, 4, 68, 0, 0, 4, 4, 4, 4, 4, 68, 0, 21, 21, 21,
+  5, 5, 4, 68, 4, 5, 4, 4, 4, 4, 4, 68, 4, 21, 20, 20,
+  0, 0, 4, 4, 4, 0, 4, 4, 4, 68, 4, 68, 4, 20, 2, 0,
+  20, 20, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+  0, 2, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+  0, 0, 0, 2, 2, 0, 2, 2, 0, 0, 0, 0, 2, 0, 2, 0,
+  0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  7, 7, 14, 14, 7, 7, 7, 7, 14, 14, 14, 7, 7, 0, 0, 0,
+  0, 7, 0, 0, 0, 14, 14, 7, 9, 7, 14, 14, 9, 9, 9, 9,
+  7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 0, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 0, 2, 2, 0, 0, 2, 2, 2, 2, 2, 0, 0,
+  2, 2, 2, 0, 2, 0, 68, 0, 2, 0, 68, 68, 2, 2, 0, 2,
+  2, 2, 1, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2,
+  2, 0, 0, 0, 0, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 0, 0, 0, 0, 5, 0, 0, 5, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 0, 5, 0, 0, 0, 0, 0, 2, 2, 0, 2,
+  2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 5, 0, 0, 5, 0, 0, 5, 0, 5, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  5, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5,
+  5, 5, 0, 0, 5, 5, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0,
+  5, 5, 0, 0, 5, 5, 0, 0, 5, 5, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5, 5,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 5, 5, 5, 5, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 20, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 0, 1, 1, 1, 0, 0, 1, 0, 1, 0, 1, 0, 1, 1, 1,
+  1, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 2, 1, 1,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 7,
+  7, 7, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 66, 23, 8, 22, 69, 69,
+  0, 0, 0, 0, 0, 0, 2, 0, 2, 2, 2, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 5, 0,
+  5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0,
+  5, 0, 5, 0, 0, 5, 0, 5, 0, 5, 0, 0, 0, 0, 0, 0,
+  5, 5, 0, 5, 5, 0, 5, 5, 0, 5, 5, 0, 5, 5, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 0, 0, 0, 0, 70, 70, 2, 2, 0, 5, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 5, 0,
+  5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0,
+  5, 0, 5, 0, 0, 5, 0, 5, 0, 5, 0, 0, 0, 0, 0, 0,
+  5, 5, 0, 5, 5, 0, 5, 5, 0, 5, 5, 0, 5, 5, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 5, 0, 0, 5, 5, 5, 5, 0, 0, 0, 5, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+  0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 7,
+  0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 2, 2, 7, 7,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0,
+  1, 0, 1, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 1, 1, 1, 1, 0,
+  1, 1, 1, 1, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0,
+  1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 2, 2, 2, 1, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  7, 0, 7, 7, 9, 0, 0, 7, 7, 0, 0, 0, 0, 0, 7, 7,
+  0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0,
+  20, 0, 20, 0, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0,
+  20, 0, 20, 0, 0, 20, 20, 0, 0, 0, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 20, 71, 20,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 0, 20, 20, 20, 20, 20, 0, 20, 0,
+  20, 20, 0, 20, 20, 0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0,
+  7, 7, 7, 7, 7, 7, 7, 9, 9, 9, 9, 9, 9, 9, 7, 7,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0, 0, 0, 0,
+  2, 2, 2, 0, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0,
+  0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+  0, 0, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2,
+  0, 0, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1,
+  1, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 7,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 7, 14, 9, 0, 0, 0, 0, 51,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 7, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 9, 9, 7, 7, 7, 9, 7, 9, 9, 9,
+  9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 7, 9, 7, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 5, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 50, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 5, 5,
+  0, 0, 0, 51, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 51, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 51, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 52, 0, 53, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 51, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0,
+  7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 51, 0, 0, 0, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 5, 5, 53, 5, 0,
+  0, 0, 51, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 51,
+  52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 51, 52, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 52, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  53, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 51, 51, 0,
+  0, 0, 0, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 52, 0, 51, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 51, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  72, 72, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 14, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 20,
+  20, 20, 20, 20, 20, 61, 61, 14, 14, 14, 0, 0, 0, 73, 61, 61,
+  61, 61, 61, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 9, 9,
+  9, 9, 9, 0, 0, 7, 7, 7, 7, 7, 9, 9, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 7, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20, 20, 20, 20, 20,
+  20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2,
+  0, 0, 2, 0, 0, 2, 2, 0, 0, 2, 2, 2, 2, 0, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 0, 2, 2, 2,
+  2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0, 0, 2, 2, 2,
+  2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0,
+  2, 2, 2, 2, 2, 0, 2, 0, 0, 0, 2, 2, 2, 2, 2, 2,
+  2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  7, 7, 7, 7, 7, 7, 7, 0, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 7, 7, 7, 7, 7,
+  7, 7, 0, 7, 7, 0, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 7,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 52, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  0, 2, 2, 0, 2, 0, 0, 2, 0, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 0, 2, 2, 2, 2, 0, 2, 0, 2, 0, 0, 0, 0,
+  0, 0, 2, 0, 0, 0, 0, 2, 0, 2, 0, 2, 0, 2, 2, 2,
+  0, 2, 2, 0, 2, 0, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2,
+  0, 2, 2, 0, 2, 0, 0, 2, 2, 2, 2, 0, 2, 2, 2, 2,
+  2, 2, 2, 0, 2, 2, 2, 2, 0, 2, 2, 2, 2, 0, 2, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0,
+  0, 2, 2, 2, 0, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const Props kProps[74] = {
+  {0, 0x00}, {0, 0x20}, {0, 0x0a}, {0, 0x2a}, {0, 0x23}, {0, 0x03},
+  {230, 0x10}, {230, 0x00}, {232, 0x00}, {220, 0x00}, {216, 0x10}, {202, 0x00},
+  {220, 0x10}, {202, 0x10}, {1, 0x00}, {1, 0x10}, {230, 0x0f}, {240, 0x30},
+  {233, 0x00}, {234, 0x00}, {0, 0x0f}, {0, 0x0b}, {222, 0x00}, {228, 0x00},
+  {10, 0x00}, {11, 0x00}, {12, 0x00}, {13, 0x00}, {14, 0x00}, {15, 0x00},
+  {16, 0x00}, {17, 0x00}, {18, 0x00}, {19, 0x00}, {20, 0x00}, {21, 0x00},
+  {22, 0x00}, {23, 0x00}, {24, 0x00}, {25, 0x00}, {30, 0x00}, {31, 0x00},
+  {32, 0x00}, {27, 0x00}, {28, 0x00}, {29, 0x00}, {33, 0x00}, {34, 0x00},
+  {35, 0x00}, {36, 0x00}, {7, 0x10}, {9, 0x00}, {7, 0x00}, {0, 0x10},
+  {84, 0x00}, {91, 0x10}, {9, 0x10}, {103, 0x00}, {107, 0x00}, {118, 0x00},
+  {122, 0x00}, {216, 0x00}, {129, 0x00}, {130, 0x00}, {132, 0x00}, {214, 0x00},
+  {218, 0x00}, {0, 0x2b}, {0, 0x2f}, {224, 0x00}, {8, 0x10}, {26, 0x00},
+  {6, 0x00}, {226, 0x00},
+};
+
+const Mapping kCanonicalMappings[2061] = {
+  {0x00c0, 0, 2}, {0x00c1, 2, 2}, {0x00c2, 4, 2}, {0x00c3, 6, 2},
+  {0x00c4, 8, 2}, {0x00c5, 10, 2}, {0x00c7, 12, 2}, {0x00c8, 14, 2},
+  {0x00c9, 16, 2}, {0x00ca, 18, 2}, {0x00cb, 20, 2}, {0x00cc, 22, 2},
+  {0x00cd, 24, 2}, {0x00ce, 26, 2}, {0x00cf, 28, 2}, {0x00d1, 30, 2},
+  {0x00d2, 32, 2}, {0x00d3, 34, 2}, {0x00d4, 36, 2}, {0x00d5, 38, 2},
+  {0x00d6, 40, 2}, {0x00d9, 42, 2}, {0x00da, 44, 2}, {0x00db, 46, 2},
+  {0x00dc, 48, 2}, {0x00dd, 50, 2}, {0x00e0, 52, 2}, {0x00e1, 54, 2},
+  {0x00e2, 56, 2}, {0x00e3, 58, 2}, {0x00e4, 60, 2}, {0x00e5, 62, 2},
+  {0x00e7, 64, 2}, {0x00e8, 66, 2}, {0x00e9, 68, 2}, {0x00ea, 70, 2},
+  {0x00eb, 72, 2}, {0x00ec, 74, 2}, {0x00ed, 76, 2}, {0x00ee, 78, 2},
+  {0x00ef, 80, 2}, {0x00f1, 82, 2}, {0x00f2, 84, 2}, {0x00f3, 86, 2},
+  {0x00f4, 88, 2}, {0x00f5, 90, 2}, {0x00f6, 92, 2}, {0x00f9, 94, 2},
+  {0x00fa, 96, 2}, {0x00fb, 98, 2}, {0x00fc, 100, 2}, {0x00fd, 102, 2},
+  {0x00ff, 104, 2}, {0x0100, 106, 2}, {0x0101, 108, 2}, {0x0102, 110, 2},
+  {0x0103, 112, 2}, {0x0104, 114, 2}, {0x0105, 116, 2}, {0x0106, 118, 2},
+  {0x0107, 120, 2}, {0x0108, 122, 2}, {0x0109, 124, 2}, {0x010a, 126, 2},
+  {0x010b, 128, 2}, {0x010c, 130, 2}, {0x010d, 132, 2}, {0x010e, 134, 2},
+  {0x010f, 136, 2}, {0x0112, 138, 2}, {0x0113, 140, 2}, {0x0114, 142, 2},
+  {0x0115, 144, 2}, {0x0116, 146, 2}, {0x0117, 148, 2}, {0x0118, 150, 2},
+  {0x0119, 152, 2}, {0x011a, 154, 2}, {0x011b, 156, 2}, {0x011c, 158, 2},
+  {0x011d, 160, 2}, {0x011e, 162, 2}, {0x011f, 164, 2}, {0x0120, 166, 2},
+  {0x0121, 168, 2}, {0x0122, 170, 2}, {0x0123, 172, 2}, {0x0124, 174, 2},
+  {0x0125, 176, 2}, {0x0128, 178, 2}, {0x0129, 180, 2}, {0x012a, 182, 2},
+  {0x012b, 184, 2}, {0x012c, 186, 2}, {0x012d, 188, 2}, {0x012e, 190, 2},
+  {0x012f, 192, 2}, {0x0130, 194, 2}, {0x0134, 196, 2}, {0x0135, 198, 2},
+  {0x0136, 200, 2}, {0x0137, 202, 2}, {0x0139, 204, 2}, {0x013a, 206, 2},
+  {0x013b, 208, 2}, {0x013c, 210, 2}, {0x013d, 212, 2}, {0x013e, 214, 2},
+  {0x0143, 216, 2}, {0x0144, 218, 2}, {0x0145, 220, 2}, {0x0146, 222, 2},
+  {0x0147, 224, 2}, {0x0148, 226, 2}, {0x014c, 228, 2}, {0x014d, 230, 2},
+  {0x014e, 232, 2}, {0x014f, 234, 2}, {0x0150, 236, 2}, {0x0151, 238, 2},
+  {0x0154, 240, 2}, {0x0155, 242, 2}, {0x0156, 244, 2}, {0x0157, 246, 2},
+  {0x0158, 248, 2}, {0x0159, 250, 2}, {0x015a, 252, 2}, {0x015b, 254, 2},
+  {0x015c, 256, 2}, {0x015d, 258, 2}, {0x015e, 260, 2}, {0x015f, 262, 2},
+  {0x0160, 264, 2}, {0x0161, 266, 2}, {0x0162, 268, 2}, {0x0163, 270, 2},
+  {0x0164, 272, 2}, {0x0165, 274, 2}, {0x0168, 276, 2}, {0x0169, 278, 2},
+  {0x016a, 280, 2}, {0x016b, 282, 2}, {0x016c, 284, 2}, {0x016d, 286, 2},
+  {0x016e, 288, 2}, {0x016f, 290, 2}, {0x0170, 292, 2}, {0x0171, 294, 2},
+  {0x0172, 296, 2}, {0x0173, 298, 2}, {0x0174, 300, 2}, {0x0175, 302, 2},
+  {0x0176, 304, 2}, {0x0177, 306, 2}, {0x0178, 308, 2}, {0x0179, 310, 2},
+  {0x017a, 312, 2}, {0x017b, 314, 2}, {0x017c, 316, 2}, {0x017d, 318, 2},
+  {0x017e, 320, 2}, {0x01a0, 322, 2}, {0x01a1, 324, 2}, {0x01af, 326, 2},
+  {0x01b0, 328, 2}, {0x01cd, 330, 2}, {0x01ce, 332, 2}, {0x01cf, 334, 2},
+  {0x01d0, 336, 2}, {0x01d1, 338, 2}, {0x01d2, 340, 2}, {0x01d3, 342, 2},
+  {0x01d4, 344, 2}, {0x01d5, 346, 3}, {0x01d6, 349, 3}, {0x01d7, 352, 3},
+  {0x01d8, 355, 3}, {0x01d9, 358, 3}, {0x01da, 361, 3}, {0x01db, 364, 3},
+  {0x01dc, 367, 3}, {0x01de, 370, 3}, {0x01df, 373, 3}, {0x01e0, 376, 3},
+  {0x01e1, 379, 3}, {0x01e2, 382, 2}, {0x01e3, 384, 2}, {0x01e6, 386, 2},
+  {0x01e7, 388, 2}, {0x01e8, 390, 2}, {0x01e9, 392, 2}, {0x01ea, 394, 2},
+  {0x01eb, 396, 2}, {0x01ec, 398, 3}, {0x01ed, 401, 3}, {0x01ee, 404, 2},
+  {0x01ef, 406, 2}, {0x01f0, 408, 2}, {0x01f4, 410, 2}, {0x01f5, 412, 2},
+  {0x01f8, 414, 2}, {0x01f9, 416, 2}, {0x01fa, 418, 3}, {0x01fb, 421, 3},
+  {0x01fc, 424, 2}, {0x01fd, 426, 2}, {0x01fe, 428, 2}, {0x01ff, 430, 2},
+  {0x0200, 432, 2}, {0x0201, 434, 2}, {0x0202, 436, 2}, {0x0203, 438, 2},
+  {0x0204, 440, 2}, {0x0205, 442, 2}, {0x0206, 444, 2}, {0x0207, 446, 2},
+  {0x0208, 448, 2}, {0x0209, 450, 2}, {0x020a, 452, 2}, {0x020b, 454, 2},
+  {0x020c, 456, 2}, {0x020d, 458, 2}, {0x020e, 460, 2}, {0x020f, 462, 2},
+  {0x0210, 464, 2}, {0x0211, 466, 2}, {0x0212, 468, 2}, {0x0213, 470, 2},
+  {0x0214, 472, 2}, {0x0215, 474, 2}, {0x0216, 476, 2}, {0x0217, 478, 2},
+  {0x0218, 480, 2}, {0x0219, 482, 2}, {0x021a, 484, 2}, {0x021b, 486, 2},
+  {0x021e, 488, 2}, {0x021f, 490, 2}, {0x0226, 492, 2}, {0x0227, 494, 2},
+  {0x0228, 496, 2}, {0x0229, 498, 2}, {0x022a, 500, 3}, {0x022b, 503, 3},
+  {0x022c, 506, 3}, {0x022d, 509, 3}, {0x022e, 512, 2}, {0x022f, 514, 2},
+  {0x0230, 516, 3}, {0x0231, 519, 3}, {0x0232, 522, 2}, {0x0233, 524, 2},
+  {0x0340, 526, 1}, {0x0341, 527, 1}, {0x0343, 528, 1}, {0x0344, 529, 2},
+  {0x0374, 531, 1}, {0x037e, 532, 1}, {0x0385, 533, 2}, {0x0386, 535, 2},
+  {0x0387, 537, 1}, {0x0388, 538, 2}, {0x0389, 540, 2}, {0x038a, 542, 2},
+  {0x038c, 544, 2}, {0x038e, 546, 2}, {0x038f, 548, 2}, {0x0390, 550, 3},
+  {0x03aa, 553, 2}, {0x03ab, 555, 2}, {0x03ac, 557, 2}, {0x03ad, 559, 2},
+  {0x03ae, 561, 2}, {0x03af, 563, 2}, {0x03b0, 565, 3}, {0x03ca, 568, 2},
+  {0x03cb, 570, 2}, {0x03cc, 572, 2}, {0x03cd, 574, 2}, {0x03ce, 576, 2},
+  {0x03d3, 578, 2}, {0x03d4, 580, 2}, {0x0400, 582, 2}, {0x0401, 584, 2},
+  {0x0403, 586, 2}, {0x0407, 588, 2}, {0x040c, 590, 2}, {0x040d, 592, 2},
+  {0x040e, 594, 2}, {0x0419, 596, 2}, {0x0439, 598, 2}, {0x0450, 600, 2},
+  {0x0451, 602, 2}, {0x0453, 604, 2}, {0x0457, 606, 2}, {0x045c, 608, 2},
+  {0x045d, 610, 2}, {0x045e, 612, 2}, {0x0476, 614, 2}, {0x0477, 616, 2},
+  {0x04c1, 618, 2}, {0x04c2, 620, 2}, {0x04d0, 622, 2}, {0x04d1, 624, 2},
+  {0x04d2, 626, 2}, {0x04d3, 628, 2}, {0x04d6, 630, 2}, {0x04d7, 632, 2},
+  {0x04da, 634, 2}, {0x04db, 636, 2}, {0x04dc, 638, 2}, {0x04dd, 640, 2},
+  {0x04de, 642, 2}, {0x04df, 644, 2}, {0x04e2, 646, 2}, {0x04e3, 648, 2},
+  {0x04e4, 650, 2}, {0x04e5, 652, 2}, {0x04e6, 654, 2}, {0x04e7, 656, 2},
+  {0x04ea, 658, 2}, {0x04eb, 660, 2}, {0x04ec, 662, 2}, {0x04ed, 664, 2},
+  {0x04ee, 666, 2}, {0x04ef, 668, 2}, {0x04f0, 670, 2}, {0x04f1, 672, 2},
+  {0x04f2, 674, 2}, {0x04f3, 676, 2}, {0x04f4, 678, 2}, {0x04f5, 680, 2},
+  {0x04f8, 682, 2}, {0x04f9, 684, 2}, {0x0622, 686, 2}, {0x0623, 688, 2},
+  {0x0624, 690, 2}, {0x0625, 692, 2}, {0x0626, 694, 2}, {0x06c0, 696, 2},
+  {0x06c2, 698, 2}, {0x06d3, 700, 2}, {0x0929, 702, 2}, {0x0931, 704, 2},
+  {0x0934, 706, 2}, {0x0958, 708, 2}, {0x0959, 710, 2}, {0x095a, 712, 2},
+  {0x095b, 714, 2}, {0x095c, 716, 2}, {0x095d, 718, 2}, {0x095e, 720, 2},
+  {0x095f, 722, 2}, {0x09cb, 724, 2}, {0x09cc, 726, 2}, {0x09dc, 728, 2},
+  {0x09dd, 730, 2}, {0x09df, 732, 2}, {0x0a33, 734, 2}, {0x0a36, 736, 2},
+  {0x0a59, 738, 2}, {0x0a5a, 740, 2}, {0x0a5b, 742, 2}, {0x0a5e, 744, 2},
+  {0x0b48, 746, 2}, {0x0b4b, 748, 2}, {0x0b4c, 750, 2}, {0x0b5c, 752, 2},
+  {0x0b5d, 754, 2}, {0x0b94, 756, 2}, {0x0bca, 758, 2}, {0x0bcb, 760, 2},
+  {0x0bcc, 762, 2}, {0x0c48, 764, 2}, {0x0cc0, 766, 2}, {0x0cc7, 768, 2},
+  {0x0cc8, 770, 2}, {0x0cca, 772, 2}, {0x0ccb, 774, 3}, {0x0d4a, 777, 2},
+  {0x0d4b, 779, 2}, {0x0d4c, 781, 2}, {0x0dda, 783, 2}, {0x0ddc, 785, 2},
+  {0x0ddd, 787, 3}, {0x0dde, 790, 2}, {0x0f43, 792, 2}, {0x0f4d, 794, 2},
+  {0x0f52, 796, 2}, {0x0f57, 798, 2}, {0x0f5c, 800, 2}, {0x0f69, 802, 2},
+  {0x0f73, 804, 2}, {0x0f75, 806, 2}, {0x0f76, 808, 2}, {0x0f78, 810, 2},
+  {0x0f81, 812, 2}, {0x0f93, 814, 2}, {0x0f9d, 816, 2}, {0x0fa2, 818, 2},
+  {0x0fa7, 820, 2}, {0x0fac, 822, 2}, {0x0fb9, 824, 2}, {0x1026, 826, 2},
+  {0x1b06, 828, 2}, {0x1b08, 830, 2}, {0x1b0a, 832, 2}, {0x1b0c, 834, 2},
+  {0x1b0e, 836, 2}, {0x1b12, 838, 2}, {0x1b3b, 840, 2}, {0x1b3d, 842, 2},
+  {0x1b40, 844, 2}, {0x1b41, 846, 2}, {0x1b43, 848, 2}, {0x1e00, 850, 2},
+  {0x1e01, 852, 2}, {0x1e02, 854, 2}, {0x1e03, 856, 2}, {0x1e04, 858, 2},
+  {0x1e05, 860, 2}, {0x1e06, 862, 2}, {0x1e07, 864, 2}, {0x1e08, 866, 3},
+  {0x1e09, 869, 3}, {0x1e0a, 872, 2}, {0x1e0b, 874, 2}, {0x1e0c, 876, 2},
+  {0x1e0d, 878, 2}, {0x1e0e, 880, 2}, {0x1e0f, 882, 2}, {0x1e10, 884, 2},
+  {0x1e11, 886, 2}, {0x1e12, 888, 2}, {0x1e13, 890, 2}, {0x1e14, 892, 3},
+  {0x1e15, 895, 3}, {0x1e16, 898, 3}, {0x1e17, 901, 3}, {0x1e18, 904, 2},
+  {0x1e19, 906, 2}, {0x1e1a, 908, 2}, {0x1e1b, 910, 2}, {0x1e1c, 912, 3},
+  {0x1e1d, 915, 3}, {0x1e1e, 918, 2}, {0x1e1f, 920, 2}, {0x1e20, 922, 2},
+  {0x1e21, 924, 2}, {0x1e22, 926, 2}, {0x1e23, 928, 2}, {0x1e24, 930, 2},
+  {0x1e25, 932, 2}, {0x1e26, 934, 2}, {0x1e27, 936, 2}, {0x1e28, 938, 2},
+  {0x1e29, 940, 2}, {0x1e2a, 942, 2}, {0x1e2b, 944, 2}, {0x1e2c, 946, 2},
+  {0x1e2d, 948, 2}, {0x1e2e, 950, 3}, {0x1e2f, 953, 3}, {0x1e30, 956, 2},
+  {0x1e31, 958, 2}, {0x1e32, 960, 2}, {0x1e33, 962, 2}, {0x1e34, 964, 2},
+  {0x1e35, 966, 2}, {0x1e36, 968, 2}, {0x1e37, 970, 2}, {0x1e38, 972, 3},
+  {0x1e39, 975, 3}, {0x1e3a, 978, 2}, {0x1e3b, 980, 2}, {0x1e3c, 982, 2},
+  {0x1e3d, 984, 2}, {0x1e3e, 986, 2}, {0x1e3f, 988, 2}, {0x1e40, 990, 2},
+  {0x1e41, 992, 2}, {0x1e42, 994, 2}, {0x1e43, 996, 2}, {0x1e44, 998, 2},
+  {0x1e45, 1000, 2}, {0x1e46, 1002, 2}, {0x1e47, 1004, 2}, {0x1e48, 1006, 2},
+  {0x1e49, 1008, 2}, {0x1e4a, 1010, 2}, {0x1e4b, 1012, 2}, {0x1e4c, 1014, 3},
+  {0x1e4d, 1017, 3}, {0x1e4e, 1020, 3}, {0x1e4f, 1023, 3}, {0x1e50, 1026, 3},
+  {0x1e51, 1029, 3}, {0x1e52, 1032, 3}, {0x1e53, 1035, 3}, {0x1e54, 1038, 2},
+  {0x1e55, 1040, 2}, {0x1e56, 1042, 2}, {0x1e57, 1044, 2}, {0x1e58, 1046, 2},
+  {0x1e59, 1048, 2}, {0x1e5a, 1050, 2}, {0x1e5b, 1052, 2}, {0x1e5c, 1054, 3},
+  {0x1e5d, 1057, 3}, {0x1e5e, 1060, 2}, {0x1e5f, 1062, 2}, {0x1e60, 1064, 2},
+  {0x1e61, 1066, 2}, {0x1e62, 1068, 2}, {0x1e63, 1070, 2}, {0x1e64, 1072, 3},
+  {0x1e65, 1075, 3}, {0x1e66, 1078, 3}, {0x1e67, 1081, 3}, {0x1e68, 1084, 3},
+  {0x1e69, 1087, 3}, {0x1e6a, 1090, 2}, {0x1e6b, 1092, 2}, {0x1e6c, 1094, 2},
+  {0x1e6d, 1096, 2}, {0x1e6e, 1098, 2}, {0x1e6f, 1100, 2}, {0x1e70, 1102, 2},
+  {0x1e71, 1104, 2}, {0x1e72, 1106, 2}, {0x1e73, 1108, 2}, {0x1e74, 1110, 2},
+  {0x1e75, 1112, 2}, {0x1e76, 1114, 2}, {0x1e77, 1116, 2}, {0x1e78, 1118, 3},
+  {0x1e79, 1121, 3}, {0x1e7a, 1124, 3}, {0x1e7b, 1127, 3}, {0x1e7c, 1130, 2},
+  {0x1e7d, 1132, 2}, {0x1e7e, 1134, 2}, {0x1e7f, 1136, 2}, {0x1e80, 1138, 2},
+  {0x1e81, 1140, 2}, {0x1e82, 1142, 2}, {0x1e83, 1144, 2}, {0x1e84, 1146, 2},
+  {0x1e85, 1148, 2}, {0x1e86, 1150, 2}, {0x1e87, 1152, 2}, {0x1e88, 1154, 2},
+  {0x1e89, 1156, 2}, {0x1e8a, 1158, 2}, {0x1e8b, 1160, 2}, {0x1e8c, 1162, 2},
+  {0x1e8d, 1164, 2}, {0x1e8e, 1166, 2}, {0x1e8f, 1168, 2}, {0x1e90, 1170, 2},
+  {0x1e91, 1172, 2}, {0x1e92, 1174, 2}, {0x1e93, 1176, 2}, {0x1e94, 1178, 2},
+  {0x1e95, 1180, 2}, {0x1e96, 1182, 2}, {0x1e97, 1184, 2}, {0x1e98, 1186, 2},
+  {0x1e99, 1188, 2}, {0x1e9b, 1190, 2}, {0x1ea0, 1192, 2}, {0x1ea1, 1194, 2},
+  {0x1ea2, 1196, 2}, {0x1ea3, 1198, 2}, {0x1ea4, 1200, 3}, {0x1ea5, 1203, 3},
+  {0x1ea6, 1206, 3}, {0x1ea7, 1209, 3}, {0x1ea8, 1212, 3}, {0x1ea9, 1215, 3},
+  {0x1eaa, 1218, 3}, {0x1eab, 1221, 3}, {0x1eac, 1224, 3}, {0x1ead, 1227, 3},
+  {0x1eae, 1230, 3}, {0x1eaf, 1233, 3}, {0x1eb0, 1236, 3}, {0x1eb1, 1239, 3},
+  {0x1eb2, 1242, 3}, {0x1eb3, 1245, 3}, {0x1eb4, 1248, 3}, {0x1eb5, 1251, 3},
+  {0x1eb6, 1254, 3}, {0x1eb7, 1257, 3}, {0x1eb8, 1260, 2}, {0x1eb9, 1262, 2},
+  {0x1eba, 1264, 2}, {0x1ebb, 1266, 2}, {0x1ebc, 1268, 2}, {0x1ebd, 1270, 2},
+  {0x1ebe, 1272, 3}, {0x1ebf, 1275, 3}, {0x1ec0, 1278, 3}, {0x1ec1, 1281, 3},
+  {0x1ec2, 1284, 3}, {0x1ec3, 1287, 3}, {0x1ec4, 1290, 3}, {0x1ec5, 1293, 3},
+  {0x1ec6, 1296, 3}, {0x1ec7, 1299, 3}, {0x1ec8, 1302, 2}, {0x1ec9, 1304, 2},
+  {0x1eca, 1306, 2}, {0x1ecb, 1308, 2}, {0x1ecc, 1310, 2}, {0x1ecd, 1312, 2},
+  {0x1ece, 1314, 2}, {0x1ecf, 1316, 2}, {0x1ed0, 1318, 3}, {0x1ed1, 1321, 3},
+  {0x1ed2, 1324, 3}, {0x1ed3, 1327, 3}, {0x1ed4, 1330, 3}, {0x1ed5, 1333, 3},
+  {0x1ed6, 1336, 3}, {0x1ed7, 1339, 3}, {0x1ed8, 1342, 3}, {0x1ed9, 1345, 3},
+  {0x1eda, 1348, 3}, {0x1edb, 1351, 3}, {0x1edc, 1354, 3}, {0x1edd, 1357, 3},
+  {0x1ede, 1360, 3}, {0x1edf, 1363, 3}, {0x1ee0, 1366, 3}, {0x1ee1, 1369, 3},
+  {0x1ee2, 1372, 3}, {0x1ee3, 1375, 3}, {0x1ee4, 1378, 2}, {0x1ee5, 1380, 2},
+  {0x1ee6, 1382, 2}, {0x1ee7, 1384, 2}, {0x1ee8, 1386, 3}, {0x1ee9, 1389, 3},
+  {0x1eea, 1392, 3}, {0x1eeb, 1395, 3}, {0x1eec, 1398, 3}, {0x1eed, 1401, 3},
+  {0x1eee, 1404, 3}, {0x1eef, 1407, 3}, {0x1ef0, 1410, 3}, {0x1ef1, 1413, 3},
+  {0x1ef2, 1416, 2}, {0x1ef3, 1418, 2}, {0x1ef4, 1420, 2}, {0x1ef5, 1422, 2},
+  {0x1ef6, 1424, 2}, {0x1ef7, 1426, 2}, {0x1ef8, 1428, 2}, {0x1ef9, 1430, 2},
+  {0x1f00, 1432, 2}, {0x1f01, 1434, 2}, {0x1f02, 1436, 3}, {0x1f03, 1439, 3},
+  {0x1f04, 1442, 3}, {0x1f05, 1445, 3}, {0x1f06, 1448, 3}, {0x1f07, 1451, 3},
+  {0x1f08, 1454, 2}, {0x1f09, 1456, 2}, {0x1f0a, 1458, 3}, {0x1f0b, 1461, 3},
+  {0x1f0c, 1464, 3}, {0x1f0d, 1467, 3}, {0x1f0e, 1470, 3}, {0x1f0f, 1473, 3},
+  {0x1f10, 1476, 2}, {0x1f11, 1478, 2}, {0x1f12, 1480, 3}, {0x1f13, 1483, 3},
+  {0x1f14, 1486, 3}, {0x1f15, 1489, 3}, {0x1f18, 1492, 2}, {0x1f19, 1494, 2},
+  {0x1f1a, 1496, 3}, {0x1f1b, 1499, 3}, {0x1f1c, 1502, 3}, {0x1f1d, 1505, 3},
+  {0x1f20, 1508, 2}, {0x1f21, 1510, 2}, {0x1f22, 1512, 3}, {0x1f23, 1515, 3},
+  {0x1f24, 1518, 3}, {0x1f25, 1521, 3}, {0x1f26, 1524, 3}, {0x1f27, 1527, 3},
+  {0x1f28, 1530, 2}, {0x1f29, 1532, 2}, {0x1f2a, 1534, 3}, {0x1f2b, 1537, 3},
+  {0x1f2c, 1540, 3}, {0x1f2d, 1543, 3}, {0x1f2e, 1546, 3}, {0x1f2f, 1549, 3},
+  {0x1f30, 1552, 2}, {0x1f31, 1554, 2}, {0x1f32, 1556, 3}, {0x1f33, 1559, 3},
+  {0x1f34, 1562, 3}, {0x1f35, 1565, 3}, {0x1f36, 1568, 3}, {0x1f37, 1571, 3},
+  {0x1f38, 1574, 2}, {0x1f39, 1576, 2}, {0x1f3a, 1578, 3}, {0x1f3b, 1581, 3},
+  {0x1f3c, 1584, 3}, {0x1f3d, 1587, 3}, {0x1f3e, 1590, 3}, {0x1f3f, 1593, 3},
+  {0x1f40, 1596, 2}, {0x1f41, 1598, 2}, {0x1f42, 1600, 3}, {0x1f43, 1603, 3},
+  {0x1f44, 1606, 3}, {0x1f45, 1609, 3}, {0x1f48, 1612, 2}, {0x1f49, 1614, 2},
+  {0x1f4a, 1616, 3}, {0x1f4b, 1619, 3}, {0x1f4c, 1622, 3}, {0x1f4d, 1625, 3},
+  {0x1f50, 1628, 2}, {0x1f51, 1630, 2}, {0x1f52, 1632, 3}, {0x1f53, 1635, 3},
+  {0x1f54, 1638, 3}, {0x1f55, 1641, 3}, {0x1f56, 1644, 3}, {0x1f57, 1647, 3},
+  {0x1f59, 1650, 2}, {0x1f5b, 1652, 3}, {0x1f5d, 1655, 3}, {0x1f5f, 1658, 3},
+  {0x1f60, 1661, 2}, {0x1f61, 1663, 2}, {0x1f62, 1665, 3}, {0x1f63, 1668, 3},
+  {0x1f64, 1671, 3}, {0x1f65, 1674, 3}, {0x1f66, 1677, 3}, {0x1f67, 1680, 3},
+  {0x1f68, 1683, 2}, {0x1f69, 1685, 2}, {0x1f6a, 1687, 3}, {0x1f6b, 1690, 3},
+  {0x1f6c, 1693, 3}, {0x1f6d, 1696, 3}, {0x1f6e, 1699, 3}, {0x1f6f, 1702, 3},
+  {0x1f70, 1705, 2}, {0x1f71, 1707, 2}, {0x1f72, 1709, 2}, {0x1f73, 1711, 2},
+  {0x1f74, 1713, 2}, {0x1f75, 1715, 2}, {0x1f76, 1717, 2}, {0x1f77, 1719, 2},
+  {0x1f78, 1721, 2}, {0x1f79, 1723, 2}, {0x1f7a, 1725, 2}, {0x1f7b, 1727, 2},
+  {0x1f7c, 1729, 2}, {0x1f7d, 1731, 2}, {0x1f80, 1733, 3}, {0x1f81, 1736, 3},
+  {0x1f82, 1739, 4}, {0x1f83, 1743, 4}, {0x1f84, 1747, 4}, {0x1f85, 1751, 4},
+  {0x1f86, 1755, 4}, {0x1f87, 1759, 4}, {0x1f88, 1763, 3}, {0x1f89, 1766, 3},
+  {0x1f8a, 1769, 4}, {0x1f8b, 1773, 4}, {0x1f8c, 1777, 4}, {0x1f8d, 1781, 4},
+  {0x1f8e, 1785, 4}, {0x1f8f, 1789, 4}, {0x1f90, 1793, 3}, {0x1f91, 1796, 3},
+  {0x1f92, 1799, 4}, {0x1f93, 1803, 4}, {0x1f94, 1807, 4}, {0x1f95, 1811, 4},
+  {0x1f96, 1815, 4}, {0x1f97, 1819, 4}, {0x1f98, 1823, 3}, {0x1f99, 1826, 3},
+  {0x1f9a, 1829, 4}, {0x1f9b, 1833, 4}, {0x1f9c, 1837, 4}, {0x1f9d, 1841, 4},
+  {0x1f9e, 1845, 4}, {0x1f9f, 1849, 4}, {0x1fa0, 1853, 3}, {0x1fa1, 1856, 3},
+  {0x1fa2, 1859, 4}, {0x1fa3, 1863, 4}, {0x1fa4, 1867, 4}, {0x1fa5, 1871, 4},
+  {0x1fa6, 1875, 4}, {0x1fa7, 1879, 4}, {0x1fa8, 1883, 3}, {0x1fa9, 1886, 3},
+  {0x1faa, 1889, 4}, {0x1fab, 1893, 4}, {0x1fac, 1897, 4}, {0x1fad, 1901, 4},
+  {0x1fae, 1905, 4}, {0x1faf, 1909, 4}, {0x1fb0, 1913, 2}, {0x1fb1, 1915, 2},
+  {0x1fb2, 1917, 3}, {0x1fb3, 1920, 2}, {0x1fb4, 1922, 3}, {0x1fb6, 1925, 2},
+  {0x1fb7, 1927, 3}, {0x1fb8, 1930, 2}, {0x1fb9, 1932, 2}, {0x1fba, 1934, 2},
+  {0x1fbb, 1936, 2}, {0x1fbc, 1938, 2}, {0x1fbe, 1940, 1}, {0x1fc1, 1941, 2},
+  {0x1fc2, 1943, 3}, {0x1fc3, 1946, 2}, {0x1fc4, 1948, 3}, {0x1fc6, 1951, 2},
+  {0x1fc7, 1953, 3}, {0x1fc8, 1956, 2}, {0x1fc9, 1958, 2}, {0x1fca, 1960, 2},
+  {0x1fcb, 1962, 2}, {0x1fcc, 1964, 2}, {0x1fcd, 1966, 2}, {0x1fce, 1968, 2},
+  {0x1fcf, 1970, 2}, {0x1fd0, 1972, 2}, {0x1fd1, 1974, 2}, {0x1fd2, 1976, 3},
+  {0x1fd3, 1979, 3}, {0x1fd6, 1982, 2}, {0x1fd7, 1984, 3}, {0x1fd8, 1987, 2},
+  {0x1fd9, 1989, 2}, {0x1fda, 1991, 2}, {0x1fdb, 1993, 2}, {0x1fdd, 1995, 2},
+  {0x1fde, 1997, 2}, {0x1fdf, 1999, 2}, {0x1fe0, 2001, 2}, {0x1fe1, 2003, 2},
+  {0x1fe2, 2005, 3}, {0x1fe3, 2008, 3}, {0x1fe4, 2011, 2}, {0x1fe5, 2013, 2},
+  {0x1fe6, 2015, 2}, {0x1fe7, 2017, 3}, {0x1fe8, 2020, 2}, {0x1fe9, 2022, 2},
+  {0x1fea, 2024, 2}, {0x1feb, 2026, 2}, {0x1fec, 2028, 2}, {0x1fed, 2030, 2},
+  {0x1fee, 2032, 2}, {0x1fef, 2034, 1}, {0x1ff2, 2035, 3}, {0x1ff3, 2038, 2},
+  {0x1ff4, 2040, 3}, {0x1ff6, 2043, 2}, {0x1ff7, 2045, 3}, {0x1ff8, 2048, 2},
+  {0x1ff9, 2050, 2}, {0x1ffa, 2052, 2}, {0x1ffb, 2054, 2}, {0x1ffc, 2056, 2},
+  {0x1ffd, 2058, 1}, {0x2000, 2059, 1}, {0x2001, 2060, 1}, {0x2126, 2061, 1},
+  {0x212a, 2062, 1}, {0x212b, 2063, 2}, {0x219a, 2065, 2}, {0x219b, 2067, 2},
+  {0x21ae, 2069, 2}, {0x21cd, 2071, 2}, {0x21ce, 2073, 2}, {0x21cf, 2075, 2},
+  {0x2204, 2077, 2}, {0x2209, 2079, 2}, {0x220c, 2081, 2}, {0x2224, 2083, 2},
+  {0x2226, 2085, 2}, {0x2241, 2087, 2}, {0x2244, 2089, 2}, {0x2247, 2091, 2},
+  {0x2249, 2093, 2}, {0x2260, 2095, 2}, {0x2262, 2097, 2}, {0x226d, 2099, 2},
+  {0x226e, 2101, 2}, {0x226f, 2103, 2}, {0x2270, 2105, 2}, {0x2271, 2107, 2},
+  {0x2274, 2109, 2}, {0x2275, 2111, 2}, {0x2278, 2113, 2}, {0x2279, 2115, 2},
+  {0x2280, 2117, 2}, {0x2281, 2119, 2}, {0x2284, 2121, 2}, {0x2285, 2123, 2},
+  {0x2288, 2125, 2}, {0x2289, 2127, 2}, {0x22ac, 2129, 2}, {0x22ad, 2131, 2},
+  {0x22ae, 2133, 2}, {0x22af, 2135, 2}, {0x22e0, 2137, 2}, {0x22e1, 2139, 2},
+  {0x22e2, 2141, 2}, {0x22e3, 2143, 2}, {0x22ea, 2145, 2}, {0x22eb, 2147, 2},
+  {0x22ec, 2149, 2}, {0x22ed, 2151, 2}, {0x2329, 2153, 1}, {0x232a, 2154, 1},
+  {0x2adc, 2155, 2}, {0x304c, 2157, 2}, {0x304e, 2159, 2}, {0x3050, 2161, 2},
+  {0x3052, 2163, 2}, {0x3054, 2165, 2}, {0x3056, 2167, 2}, {0x3058, 2169, 2},
+  {0x305a, 2171, 2}, {0x305c, 2173, 2}, {0x305e, 2175, 2}, {0x3060, 2177, 2},
+  {0x3062, 2179, 2}, {0x3065, 2181, 2}, {0x3067, 2183, 2}, {0x3069, 2185, 2},
+  {0x3070, 2187, 2}, {0x3071, 2189, 2}, {0x3073, 2191, 2}, {0x3074, 2193, 2},
+  {0x3076, 2195, 2}, {0x3077, 2197, 2}, {0x3079, 2199, 2}, {0x307a, 2201, 2},
+  {0x307c, 2203, 2}, {0x307d, 2205, 2}, {0x3094, 2207, 2}, {0x309e, 2209, 2},
+  {0x30ac, 2211, 2}, {0x30ae, 2213, 2}, {0x30b0, 2215, 2}, {0x30b2, 2217, 2},
+  {0x30b4, 2219, 2}, {0x30b6, 2221, 2}, {0x30b8, 2223, 2}, {0x30ba, 2225, 2},
+  {0x30bc, 2227, 2}, {0x30be, 2229, 2}, {0x30c0, 2231, 2}, {0x30c2, 2233, 2},
+  {0x30c5, 2235, 2}, {0x30c7, 2237, 2}, {0x30c9, 2239, 2}, {0x30d0, 2241, 2},
+  {0x30d1, 2243, 2}, {0x30d3, 2245, 2}, {0x30d4, 2247, 2}, {0x30d6, 2249, 2},
+  {0x30d7, 2251, 2}, {0x30d9, 2253, 2}, {0x30da, 2255, 2}, {0x30dc, 2257, 2},
+  {0x30dd, 2259, 2}, {0x30f4, 2261, 2}, {0x30f7, 2263, 2}, {0x30f8, 2265, 2},
+  {0x30f9, 2267, 2}, {0x30fa, 2269, 2}, {0x30fe, 2271, 2}, {0xf900, 2273, 1},
+  {0xf901, 2274, 1}, {0xf902, 2275, 1}, {0xf903, 2276, 1}, {0xf904, 2277, 1},
+  {0xf905, 2278, 1}, {0xf906, 2279, 1}, {0xf907, 2280, 1}, {0xf908, 2281, 1},
+  {0xf909, 2282, 1}, {0xf90a, 2283, 1}, {0xf90b, 2284, 1}, {0xf90c, 2285, 1},
+  {0xf90d, 2286, 1}, {0xf90e, 2287, 1}, {0xf90f, 2288, 1}, {0xf910, 2289, 1},
+  {0xf911, 2290, 1}, {0xf912, 2291, 1}, {0xf913, 2292, 1}, {0xf914, 2293, 1},
+  {0xf915, 2294, 1}, {0xf916, 2295, 1}, {0xf917, 2296, 1}, {0xf918, 2297, 1},
+  {0xf919, 2298, 1}, {0xf91a, 2299, 1}, {0xf91b, 2300, 1}, {0xf91c, 2301, 1},
+  {0xf91d, 2302, 1}, {0xf91e, 2303, 1}, {0xf91f, 2304, 1}, {0xf920, 2305, 1},
+  {0xf921, 2306, 1}, {0xf922, 2307, 1}, {0xf923, 2308, 1}, {0xf924, 2309, 1},
+  {0xf925, 2310, 1}, {0xf926, 2311, 1}, {0xf927, 2312, 1}, {0xf928, 2313, 1},
+  {0xf929, 2314, 1}, {0xf92a, 2315, 1}, {0xf92b, 2316, 1}, {0xf92c, 2317, 1},
+  {0xf92d, 2318, 1}, {0xf92e, 2319, 1}, {0xf92f, 2320, 1}, {0xf930, 2321, 1},
+  {0xf931, 2322, 1}, {0xf932, 2323, 1}, {0xf933, 2324, 1}, {0xf934, 2325, 1},
+  {0xf935, 2326, 1}, {0xf936, 2327, 1}, {0xf937, 2328, 1}, {0xf938, 2329, 1},
+  {0xf939, 2330, 1}, {0xf93a, 2331, 1}, {0xf93b, 2332, 1}, {0xf93c, 2333, 1},
+  {0xf93d, 2334, 1}, {0xf93e, 2335, 1}, {0xf93f, 2336, 1}, {0xf940, 2337, 1},
+  {0xf941, 2338, 1}, {0xf942, 2339, 1}, {0xf943, 2340, 1}, {0xf944, 2341, 1},
+  {0xf945, 2342, 1}, {0xf946, 2343, 1}, {0xf947, 2344, 1}, {0xf948, 2345, 1},
+  {0xf949, 2346, 1}, {0xf94a, 2347, 1}, {0xf94b, 2348, 1}, {0xf94c, 2349, 1},
+  {0xf94d, 2350, 1}, {0xf94e, 2351, 1}, {0xf94f, 2352, 1}, {0xf950, 2353, 1},
+  {0xf951, 2354, 1}, {0xf952, 2355, 1}, {0xf953, 2356, 1}, {0xf954, 2357, 1},
+  {0xf955, 2358, 1}, {0xf956, 2359, 1}, {0xf957, 2360, 1}, {0xf958, 2361, 1},
+  {0xf959, 2362, 1}, {0xf95a, 2363, 1}, {0xf95b, 2364, 1}, {0xf95c, 2365, 1},
+  {0xf95d, 2366, 1}, {0xf95e, 2367, 1}, {0xf95f, 2368, 1}, {0xf960, 2369, 1},
+  {0xf961, 2370, 1}, {0xf962, 2371, 1}, {0xf963, 2372, 1}, {0xf964, 2373, 1},
+  {0xf965, 2374, 1}, {0xf966, 2375, 1}, {0xf967, 2376, 1}, {0xf968, 2377, 1},
+  {0xf969, 2378, 1}, {0xf96a, 2379, 1}, {0xf96b, 2380, 1}, {0xf96c, 2381, 1},
+  {0xf96d, 2382, 1}, {0xf96e, 2383, 1}, {0xf96f, 2384, 1}, {0xf970, 2385, 1},
+  {0xf971, 2386, 1}, {0xf972, 2387, 1}, {0xf973, 2388, 1}, {0xf974, 2389, 1},
+  {0xf975, 2390, 1}, {0xf976, 2391, 1}, {0xf977, 2392, 1}, {0xf978, 2393, 1},
+  {0xf979, 2394, 1}, {0xf97a, 2395, 1}, {0xf97b, 2396, 1}, {0xf97c, 2397, 1},
+  {0xf97d, 2398, 1}, {0xf97e, 2399, 1}, {0xf97f, 2400, 1}, {0xf980, 2401, 1},
+  {0xf981, 2402, 1}, {0xf982, 2403, 1}, {0xf983, 2404, 1}, {0xf984, 2405, 1},
+  {0xf985, 2406, 1}, {0xf986, 2407, 1}, {0xf987, 2408, 1}, {0xf988, 2409, 1},
+  {0xf989, 2410, 1}, {0xf98a, 2411, 1}, {0xf98b, 2412, 1}, {0xf98c, 2413, 1},
+  {0xf98d, 2414, 1}, {0xf98e, 2415, 1}, {0xf98f, 2416, 1}, {0xf990, 2417, 1},
+  {0xf991, 2418, 1}, {0xf992, 2419, 1}, {0xf993, 2420, 1}, {0xf994, 2421, 1},
+  {0xf995, 2422, 1}, {0xf996, 2423, 1}, {0xf997, 2424, 1}, {0xf998, 2425, 1},
+  {0xf999, 2426, 1}, {0xf99a, 2427, 1}, {0xf99b, 2428, 1}, {0xf99c, 2429, 1},
+  {0xf99d, 2430, 1}, {0xf99e, 2431, 1}, {0xf99f, 2432, 1}, {0xf9a0, 2433, 1},
+  {0xf9a1, 2434, 1}, {0xf9a2, 2435, 1}, {0xf9a3, 2436, 1}, {0xf9a4, 2437, 1},
+  {0xf9a5, 2438, 1}, {0xf9a6, 2439, 1}, {0xf9a7, 2440, 1}, {0xf9a8, 2441, 1},
+  {0xf9a9, 2442, 1}, {0xf9aa, 2443, 1}, {0xf9ab, 2444, 1}, {0xf9ac, 2445, 1},
+  {0xf9ad, 2446, 1}, {0xf9ae, 2447, 1}, {0xf9af, 2448, 1}, {0xf9b0, 2449, 1},
+  {0xf9b1, 2450, 1}, {0xf9b2, 2451, 1}, {0xf9b3, 2452, 1}, {0xf9b4, 2453, 1},
+  {0xf9b5, 2454, 1}, {0xf9b6, 2455, 1}, {0xf9b7, 2456, 1}, {0xf9b8, 2457, 1},
+  {0xf9b9, 2458, 1}, {0xf9ba, 2459, 1}, {0xf9bb, 2460, 1}, {0xf9bc, 2461, 1},
+  {0xf9bd, 2462, 1}, {0xf9be, 2463, 1}, {0xf9bf, 2464, 1}, {0xf9c0, 2465, 1},
+  {0xf9c1, 2466, 1}, {0xf9c2, 2467, 1}, {0xf9c3, 2468, 1}, {0xf9c4, 2469, 1},
+  {0xf9c5, 2470, 1}, {0xf9c6, 2471, 1}, {0xf9c7, 2472, 1}, {0xf9c8, 2473, 1},
+  {0xf9c9, 2474, 1}, {0xf9ca, 2475, 1}, {0xf9cb, 2476, 1}, {0xf9cc, 2477, 1},
+  {0xf9cd, 2478, 1}, {0xf9ce, 2479, 1}, {0xf9cf, 2480, 1}, {0xf9d0, 2481, 1},
+  {0xf9d1, 2482, 1}, {0xf9d2, 2483, 1}, {0xf9d3, 2484, 1}, {0xf9d4, 2485, 1},
+  {0xf9d5, 2486, 1}, {0xf9d6, 2487, 1}, {0xf9d7, 2488, 1}, {0xf9d8, 2489, 1},
+  {0xf9d9, 2490, 1}, {0xf9da, 2491, 1}, {0xf9db, 2492, 1}, {0xf9dc, 2493, 1},
+  {0xf9dd, 2494, 1}, {0xf9de, 2495, 1}, {0xf9df, 2496, 1}, {0xf9e0, 2497, 1},
+  {0xf9e1, 2498, 1}, {0xf9e2, 2499, 1}, {0xf9e3, 2500, 1}, {0xf9e4, 2501, 1},
+  {0xf9e5, 2502, 1}, {0xf9e6, 2503, 1}, {0xf9e7, 2504, 1}, {0xf9e8, 2505, 1},
+  {0xf9e9, 2506, 1}, {0xf9ea, 2507, 1}, {0xf9eb, 2508, 1}, {0xf9ec, 2509, 1},
+  {0xf9ed, 2510, 1}, {0xf9ee, 2511, 1}, {0xf9ef, 2512, 1}, {0xf9f0, 2513, 1},
+  {0xf9f1, 2514, 1}, {0xf9f2, 2515, 1}, {0xf9f3, 2516, 1}, {0xf9f4, 2517, 1},
+  {0xf9f5, 2518, 1}, {0xf9f6, 2519, 1}, {0xf9f7, 2520, 1}, {0xf9f8, 2521, 1},
+  {0xf9f9, 2522, 1}, {0xf9fa, 2523, 1}, {0xf9fb, 2524, 1}, {0xf9fc, 2525, 1},
+  {0xf9fd, 2526, 1}, {0xf9fe, 2527, 1}, {0xf9ff, 2528, 1}, {0xfa00, 2529, 1},
+  {0xfa01, 2530, 1}, {0xfa02, 2531, 1}, {0xfa03, 2532, 1}, {0xfa04, 2533, 1},
+  {0xfa05, 2534, 1}, {0xfa06, 2535, 1}, {0xfa07, 2536, 1}, {0xfa08, 2537, 1},
+  {0xfa09, 2538, 1}, {0xfa0a, 2539, 1}, {0xfa0b, 2540, 1}, {0xfa0c, 2541, 1},
+  {0xfa0d, 2542, 1}, {0xfa10, 2543, 1}, {0xfa12, 2544, 1}, {0xfa15, 2545, 1},
+  {0xfa16, 2546, 1}, {0xfa17, 2547, 1}, {0xfa18, 2548, 1}, {0xfa19, 2549, 1},
+  {0xfa1a, 2550, 1}, {0xfa1b, 2551, 1}, {0xfa1c, 2552, 1}, {0xfa1d, 2553, 1},
+  {0xfa1e, 2554, 1}, {0xfa20, 2555, 1}, {0xfa22, 2556, 1}, {0xfa25, 2557, 1},
+  {0xfa26, 2558, 1}, {0xfa2a, 2559, 1}, {0xfa2b, 2560, 1}, {0xfa2c, 2561, 1},
+  {0xfa2d, 2562, 1}, {0xfa2e, 2563, 1}, {0xfa2f, 2564, 1}, {0xfa30, 2565, 1},
+  {0xfa31, 2566, 1}, {0xfa32, 2567, 1}, {0xfa33, 2568, 1}, {0xfa34, 2569, 1},
+  {0xfa35, 2570, 1}, {0xfa36, 2571, 1}, {0xfa37, 2572, 1}, {0xfa38, 2573, 1},
+  {0xfa39, 2574, 1}, {0xfa3a, 2575, 1}, {0xfa3b, 2576, 1}, {0xfa3c, 2577, 1},
+  {0xfa3d, 2578, 1}, {0xfa3e, 2579, 1}, {0xfa3f, 2580, 1}, {0xfa40, 2581, 1},
+  {0xfa41, 2582, 1}, {0xfa42, 2583, 1}, {0xfa43, 2584, 1}, {0xfa44, 2585, 1},
+  {0xfa45, 2586, 1}, {0xfa46, 2587, 1}, {0xfa47, 2588, 1}, {0xfa48, 2589, 1},
+  {0xfa49, 2590, 1}, {0xfa4a, 2591, 1}, {0xfa4b, 2592, 1}, {0xfa4c, 2593, 1},
+  {0xfa4d, 2594, 1}, {0xfa4e, 2595, 1}, {0xfa4f, 2596, 1}, {0xfa50, 2597, 1},
+  {0xfa51, 2598, 1}, {0xfa52, 2599, 1}, {0xfa53, 2600, 1}, {0xfa54, 2601, 1},
+  {0xfa55, 2602, 1}, {0xfa56, 2603, 1}, {0xfa57, 2604, 1}, {0xfa58, 2605, 1},
+  {0xfa59, 2606, 1}, {0xfa5a, 2607, 1}, {0xfa5b, 2608, 1}, {0xfa5c, 2609, 1},
+  {0xfa5d, 2610, 1}, {0xfa5e, 2611, 1}, {0xfa5f, 2612, 1}, {0xfa60, 2613, 1},
+  {0xfa61, 2614, 1}, {0xfa62, 2615, 1}, {0xfa63, 2616, 1}, {0xfa64, 2617, 1},
+  {0xfa65, 2618, 1}, {0xfa66, 2619, 1}, {0xfa67, 2620, 1}, {0xfa68, 2621, 1},
+  {0xfa69, 2622, 1}, {0xfa6a, 2623, 1}, {0xfa6b, 2624, 1}, {0xfa6c, 2625, 1},
+  {0xfa6d, 2626, 1}, {0xfa70, 2627, 1}, {0xfa71, 2628, 1}, {0xfa72, 2629, 1},
+  {0xfa73, 2630, 1}, {0xfa74, 2631, 1}, {0xfa75, 2632, 1}, {0xfa76, 2633, 1},
+  {0xfa77, 2634, 1}, {0xfa78, 2635, 1}, {0xfa79, 2636, 1}, {0xfa7a, 2637, 1},
+  {0xfa7b, 2638, 1}, {0xfa7c, 2639, 1}, {0xfa7d, 2640, 1}, {0xfa7e, 2641, 1},
+  {0xfa7f, 2642, 1}, {0xfa80, 2643, 1}, {0xfa81, 2644, 1}, {0xfa82, 2645, 1},
+  {0xfa83, 2646, 1}, {0xfa84, 2647, 1}, {0xfa85, 2648, 1}, {0xfa86, 2649, 1},
+  {0xfa87, 2650, 1}, {0xfa88, 2651, 1}, {0xfa89, 2652, 1}, {0xfa8a, 2653, 1},
+  {0xfa8b, 2654, 1}, {0xfa8c, 2655, 1}, {0xfa8d, 2656, 1}, {0xfa8e, 2657, 1},
+  {0xfa8f, 2658, 1}, {0xfa90, 2659, 1}, {0xfa91, 2660, 1}, {0xfa92, 2661, 1},
+  {0xfa93, 2662, 1}, {0xfa94, 2663, 1}, {0xfa95, 2664, 1}, {0xfa96, 2665, 1},
+  {0xfa97, 2666, 1}, {0xfa98, 2667, 1}, {0xfa99, 2668, 1}, {0xfa9a, 2669, 1},
+  {0xfa9b, 2670, 1}, {0xfa9c, 2671, 1}, {0xfa9d, 2672, 1}, {0xfa9e, 2673, 1},
+  {0xfa9f, 2674, 1}, {0xfaa0, 2675, 1}, {0xfaa1, 2676, 1}, {0xfaa2, 2677, 1},
+  {0xfaa3, 2678, 1}, {0xfaa4, 2679, 1}, {0xfaa5, 2680, 1}, {0xfaa6, 2681, 1},
+  {0xfaa7, 2682, 1}, {0xfaa8, 2683, 1}, {0xfaa9, 2684, 1}, {0xfaaa, 2685, 1},
+  {0xfaab, 2686, 1}, {0xfaac, 2687, 1}, {0xfaad, 2688, 1}, {0xfaae, 2689, 1},
+  {0xfaaf, 2690, 1}, {0xfab0, 2691, 1}, {0xfab1, 2692, 1}, {0xfab2, 2693, 1},
+  {0xfab3, 2694, 1}, {0xfab4, 2695, 1}, {0xfab5, 2696, 1}, {0xfab6, 2697, 1},
+  {0xfab7, 2698, 1}, {0xfab8, 2699, 1}, {0xfab9, 2700, 1}, {0xfaba, 2701, 1},
+  {0xfabb, 2702, 1}, {0xfabc, 2703, 1}, {0xfabd, 2704, 1}, {0xfabe, 2705, 1},
+  {0xfabf, 2706, 1}, {0xfac0, 2707, 1}, {0xfac1, 2708, 1}, {0xfac2, 2709, 1},
+  {0xfac3, 2710, 1}, {0xfac4, 2711, 1}, {0xfac5, 2712, 1}, {0xfac6, 2713, 1},
+  {0xfac7, 2714, 1}, {0xfac8, 2715, 1}, {0xfac9, 2716, 1}, {0xfaca, 2717, 1},
+  {0xfacb, 2718, 1}, {0xfacc, 2719, 1}, {0xfacd, 2720, 1}, {0xface, 2721, 1},
+  {0xfacf, 2722, 1}, {0xfad0, 2723, 1}, {0xfad1, 2724, 1}, {0xfad2, 2725, 1},
+  {0xfad3, 2726, 1}, {0xfad4, 2727, 1}, {0xfad5, 2728, 1}, {0xfad6, 2729, 1},
+  {0xfad7, 2730, 1}, {0xfad8, 2731, 1}, {0xfad9, 2732, 1}, {0xfb1d, 2733, 2},
+  {0xfb1f, 2735, 2}, {0xfb2a, 2737, 2}, {0xfb2b, 2739, 2}, {0xfb2c, 2741, 3},
+  {0xfb2d, 2744, 3}, {0xfb2e, 2747, 2}, {0xfb2f, 2749, 2}, {0xfb30, 2751, 2},
+  {0xfb31, 2753, 2}, {0xfb32, 2755, 2}, {0xfb33, 2757, 2}, {0xfb34, 2759, 2},
+  {0xfb35, 2761, 2}, {0xfb36, 2763, 2}, {0xfb38, 2765, 2}, {0xfb39, 2767, 2},
+  {0xfb3a, 2769, 2}, {0xfb3b, 2771, 2}, {0xfb3c, 2773, 2}, {0xfb3e, 2775, 2},
+  {0xfb40, 2777, 2}, {0xfb41, 2779, 2}, {0xfb43, 2781, 2}, {0xfb44, 2783, 2},
+  {0xfb46, 2785, 2}, {0xfb47, 2787, 2}, {0xfb48, 2789, 2}, {0xfb49, 2791, 2},
+  {0xfb4a, 2793, 2}, {0xfb4b, 2795, 2}, {0xfb4c, 2797, 2}, {0xfb4d, 2799, 2},
+  {0xfb4e, 2801, 2}, {0x1109a, 2803, 2}, {0x1109c, 2805, 2}, {0x110ab, 2807, 2},
+  {0x1112e, 2809, 2}, {0x1112f, 2811, 2}, {0x1134b, 2813, 2}, {0x1134c, 2815, 2},
+  {0x114bb, 2817, 2}, {0x114bc, 2819, 2}, {0x114be, 2821, 2}, {0x115ba, 2823, 2},
+  {0x115bb, 2825, 2}, {0x11938, 2827, 2}, {0x1d15e, 2829, 2}, {0x1d15f, 2831, 2},
+  {0x1d160, 2833, 3}, {0x1d161, 2836, 3}, {0x1d162, 2839, 3}, {0x1d163, 2842, 3},
+  {0x1d164, 2845, 3}, {0x1d1bb, 2848, 2}, {0x1d1bc, 2850, 2}, {0x1d1bd, 2852, 3},
+  {0x1d1be, 2855, 3}, {0x1d1bf, 2858, 3}, {0x1d1c0, 2861, 3}, {0x2f800, 2864, 1},
+  {0x2f801, 2865, 1}, {0x2f802, 2866, 1}, {0x2f803, 2867, 1}, {0x2f804, 2868, 1},
+  {0x2f805, 2869, 1}, {0x2f806, 2870, 1}, {0x2f807, 2871, 1}, {0x2f808, 2872, 1},
+  {0x2f809, 2873, 1}, {0x2f80a, 2874, 1}, {0x2f80b, 2875, 1}, {0x2f80c, 2876, 1},
+  {0x2f80d, 2877, 1}, {0x2f80e, 2878, 1}, {0x2f80f, 2879, 1}, {0x2f810, 2880, 1},
+  {0x2f811, 2881, 1}, {0x2f812, 2882, 1}, {0x2f813, 2883, 1}, {0x2f814, 2884, 1},
+  {0x2f815, 2885, 1}, {0x2f816, 2886, 1}, {0x2f817, 2887, 1}, {0x2f818, 2888, 1},
+  {0x2f819, 2889, 1}, {0x2f81a, 2890, 1}, {0x2f81b, 2891, 1}, {0x2f81c, 2892, 1},
+  {0x2f81d, 2893, 1}, {0x2f81e, 2894, 1}, {0x2f81f, 2895, 1}, {0x2f820, 2896, 1},
+  {0x2f821, 2897, 1}, {0x2f822, 2898, 1}, {0x2f823, 2899, 1}, {0x2f824, 2900, 1},
+  {0x2f825, 2901, 1}, {0x2f826, 2902, 1}, {0x2f827, 2903, 1}, {0x2f828, 2904, 1},
+  {0x2f829, 2905, 1}, {0x2f82a, 2906, 1}, {0x2f82b, 2907, 1}, {0x2f82c, 2908, 1},
+  {0x2f82d, 2909, 1}, {0x2f82e, 2910, 1}, {0x2f82f, 2911, 1}, {0x2f830, 2912, 1},
+  {0x2f831, 2913, 1}, {0x2f832, 2914, 1}, {0x2f833, 2915, 1}, {0x2f834, 2916, 1},
+  {0x2f835, 2917, 1}, {0x2f836, 2918, 1}, {0x2f837, 2919, 1}, {0x2f838, 2920, 1},
+  {0x2f839, 2921, 1}, {0x2f83a, 2922, 1}, {0x2f83b, 2923, 1}, {0x2f83c, 2924, 1},
+  {0x2f83d, 2925, 1}, {0x2f83e, 2926, 1}, {0x2f83f, 2927, 1}, {0x2f840, 2928, 1},
+  {0x2f841, 2929, 1}, {0x2f842, 2930, 1}, {0x2f843, 2931, 1}, {0x2f844, 2932, 1},
+  {0x2f845, 2933, 1}, {0x2f846, 2934, 1}, {0x2f847, 2935, 1}, {0x2f848, 2936, 1},
+  {0x2f849, 2937, 1}, {0x2f84a, 2938, 1}, {0x2f84b, 2939, 1}, {0x2f84c, 2940, 1},
+  {0x2f84d, 2941, 1}, {0x2f84e, 2942, 1}, {0x2f84f, 2943, 1}, {0x2f850, 2944, 1},
+  {0x2f851, 2945, 1}, {0x2f852, 2946, 1}, {0x2f853, 2947, 1}, {0x2f854, 2948, 1},
+  {0x2f855, 2949, 1}, {0x2f856, 2950, 1}, {0x2f857, 2951, 1}, {0x2f858, 2952, 1},
+  {0x2f859, 2953, 1}, {0x2f85a, 2954, 1}, {0x2f85b, 2955, 1}, {0x2f85c, 2956, 1},
+  {0x2f85d, 2957, 1}, {0x2f85e, 2958, 1}, {0x2f85f, 2959, 1}, {0x2f860, 2960, 1},
+  {0x2f861, 2961, 1}, {0x2f862, 2962, 1}, {0x2f863, 2963, 1}, {0x2f864, 2964, 1},
+  {0x2f865, 2965, 1}, {0x2f866, 2966, 1}, {0x2f867, 2967, 1}, {0x2f868, 2968, 1},
+  {0x2f869, 2969, 1}, {0x2f86a, 2970, 1}, {0x2f86b, 2971, 1}, {0x2f86c, 2972, 1},
+  {0x2f86d, 2973, 1}, {0x2f86e, 2974, 1}, {0x2f86f, 2975, 1}, {0x2f870, 2976, 1},
+  {0x2f871, 2977, 1}, {0x2f872, 2978, 1}, {0x2f873, 2979, 1}, {0x2f874, 2980, 1},
+  {0x2f875, 2981, 1}, {0x2f876, 2982, 1}, {0x2f877, 2983, 1}, {0x2f878, 2984, 1},
+  {0x2f879, 2985, 1}, {0x2f87a, 2986, 1}, {0x2f87b, 2987, 1}, {0x2f87c, 2988, 1},
+  {0x2f87d, 2989, 1}, {0x2f87e, 2990, 1}, {0x2f87f, 2991, 1}, {0x2f880, 2992, 1},
+  {0x2f881, 2993, 1}, {0x2f882, 2994, 1}, {0x2f883, 2995, 1}, {0x2f884, 2996, 1},
+  {0x2f885, 2997, 1}, {0x2f886, 2998, 1}, {0x2f887, 2999, 1}, {0x2f888, 3000, 1},
+  {0x2f889, 3001, 1}, {0x2f88a, 3002, 1}, {0x2f88b, 3003, 1}, {0x2f88c, 3004, 1},
+  {0x2f88d, 3005, 1}, {0x2f88e, 3006, 1}, {0x2f88f, 3007, 1}, {0x2f890, 3008, 1},
+  {0x2f891, 3009, 1}, {0x2f892, 3010, 1}, {0x2f893, 3011, 1}, {0x2f894, 3012, 1},
+  {0x2f895, 3013, 1}, {0x2f896, 3014, 1}, {0x2f897, 3015, 1}, {0x2f898, 3016, 1},
+  {0x2f899, 3017, 1}, {0x2f89a, 3018, 1}, {0x2f89b, 3019, 1}, {0x2f89c, 3020, 1},
+  {0x2f89d, 3021, 1}, {0x2f89e, 3022, 1}, {0x2f89f, 3023, 1}, {0x2f8a0, 3024, 1},
+  {0x2f8a1, 3025, 1}, {0x2f8a2, 3026, 1}, {0x2f8a3, 3027, 1}, {0x2f8a4, 3028, 1},
+  {0x2f8a5, 3029, 1}, {0x2f8a6, 3030, 1}, {0x2f8a7, 3031, 1}, {0x2f8a8, 3032, 1},
+  {0x2f8a9, 3033, 1}, {0x2f8aa, 3034, 1}, {0x2f8ab, 3035, 1}, {0x2f8ac, 3036, 1},
+  {0x2f8ad, 3037, 1}, {0x2f8ae, 3038, 1}, {0x2f8af, 3039, 1}, {0x2f8b0, 3040, 1},
+  {0x2f8b1, 3041, 1}, {0x2f8b2, 3042, 1}, {0x2f8b3, 3043, 1}, {0x2f8b4, 3044, 1},
+  {0x2f8b5, 3045, 1}, {0x2f8b6, 3046, 1}, {0x2f8b7, 3047, 1}, {0x2f8b8, 3048, 1},
+  {0x2f8b9, 3049, 1}, {0x2f8ba, 3050, 1}, {0x2f8bb, 3051, 1}, {0x2f8bc, 3052, 1},
+  {0x2f8bd, 3053, 1}, {0x2f8be, 3054, 1}, {0x2f8bf, 3055, 1}, {0x2f8c0, 3056, 1},
+  {0x2f8c1, 3057, 1}, {0x2f8c2, 3058, 1}, {0x2f8c3, 3059, 1}, {0x2f8c4, 3060, 1},
+  {0x2f8c5, 3061, 1}, {0x2f8c6, 3062, 1}, {0x2f8c7, 3063, 1}, {0x2f8c8, 3064, 1},
+  {0x2f8c9, 3065, 1}, {0x2f8ca, 3066, 1}, {0x2f8cb, 3067, 1}, {0x2f8cc, 3068, 1},
+  {0x2f8cd, 3069, 1}, {0x2f8ce, 3070, 1}, {0x2f8cf, 3071, 1}, {0x2f8d0, 3072, 1},
+  {0x2f8d1, 3073, 1}, {0x2f8d2, 3074, 1}, {0x2f8d3, 3075, 1}, {0x2f8d4, 3076, 1},
+  {0x2f8d5, 3077, 1}, {0x2f8d6, 3078, 1}, {0x2f8d7, 3079, 1}, {0x2f8d8, 3080, 1},
+  {0x2f8d9, 3081, 1}, {0x2f8da, 3082, 1}, {0x2f8db, 3083, 1}, {0x2f8dc, 3084, 1},
+  {0x2f8dd, 3085, 1}, {0x2f8de, 3086, 1}, {0x2f8df, 3087, 1}, {0x2f8e0, 3088, 1},
+  {0x2f8e1, 3089, 1}, {0x2f8e2, 3090, 1}, {0x2f8e3, 3091, 1}, {0x2f8e4, 3092, 1},
+  {0x2f8e5, 3093, 1}, {0x2f8e6, 3094, 1}, {0x2f8e7, 3095, 1}, {0x2f8e8, 3096, 1},
+  {0x2f8e9, 3097, 1}, {0x2f8ea, 3098, 1}, {0x2f8eb, 3099, 1}, {0x2f8ec, 3100, 1},
+  {0x2f8ed, 3101, 1}, {0x2f8ee, 3102, 1}, {0x2f8ef, 3103, 1}, {0x2f8f0, 3104, 1},
+  {0x2f8f1, 3105, 1}, {0x2f8f2, 3106, 1}, {0x2f8f3, 3107, 1}, {0x2f8f4, 3108, 1},
+  {0x2f8f5, 3109, 1}, {0x2f8f6, 3110, 1}, {0x2f8f7, 3111, 1}, {0x2f8f8, 3112, 1},
+  {0x2f8f9, 3113, 1}, {0x2f8fa, 3114, 1}, {0x2f8fb, 3115, 1}, {0x2f8fc, 3116, 1},
+  {0x2f8fd, 3117, 1}, {0x2f8fe, 3118, 1}, {0x2f8ff, 3119, 1}, {0x2f900, 3120, 1},
+  {0x2f901, 3121, 1}, {0x2f902, 3122, 1}, {0x2f903, 3123, 1}, {0x2f904, 3124, 1},
+  {0x2f905, 3125, 1}, {0x2f906, 3126, 1}, {0x2f907, 3127, 1}, {0x2f908, 3128, 1},
+  {0x2f909, 3129, 1}, {0x2f90a, 3130, 1}, {0x2f90b, 3131, 1}, {0x2f90c, 3132, 1},
+  {0x2f90d, 3133, 1}, {0x2f90e, 3134, 1}, {0x2f90f, 3135, 1}, {0x2f910, 3136, 1},
+  {0x2f911, 3137, 1}, {0x2f912, 3138, 1}, {0x2f913, 3139, 1}, {0x2f914, 3140, 1},
+  {0x2f915, 3141, 1}, {0x2f916, 3142, 1}, {0x2f917, 3143, 1}, {0x2f918, 3144, 1},
+  {0x2f919, 3145, 1}, {0x2f91a, 3146, 1}, {0x2f91b, 3147, 1}, {0x2f91c, 3148, 1},
+  {0x2f91d, 3149, 1}, {0x2f91e, 3150, 1}, {0x2f91f, 3151, 1}, {0x2f920, 3152, 1},
+  {0x2f921, 3153, 1}, {0x2f922, 3154, 1}, {0x2f923, 3155, 1}, {0x2f924, 3156, 1},
+  {0x2f925, 3157, 1}, {0x2f926, 3158, 1}, {0x2f927, 3159, 1}, {0x2f928, 3160, 1},
+  {0x2f929, 3161, 1}, {0x2f92a, 3162, 1}, {0x2f92b, 3163, 1}, {0x2f92c, 3164, 1},
+  {0x2f92d, 3165, 1}, {0x2f92e, 3166, 1}, {0x2f92f, 3167, 1}, {0x2f930, 3168, 1},
+  {0x2f931, 3169, 1}, {0x2f932, 3170, 1}, {0x2f933, 3171, 1}, {0x2f934, 3172, 1},
+  {0x2f935, 3173, 1}, {0x2f936, 3174, 1}, {0x2f937, 3175, 1}, {0x2f938, 3176, 1},
+  {0x2f939, 3177, 1}, {0x2f93a, 3178, 1}, {0x2f93b, 3179, 1}, {0x2f93c, 3180, 1},
+  {0x2f93d, 3181, 1}, {0x2f93e, 3182, 1}, {0x2f93f, 3183, 1}, {0x2f940, 3184, 1},
+  {0x2f941, 3185, 1}, {0x2f942, 3186, 1}, {0x2f943, 3187, 1}, {0x2f944, 3188, 1},
+  {0x2f945, 3189, 1}, {0x2f946, 3190, 1}, {0x2f947, 3191, 1}, {0x2f948, 3192, 1},
+  {0x2f949, 3193, 1}, {0x2f94a, 3194, 1}, {0x2f94b, 3195, 1}, {0x2f94c, 3196, 1},
+  {0x2f94d, 3197, 1}, {0x2f94e, 3198, 1}, {0x2f94f, 3199, 1}, {0x2f950, 3200, 1},
+  {0x2f951, 3201, 1}, {0x2f952, 3202, 1}, {0x2f953, 3203, 1}, {0x2f954, 3204, 1},
+  {0x2f955, 3205, 1}, {0x2f956, 3206, 1}, {0x2f957, 3207, 1}, {0x2f958, 3208, 1},
+  {0x2f959, 3209, 1}, {0x2f95a, 3210, 1}, {0x2f95b, 3211, 1}, {0x2f95c, 3212, 1},
+  {0x2f95d, 3213, 1}, {0x2f95e, 3214, 1}, {0x2f95f, 3215, 1}, {0x2f960, 3216, 1},
+  {0x2f961, 3217, 1}, {0x2f962, 3218, 1}, {0x2f963, 3219, 1}, {0x2f964, 3220, 1},
+  {0x2f965, 3221, 1}, {0x2f966, 3222, 1}, {0x2f967, 3223, 1}, {0x2f968, 3224, 1},
+  {0x2f969, 3225, 1}, {0x2f96a, 3226, 1}, {0x2f96b, 3227, 1}, {0x2f96c, 3228, 1},
+  {0x2f96d, 3229, 1}, {0x2f96e, 3230, 1}, {0x2f96f, 3231, 1}, {0x2f970, 3232, 1},
+  {0x2f971, 3233, 1}, {0x2f972, 3234, 1}, {0x2f973, 3235, 1}, {0x2f974, 3236, 1},
+  {0x2f975, 3237, 1}, {0x2f976, 3238, 1}, {0x2f977, 3239, 1}, {0x2f978, 3240, 1},
+  {0x2f979, 3241, 1}, {0x2f97a, 3242, 1}, {0x2f97b, 3243, 1}, {0x2f97c, 3244, 1},
+  {0x2f97d, 3245, 1}, {0x2f97e, 3246, 1}, {0x2f97f, 3247, 1}, {0x2f980, 3248, 1},
+  {0x2f981, 3249, 1}, {0x2f982, 3250, 1}, {0x2f983, 3251, 1}, {0x2f984, 3252, 1},
+  {0x2f985, 3253, 1}, {0x2f986, 3254, 1}, {0x2f987, 3255, 1}, {0x2f988, 3256, 1},
+  {0x2f989, 3257, 1}, {0x2f98a, 3258, 1}, {0x2f98b, 3259, 1}, {0x2f98c, 3260, 1},
+  {0x2f98d, 3261, 1}, {0x2f98e, 3262, 1}, {0x2f98f, 3263, 1}, {0x2f990, 3264, 1},
+  {0x2f991, 3265, 1}, {0x2f992, 3266, 1}, {0x2f993, 3267, 1}, {0x2f994, 3268, 1},
+  {0x2f995, 3269, 1}, {0x2f996, 3270, 1}, {0x2f997, 3271, 1}, {0x2f998, 3272, 1},
+  {0x2f999, 3273, 1}, {0x2f99a, 3274, 1}, {0x2f99b, 3275, 1}, {0x2f99c, 3276, 1},
+  {0x2f99d, 3277, 1}, {0x2f99e, 3278, 1}, {0x2f99f, 3279, 1}, {0x2f9a0, 3280, 1},
+  {0x2f9a1, 3281, 1}, {0x2f9a2, 3282, 1}, {0x2f9a3, 3283, 1}, {0x2f9a4, 3284, 1},
+  {0x2f9a5, 3285, 1}, {0x2f9a6, 3286, 1}, {0x2f9a7, 3287, 1}, {0x2f9a8, 3288, 1},
+  {0x2f9a9, 3289, 1}, {0x2f9aa, 3290, 1}, {0x2f9ab, 3291, 1}, {0x2f9ac, 3292, 1},
+  {0x2f9ad, 3293, 1}, {0x2f9ae, 3294, 1}, {0x2f9af, 3295, 1}, {0x2f9b0, 3296, 1},
+  {0x2f9b1, 3297, 1}, {0x2f9b2, 3298, 1}, {0x2f9b3, 3299, 1}, {0x2f9b4, 3300, 1},
+  {0x2f9b5, 3301, 1}, {0x2f9b6, 3302, 1}, {0x2f9b7, 3303, 1}, {0x2f9b8, 3304, 1},
+  {0x2f9b9, 3305, 1}, {0x2f9ba, 3306, 1}, {0x2f9bb, 3307, 1}, {0x2f9bc, 3308, 1},
+  {0x2f9bd, 3309, 1}, {0x2f9be, 3310, 1}, {0x2f9bf, 3311, 1}, {0x2f9c0, 3312, 1},
+  {0x2f9c1, 3313, 1}, {0x2f9c2, 3314, 1}, {0x2f9c3, 3315, 1}, {0x2f9c4, 3316, 1},
+  {0x2f9c5, 3317, 1}, {0x2f9c6, 3318, 1}, {0x2f9c7, 3319, 1}, {0x2f9c8, 3320, 1},
+  {0x2f9c9, 3321, 1}, {0x2f9ca, 3322, 1}, {0x2f9cb, 3323, 1}, {0x2f9cc, 3324, 1},
+  {0x2f9cd, 3325, 1}, {0x2f9ce, 3326, 1}, {0x2f9cf, 3327, 1}, {0x2f9d0, 3328, 1},
+  {0x2f9d1, 3329, 1}, {0x2f9d2, 3330, 1}, {0x2f9d3, 3331, 1}, {0x2f9d4, 3332, 1},
+  {0x2f9d5, 3333, 1}, {0x2f9d6, 3334, 1}, {0x2f9d7, 3335, 1}, {0x2f9d8, 3336, 1},
+  {0x2f9d9, 3337, 1}, {0x2f9da, 3338, 1}, {0x2f9db, 3339, 1}, {0x2f9dc, 3340, 1},
+  {0x2f9dd, 3341, 1}, {0x2f9de, 3342, 1}, {0x2f9df, 3343, 1}, {0x2f9e0, 3344, 1},
+  {0x2f9e1, 3345, 1}, {0x2f9e2, 3346, 1}, {0x2f9e3, 3347, 1}, {0x2f9e4, 3348, 1},
+  {0x2f9e5, 3349, 1}, {0x2f9e6, 3350, 1}, {0x2f9e7, 3351, 1}, {0x2f9e8, 3352, 1},
+  {0x2f9e9, 3353, 1}, {0x2f9ea, 3354, 1}, {0x2f9eb, 3355, 1}, {0x2f9ec, 3356, 1},
+  {0x2f9ed, 3357, 1}, {0x2f9ee, 3358, 1}, {0x2f9ef, 3359, 1}, {0x2f9f0, 3360, 1},
+  {0x2f9f1, 3361, 1}, {0x2f9f2, 3362, 1}, {0x2f9f3, 3363, 1}, {0x2f9f4, 3364, 1},
+  {0x2f9f5, 3365, 1}, {0x2f9f6, 3366, 1}, {0x2f9f7, 3367, 1}, {0x2f9f8, 3368, 1},
+  {0x2f9f9, 3369, 1}, {0x2f9fa, 3370, 1}, {0x2f9fb, 3371, 1}, {0x2f9fc, 3372, 1},
+  {0x2f9fd, 3373, 1}, {0x2f9fe, 3374, 1}, {0x2f9ff, 3375, 1}, {0x2fa00, 3376, 1},
+  {0x2fa01, 3377, 1}, {0x2fa02, 3378, 1}, {0x2fa03, 3379, 1}, {0x2fa04, 3380, 1},
+  {0x2fa05, 3381, 1}, {0x2fa06, 3382, 1}, {0x2fa07, 3383, 1}, {0x2fa08, 3384, 1},
+  {0x2fa09, 3385, 1}, {0x2fa0a, 3386, 1}, {0x2fa0b, 3387, 1}, {0x2fa0c, 3388, 1},
+  {0x2fa0d, 3389, 1}, {0x2fa0e, 3390, 1}, {0x2fa0f, 3391, 1}, {0x2fa10, 3392, 1},
+  {0x2fa11, 3393, 1}, {0x2fa12, 3394, 1}, {0x2fa13, 3395, 1}, {0x2fa14, 3396, 1},
+  {0x2fa15, 3397, 1}, {0x2fa16, 3398, 1}, {0x2fa17, 3399, 1}, {0x2fa18, 3400, 1},
+  {0x2fa19, 3401, 1}, {0x2fa1a, 3402, 1}, {0x2fa1b, 3403, 1}, {0x2fa1c, 3404, 1},
+  {0x2fa1d, 3405, 1},
+};
+
+const size_t kNumCanonicalMappings = 2061;
+
+const int32_t kCanonicalData[3406] = {
+  0x0041, 0x0300, 0x0041, 0x0301, 0x0041, 0x0302, 0x0041, 0x0303,
+  0x0041, 0x0308, 0x0041, 0x030a, 0x0043, 0x0327, 0x0045, 0x0300,
+  0x0045, 0x0301, 0x0045, 0x0302, 0x0045, 0x0308, 0x0049, 0x0300,
+  0x0049, 0x0301, 0x0049, 0x0302, 0x0049, 0x0308, 0x004e, 0x0303,
+  0x004f, 0x0300, 0x004f, 0x0301, 0x004f, 0x0302, 0x004f, 0x0303,
+  0x004f, 0x0308, 0x0055, 0x0300, 0x0055, 0x0301, 0x0055, 0x0302,
+  0x0055, 0x0308, 0x0059, 0x0301, 0x0061, 0x0300, 0x0061, 0x0301,
+  0x0061, 0x0302, 0x0061, 0x0303, 0x0061, 0x0308, 0x0061, 0x030a,
+  0x0063, 0x0327, 0x0065, 0x0300, 0x0065, 0x0301, 0x0065, 0x0302,
+  0x0065, 0x0308, 0x0069, 0x0300, 0x0069, 0x0301, 0x0069, 0x0302,
+  0x0069, 0x0308, 0x006e, 0x0303, 0x006f, 0x0300, 0x006f, 0x0301,
+  0x006f, 0x0302, 0x006f, 0x0303, 0x006f, 0x0308, 0x0075, 0x0300,
+  0x0075, 0x0301, 0x0075, 0x0302, 0x0075, 0x0308, 0x0079, 0x0301,
+  0x0079, 0x0308, 0x0041, 0x0304, 0x0061, 0x0304, 0x0041, 0x0306,
+  0x0061, 0x0306, 0x0041, 0x0328, 0x0061, 0x0328, 0x0043, 0x0301,
+  0x0063, 0x0301, 0x0043, 0x0302, 0x0063, 0x0302, 0x0043, 0x0307,
+  0x0063, 0x0307, 0x0043, 0x030c, 0x0063, 0x030c, 0x0044, 0x030c,
+  0x0064, 0x030c, 0x0045, 0x0304, 0x0065, 0x0304, 0x0045, 0x0306,
+  0x0065, 0x0306, 0x0045, 0x0307, 0x0065, 0x0307, 0x0045, 0x0328,
+  0x0065, 0x0328, 0x0045, 0x030c, 0x0065, 0x030c, 0x0047, 0x0302,
+  0x0067, 0x0302, 0x0047, 0x0306, 0x0067, 0x0306, 0x0047, 0x0307,
+  0x0067, 0x0307, 0x0047, 0x0327, 0x0067, 0x0327, 0x0048, 0x0302,
+  0x0068, 0x0302, 0x0049, 0x0303, 0x0069, 0x0303, 0x0049, 0x0304,
+  0x0069, 0x0304, 0x0049, 0x0306, 0x0069, 0x0306, 0x0049, 0x0328,
+  0x0069, 0x0328, 0x0049, 0x0307, 0x004a, 0x0302, 0x006a, 0x0302,
+  0x004b, 0x0327, 0x006b, 0x0327, 0x004c, 0x0301, 0x006c, 0x0301,
+  0x004c, 0x0327, 0x006c, 0x0327, 0x004c, 0x030c, 0x006c, 0x030c,
+  0x004e, 0x0301, 0x006e, 0x0301, 0x004e, 0x0327, 0x006e, 0x0327,
+  0x004e, 0x030c, 0x006e, 0x030c, 0x004f, 0x0304, 0x006f, 0x0304,
+  0x004f, 0x0306, 0x006f, 0x0306, 0x004f, 0x030b, 0x006f, 0x030b,
+  0x0052, 0x0301, 0x0072, 0x0301, 0x0052, 0x0327, 0x0072, 0x0327,
+  0x0052, 0x030c, 0x0072, 0x030c, 0x0053, 0x0301, 0x0073, 0x0301,
+  0x0053, 0x0302, 0x0073, 0x0302, 0x0053, 0x0327, 0x0073, 0x0327,
+  0x0053, 0x030c, 0x0073, 0x030c, 0x0054, 0x0327, 0x0074, 0x0327,
+  0x0054, 0x030c, 0x0074, 0x030c, 0x0055, 0x0303, 0x0075, 0x0303,
+  0x0055, 0x0304, 0x0075, 0x0304, 0x0055, 0x0306, 0x0075, 0x0306,
+  0x0055, 0x030a, 0x0075, 0x030a, 0x0055, 0x030b, 0x0075, 0x030b,
+  0x0055, 0x0328, 0x0075, 0x0328, 0x0057, 0x0302, 0x0077, 0x0302,
+  0x0059, 0x0302, 0x0079, 0x0302, 0x0059, 0x0308, 0x005a, 0x0301,
+  0x007a, 0x0301, 0x005a, 0x0307, 0x007a, 0x0307, 0x005a, 0x030c,
+  0x007a, 0x030c, 0x004f, 0x031b, 0x006f, 0x031b, 0x0055, 0x031b,
+  0x0075, 0x031b, 0x0041, 0x030c, 0x0061, 0x030c, 0x0049, 0x030c,
+  0x0069, 0x030c, 0x004f, 0x030c, 0x006f, 0x030c, 0x0055, 0x030c,
+  0x0075, 0x030c, 0x0055, 0x0308, 0x0304, 0x0075, 0x0308, 0x0304,
+  0x0055, 0x0308, 0x0301, 0x0075, 0x0308, 0x0301, 0x0055, 0x0308,
+  0x030c, 0x0075, 0x0308, 0x030c, 0x0055, 0x0308, 0x0300, 0x0075,
+  0x0308, 0x0300, 0x0041, 0x0308, 0x0304, 0x0061, 0x0308, 0x0304,
+  0x0041, 0x0307, 0x0304, 0x0061, 0x0307, 0x0304, 0x00c6, 0x0304,
+  0x00e6, 0x0304, 0x0047, 0x030c, 0x0067, 0x030c, 0x004b, 0x030c,
+  0x006b, 0x030c, 0x004f, 0x0328, 0x006f, 0x0328, 0x004f, 0x0328,
+  0x0304, 0x006f, 0x0328, 0x0304, 0x01b7, 0x030c, 0x0292, 0x030c,
+  0x006a, 0x030c, 0x0047, 0x0301, 0x0067, 0x0301, 0x004e, 0x0300,
+  0x006e, 0x0300, 0x0041, 0x030a, 0x0301, 0x0061, 0x030a, 0x0301,
+  0x00c6, 0x0301, 0x00e6, 0x0301, 0x00d8, 0x0301, 0x00f8, 0x0301,
+  0x0041, 0x030f, 0x0061, 0x030f, 0x0041, 0x0311, 0x0061, 0x0311,
+  0x0045, 0x030f, 0x0065, 0x030f, 0x0045, 0x0311, 0x0065, 0x0311,
+  0x0049, 0x030f, 0x0069, 0x030f, 0x0049, 0x0311, 0x0069, 0x0311,
+  0x004f, 0x030f, 0x006f, 0x030f, 0x004f, 0x0311, 0x006f, 0x0311,
+  0x0052, 0x030f, 0x0072, 0x030f, 0x0052, 0x0311, 0x0072, 0x0311,
+  0x0055, 0x030f, 0x0075, 0x030f, 0x0055, 0x0311, 0x0075, 0x0311,
+  0x0053, 0x0326, 0x0073, 0x0326, 0x0054, 0x0326, 0x0074, 0x0326,
+  0x0048, 0x030c, 0x0068, 0x030c, 0x0041, 0x0307, 0x0061, 0x0307,
+  0x0045, 0x0327, 0x0065, 0x0327, 0x004f, 0x0308, 0x0304, 0x006f,
+  0x0308, 0x0304, 0x004f, 0x0303, 0x0304, 0x006f, 0x0303, 0x0304,
+  0x004f, 0x0307, 0x006f, 0x0307, 0x004f, 0x0307, 0x0304, 0x006f,
+  0x0307, 0x0304, 0x0059, 0x0304, 0x0079, 0x0304, 0x0300, 0x0301,
+  0x0313, 0x0308, 0x0301, 0x02b9, 0x003b, 0x00a8, 0x0301, 0x0391,
+  0x0301, 0x00b7, 0x0395, 0x0301, 0x0397, 0x0301, 0x0399, 0x0301,
+  0x039f, 0x0301, 0x03a5, 0x0301, 0x03a9, 0x0301, 0x03b9, 0x0308,
+  0x0301, 0x0399, 0x0308, 0x03a5, 0x0308, 0x03b1, 0x0301, 0x03b5,
+  0x0301, 0x03b7, 0x0301, 0x03b9, 0x0301, 0x03c5, 0x0308, 0x0301,
+  0x03b9, 0x0308, 0x03c5, 0x0308, 0x03bf, 0x0301, 0x03c5, 0x0301,
+  0x03c9, 0x0301, 0x03d2, 0x0301, 0x03d2, 0x0308, 0x0415, 0x0300,
+  0x0415, 0x0308, 0x0413, 0x0301, 0x0406, 0x0308, 0x041a, 0x0301,
+  0x0418, 0x0300, 0x0423, 0x0306, 0x0418, 0x0306, 0x0438, 0x0306,
+  0x0435, 0x0300, 0x0435, 0x0308, 0x0433, 0x0301, 0x0456, 0x0308,
+  0x043a, 0x0301, 0x0438, 0x0300, 0x0443, 0x0306, 0x0474, 0x030f,
+  0x0475, 0x030f, 0x0416, 0x0306, 0x0436, 0x0306, 0x0410, 0x0306,
+  0x0430, 0x0306, 0x0410, 0x0308, 0x0430, 0x0308, 0x0415, 0x0306,
+  0x0435, 0x0306, 0x04d8, 0x0308, 0x04d9, 0x0308, 0x0416, 0x0308,
+  0x0436, 0x0308, 0x0417, 0x0308, 0x0437, 0x0308, 0x0418, 0x0304,
+  0x0438, 0x0304, 0x0418, 0x0308, 0x0438, 0x0308, 0x041e, 0x0308,
+  0x043e, 0x0308, 0x04e8, 0x0308, 0x04e9, 0x0308, 0x042d, 0x0308,
+  0x044d, 0x0308, 0x0423, 0x0304, 0x0443, 0x0304, 0x0423, 0x0308,
+  0x0443, 0x0308, 0x0423, 0x030b, 0x0443, 0x030b, 0x0427, 0x0308,
+  0x0447, 0x0308, 0x042b, 0x0308, 0x044b, 0x0308, 0x0627, 0x0653,
+  0x0627, 0x0654, 0x0648, 0x0654, 0x0627, 0x0655, 0x064a, 0x0654,
+  0x06d5, 0x0654, 0x06c1, 0x0654, 0x06d2, 0x0654, 0x0928, 0x093c,
+  0x0930, 0x093c, 0x0933, 0x093c, 0x0915, 0x093c, 0x0916, 0x093c,
+  0x0917, 0x093c, 0x091c, 0x093c, 0x0921, 0x093c, 0x0922, 0x093c,
+  0x092b, 0x093c, 0x092f, 0x093c, 0x09c7, 0x09be, 0x09c7, 0x09d7,
+  0x09a1, 0x09bc, 0x09a2, 0x09bc, 0x09af, 0x09bc, 0x0a32, 0x0a3c,
+  0x0a38, 0x0a3c, 0x0a16, 0x0a3c, 0x0a17, 0x0a3c, 0x0a1c, 0x0a3c,
+  0x0a2b, 0x0a3c, 0x0b47, 0x0b56, 0x0b47, 0x0b3e, 0x0b47, 0x0b57,
+  0x0b21, 0x0b3c, 0x0b22, 0x0b3c, 0x0b92, 0x0bd7, 0x0bc6, 0x0bbe,
+  0x0bc7, 0x0bbe, 0x0bc6, 0x0bd7, 0x0c46, 0x0c56, 0x0cbf, 0x0cd5,
+  0x0cc6, 0x0cd5, 0x0cc6, 0x0cd6, 0x0cc6, 0x0cc2, 0x0cc6, 0x0cc2,
+  0x0cd5, 0x0d46, 0x0d3e, 0x0d47, 0x0d3e, 0x0d46, 0x0d57, 0x0dd9,
+  0x0dca, 0x0dd9, 0x0dcf, 0x0dd9, 0x0dcf, 0x0dca, 0x0dd9, 0x0ddf,
+  0x0f42, 0x0fb7, 0x0f4c, 0x0fb7, 0x0f51, 0x0fb7, 0x0f56, 0x0fb7,
+  0x0f5b, 0x0fb7, 0x0f40, 0x0fb5, 0x0f71, 0x0f72, 0x0f71, 0x0f74,
+  0x0fb2, 0x0f80, 0x0fb3, 0x0f80, 0x0f71, 0x0f80, 0x0f92, 0x0fb7,
+  0x0f9c, 0x0fb7, 0x0fa1, 0x0fb7, 0x0fa6, 0x0fb7, 0x0fab, 0x0fb7,
+  0x0f90, 0x0fb5, 0x1025, 0x102e, 0x1b05, 0x1b35, 0x1b07, 0x1b35,
+  0x1b09, 0x1b35, 0x1b0b, 0x1b35, 0x1b0d, 0x1b35, 0x1b11, 0x1b35,
+  0x1b3a, 0x1b35, 0x1b3c, 0x1b35, 0x1b3e, 0x1b35, 0x1b3f, 0x1b35,
+  0x1b42, 0x1b35, 0x0041, 0x0325, 0x0061, 0x0325, 0x0042, 0x0307,
+  0x0062, 0x0307, 0x0042, 0x0323, 0x0062, 0x0323, 0x0042, 0x0331,
+  0x0062, 0x0331, 0x0043, 0x0327, 0x0301, 0x0063, 0x0327, 0x0301,
+  0x0044, 0x0307, 0x0064, 0x0307, 0x0044, 0x0323, 0x0064, 0x0323,
+  0x0044, 0x0331, 0x0064, 0x0331, 0x0044, 0x0327, 0x0064, 0x0327,
+  0x0044, 0x032d, 0x0064, 0x032d, 0x0045, 0x0304, 0x0300, 0x0065,
+  0x0304, 0x0300, 0x0045, 0x0304, 0x0301, 0x0065, 0x0304, 0x0301,
+  0x0045, 0x032d, 0x0065, 0x032d, 0x0045, 0x0330, 0x0065, 0x0330,
+  0x0045, 0x0327, 0x0306, 0x0065, 0x0327, 0x0306, 0x0046, 0x0307,
+  0x0066, 0x0307, 0x0047, 0x0304, 0x0067, 0x0304, 0x0048, 0x0307,
+  0x0068, 0x0307, 0x0048, 0x0323, 0x0068, 0x0323, 0x0048, 0x0308,
+  0x0068, 0x0308, 0x0048, 0x0327, 0x0068, 0x0327, 0x0048, 0x032e,
+  0x0068, 0x032e, 0x0049, 0x0330, 0x0069, 0x0330, 0x0049, 0x0308,
+  0x0301, 0x0069, 0x0308, 0x0301, 0x004b, 0x0301, 0x006b, 0x0301,
+  0x004b, 0x0323, 0x006b, 0x0323, 0x004b, 0x0331, 0x006b, 0x0331,
+  0x004c, 0x0323, 0x006c, 0x0323, 0x004c, 0x0323, 0x0304, 0x006c,
+  0x0323, 0x0304, 0x004c, 0x0331, 0x006c, 0x0331, 0x004c, 0x032d,
+  0x006c, 0x032d, 0x004d, 0x0301, 0x006d, 0x0301, 0x004d, 0x0307,
+  0x006d, 0x0307, 0x004d, 0x0323, 0x006d, 0x0323, 0x004e, 0x0307,
+  0x006e, 0x0307, 0x004e, 0x0323, 0x006e, 0x0323, 0x004e, 0x0331,
+  0x006e, 0x0331, 0x004e, 0x032d, 0x006e, 0x032d, 0x004f, 0x0303,
+  0x0301, 0x006f, 0x0303, 0x0301, 0x004f, 0x0303, 0x0308, 0x006f,
+  0x0303, 0x0308, 0x004f, 0x0304, 0x0300, 0x006f, 0x0304, 0x0300,
+  0x004f, 0x0304, 0x0301, 0x006f, 0x0304, 0x0301, 0x0050, 0x0301,
+  0x0070, 0x0301, 0x0050, 0x0307, 0x0070, 0x0307, 0x0052, 0x0307,
+  0x0072, 0x0307, 0x0052, 0x0323, 0x0072, 0x0323, 0x0052, 0x0323,
+  0x0304, 0x0072, 0x0323, 0x0304, 0x0052, 0x0331, 0x0072, 0x0331,
+  0x0053, 0x0307, 0x0073, 0x0307, 0x0053, 0x0323, 0x0073, 0x0323,
+  0x0053, 0x0301, 0x0307, 0x0073, 0x0301, 0x0307, 0x0053, 0x030c,
+  0x0307, 0x0073, 0x030c, 0x0307, 0x0053, 0x0323, 0x0307, 0x0073,
+  0x0323, 0x0307, 0x0054, 0x0307, 0x0074, 0x0307, 0x0054, 0x0323,
+  0x0074, 0x0323, 0x0054, 0x0331, 0x0074, 0x0331, 0x0054, 0x032d,
+  0x0074, 0x032d, 0x0055, 0x0324, 0x0075, 0x0324, 0x0055, 0x0330,
+  0x0075, 0x0330, 0x0055, 0x032d, 0x0075, 0x032d, 0x0055, 0x0303,
+  0x0301, 0x0075, 0x0303, 0x0301, 0x0055, 0x0304, 0x0308, 0x0075,
+  0x0304, 0x0308, 0x0056, 0x0303, 0x0076, 0x0303, 0x0056, 0x0323,
+  0x0076, 0x0323, 0x0057, 0x0300, 0x0077, 0x0300, 0x0057, 0x0301,
+  0x0077, 0x0301, 0x0057, 0x0308, 0x0077, 0x0308, 0x0057, 0x0307,
+  0x0077, 0x0307, 0x0057, 0x0323, 0x0077, 0x0323, 0x0058, 0x0307,
+  0x0078, 0x0307, 0x0058, 0x0308, 0x0078, 0x0308, 0x0059, 0x0307,
+  0x0079, 0x0307, 0x005a, 0x0302, 0x007a, 0x0302, 0x005a, 0x0323,
+  0x007a, 0x0323, 0x005a, 0x0331, 0x007a, 0x0331, 0x0068, 0x0331,
+  0x0074, 0x0308, 0x0077, 0x030a, 0x0079, 0x030a, 0x017f, 0x0307,
+  0x0041, 0x0323, 0x0061, 0x0323, 0x0041, 0x0309, 0x0061, 0x0309,
+  0x0041, 0x0302, 0x0301, 0x0061, 0x0302, 0x0301, 0x0041, 0x0302,
+  0x0300, 0x0061, 0x0302, 0x0300, 0x0041, 0x0302, 0x0309, 0x0061,
+  0x0302, 0x0309, 0x0041, 0x0302, 0x0303, 0x0061, 0x0302, 0x0303,
+  0x0041, 0x0323, 0x0302, 0x0061, 0x0323, 0x0302, 0x0041, 0x0306,
+  0x0301, 0x0061, 0x0306, 0x0301, 0x0041, 0x0306, 0x0300, 0x0061,
+  0x0306, 0x0300, 0x0041, 0x0306, 0x0309, 0x0061, 0x0306, 0x0309,
+  0x0041, 0x0306, 0x0303, 0x0061, 0x0306, 0x0303, 0x0041, 0x0323,
+  0x0306, 0x0061, 0x0323, 0x0306, 0x0045, 0x0323, 0x0065, 0x0323,
+  0x0045, 0x0309, 0x0065, 0x0309, 0x0045, 0x0303, 0x0065, 0x0303,
+  0x0045, 0x0302, 0x0301, 0x0065, 0x0302, 0x0301, 0x0045, 0x0302,
+  0x0300, 0x0065, 0x0302, 0x0300, 0x0045, 0x0302, 0x0309, 0x0065,
+  0x0302, 0x0309, 0x0045, 0x0302, 0x0303, 0x0065, 0x0302, 0x0303,
+  0x0045, 0x0323, 0x0302, 0x0065, 0x0323, 0x0302, 0x0049, 0x0309,
+  0x0069, 0x0309, 0x0049, 0x0323, 0x0069, 0x0323, 0x004f, 0x0323,
+  0x006f, 0x0323, 0x004f, 0x0309, 0x006f, 0x0309, 0x004f, 0x0302,
+  0x0301, 0x006f, 0x0302, 0x0301, 0x004f, 0x0302, 0x0300, 0x006f,
+  0x0302, 0x0300, 0x004f, 0x0302, 0x0309, 0x006f, 0x0302, 0x0309,
+  0x004f, 0x0302, 0x0303, 0x006f, 0x0302, 0x0303, 0x004f, 0x0323,
+  0x0302, 0x006f, 0x0323, 0x0302, 0x004f, 0x031b, 0x0301, 0x006f,
+  0x031b, 0x0301, 0x004f, 0x031b, 0x0300, 0x006f, 0x031b, 0x0300,
+  0x004f, 0x031b, 0x0309, 0x006f, 0x031b, 0x0309, 0x004f, 0x031b,
+  0x0303, 0x006f, 0x031b, 0x0303, 0x004f, 0x031b, 0x0323, 0x006f,
+  0x031b, 0x0323, 0x0055, 0x0323, 0x0075, 0x0323, 0x0055, 0x0309,
+  0x0075, 0x0309, 0x0055, 0x031b, 0x0301, 0x0075, 0x031b, 0x0301,
+  0x0055, 0x031b, 0x0300, 0x0075, 0x031b, 0x0300, 0x0055, 0x031b,
+  0x0309, 0x0075, 0x031b, 0x0309, 0x0055, 0x031b, 0x0303, 0x0075,
+  0x031b, 0x0303, 0x0055, 0x031b, 0x0323, 0x0075, 0x031b, 0x0323,
+  0x0059, 0x0300, 0x0079, 0x0300, 0x0059, 0x0323, 0x0079, 0x0323,
+  0x0059, 0x0309, 0x0079, 0x0309, 0x0059, 0x0303, 0x0079, 0x0303,
+  0x03b1, 0x0313, 0x03b1, 0x0314, 0x03b1, 0x0313, 0x0300, 0x03b1,
+  0x0314, 0x0300, 0x03b1, 0x0313, 0x0301, 0x03b1, 0x0314, 0x0301,
+  0x03b1, 0x0313, 0x0342, 0x03b1, 0x0314, 0x0342, 0x0391, 0x0313,
+  0x0391, 0x0314, 0x0391, 0x0313, 0x0300, 0x0391, 0x0314, 0x0300,
+  0x0391, 0x0313, 0x0301, 0x0391, 0x0314, 0x0301, 0x0391, 0x0313,
+  0x0342, 0x0391, 0x0314, 0x0342, 0x03b5, 0x0313, 0x03b5, 0x0314,
+  0x03b5, 0x0313, 0x0300, 0x03b5, 0x0314, 0x0300, 0x03b5, 0x0313,
+  0x0301, 0x03b5, 0x0314, 0x0301, 0x0395, 0x0313, 0x0395, 0x0314,
+  0x0395, 0x0313, 0x0300, 0x0395, 0x0314, 0x0300, 0x0395, 0x0313,
+  0x0301, 0x0395, 0x0314, 0x0301, 0x03b7, 0x0313, 0x03b7, 0x0314,
+  0x03b7, 0x0313, 0x0300, 0x03b7, 0x0314, 0x0300, 0x03b7, 0x0313,
+  0x0301, 0x03b7, 0x0314, 0x0301, 0x03b7, 0x0313, 0x0342, 0x03b7,
+  0x0314, 0x0342, 0x0397, 0x0313, 0x0397, 0x0314, 0x0397, 0x0313,
+  0x0300, 0x0397, 0x0314, 0x0300, 0x0397, 0x0313, 0x0301, 0x0397,
+  0x0314, 0x0301, 0x0397, 0x0313, 0x0342, 0x0397, 0x0314, 0x0342,
+  0x03b9, 0x0313, 0x03b9, 0x0314, 0x03b9, 0x0313, 0x0300, 0x03b9,
+  0x0314, 0x0300, 0x03b9, 0x0313, 0x0301, 0x03b9, 0x0314, 0x0301,
+  0x03b9, 0x0313, 0x0342, 0x03b9, 0x0314, 0x0342, 0x0399, 0x0313,
+  0x0399, 0x0314, 0x0399, 0x0313, 0x0300, 0x0399, 0x0314, 0x0300,
+  0x0399, 0x0313, 0x0301, 0x0399, 0x0314, 0x0301, 0x0399, 0x0313,
+  0x0342, 0x0399, 0x0314, 0x0342, 0x03bf, 0x0313, 0x03bf, 0x0314,
+  0x03bf, 0x0313, 0x0300, 0x03bf, 0x0314, 0x0300, 0x03bf, 0x0313,
+  0x0301, 0x03bf, 0x0314, 0x0301, 0x039f, 0x0313, 0x039f, 0x0314,
+  0x039f, 0x0313, 0x0300, 0x039f, 0x0314, 0x0300, 0x039f, 0x0313,
+  0x0301, 0x039f, 0x0314, 0x0301, 0x03c5, 0x0313, 0x03c5, 0x0314,
+  0x03c5, 0x0313, 0x0300, 0x03c5, 0x0314, 0x0300, 0x03c5, 0x0313,
+  0x0301, 0x03c5, 0x0314, 0x0301, 0x03c5, 0x0313, 0x0342, 0x03c5,
+  0x0314, 0x0342, 0x03a5, 0x0314, 0x03a5, 0x0314, 0x0300, 0x03a5,
+  0x0314, 0x0301, 0x03a5, 0x0314, 0x0342, 0x03c9, 0x0313, 0x03c9,
+  0x0314, 0x03c9, 0x0313, 0x0300, 0x03c9, 0x0314, 0x0300, 0x03c9,
+  0x0313, 0x0301, 0x03c9, 0x0314, 0x0301, 0x03c9, 0x0313, 0x0342,
+  0x03c9, 0x0314, 0x0342, 0x03a9, 0x0313, 0x03a9, 0x0314, 0x03a9,
+  0x0313, 0x0300, 0x03a9, 0x0314, 0x0300, 0x03a9, 0x0313, 0x0301,
+  0x03a9, 0x0314, 0x0301, 0x03a9, 0x0313, 0x0342, 0x03a9, 0x0314,
+  0x0342, 0x03b1, 0x0300, 0x03b1, 0x0301, 0x03b5, 0x0300, 0x03b5,
+  0x0301, 0x03b7, 0x0300, 0x03b7, 0x0301, 0x03b9, 0x0300, 0x03b9,
+  0x0301, 0x03bf, 0x0300, 0x03bf, 0x0301, 0x03c5, 0x0300, 0x03c5,
+  0x0301, 0x03c9, 0x0300, 0x03c9, 0x0301, 0x03b1, 0x0313, 0x0345,
+  0x03b1, 0x0314, 0x0345, 0x03b1, 0x0313, 0x0300, 0x0345, 0x03b1,
+  0x0314, 0x0300, 0x0345, 0x03b1, 0x0313, 0x0301, 0x0345, 0x03b1,
+  0x0314, 0x0301, 0x0345, 0x03b1, 0x0313, 0x0342, 0x0345, 0x03b1,
+  0x0314, 0x0342, 0x0345, 0x0391, 0x0313, 0x0345, 0x0391, 0x0314,
+  0x0345, 0x0391, 0x0313, 0x0300, 0x0345, 0x0391, 0x0314, 0x0300,
+  0x0345, 0x0391, 0x0313, 0x0301, 0x0345, 0x0391, 0x0314, 0x0301,
+  0x0345, 0x0391, 0x0313, 0x0342, 0x0345, 0x0391, 0x0314, 0x0342,
+  0x0345, 0x03b7, 0x0313, 0x0345, 0x03b7, 0x0314, 0x0345, 0x03b7,
+  0x0313, 0x0300, 0x0345, 0x03b7, 0x0314, 0x0300, 0x0345, 0x03b7,
+  0x0313, 0x0301, 0x0345, 0x03b7, 0x0314, 0x0301, 0x0345, 0x03b7,
+  0x0313, 0x0342, 0x0345, 0x03b7, 0x0314, 0x0342, 0x0345, 0x0397,
+  0x0313, 0x0345, 0x0397, 0x0314, 0x0345, 0x0397, 0x0313, 0x0300,
+  0x0345, 0x0397, 0x0314, 0x0300, 0x0345, 0x0397, 0x0313, 0x0301,
+  0x0345, 0x0397, 0x0314, 0x0301, 0x0345, 0x0397, 0x0313, 0x0342,
+  0x0345, 0x0397, 0x0314, 0x0342, 0x0345, 0x03c9, 0x0313, 0x0345,
+  0x03c9, 0x0314, 0x0345, 0x03c9, 0x0313, 0x0300, 0x0345, 0x03c9,
+  0x0314, 0x0300, 0x0345, 0x03c9, 0x0313, 0x0301, 0x0345, 0x03c9,
+  0x0314, 0x0301, 0x0345, 0x03c9, 0x0313, 0x0342, 0x0345, 0x03c9,
+  0x0314, 0x0342, 0x0345, 0x03a9, 0x0313, 0x0345, 0x03a9, 0x0314,
+  0x0345, 0x03a9, 0x0313, 0x0300, 0x0345, 0x03a9, 0x0314, 0x0300,
+  0x0345, 0x03a9, 0x0313, 0x0301, 0x0345, 0x03a9, 0x0314, 0x0301,
+  0x0345, 0x03a9, 0x0313, 0x0342, 0x0345, 0x03a9, 0x0314, 0x0342,
+  0x0345, 0x03b1, 0x0306, 0x03b1, 0x0304, 0x03b1, 0x0300, 0x0345,
+  0x03b1, 0x0345, 0x03b1, 0x0301, 0x0345, 0x03b1, 0x0342, 0x03b1,
+  0x0342, 0x0345, 0x0391, 0x0306, 0x0391, 0x0304, 0x0391, 0x0300,
+  0x0391, 0x0301, 0x0391, 0x0345, 0x03b9, 0x00a8, 0x0342, 0x03b7,
+  0x0300, 0x0345, 0x03b7, 0x0345, 0x03b7, 0x0301, 0x0345, 0x03b7,
+  0x0342, 0x03b7, 0x0342, 0x0345, 0x0395, 0x0300, 0x0395, 0x0301,
+  0x0397, 0x0300, 0x0397, 0x0301, 0x0397, 0x0345, 0x1fbf, 0x0300,
+  0x1fbf, 0x0301, 0x1fbf, 0x0342, 0x03b9, 0x0306, 0x03b9, 0x0304,
+  0x03b9, 0x0308, 0x0300, 0x03b9, 0x0308, 0x0301, 0x03b9, 0x0342,
+  0x03b9, 0x0308, 0x0342, 0x0399, 0x0306, 0x0399, 0x0304, 0x0399,
+  0x0300, 0x0399, 0x0301, 0x1ffe, 0x0300, 0x1ffe, 0x0301, 0x1ffe,
+  0x0342, 0x03c5, 0x0306, 0x03c5, 0x0304, 0x03c5, 0x0308, 0x0300,
+  0x03c5, 0x0308, 0x0301, 0x03c1, 0x0313, 0x03c1, 0x0314, 0x03c5,
+  0x0342, 0x03c5, 0x0308, 0x0342, 0x03a5, 0x0306, 0x03a5, 0x0304,
+  0x03a5, 0x0300, 0x03a5, 0x0301, 0x03a1, 0x0314, 0x00a8, 0x0300,
+  0x00a8, 0x0301, 0x0060, 0x03c9, 0x0300, 0x0345, 0x03c9, 0x0345,
+  0x03c9, 0x0301, 0x0345, 0x03c9, 0x0342, 0x03c9, 0x0342, 0x0345,
+  0x039f, 0x0300, 0x039f, 0x0301, 0x03a9, 0x0300, 0x03a9, 0x0301,
+  0x03a9, 0x0345, 0x00b4, 0x2002, 0x2003, 0x03a9, 0x004b, 0x0041,
+  0x030a, 0x2190, 0x0338, 0x2192, 0x0338, 0x2194, 0x0338, 0x21d0,
+  0x0338, 0x21d4, 0x0338, 0x21d2, 0x0338, 0x2203, 0x0338, 0x2208,
+  0x0338, 0x220b, 0x0338, 0x2223, 0x0338, 0x2225, 0x0338, 0x223c,
+  0x0338, 0x2243, 0x0338, 0x2245, 0x0338, 0x2248, 0x0338, 0x003d,
+  0x0338, 0x2261, 0x0338, 0x224d, 0x0338, 0x003c, 0x0338, 0x003e,
+  0x0338, 0x2264, 0x0338, 0x2265, 0x0338, 0x2272, 0x0338, 0x2273,
+  0x0338, 0x2276, 0x0338, 0x2277, 0x0338, 0x227a, 0x0338, 0x227b,
+  0x0338, 0x2282, 0x0338, 0x2283, 0x0338, 0x2286, 0x0338, 0x2287,
+  0x0338, 0x22a2, 0x0338, 0x22a8, 0x0338, 0x22a9, 0x0338, 0x22ab,
+  0x0338, 0x227c, 0x0338, 0x227d, 0x0338, 0x2291, 0x0338, 0x2292,
+  0x0338, 0x22b2, 0x0338, 0x22b3, 0x0338, 0x22b4, 0x0338, 0x22b5,
+  0x0338, 0x3008, 0x3009, 0x2add, 0x0338, 0x304b, 0x3099, 0x304d,
+  0x3099, 0x304f, 0x3099, 0x3051, 0x3099, 0x3053, 0x3099, 0x3055,
+  0x3099, 0x3057, 0x3099, 0x3059, 0x3099, 0x305b, 0x3099, 0x305d,
+  0x3099, 0x305f, 0x3099, 0x3061, 0x3099, 0x3064, 0x3099, 0x3066,
+  0x3099, 0x3068, 0x3099, 0x306f, 0x3099, 0x306f, 0x309a, 0x3072,
+  0x3099, 0x3072, 0x309a, 0x3075, 0x3099, 0x3075, 0x309a, 0x3078,
+  0x3099, 0x3078, 0x309a, 0x307b, 0x3099, 0x307b, 0x309a, 0x3046,
+  0x3099, 0x309d, 0x3099, 0x30ab, 0x3099, 0x30ad, 0x3099, 0x30af,
+  0x3099, 0x30b1, 0x3099, 0x30b3, 0x3099, 0x30b5, 0x3099, 0x30b7,
+  0x3099, 0x30b9, 0x3099, 0x30bb, 0x3099, 0x30bd, 0x3099, 0x30bf,
+  0x3099, 0x30c1, 0x3099, 0x30c4, 0x3099, 0x30c6, 0x3099, 0x30c8,
+  0x3099, 0x30cf, 0x3099, 0x30cf, 0x309a, 0x30d2, 0x3099, 0x30d2,
+  0x309a, 0x30d5, 0x3099, 0x30d5, 0x309a, 0x30d8, 0x3099, 0x30d8,
+  0x309a, 0x30db, 0x3099, 0x30db, 0x309a, 0x30a6, 0x3099, 0x30ef,
+  0x3099, 0x30f0, 0x3099, 0x30f1, 0x3099, 0x30f2, 0x3099, 0x30fd,
+  0x3099, 0x8c48, 0x66f4, 0x8eca, 0x8cc8, 0x6ed1, 0x4e32, 0x53e5,
+  0x9f9c, 0x9f9c, 0x5951, 0x91d1, 0x5587, 0x5948, 0x61f6, 0x7669,
+  0x7f85, 0x863f, 0x87ba, 0x88f8, 0x908f, 0x6a02, 0x6d1b, 0x70d9,
+  0x73de, 0x843d, 0x916a, 0x99f1, 0x4e82, 0x5375, 0x6b04, 0x721b,
+  0x862d, 0x9e1e, 0x5d50, 0x6feb, 0x85cd, 0x8964, 0x62c9, 0x81d8,
+  0x881f, 0x5eca, 0x6717, 0x6d6a, 0x72fc, 0x90ce, 0x4f86, 0x51b7,
+  0x52de, 0x64c4, 0x6ad3, 0x7210, 0x76e7, 0x8001, 0x8606, 0x865c,
+  0x8def, 0x9732, 0x9b6f, 0x9dfa, 0x788c, 0x797f, 0x7da0, 0x83c9,
+  0x9304, 0x9e7f, 0x8ad6, 0x58df, 0x5f04, 0x7c60, 0x807e, 0x7262,
+  0x78ca, 0x8cc2, 0x96f7, 0x58d8, 0x5c62, 0x6a13, 0x6dda, 0x6f0f,
+  0x7d2f, 0x7e37, 0x964b, 0x52d2, 0x808b, 0x51dc, 0x51cc, 0x7a1c,
+  0x7dbe, 0x83f1, 0x9675, 0x8b80, 0x62cf, 0x6a02, 0x8afe, 0x4e39,
+  0x5be7, 0x6012, 0x7387, 0x7570, 0x5317, 0x78fb, 0x4fbf, 0x5fa9,
+  0x4e0d, 0x6ccc, 0x6578, 0x7d22, 0x53c3, 0x585e, 0x7701, 0x8449,
+  0x8aaa, 0x6bba, 0x8fb0, 0x6c88, 0x62fe, 0x82e5, 0x63a0, 0x7565,
+  0x4eae, 0x5169, 0x51c9, 0x6881, 0x7ce7, 0x826f, 0x8ad2, 0x91cf,
+  0x52f5, 0x5442, 0x5973, 0x5eec, 0x65c5, 0x6ffe, 0x792a, 0x95ad,
+  0x9a6a, 0x9e97, 0x9ece, 0x529b, 0x66c6, 0x6b77, 0x8f62, 0x5e74,
+  0x6190, 0x6200, 0x649a, 0x6f23, 0x7149, 0x7489, 0x79ca, 0x7df4,
+  0x806f, 0x8f26, 0x84ee, 0x9023, 0x934a, 0x5217, 0x52a3, 0x54bd,
+  0x70c8, 0x88c2, 0x8aaa, 0x5ec9, 0x5ff5, 0x637b, 0x6bae, 0x7c3e,
+  0x7375, 0x4ee4, 0x56f9, 0x5be7, 0x5dba, 0x601c, 0x73b2, 0x7469,
+  0x7f9a, 0x8046, 0x9234, 0x96f6, 0x9748, 0x9818, 0x4f8b, 0x79ae,
+  0x91b4, 0x96b8, 0x60e1, 0x4e86, 0x50da, 0x5bee, 0x5c3f, 0x6599,
+  0x6a02, 0x71ce, 0x7642, 0x84fc, 0x907c, 0x9f8d, 0x6688, 0x962e,
+  0x5289, 0x677b, 0x67f3, 0x6d41, 0x6e9c, 0x7409, 0x7559, 0x786b,
+  0x7d10, 0x985e, 0x516d, 0x622e, 0x9678, 0x502b, 0x5d19, 0x6dea,
+  0x8f2a, 0x5f8b, 0x6144, 0x6817, 0x7387, 0x9686, 0x5229, 0x540f,
+  0x5c65, 0x6613, 0x674e, 0x68a8, 0x6ce5, 0x7406, 0x75e2, 0x7f79,
+  0x88cf, 0x88e1, 0x91cc, 0x96e2, 0x533f, 0x6eba, 0x541d, 0x71d0,
+  0x7498, 0x85fa, 0x96a3, 0x9c57, 0x9e9f, 0x6797, 0x6dcb, 0x81e8,
+  0x7acb, 0x7b20, 0x7c92, 0x72c0, 0x7099, 0x8b58, 0x4ec0, 0x8336,
+  0x523a, 0x5207, 0x5ea6, 0x62d3, 0x7cd6, 0x5b85, 0x6d1e, 0x66b4,
+  0x8f3b, 0x884c, 0x964d, 0x898b, 0x5ed3, 0x5140, 0x55c0, 0x585a,
+  0x6674, 0x51de, 0x732a, 0x76ca, 0x793c, 0x795e, 0x7965, 0x798f,
+  0x9756, 0x7cbe, 0x7fbd, 0x8612, 0x8af8, 0x9038, 0x90fd, 0x98ef,
+  0x98fc, 0x9928, 0x9db4, 0x90de, 0x96b7, 0x4fae, 0x50e7, 0x514d,
+  0x52c9, 0x52e4, 0x5351, 0x559d, 0x5606, 0x5668, 0x5840, 0x58a8,
+  0x5c64, 0x5c6e, 0x6094, 0x6168, 0x618e, 0x61f2, 0x654f, 0x65e2,
+  0x6691, 0x6885, 0x6d77, 0x6e1a, 0x6f22, 0x716e, 0x722b, 0x7422,
+  0x7891, 0x793e, 0x7949, 0x7948, 0x7950, 0x7956, 0x795d, 0x798d,
+  0x798e, 0x7a40, 0x7a81, 0x7bc0, 0x7df4, 0x7e09, 0x7e41, 0x7f72,
+  0x8005, 0x81ed, 0x8279, 0x8279, 0x8457, 0x8910, 0x8996, 0x8b01,
+  0x8b39, 0x8cd3, 0x8d08, 0x8fb6, 0x9038, 0x96e3, 0x97ff, 0x983b,
+  0x6075, 0x242ee, 0x8218, 0x4e26, 0x51b5, 0x5168, 0x4f80, 0x5145,
+  0x5180, 0x52c7, 0x52fa, 0x559d, 0x5555, 0x5599, 0x55e2, 0x585a,
+  0x58b3, 0x5944, 0x5954, 0x5a62, 0x5b28, 0x5ed2, 0x5ed9, 0x5f69,
+  0x5fad, 0x60d8, 0x614e, 0x6108, 0x618e, 0x6160, 0x61f2, 0x6234,
+  0x63c4, 0x641c, 0x6452, 0x6556, 0x6674, 0x6717, 0x671b, 0x6756,
+  0x6b79, 0x6bba, 0x6d41, 0x6edb, 0x6ecb, 0x6f22, 0x701e, 0x716e,
+  0x77a7, 0x7235, 0x72af, 0x732a, 0x7471, 0x7506, 0x753b, 0x761d,
+  0x761f, 0x76ca, 0x76db, 0x76f4, 0x774a, 0x7740, 0x78cc, 0x7ab1,
+  0x7bc0, 0x7c7b, 0x7d5b, 0x7df4, 0x7f3e, 0x8005, 0x8352, 0x83ef,
+  0x8779, 0x8941, 0x8986, 0x8996, 0x8abf, 0x8af8, 0x8acb, 0x8b01,
+  0x8afe, 0x8aed, 0x8b39, 0x8b8a, 0x8d08, 0x8f38, 0x9072, 0x9199,
+  0x9276, 0x967c, 0x96e3, 0x9756, 0x97db, 0x97ff, 0x980b, 0x983b,
+  0x9b12, 0x9f9c, 0x2284a, 0x22844, 0x233d5, 0x3b9d, 0x4018, 0x4039,
+  0x25249, 0x25cd0, 0x27ed3, 0x9f43, 0x9f8e, 0x05d9, 0x05b4, 0x05f2,
+  0x05b7, 0x05e9, 0x05c1, 0x05e9, 0x05c2, 0x05e9, 0x05bc, 0x05c1,
+  0x05e9, 0x05bc, 0x05c2, 0x05d0, 0x05b7, 0x05d0, 0x05b8, 0x05d0,
+  0x05bc, 0x05d1, 0x05bc, 0x05d2, 0x05bc, 0x05d3, 0x05bc, 0x05d4,
+  0x05bc, 0x05d5, 0x05bc, 0x05d6, 0x05bc, 0x05d8, 0x05bc, 0x05d9,
+  0x05bc, 0x05da, 0x05bc, 0x05db, 0x05bc, 0x05dc, 0x05bc, 0x05de,
+  0x05bc, 0x05e0, 0x05bc, 0x05e1, 0x05bc, 0x05e3, 0x05bc, 0x05e4,
+  0x05bc, 0x05e6, 0x05bc, 0x05e7, 0x05bc, 0x05e8, 0x05bc, 0x05e9,
+  0x05bc, 0x05ea, 0x05bc, 0x05d5, 0x05b9, 0x05d1, 0x05bf, 0x05db,
+  0x05bf, 0x05e4, 0x05bf, 0x11099, 0x110ba, 0x1109b, 0x110ba, 0x110a5,
+  0x110ba, 0x11131, 0x11127, 0x11132, 0x11127, 0x11347, 0x1133e, 0x11347,
+  0x11357, 0x114b9, 0x114ba, 0x114b9, 0x114b0, 0x114b9, 0x114bd, 0x115b8,
+  0x115af, 0x115b9, 0x115af, 0x11935, 0x11930, 0x1d157, 0x1d165, 0x1d158,
+  0x1d165, 0x1d158, 0x1d165, 0x1d16e, 0x1d158, 0x1d165, 0x1d16f, 0x1d158,
+  0x1d165, 0x1d170, 0x1d158, 0x1d165, 0x1d171, 0x1d158, 0x1d165, 0x1d172,
+  0x1d1b9, 0x1d165, 0x1d1ba, 0x1d165, 0x1d1b9, 0x1d165, 0x1d16e, 0x1d1ba,
+  0x1d165, 0x1d16e, 0x1d1b9, 0x1d165, 0x1d16f, 0x1d1ba, 0x1d165, 0x1d16f,
+  0x4e3d, 0x4e38, 0x4e41, 0x20122, 0x4f60, 0x4fae, 0x4fbb, 0x5002,
+  0x507a, 0x5099, 0x50e7, 0x50cf, 0x349e, 0x2063a, 0x514d, 0x5154,
+  0x5164, 0x5177, 0x2051c, 0x34b9, 0x5167, 0x518d, 0x2054b, 0x5197,
+  0x51a4, 0x4ecc, 0x51ac, 0x51b5, 0x291df, 0x51f5, 0x5203, 0x34df,
+  0x523b, 0x5246, 0x5272, 0x5277, 0x3515, 0x52c7, 0x52c9, 0x52e4,
+  0x52fa, 0x5305, 0x5306, 0x5317, 0x5349, 0x5351, 0x535a, 0x5373,
+  0x537d, 0x537f, 0x537f, 0x537f, 0x20a2c, 0x7070, 0x53ca, 0x53df,
+  0x20b63, 0x53eb, 0x53f1, 0x5406, 0x549e, 0x5438, 0x5448, 0x5468,
+  0x54a2, 0x54f6, 0x5510, 0x5553, 0x5563, 0x5584, 0x5584, 0x5599,
+  0x55ab, 0x55b3, 0x55c2, 0x5716, 0x5606, 0x5717, 0x5651, 0x5674,
+  0x5207, 0x58ee, 0x57ce, 0x57f4, 0x580d, 0x578b, 0x5832, 0x5831,
+  0x58ac, 0x214e4, 0x58f2, 0x58f7, 0x5906, 0x591a, 0x5922, 0x5962,
+  0x216a8, 0x216ea, 0x59ec, 0x5a1b, 0x5a27, 0x59d8, 0x5a66, 0x36ee,
+  0x36fc, 0x5b08, 0x5b3e, 0x5b3e, 0x219c8, 0x5bc3, 0x5bd8, 0x5be7,
+  0x5bf3, 0x21b18, 0x5bff, 0x5c06, 0x5f53, 0x5c22, 0x3781, 0x5c60,
+  0x5c6e, 0x5cc0, 0x5c8d, 0x21de4, 0x5d43, 0x21de6, 0x5d6e, 0x5d6b,
+  0x5d7c, 0x5de1, 0x5de2, 0x382f, 0x5dfd, 0x5e28, 0x5e3d, 0x5e69,
+  0x3862, 0x22183, 0x387c, 0x5eb0, 0x5eb3, 0x5eb6, 0x5eca, 0x2a392,
+  0x5efe, 0x22331, 0x22331, 0x8201, 0x5f22, 0x5f22, 0x38c7, 0x232b8,
+  0x261da, 0x5f62, 0x5f6b, 0x38e3, 0x5f9a, 0x5fcd, 0x5fd7, 0x5ff9,
+  0x6081, 0x393a, 0x391c, 0x6094, 0x226d4, 0x60c7, 0x6148, 0x614c,
+  0x614e, 0x614c, 0x617a, 0x618e, 0x61b2, 0x61a4, 0x61af, 0x61de,
+  0x61f2, 0x61f6, 0x6210, 0x621b, 0x625d, 0x62b1, 0x62d4, 0x6350,
+  0x22b0c, 0x633d, 0x62fc, 0x6368, 0x6383, 0x63e4, 0x22bf1, 0x6422,
+  0x63c5, 0x63a9, 0x3a2e, 0x6469, 0x647e, 0x649d, 0x6477, 0x3a6c,
+  0x654f, 0x656c, 0x2300a, 0x65e3, 0x66f8, 0x6649, 0x3b19, 0x6691,
+  0x3b08, 0x3ae4, 0x5192, 0x5195, 0x6700, 0x669c, 0x80ad, 0x43d9,
+  0x6717, 0x671b, 0x6721, 0x675e, 0x6753, 0x233c3, 0x3b49, 0x67fa,
+  0x6785, 0x6852, 0x6885, 0x2346d, 0x688e, 0x681f, 0x6914, 0x3b9d,
+  0x6942, 0x69a3, 0x69ea, 0x6aa8, 0x236a3, 0x6adb, 0x3c18, 0x6b21,
+  0x238a7, 0x6b54, 0x3c4e, 0x6b72, 0x6b9f, 0x6bba, 0x6bbb, 0x23a8d,
+  0x21d0b, 0x23afa, 0x6c4e, 0x23cbc, 0x6cbf, 0x6ccd, 0x6c67, 0x6d16,
+  0x6d3e, 0x6d77, 0x6d41, 0x6d69, 0x6d78, 0x6d85, 0x23d1e, 0x6d34,
+  0x6e2f, 0x6e6e, 0x3d33, 0x6ecb, 0x6ec7, 0x23ed1, 0x6df9, 0x6f6e,
+  0x23f5e, 0x23f8e, 0x6fc6, 0x7039, 0x701e, 0x701b, 0x3d96, 0x704a,
+  0x707d, 0x7077, 0x70ad, 0x20525, 0x7145, 0x24263, 0x719c, 0x243ab,
+  0x7228, 0x7235, 0x7250, 0x24608, 0x7280, 0x7295, 0x24735, 0x24814,
+  0x737a, 0x738b, 0x3eac, 0x73a5, 0x3eb8, 0x3eb8, 0x7447, 0x745c,
+  0x7471, 0x7485, 0x74ca, 0x3f1b, 0x7524, 0x24c36, 0x753e, 0x24c92,
+  0x7570, 0x2219f, 0x7610, 0x24fa1, 0x24fb8, 0x25044, 0x3ffc, 0x4008,
+  0x76f4, 0x250f3, 0x250f2, 0x25119, 0x25133, 0x771e, 0x771f, 0x771f,
+  0x774a, 0x4039, 0x778b, 0x4046, 0x4096, 0x2541d, 0x784e, 0x788c,
+  0x78cc, 0x40e3, 0x25626, 0x7956, 0x2569a, 0x256c5, 0x798f, 0x79eb,
+  0x412f, 0x7a40, 0x7a4a, 0x7a4f, 0x2597c, 0x25aa7, 0x25aa7, 0x7aee,
+  0x4202, 0x25bab, 0x7bc6, 0x7bc9, 0x4227, 0x25c80, 0x7cd2, 0x42a0,
+  0x7ce8, 0x7ce3, 0x7d00, 0x25f86, 0x7d63, 0x4301, 0x7dc7, 0x7e02,
+  0x7e45, 0x4334, 0x26228, 0x26247, 0x4359, 0x262d9, 0x7f7a, 0x2633e,
+  0x7f95, 0x7ffa, 0x8005, 0x264da, 0x26523, 0x8060, 0x265a8, 0x8070,
+  0x2335f, 0x43d5, 0x80b2, 0x8103, 0x440b, 0x813e, 0x5ab5, 0x267a7,
+  0x267b5, 0x23393, 0x2339c, 0x8201, 0x8204, 0x8f9e, 0x446b, 0x8291,
+  0x828b, 0x829d, 0x52b3, 0x82b1, 0x82b3, 0x82bd, 0x82e6, 0x26b3c,
+  0x82e5, 0x831d, 0x8363, 0x83ad, 0x8323, 0x83bd, 0x83e7, 0x8457,
+  0x8353, 0x83ca, 0x83cc, 0x83dc, 0x26c36, 0x26d6b, 0x26cd5, 0x452b,
+  0x84f1, 0x84f3, 0x8516, 0x273ca, 0x8564, 0x26f2c, 0x455d, 0x4561,
+  0x26fb1, 0x270d2, 0x456b, 0x8650, 0x865c, 0x8667, 0x8669, 0x86a9,
+  0x8688, 0x870e, 0x86e2, 0x8779, 0x8728, 0x876b, 0x8786, 0x45d7,
+  0x87e1, 0x8801, 0x45f9, 0x8860, 0x8863, 0x27667, 0x88d7, 0x88de,
+  0x4635, 0x88fa, 0x34bb, 0x278ae, 0x27966, 0x46be, 0x46c7, 0x8aa0,
+  0x8aed, 0x8b8a, 0x8c55, 0x27ca8, 0x8cab, 0x8cc1, 0x8d1b, 0x8d77,
+  0x27f2f, 0x20804, 0x8dcb, 0x8dbc, 0x8df0, 0x208de, 0x8ed4, 0x8f38,
+  0x285d2, 0x285ed, 0x9094, 0x90f1, 0x9111, 0x2872e, 0x911b, 0x9238,
+  0x92d7, 0x92d8, 0x927c, 0x93f9, 0x9415, 0x28bfa, 0x958b, 0x4995,
+  0x95b7, 0x28d77, 0x49e6, 0x96c3, 0x5db2, 0x9723, 0x29145, 0x2921a,
+  0x4a6e, 0x4a76, 0x97e0, 0x2940a, 0x4ab2, 0x29496, 0x980b, 0x980b,
+  0x9829, 0x295b6, 0x98e2, 0x4b33, 0x9929, 0x99a7, 0x99c2, 0x99fe,
+  0x4bce, 0x29b30, 0x9b12, 0x9c40, 0x9cfd, 0x4cce, 0x4ced, 0x9d67,
+  0x2a0ce, 0x4cf8, 0x2a105, 0x2a20e, 0x2a291, 0x9ebb, 0x4d56, 0x9ef9,
+  0x9efe, 0x9f05, 0x9f0f, 0x9f16, 0x9f3b, 0x2a600,
+};
+
+const Mapping kCompatMappings[3750] = {
+  {0x00a0, 0, 1}, {0x00a8, 1, 2}, {0x00aa, 3, 1}, {0x00af, 4, 2},
+  {0x00b2, 6, 1}, {0x00b3, 7, 1}, {0x00b4, 8, 2}, {0x00b5, 10, 1},
+  {0x00b8, 11, 2}, {0x00b9, 13, 1}, {0x00ba, 14, 1}, {0x00bc, 15, 3},
+  {0x00bd, 18, 3}, {0x00be, 21, 3}, {0x0132, 24, 2}, {0x0133, 26, 2},
+  {0x013f, 28, 2}, {0x0140, 30, 2}, {0x0149, 32, 2}, {0x017f, 34, 1},
+  {0x01c4, 35, 3}, {0x01c5, 38, 3}, {0x01c6, 41, 3}, {0x01c7, 44, 2},
+  {0x01c8, 46, 2}, {0x01c9, 48, 2}, {0x01ca, 50, 2}, {0x01cb, 52, 2},
+  {0x01cc, 54, 2}, {0x01f1, 56, 2}, {0x01f2, 58, 2}, {0x01f3, 60, 2},
+  {0x02b0, 62, 1}, {0x02b1, 63, 1}, {0x02b2, 64, 1}, {0x02b3, 65, 1},
+  {0x02b4, 66, 1}, {0x02b5, 67, 1}, {0x02b6, 68, 1}, {0x02b7, 69, 1},
+  {0x02b8, 70, 1}, {0x02d8, 71, 2}, {0x02d9, 73, 2}, {0x02da, 75, 2},
+  {0x02db, 77, 2}, {0x02dc, 79, 2}, {0x02dd, 81, 2}, {0x02e0, 83, 1},
+  {0x02e1, 84, 1}, {0x02e2, 85, 1}, {0x02e3, 86, 1}, {0x02e4, 87, 1},
+  {0x037a, 88, 2}, {0x0384, 90, 2}, {0x0385, 92, 3}, {0x03d0, 95, 1},
+  {0x03d1, 96, 1}, {0x03d2, 97, 1}, {0x03d3, 98, 2}, {0x03d4, 100, 2},
+  {0x03d5, 102, 1}, {0x03d6, 103, 1}, {0x03f0, 104, 1}, {0x03f1, 105, 1},
+  {0x03f2, 106, 1}, {0x03f4, 107, 1}, {0x03f5, 108, 1}, {0x03f9, 109, 1},
+  {0x0587, 110, 2}, {0x0675, 112, 2}, {0x0676, 114, 2}, {0x0677, 116, 2},
+  {0x0678, 118, 2}, {0x0e33, 120, 2}, {0x0eb3, 122, 2}, {0x0edc, 124, 2},
+  {0x0edd, 126, 2}, {0x0f0c, 128, 1}, {0x0f77, 129, 3}, {0x0f79, 132, 3},
+  {0x10fc, 135, 1}, {0x1d2c, 136, 1}, {0x1d2d, 137, 1}, {0x1d2e, 138, 1},
+  {0x1d30, 139, 1}, {0x1d31, 140, 1}, {0x1d32, 141, 1}, {0x1d33, 142, 1},
+  {0x1d34, 143, 1}, {0x1d35, 144, 1}, {0x1d36, 145, 1}, {0x1d37, 146, 1},
+  {0x1d38, 147, 1}, {0x1d39, 148, 1}, {0x1d3a, 149, 1}, {0x1d3c, 150, 1},
+  {0x1d3d, 151, 1}, {0x1d3e, 152, 1}, {0x1d3f, 153, 1}, {0x1d40, 154, 1},
+  {0x1d41, 155, 1}, {0x1d42, 156, 1}, {0x1d43, 157, 1}, {0x1d44, 158, 1},
+  {0x1d45, 159, 1}, {0x1d46, 160, 1}, {0x1d47, 161, 1}, {0x1d48, 162, 1},
+  {0x1d49, 163, 1}, {0x1d4a, 164, 1}, {0x1d4b, 165, 1}, {0x1d4c, 166, 1},
+  {0x1d4d, 167, 1}, {0x1d4f, 168, 1}, {0x1d50, 169, 1}, {0x1d51, 170, 1},
+  {0x1d52, 171, 1}, {0x1d53, 172, 1}, {0x1d54, 173, 1}, {0x1d55, 174, 1},
+  {0x1d56, 175, 1}, {0x1d57, 176, 1}, {0x1d58, 177, 1}, {0x1d59, 178, 1},
+  {0x1d5a, 179, 1}, {0x1d5b, 180, 1}, {0x1d5c, 181, 1}, {0x1d5d, 182, 1},
+  {0x1d5e, 183, 1}, {0x1d5f, 184, 1}, {0x1d60, 185, 1}, {0x1d61, 186, 1},
+  {0x1d62, 187, 1}, {0x1d63, 188, 1}, {0x1d64, 189, 1}, {0x1d65, 190, 1},
+  {0x1d66, 191, 1}, {0x1d67, 192, 1}, {0x1d68, 193, 1}, {0x1d69, 194, 1},
+  {0x1d6a, 195, 1}, {0x1d78, 196, 1}, {0x1d9b, 197, 1}, {0x1d9c, 198, 1},
+  {0x1d9d, 199, 1}, {0x1d9e, 200, 1}, {0x1d9f, 201, 1}, {0x1da0, 202, 1},
+  {0x1da1, 203, 1}, {0x1da2, 204, 1}, {0x1da3, 205, 1}, {0x1da4, 206, 1},
+  {0x1da5, 207, 1}, {0x1da6, 208, 1}, {0x1da7, 209, 1}, {0x1da8, 210, 1},
+  {0x1da9, 211, 1}, {0x1daa, 212, 1}, {0x1dab, 213, 1}, {0x1dac, 214, 1},
+  {0x1dad, 215, 1}, {0x1dae, 216, 1}, {0x1daf, 217, 1}, {0x1db0, 218, 1},
+  {0x1db1, 219, 1}, {0x1db2, 220, 1}, {0x1db3, 221, 1}, {0x1db4, 222, 1},
+  {0x1db5, 223, 1}, {0x1db6, 224, 1}, {0x1db7, 225, 1}, {0x1db8, 226, 1},
+  {0x1db9, 227, 1}, {0x1dba, 228, 1}, {0x1dbb, 229, 1}, {0x1dbc, 230, 1},
+  {0x1dbd, 231, 1}, {0x1dbe, 232, 1}, {0x1dbf, 233, 1}, {0x1e9a, 234, 2},
+  {0x1e9b, 236, 2}, {0x1fbd, 238, 2}, {0x1fbf, 240, 2}, {0x1fc0, 242, 2},
+  {0x1fc1, 244, 3}, {0x1fcd, 247, 3}, {0x1fce, 250, 3}, {0x1fcf, 253, 3},
+  {0x1fdd, 256, 3}, {0x1fde, 259, 3}, {0x1fdf, 262, 3}, {0x1fed, 265, 3},
+  {0x1fee, 268, 3}, {0x1ffd, 271, 2}, {0x1ffe, 273, 2}, {0x2000, 275, 1},
+  {0x2001, 276, 1}, {0x2002, 277, 1}, {0x2003, 278, 1}, {0x2004, 279, 1},
+  {0x2005, 280, 1}, {0x2006, 281, 1}, {0x2007, 282, 1}, {0x2008, 283, 1},
+  {0x2009, 284, 1}, {0x200a, 285, 1}, {0x2011, 286, 1}, {0x2017, 287, 2},
+  {0x2024, 289, 1}, {0x2025, 290, 2}, {0x2026, 292, 3}, {0x202f, 295, 1},
+  {0x2033, 296, 2}, {0x2034, 298, 3}, {0x2036, 301, 2}, {0x2037, 303, 3},
+  {0x203c, 306, 2}, {0x203e, 308, 2}, {0x2047, 310, 2}, {0x2048, 312, 2},
+  {0x2049, 314, 2}, {0x2057, 316, 4}, {0x205f, 320, 1}, {0x2070, 321, 1},
+  {0x2071, 322, 1}, {0x2074, 323, 1}, {0x2075, 324, 1}, {0x2076, 325, 1},
+  {0x2077, 326, 1}, {0x2078, 327, 1}, {0x2079, 328, 1}, {0x207a, 329, 1},
+  {0x207b, 330, 1}, {0x207c, 331, 1}, {0x207d, 332, 1}, {0x207e, 333, 1},
+  {0x207f, 334, 1}, {0x2080, 335, 1}, {0x2081, 336, 1}, {0x2082, 337, 1},
+  {0x2083, 338, 1}, {0x2084, 339, 1}, {0x2085, 340, 1}, {0x2086, 341, 1},
+  {0x2087, 342, 1}, {0x2088, 343, 1}, {0x2089, 344, 1}, {0x208a, 345, 1},
+  {0x208b, 346, 1}, {0x208c, 347, 1}, {0x208d, 348, 1}, {0x208e, 349, 1},
+  {0x2090, 350, 1}, {0x2091, 351, 1}, {0x2092, 352, 1}, {0x2093, 353, 1},
+  {0x2094, 354, 1}, {0x2095, 355, 1}, {0x2096, 356, 1}, {0x2097, 357, 1},
+  {0x2098, 358, 1}, {0x2099, 359, 1}, {0x209a, 360, 1}, {0x209b, 361, 1},
+  {0x209c, 362, 1}, {0x20a8, 363, 2}, {0x2100, 365, 3}, {0x2101, 368, 3},
+  {0x2102, 371, 1}, {0x2103, 372, 2}, {0x2105, 374, 3}, {0x2106, 377, 3},
+  {0x2107, 380, 1}, {0x2109, 381, 2}, {0x210a, 383, 1}, {0x210b, 384, 1},
+  {0x210c, 385, 1}, {0x210d, 386, 1}, {0x210e, 387, 1}, {0x210f, 388, 1},
+  {0x2110, 389, 1}, {0x2111, 390, 1}, {0x2112, 391, 1}, {0x2113, 392, 1},
+  {0x2115, 393, 1}, {0x2116, 394, 2}, {0x2119, 396, 1}, {0x211a, 397, 1},
+  {0x211b, 398, 1}, {0x211c, 399, 1}, {0x211d, 400, 1}, {0x2120, 401, 2},
+  {0x2121, 403, 3}, {0x2122, 406, 2}, {0x2124, 408, 1}, {0x2128, 409, 1},
+  {0x212c, 410, 1}, {0x212d, 411, 1}, {0x212f, 412, 1}, {0x2130, 413, 1},
+  {0x2131, 414, 1}, {0x2133, 415, 1}, {0x2134, 416, 1}, {0x2135, 417, 1},
+  {0x2136, 418, 1}, {0x2137, 419, 1}, {0x2138, 420, 1}, {0x2139, 421, 1},
+  {0x213b, 422, 3}, {0x213c, 425, 1}, {0x213d, 426, 1}, {0x213e, 427, 1},
+  {0x213f, 428, 1}, {0x2140, 429, 1}, {0x2145, 430, 1}, {0x2146, 431, 1},
+  {0x2147, 432, 1}, {0x2148, 433, 1}, {0x2149, 434, 1}, {0x2150, 435, 3},
+  {0x2151, 438, 3}, {0x2152, 441, 4}, {0x2153, 445, 3}, {0x2154, 448, 3},
+  {0x2155, 451, 3}, {0x2156, 454, 3}, {0x2157, 457, 3}, {0x2158, 460, 3},
+  {0x2159, 463, 3}, {0x215a, 466, 3}, {0x215b, 469, 3}, {0x215c, 472, 3},
+  {0x215d, 475, 3}, {0x215e, 478, 3}, {0x215f, 481, 2}, {0x2160, 483, 1},
+  {0x2161, 484, 2}, {0x2162, 486, 3}, {0x2163, 489, 2}, {0x2164, 491, 1},
+  {0x2165, 492, 2}, {0x2166, 494, 3}, {0x2167, 497, 4}, {0x2168, 501, 2},
+  {0x2169, 503, 1}, {0x216a, 504, 2}, {0x216b, 506, 3}, {0x216c, 509, 1},
+  {0x216d, 510, 1}, {0x216e, 511, 1}, {0x216f, 512, 1}, {0x2170, 513, 1},
+  {0x2171, 514, 2}, {0x2172, 516, 3}, {0x2173, 519, 2}, {0x2174, 521, 1},
+  {0x2175, 522, 2}, {0x2176, 524, 3}, {0x2177, 527, 4}, {0x2178, 531, 2},
+  {0x2179, 533, 1}, {0x217a, 534, 2}, {0x217b, 536, 3}, {0x217c, 539, 1},
+  {0x217d, 540, 1}, {0x217e, 541, 1}, {0x217f, 542, 1}, {0x2189, 543, 3},
+  {0x222c, 546, 2}, {0x222d, 548, 3}, {0x222f, 551, 2}, {0x2230, 553, 3},
+  {0x2460, 556, 1}, {0x2461, 557, 1}, {0x2462, 558, 1}, {0x2463, 559, 1},
+  {0x2464, 560, 1}, {0x2465, 561, 1}, {0x2466, 562, 1}, {0x2467, 563, 1},
+  {0x2468, 564, 1}, {0x2469, 565, 2}, {0x246a, 567, 2}, {0x246b, 569, 2},
+  {0x246c, 571, 2}, {0x246d, 573, 2}, {0x246e, 575, 2}, {0x246f, 577, 2},
+  {0x2470, 579, 2}, {0x2471, 581, 2}, {0x2472, 583, 2}, {0x2473, 585, 2},
+  {0x2474, 587, 3}, {0x2475, 590, 3}, {0x2476, 593, 3}, {0x2477, 596, 3},
+  {0x2478, 599, 3}, {0x2479, 602, 3}, {0x247a, 605, 3}, {0x247b, 608, 3},
+  {0x247c, 611, 3}, {0x247d, 614, 4}, {0x247e, 618, 4}, {0x247f, 622, 4},
+  {0x2480, 626, 4}, {0x2481, 630, 4}, {0x2482, 634, 4}, {0x2483, 638, 4},
+  {0x2484, 642, 4}, {0x2485, 646, 4}, {0x2486, 650, 4}, {0x2487, 654, 4},
+  {0x2488, 658, 2}, {0x2489, 660, 2}, {0x248a, 662, 2}, {0x248b, 664, 2},
+  {0x248c, 666, 2}, {0x248d, 668, 2}, {0x248e, 670, 2}, {0x248f, 672, 2},
+  {0x2490, 674, 2}, {0x2491, 676, 3}, {0x2492, 679, 3}, {0x2493, 682, 3},
+  {0x2494, 685, 3}, {0x2495, 688, 3}, {0x2496, 691, 3}, {0x2497, 694, 3},
+  {0x2498, 697, 3}, {0x2499, 700, 3}, {0x249a, 703, 3}, {0x249b, 706, 3},
+  {0x249c, 709, 3}, {0x249d, 712, 3}, {0x249e, 715, 3}, {0x249f, 718, 3},
+  {0x24a0, 721, 3}, {0x24a1, 724, 3}, {0x24a2, 727, 3}, {0x24a3, 730, 3},
+  {0x24a4, 733, 3}, {0x24a5, 736, 3}, {0x24a6, 739, 3}, {0x24a7, 742, 3},
+  {0x24a8, 745, 3}, {0x24a9, 748, 3}, {0x24aa, 751, 3}, {0x24ab, 754, 3},
+  {0x24ac, 757, 3}, {0x24ad, 760, 3}, {0x24ae, 763, 3}, {0x24af, 766, 3},
+  {0x24b0, 769, 3}, {0x24b1, 772, 3}, {0x24b2, 775, 3}, {0x24b3, 778, 3},
+  {0x24b4, 781, 3}, {0x24b5, 784, 3}, {0x24b6, 787, 1}, {0x24b7, 788, 1},
+  {0x24b8, 789, 1}, {0x24b9, 790, 1}, {0x24ba, 791, 1}, {0x24bb, 792, 1},
+  {0x24bc, 793, 1}, {0x24bd, 794, 1}, {0x24be, 795, 1}, {0x24bf, 796, 1},
+  {0x24c0, 797, 1}, {0x24c1, 798, 1}, {0x24c2, 799, 1}, {0x24c3, 800, 1},
+  {0x24c4, 801, 1}, {0x24c5, 802, 1}, {0x24c6, 803, 1}, {0x24c7, 804, 1},
+  {0x24c8, 805, 1}, {0x24c9, 806, 1}, {0x24ca, 807, 1}, {0x24cb, 808, 1},
+  {0x24cc, 809, 1}, {0x24cd, 810, 1}, {0x24ce, 811, 1}, {0x24cf, 812, 1},
+  {0x24d0, 813, 1}, {0x24d1, 814, 1}, {0x24d2, 815, 1}, {0x24d3, 816, 1},
+  {0x24d4, 817, 1}, {0x24d5, 818, 1}, {0x24d6, 819, 1}, {0x24d7, 820, 1},
+  {0x24d8, 821, 1}, {0x24d9, 822, 1}, {0x24da, 823, 1}, {0x24db, 824, 1},
+  {0x24dc, 825, 1}, {0x24dd, 826, 1}, {0x24de, 827, 1}, {0x24df, 828, 1},
+  {0x24e0, 829, 1}, {0x24e1, 830, 1}, {0x24e2, 831, 1}, {0x24e3, 832, 1},
+  {0x24e4, 833, 1}, {0x24e5, 834, 1}, {0x24e6, 835, 1}, {0x24e7, 836, 1},
+  {0x24e8, 837, 1}, {0x24e9, 838, 1}, {0x24ea, 839, 1}, {0x2a0c, 840, 4},
+  {0x2a74, 844, 3}, {0x2a75, 847, 2}, {0x2a76, 849, 3}, {0x2c7c, 852, 1},
+  {0x2c7d, 853, 1}, {0x2d6f, 854, 1}, {0x2e9f, 855, 1}, {0x2ef3, 856, 1},
+  {0x2f00, 857, 1}, {0x2f01, 858, 1}, {0x2f02, 859, 1}, {0x2f03, 860, 1},
+  {0x2f04, 861, 1}, {0x2f05, 862, 1}, {0x2f06, 863, 1}, {0x2f07, 864, 1},
+  {0x2f08, 865, 1}, {0x2f09, 866, 1}, {0x2f0a, 867, 1}, {0x2f0b, 868, 1},
+  {0x2f0c, 869, 1}, {0x2f0d, 870, 1}, {0x2f0e, 871, 1}, {0x2f0f, 872, 1},
+  {0x2f10, 873, 1}, {0x2f11, 874, 1}, {0x2f12, 875, 1}, {0x2f13, 876, 1},
+  {0x2f14, 877, 1}, {0x2f15, 878, 1}, {0x2f16, 879, 1}, {0x2f17, 880, 1},
+  {0x2f18, 881, 1}, {0x2f19, 882, 1}, {0x2f1a, 883, 1}, {0x2f1b, 884, 1},
+  {0x2f1c, 885, 1}, {0x2f1d, 886, 1}, {0x2f1e, 887, 1}, {0x2f1f, 888, 1},
+  {0x2f20, 889, 1}, {0x2f21, 890, 1}, {0x2f22, 891, 1}, {0x2f23, 892, 1},
+  {0x2f24, 893, 1}, {0x2f25, 894, 1}, {0x2f26, 895, 1}, {0x2f27, 896, 1},
+  {0x2f28, 897, 1}, {0x2f29, 898, 1}, {0x2f2a, 899, 1}, {0x2f2b, 900, 1},
+  {0x2f2c, 901, 1}, {0x2f2d, 902, 1}, {0x2f2e, 903, 1}, {0x2f2f, 904, 1},
+  {0x2f30, 905, 1}, {0x2f31, 906, 1}, {0x2f32, 907, 1}, {0x2f33, 908, 1},
+  {0x2f34, 909, 1}, {0x2f35, 910, 1}, {0x2f36, 911, 1}, {0x2f37, 912, 1},
+  {0x2f38, 913, 1}, {0x2f39, 914, 1}, {0x2f3a, 915, 1}, {0x2f3b, 916, 1},
+  {0x2f3c, 917, 1}, {0x2f3d, 918, 1}, {0x2f3e, 919, 1}, {0x2f3f, 920, 1},
+  {0x2f40, 921, 1}, {0x2f41, 922, 1}, {0x2f42, 923, 1}, {0x2f43, 924, 1},
+  {0x2f44, 925, 1}, {0x2f45, 926, 1}, {0x2f46, 927, 1}, {0x2f47, 928, 1},
+  {0x2f48, 929, 1}, {0x2f49, 930, 1}, {0x2f4a, 931, 1}, {0x2f4b, 932, 1},
+  {0x2f4c, 933, 1}, {0x2f4d, 934, 1}, {0x2f4e, 935, 1}, {0x2f4f, 936, 1},
+  {0x2f50, 937, 1}, {0x2f51, 938, 1}, {0x2f52, 939, 1}, {0x2f53, 940, 1},
+  {0x2f54, 941, 1}, {0x2f55, 942, 1}, {0x2f56, 943, 1}, {0x2f57, 944, 1},
+  {0x2f58, 945, 1}, {0x2f59, 946, 1}, {0x2f5a, 947, 1}, {0x2f5b, 948, 1},
+  {0x2f5c, 949, 1}, {0x2f5d, 950, 1}, {0x2f5e, 951, 1}, {0x2f5f, 952, 1},
+  {0x2f60, 953, 1}, {0x2f61, 954, 1}, {0x2f62, 955, 1}, {0x2f63, 956, 1},
+  {0x2f64, 957, 1}, {0x2f65, 958, 1}, {0x2f66, 959, 1}, {0x2f67, 960, 1},
+  {0x2f68, 961, 1}, {0x2f69, 962, 1}, {0x2f6a, 963, 1}, {0x2f6b, 964, 1},
+  {0x2f6c, 965, 1}, {0x2f6d, 966, 1}, {0x2f6e, 967, 1}, {0x2f6f, 968, 1},
+  {0x2f70, 969, 1}, {0x2f71, 970, 1}, {0x2f72, 971, 1}, {0x2f73, 972, 1},
+  {0x2f74, 973, 1}, {0x2f75, 974, 1}, {0x2f76, 975, 1}, {0x2f77, 976, 1},
+  {0x2f78, 977, 1}, {0x2f79, 978, 1}, {0x2f7a, 979, 1}, {0x2f7b, 980, 1},
+  {0x2f7c, 981, 1}, {0x2f7d, 982, 1}, {0x2f7e, 983, 1}, {0x2f7f, 984, 1},
+  {0x2f80, 985, 1}, {0x2f81, 986, 1}, {0x2f82, 987, 1}, {0x2f83, 988, 1},
+  {0x2f84, 989, 1}, {0x2f85, 990, 1}, {0x2f86, 991, 1}, {0x2f87, 992, 1},
+  {0x2f88, 993, 1}, {0x2f89, 994, 1}, {0x2f8a, 995, 1}, {0x2f8b, 996, 1},
+  {0x2f8c, 997, 1}, {0x2f8d, 998, 1}, {0x2f8e, 999, 1}, {0x2f8f, 1000, 1},
+  {0x2f90, 1001, 1}, {0x2f91, 1002, 1}, {0x2f92, 1003, 1}, {0x2f93, 1004, 1},
+  {0x2f94, 1005, 1}, {0x2f95, 1006, 1}, {0x2f96, 1007, 1}, {0x2f97, 1008, 1},
+  {0x2f98, 1009, 1}, {0x2f99, 1010, 1}, {0x2f9a, 1011, 1}, {0x2f9b, 1012, 1},
+  {0x2f9c, 1013, 1}, {0x2f9d, 1014, 1}, {0x2f9e, 1015, 1}, {0x2f9f, 1016, 1},
+  {0x2fa0, 1017, 1}, {0x2fa1, 1018, 1}, {0x2fa2, 1019, 1}, {0x2fa3, 1020, 1},
+  {0x2fa4, 1021, 1}, {0x2fa5, 1022, 1}, {0x2fa6, 1023, 1}, {0x2fa7, 1024, 1},
+  {0x2fa8, 1025, 1}, {0x2fa9, 1026, 1}, {0x2faa, 1027, 1}, {0x2fab, 1028, 1},
+  {0x2fac, 1029, 1}, {0x2fad, 1030, 1}, {0x2fae, 1031, 1}, {0x2faf, 1032, 1},
+  {0x2fb0, 1033, 1}, {0x2fb1, 1034, 1}, {0x2fb2, 1035, 1}, {0x2fb3, 1036, 1},
+  {0x2fb4, 1037, 1}, {0x2fb5, 1038, 1}, {0x2fb6, 1039, 1}, {0x2fb7, 1040, 1},
+  {0x2fb8, 1041, 1}, {0x2fb9, 1042, 1}, {0x2fba, 1043, 1}, {0x2fbb, 1044, 1},
+  {0x2fbc, 1045, 1}, {0x2fbd, 1046, 1}, {0x2fbe, 1047, 1}, {0x2fbf, 1048, 1},
+  {0x2fc0, 1049, 1}, {0x2fc1, 1050, 1}, {0x2fc2, 1051, 1}, {0x2fc3, 1052, 1},
+  {0x2fc4, 1053, 1}, {0x2fc5, 1054, 1}, {0x2fc6, 1055, 1}, {0x2fc7, 1056, 1},
+  {0x2fc8, 1057, 1}, {0x2fc9, 1058, 1}, {0x2fca, 1059, 1}, {0x2fcb, 1060, 1},
+  {0x2fcc, 1061, 1}, {0x2fcd, 1062, 1}, {0x2fce, 1063, 1}, {0x2fcf, 1064, 1},
+  {0x2fd0, 1065, 1}, {0x2fd1, 1066, 1}, {0x2fd2, 1067, 1}, {0x2fd3, 1068, 1},
+  {0x2fd4, 1069, 1}, {0x2fd5, 1070, 1}, {0x3000, 1071, 1}, {0x3036, 1072, 1},
+  {0x3038, 1073, 1}, {0x3039, 1074, 1}, {0x303a, 1075, 1}, {0x309b, 1076, 2},
+  {0x309c, 1078, 2}, {0x309f, 1080, 2}, {0x30ff, 1082, 2}, {0x3131, 1084, 1},
+  {0x3132, 1085, 1}, {0x3133, 1086, 1}, {0x3134, 1087, 1}, {0x3135, 1088, 1},
+  {0x3136, 1089, 1}, {0x3137, 1090, 1}, {0x3138, 1091, 1}, {0x3139, 1092, 1},
+  {0x313a, 1093, 1}, {0x313b, 1094, 1}, {0x313c, 1095, 1}, {0x313d, 1096, 1},
+  {0x313e, 1097, 1}, {0x313f, 1098, 1}, {0x3140, 1099, 1}, {0x3141, 1100, 1},
+  {0x3142, 1101, 1}, {0x3143, 1102, 1}, {0x3144, 1103, 1}, {0x3145, 1104, 1},
+  {0x3146, 1105, 1}, {0x3147, 1106, 1}, {0x3148, 1107, 1}, {0x3149, 1108, 1},
+  {0x314a, 1109, 1}, {0x314b, 1110, 1}, {0x314c, 1111, 1}, {0x314d, 1112, 1},
+  {0x314e, 1113, 1}, {0x314f, 1114, 1}, {0x3150, 1115, 1}, {0x3151, 1116, 1},
+  {0x3152, 1117, 1}, {0x3153, 1118, 1}, {0x3154, 1119, 1}, {0x3155, 1120, 1},
+  {0x3156, 1121, 1}, {0x3157, 1122, 1}, {0x3158, 1123, 1}, {0x3159, 1124, 1},
+  {0x315a, 1125, 1}, {0x315b, 1126, 1}, {0x315c, 1127, 1}, {0x315d, 1128, 1},
+  {0x315e, 1129, 1}, {0x315f, 1130, 1}, {0x3160, 1131, 1}, {0x3161, 1132, 1},
+  {0x3162, 1133, 1}, {0x3163, 1134, 1}, {0x3164, 1135, 1}, {0x3165, 1136, 1},
+  {0x3166, 1137, 1}, {0x3167, 1138, 1}, {0x3168, 1139, 1}, {0x3169, 1140, 1},
+  {0x316a, 1141, 1}, {0x316b, 1142, 1}, {0x316c, 1143, 1}, {0x316d, 1144, 1},
+  {0x316e, 1145, 1}, {0x316f, 1146, 1}, {0x3170, 1147, 1}, {0x3171, 1148, 1},
+  {0x3172, 1149, 1}, {0x3173, 1150, 1}, {0x3174, 1151, 1}, {0x3175, 1152, 1},
+  {0x3176, 1153, 1}, {0x3177, 1154, 1}, {0x3178, 1155, 1}, {0x3179, 1156, 1},
+  {0x317a, 1157, 1}, {0x317b, 1158, 1}, {0x317c, 1159, 1}, {0x317d, 1160, 1},
+  {0x317e, 1161, 1}, {0x317f, 1162, 1}, {0x3180, 1163, 1}, {0x3181, 1164, 1},
+  {0x3182, 1165, 1}, {0x3183, 1166, 1}, {0x3184, 1167, 1}, {0x3185, 1168, 1},
+  {0x3186, 1169, 1}, {0x3187, 1170, 1}, {0x3188, 1171, 1}, {0x3189, 1172, 1},
+  {0x318a, 1173, 1}, {0x318b, 1174, 1}, {0x318c, 1175, 1}, {0x318d, 1176, 1},
+  {0x318e, 1177, 1}, {0x3192, 1178, 1}, {0x3193, 1179, 1}, {0x3194, 1180, 1},
+  {0x3195, 1181, 1}, {0x3196, 1182, 1}, {0x3197, 1183, 1}, {0x3198, 1184, 1},
+  {0x3199, 1185, 1}, {0x319a, 1186, 1}, {0x319b, 1187, 1}, {0x319c, 1188, 1},
+  {0x319d, 1189, 1}, {0x319e, 1190, 1}, {0x319f, 1191, 1}, {0x3200, 1192, 3},
+  {0x3201, 1195, 3}, {0x3202, 1198, 3}, {0x3203, 1201, 3}, {0x3204, 1204, 3},
+  {0x3205, 1207, 3}, {0x3206, 1210, 3}, {0x3207, 1213, 3}, {0x3208, 1216, 3},
+  {0x3209, 1219, 3}, {0x320a, 1222, 3}, {0x320b, 1225, 3}, {0x320c, 1228, 3},
+  {0x320d, 1231, 3}, {0x320e, 1234, 4}, {0x320f, 1238, 4}, {0x3210, 1242, 4},
+  {0x3211, 1246, 4}, {0x3212, 1250, 4}, {0x3213, 1254, 4}, {0x3214, 1258, 4},
+  {0x3215, 1262, 4}, {0x3216, 1266, 4}, {0x3217, 1270, 4}, {0x3218, 1274, 4},
+  {0x3219, 1278, 4}, {0x321a, 1282, 4}, {0x321b, 1286, 4}, {0x321c, 1290, 4},
+  {0x321d, 1294, 7}, {0x321e, 1301, 6}, {0x3220, 1307, 3}, {0x3221, 1310, 3},
+  {0x3222, 1313, 3}, {0x3223, 1316, 3}, {0x3224, 1319, 3}, {0x3225, 1322, 3},
+  {0x3226, 1325, 3}, {0x3227, 1328, 3}, {0x3228, 1331, 3}, {0x3229, 1334, 3},
+  {0x322a, 1337, 3}, {0x322b, 1340, 3}, {0x322c, 1343, 3}, {0x322d, 1346, 3},
+  {0x322e, 1349, 3}, {0x322f, 1352, 3}, {0x3230, 1355, 3}, {0x3231, 1358, 3},
+  {0x3232, 1361, 3}, {0x3233, 1364, 3}, {0x3234, 1367, 3}, {0x3235, 1370, 3},
+  {0x3236, 1373, 3}, {0x3237, 1376, 3}, {0x3238, 1379, 3}, {0x3239, 1382, 3},
+  {0x323a, 1385, 3}, {0x323b, 1388, 3}, {0x323c, 1391, 3}, {0x323d, 1394, 3},
+  {0x323e, 1397, 3}, {0x323f, 1400, 3}, {0x3240, 1403, 3}, {0x3241, 1406, 3},
+  {0x3242, 1409, 3}, {0x3243, 1412, 3}, {0x3244, 1415, 1}, {0x3245, 1416, 1},
+  {0x3246, 1417, 1}, {0x3247, 1418, 1}, {0x3250, 1419, 3}, {0x3251, 1422, 2},
+  {0x3252, 1424, 2}, {0x3253, 1426, 2}, {0x3254, 1428, 2}, {0x3255, 1430, 2},
+  {0x3256, 1432, 2}, {0x3257, 1434, 2}, {0x3258, 1436, 2}, {0x3259, 1438, 2},
+  {0x325a, 1440, 2}, {0x325b, 1442, 2}, {0x325c, 1444, 2}, {0x325d, 1446, 2},
+  {0x325e, 1448, 2}, {0x325f, 1450, 2}, {0x3260, 1452, 1}, {0x3261, 1453, 1},
+  {0x3262, 1454, 1}, {0x3263, 1455, 1}, {0x3264, 1456, 1}, {0x3265, 1457, 1},
+  {0x3266, 1458, 1}, {0x3267, 1459, 1}, {0x3268, 1460, 1}, {0x3269, 1461, 1},
+  {0x326a, 1462, 1}, {0x326b, 1463, 1}, {0x326c, 1464, 1}, {0x326d, 1465, 1},
+  {0x326e, 1466, 2}, {0x326f, 1468, 2}, {0x3270, 1470, 2}, {0x3271, 1472, 2},
+  {0x3272, 1474, 2}, {0x3273, 1476, 2}, {0x3274, 1478, 2}, {0x3275, 1480, 2},
+  {0x3276, 1482, 2}, {0x3277, 1484, 2}, {0x3278, 1486, 2}, {0x3279, 1488, 2},
+  {0x327a, 1490, 2}, {0x327b, 1492, 2}, {0x327c, 1494, 5}, {0x327d, 1499, 4},
+  {0x327e, 1503, 2}, {0x3280, 1505, 1}, {0x3281, 1506, 1}, {0x3282, 1507, 1},
+  {0x3283, 1508, 1}, {0x3284, 1509, 1}, {0x3285, 1510, 1}, {0x3286, 1511, 1},
+  {0x3287, 1512, 1}, {0x3288, 1513, 1}, {0x3289, 1514, 1}, {0x328a, 1515, 1},
+  {0x328b, 1516, 1}, {0x328c, 1517, 1}, {0x328d, 1518, 1}, {0x328e, 1519, 1},
+  {0x328f, 1520, 1}, {0x3290, 1521, 1}, {0x3291, 1522, 1}, {0x3292, 1523, 1},
+  {0x3293, 1524, 1}, {0x3294, 1525, 1}, {0x3295, 1526, 1}, {0x3296, 1527, 1},
+  {0x3297, 1528, 1}, {0x3298, 1529, 1}, {0x3299, 1530, 1}, {0x329a, 1531, 1},
+  {0x329b, 1532, 1}, {0x329c, 1533, 1}, {0x329d, 1534, 1}, {0x329e, 1535, 1},
+  {0x329f, 1536, 1}, {0x32a0, 1537, 1}, {0x32a1, 1538, 1}, {0x32a2, 1539, 1},
+  {0x32a3, 1540, 1}, {0x32a4, 1541, 1}, {0x32a5, 1542, 1}, {0x32a6, 1543, 1},
+  {0x32a7, 1544, 1}, {0x32a8, 1545, 1}, {0x32a9, 1546, 1}, {0x32aa, 1547, 1},
+  {0x32ab, 1548, 1}, {0x32ac, 1549, 1}, {0x32ad, 1550, 1}, {0x32ae, 1551, 1},
+  {0x32af, 1552, 1}, {0x32b0, 1553, 1}, {0x32b1, 1554, 2}, {0x32b2, 1556, 2},
+  {0x32b3, 1558, 2}, {0x32b4, 1560, 2}, {0x32b5, 1562, 2}, {0x32b6, 1564, 2},
+  {0x32b7, 1566, 2}, {0x32b8, 1568, 2}, {0x32b9, 1570, 2}, {0x32ba, 1572, 2},
+  {0x32bb, 1574, 2}, {0x32bc, 1576, 2}, {0x32bd, 1578, 2}, {0x32be, 1580, 2},
+  {0x32bf, 1582, 2}, {0x32c0, 1584, 2}, {0x32c1, 1586, 2}, {0x32c2, 1588, 2},
+  {0x32c3, 1590, 2}, {0x32c4, 1592, 2}, {0x32c5, 1594, 2}, {0x32c6, 1596, 2},
+  {0x32c7, 1598, 2}, {0x32c8, 1600, 2}, {0x32c9, 1602, 3}, {0x32ca, 1605, 3},
+  {0x32cb, 1608, 3}, {0x32cc, 1611, 2}, {0x32cd, 1613, 3}, {0x32ce, 1616, 2},
+  {0x32cf, 1618, 3}, {0x32d0, 1621, 1}, {0x32d1, 1622, 1}, {0x32d2, 1623, 1},
+  {0x32d3, 1624, 1}, {0x32d4, 1625, 1}, {0x32d5, 1626, 1}, {0x32d6, 1627, 1},
+  {0x32d7, 1628, 1}, {0x32d8, 1629, 1}, {0x32d9, 1630, 1}, {0x32da, 1631, 1},
+  {0x32db, 1632, 1}, {0x32dc, 1633, 1}, {0x32dd, 1634, 1}, {0x32de, 1635, 1},
+  {0x32df, 1636, 1}, {0x32e0, 1637, 1}, {0x32e1, 1638, 1}, {0x32e2, 1639, 1},
+  {0x32e3, 1640, 1}, {0x32e4, 1641, 1}, {0x32e5, 1642, 1}, {0x32e6, 1643, 1},
+  {0x32e7, 1644, 1}, {0x32e8, 1645, 1}, {0x32e9, 1646, 1}, {0x32ea, 1647, 1},
+  {0x32eb, 1648, 1}, {0x32ec, 1649, 1}, {0x32ed, 1650, 1}, {0x32ee, 1651, 1},
+  {0x32ef, 1652, 1}, {0x32f0, 1653, 1}, {0x32f1, 1654, 1}, {0x32f2, 1655, 1},
+  {0x32f3, 1656, 1}, {0x32f4, 1657, 1}, {0x32f5, 1658, 1}, {0x32f6, 1659, 1},
+  {0x32f7, 1660, 1}, {0x32f8, 1661, 1}, {0x32f9, 1662, 1}, {0x32fa, 1663, 1},
+  {0x32fb, 1664, 1}, {0x32fc, 1665, 1}, {0x32fd, 1666, 1}, {0x32fe, 1667, 1},
+  {0x32ff, 1668, 2}, {0x3300, 1670, 5}, {0x3301, 1675, 4}, {0x3302, 1679, 5},
+  {0x3303, 1684, 3}, {0x3304, 1687, 5}, {0x3305, 1692, 3}, {0x3306, 1695, 3},
+  {0x3307, 1698, 6}, {0x3308, 1704, 4}, {0x3309, 1708, 3}, {0x330a, 1711, 3},
+  {0x330b, 1714, 3}, {0x330c, 1717, 4}, {0x330d, 1721, 4}, {0x330e, 1725, 4},
+  {0x330f, 1729, 4}, {0x3310, 1733, 4}, {0x3311, 1737, 4}, {0x3312, 1741, 4},
+  {0x3313, 1745, 6}, {0x3314, 1751, 2}, {0x3315, 1753, 6}, {0x3316, 1759, 6},
+  {0x3317, 1765, 5}, {0x3318, 1770, 4}, {0x3319, 1774, 6}, {0x331a, 1780, 6},
+  {0x331b, 1786, 4}, {0x331c, 1790, 3}, {0x331d, 1793, 3}, {0x331e, 1796, 4},
+  {0x331f, 1800, 4}, {0x3320, 1804, 5}, {0x3321, 1809, 5}, {0x3322, 1814, 3},
+  {0x3323, 1817, 3}, {0x3324, 1820, 4}, {0x3325, 1824, 3}, {0x3326, 1827, 3},
+  {0x3327, 1830, 2}, {0x3328, 1832, 2}, {0x3329, 1834, 3}, {0x332a, 1837, 3},
+  {0x332b, 1840, 6}, {0x332c, 1846, 4}, {0x332d, 1850, 5}, {0x332e, 1855, 6},
+  {0x332f, 1861, 4}, {0x3330, 1865, 3}, {0x3331, 1868, 3}, {0x3332, 1871, 6},
+  {0x3333, 1877, 4}, {0x3334, 1881, 6}, {0x3335, 1887, 3}, {0x3336, 1890, 5},
+  {0x3337, 1895, 3}, {0x3338, 1898, 4}, {0x3339, 1902, 3}, {0x333a, 1905, 4},
+  {0x333b, 1909, 5}, {0x333c, 1914, 4}, {0x333d, 1918, 5}, {0x333e, 1923, 4},
+  {0x333f, 1927, 2}, {0x3340, 1929, 5}, {0x3341, 1934, 3}, {0x3342, 1937, 3},
+  {0x3343, 1940, 4}, {0x3344, 1944, 3}, {0x3345, 1947, 3}, {0x3346, 1950, 3},
+  {0x3347, 1953, 5}, {0x3348, 1958, 4}, {0x3349, 1962, 2}, {0x334a, 1964, 6},
+  {0x334b, 1970, 3}, {0x334c, 1973, 5}, {0x334d, 1978, 4}, {0x334e, 1982, 4},
+  {0x334f, 1986, 3}, {0x3350, 1989, 3}, {0x3351, 1992, 4}, {0x3352, 1996, 2},
+  {0x3353, 1998, 4}, {0x3354, 2002, 5}, {0x3355, 2007, 2}, {0x3356, 2009, 6},
+  {0x3357, 2015, 3}, {0x3358, 2018, 2}, {0x3359, 2020, 2}, {0x335a, 2022, 2},
+  {0x335b, 2024, 2}, {0x335c, 2026, 2}, {0x335d, 2028, 2}, {0x335e, 2030, 2},
+  {0x335f, 2032, 2}, {0x3360, 2034, 2}, {0x3361, 2036, 2}, {0x3362, 2038, 3},
+  {0x3363, 2041, 3}, {0x3364, 2044, 3}, {0x3365, 2047, 3}, {0x3366, 2050, 3},
+  {0x3367, 2053, 3}, {0x3368, 2056, 3}, {0x3369, 2059, 3}, {0x336a, 2062, 3},
+  {0x336b, 2065, 3}, {0x336c, 2068, 3}, {0x336d, 2071, 3}, {0x336e, 2074, 3},
+  {0x336f, 2077, 3}, {0x3370, 2080, 3}, {0x3371, 2083, 3}, {0x3372, 2086, 2},
+  {0x3373, 2088, 2}, {0x3374, 2090, 3}, {0x3375, 2093, 2}, {0x3376, 2095, 2},
+  {0x3377, 2097, 2}, {0x3378, 2099, 3}, {0x3379, 2102, 3}, {0x337a, 2105, 2},
+  {0x337b, 2107, 2}, {0x337c, 2109, 2}, {0x337d, 2111, 2}, {0x337e, 2113, 2},
+  {0x337f, 2115, 4}, {0x3380, 2119, 2}, {0x3381, 2121, 2}, {0x3382, 2123, 2},
+  {0x3383, 2125, 2}, {0x3384, 2127, 2}, {0x3385, 2129, 2}, {0x3386, 2131, 2},
+  {0x3387, 2133, 2}, {0x3388, 2135, 3}, {0x3389, 2138, 4}, {0x338a, 2142, 2},
+  {0x338b, 2144, 2}, {0x338c, 2146, 2}, {0x338d, 2148, 2}, {0x338e, 2150, 2},
+  {0x338f, 2152, 2}, {0x3390, 2154, 2}, {0x3391, 2156, 3}, {0x3392, 2159, 3},
+  {0x3393, 2162, 3}, {0x3394, 2165, 3}, {0x3395, 2168, 2}, {0x3396, 2170, 2},
+  {0x3397, 2172, 2}, {0x3398, 2174, 2}, {0x3399, 2176, 2}, {0x339a, 2178, 2},
+  {0x339b, 2180, 2}, {0x339c, 2182, 2}, {0x339d, 2184, 2}, {0x339e, 2186, 2},
+  {0x339f, 2188, 3}, {0x33a0, 2191, 3}, {0x33a1, 2194, 2}, {0x33a2, 2196, 3},
+  {0x33a3, 2199, 3}, {0x33a4, 2202, 3}, {0x33a5, 2205, 2}, {0x33a6, 2207, 3},
+  {0x33a7, 2210, 3}, {0x33a8, 2213, 4}, {0x33a9, 2217, 2}, {0x33aa, 2219, 3},
+  {0x33ab, 2222, 3}, {0x33ac, 2225, 3}, {0x33ad, 2228, 3}, {0x33ae, 2231, 5},
+  {0x33af, 2236, 6}, {0x33b0, 2242, 2}, {0x33b1, 2244, 2}, {0x33b2, 2246, 2},
+  {0x33b3, 2248, 2}, {0x33b4, 2250, 2}, {0x33b5, 2252, 2}, {0x33b6, 2254, 2},
+  {0x33b7, 2256, 2}, {0x33b8, 2258, 2}, {0x33b9, 2260, 2}, {0x33ba, 2262, 2},
+  {0x33bb, 2264, 2}, {0x33bc, 2266, 2}, {0x33bd, 2268, 2}, {0x33be, 2270, 2},
+  {0x33bf, 2272, 2}, {0x33c0, 2274, 2}, {0x33c1, 2276, 2}, {0x33c2, 2278, 4},
+  {0x33c3, 2282, 2}, {0x33c4, 2284, 2}, {0x33c5, 2286, 2}, {0x33c6, 2288, 4},
+  {0x33c7, 2292, 3}, {0x33c8, 2295, 2}, {0x33c9, 2297, 2}, {0x33ca, 2299, 2},
+  {0x33cb, 2301, 2}, {0x33cc, 2303, 2}, {0x33cd, 2305, 2}, {0x33ce, 2307, 2},
+  {0x33cf, 2309, 2}, {0x33d0, 2311, 2}, {0x33d1, 2313, 2}, {0x33d2, 2315, 3},
+  {0x33d3, 2318, 2}, {0x33d4, 2320, 2}, {0x33d5, 2322, 3}, {0x33d6, 2325, 3},
+  {0x33d7, 2328, 2}, {0x33d8, 2330, 4}, {0x33d9, 2334, 3}, {0x33da, 2337, 2},
+  {0x33db, 2339, 2}, {0x33dc, 2341, 2}, {0x33dd, 2343, 2}, {0x33de, 2345, 3},
+  {0x33df, 2348, 3}, {0x33e0, 2351, 2}, {0x33e1, 2353, 2}, {0x33e2, 2355, 2},
+  {0x33e3, 2357, 2}, {0x33e4, 2359, 2}, {0x33e5, 2361, 2}, {0x33e6, 2363, 2},
+  {0x33e7, 2365, 2}, {0x33e8, 2367, 2}, {0x33e9, 2369, 3}, {0x33ea, 2372, 3},
+  {0x33eb, 2375, 3}, {0x33ec, 2378, 3}, {0x33ed, 2381, 3}, {0x33ee, 2384, 3},
+  {0x33ef, 2387, 3}, {0x33f0, 2390, 3}, {0x33f1, 2393, 3}, {0x33f2, 2396, 3},
+  {0x33f3, 2399, 3}, {0x33f4, 2402, 3}, {0x33f5, 2405, 3}, {0x33f6, 2408, 3},
+  {0x33f7, 2411, 3}, {0x33f8, 2414, 3}, {0x33f9, 2417, 3}, {0x33fa, 2420, 3},
+  {0x33fb, 2423, 3}, {0x33fc, 2426, 3}, {0x33fd, 2429, 3}, {0x33fe, 2432, 3},
+  {0x33ff, 2435, 3}, {0xa69c, 2438, 1}, {0xa69d, 2439, 1}, {0xa770, 2440, 1},
+  {0xa7f2, 2441, 1}, {0xa7f3, 2442, 1}, {0xa7f4, 2443, 1}, {0xa7f8, 2444, 1},
+  {0xa7f9, 2445, 1}, {0xab5c, 2446, 1}, {0xab5d, 2447, 1}, {0xab5e, 2448, 1},
+  {0xab5f, 2449, 1}, {0xab69, 2450, 1}, {0xfb00, 2451, 2}, {0xfb01, 2453, 2},
+  {0xfb02, 2455, 2}, {0xfb03, 2457, 3}, {0xfb04, 2460, 3}, {0xfb05, 2463, 2},
+  {0xfb06, 2465, 2}, {0xfb13, 2467, 2}, {0xfb14, 2469, 2}, {0xfb15, 2471, 2},
+  {0xfb16, 2473, 2}, {0xfb17, 2475, 2}, {0xfb20, 2477, 1}, {0xfb21, 2478, 1},
+  {0xfb22, 2479, 1}, {0xfb23, 2480, 1}, {0xfb24, 2481, 1}, {0xfb25, 2482, 1},
+  {0xfb26, 2483, 1}, {0xfb27, 2484, 1}, {0xfb28, 2485, 1}, {0xfb29, 2486, 1},
+  {0xfb4f, 2487, 2}, {0xfb50, 2489, 1}, {0xfb51, 2490, 1}, {0xfb52, 2491, 1},
+  {0xfb53, 2492, 1}, {0xfb54, 2493, 1}, {0xfb55, 2494, 1}, {0xfb56, 2495, 1},
+  {0xfb57, 2496, 1}, {0xfb58, 2497, 1}, {0xfb59, 2498, 1}, {0xfb5a, 2499, 1},
+  {0xfb5b, 2500, 1}, {0xfb5c, 2501, 1}, {0xfb5d, 2502, 1}, {0xfb5e, 2503, 1},
+  {0xfb5f, 2504, 1}, {0xfb60, 2505, 1}, {0xfb61, 2506, 1}, {0xfb62, 2507, 1},
+  {0xfb63, 2508, 1}, {0xfb64, 2509, 1}, {0xfb65, 2510, 1}, {0xfb66, 2511, 1},
+  {0xfb67, 2512, 1}, {0xfb68, 2513, 1}, {0xfb69, 2514, 1}, {0xfb6a, 2515, 1},
+  {0xfb6b, 2516, 1}, {0xfb6c, 2517, 1}, {0xfb6d, 2518, 1}, {0xfb6e, 2519, 1},
+  {0xfb6f, 2520, 1}, {0xfb70, 2521, 1}, {0xfb71, 2522, 1}, {0xfb72, 2523, 1},
+  {0xfb73, 2524, 1}, {0xfb74, 2525, 1}, {0xfb75, 2526, 1}, {0xfb76, 2527, 1},
+  {0xfb77, 2528, 1}, {0xfb78, 2529, 1}, {0xfb79, 2530, 1}, {0xfb7a, 2531, 1},
+  {0xfb7b, 2532, 1}, {0xfb7c, 2533, 1}, {0xfb7d, 2534, 1}, {0xfb7e, 2535, 1},
+  {0xfb7f, 2536, 1}, {0xfb80, 2537, 1}, {0xfb81, 2538, 1}, {0xfb82, 2539, 1},
+  {0xfb83, 2540, 1}, {0xfb84, 2541, 1}, {0xfb85, 2542, 1}, {0xfb86, 2543, 1},
+  {0xfb87, 2544, 1}, {0xfb88, 2545, 1}, {0xfb89, 2546, 1}, {0xfb8a, 2547, 1},
+  {0xfb8b, 2548, 1}, {0xfb8c, 2549, 1}, {0xfb8d, 2550, 1}, {0xfb8e, 2551, 1},
+  {0xfb8f, 2552, 1}, {0xfb90, 2553, 1}, {0xfb91, 2554, 1}, {0xfb92, 2555, 1},
+  {0xfb93, 2556, 1}, {0xfb94, 2557, 1}, {0xfb95, 2558, 1}, {0xfb96, 2559, 1},
+  {0xfb97, 2560, 1}, {0xfb98, 2561, 1}, {0xfb99, 2562, 1}, {0xfb9a, 2563, 1},
+  {0xfb9b, 2564, 1}, {0xfb9c, 2565, 1}, {0xfb9d, 2566, 1}, {0xfb9e, 2567, 1},
+  {0xfb9f, 2568, 1}, {0xfba0, 2569, 1}, {0xfba1, 2570, 1}, {0xfba2, 2571, 1},
+  {0xfba3, 2572, 1}, {0xfba4, 2573, 2}, {0xfba5, 2575, 2}, {0xfba6, 2577, 1},
+  {0xfba7, 2578, 1}, {0xfba8, 2579, 1}, {0xfba9, 2580, 1}, {0xfbaa, 2581, 1},
+  {0xfbab, 2582, 1}, {0xfbac, 2583, 1}, {0xfbad, 2584, 1}, {0xfbae, 2585, 1},
+  {0xfbaf, 2586, 1}, {0xfbb0, 2587, 2}, {0xfbb1, 2589, 2}, {0xfbd3, 2591, 1},
+  {0xfbd4, 2592, 1}, {0xfbd5, 2593, 1}, {0xfbd6, 2594, 1}, {0xfbd7, 2595, 1},
+  {0xfbd8, 2596, 1}, {0xfbd9, 2597, 1}, {0xfbda, 2598, 1}, {0xfbdb, 2599, 1},
+  {0xfbdc, 2600, 1}, {0xfbdd, 2601, 2}, {0xfbde, 2603, 1}, {0xfbdf, 2604, 1},
+  {0xfbe0, 2605, 1}, {0xfbe1, 2606, 1}, {0xfbe2, 2607, 1}, {0xfbe3, 2608, 1},
+  {0xfbe4, 2609, 1}, {0xfbe5, 2610, 1}, {0xfbe6, 2611, 1}, {0xfbe7, 2612, 1},
+  {0xfbe8, 2613, 1}, {0xfbe9, 2614, 1}, {0xfbea, 2615, 3}, {0xfbeb, 2618, 3},
+  {0xfbec, 2621, 3}, {0xfbed, 2624, 3}, {0xfbee, 2627, 3}, {0xfbef, 2630, 3},
+  {0xfbf0, 2633, 3}, {0xfbf1, 2636, 3}, {0xfbf2, 2639, 3}, {0xfbf3, 2642, 3},
+  {0xfbf4, 2645, 3}, {0xfbf5, 2648, 3}, {0xfbf6, 2651, 3}, {0xfbf7, 2654, 3},
+  {0xfbf8, 2657, 3}, {0xfbf9, 2660, 3}, {0xfbfa, 2663, 3}, {0xfbfb, 2666, 3},
+  {0xfbfc, 2669, 1}, {0xfbfd, 2670, 1}, {0xfbfe, 2671, 1}, {0xfbff, 2672, 1},
+  {0xfc00, 2673, 3}, {0xfc01, 2676, 3}, {0xfc02, 2679, 3}, {0xfc03, 2682, 3},
+  {0xfc04, 2685, 3}, {0xfc05, 2688, 2}, {0xfc06, 2690, 2}, {0xfc07, 2692, 2},
+  {0xfc08, 2694, 2}, {0xfc09, 2696, 2}, {0xfc0a, 2698, 2}, {0xfc0b, 2700, 2},
+  {0xfc0c, 2702, 2}, {0xfc0d, 2704, 2}, {0xfc0e, 2706, 2}, {0xfc0f, 2708, 2},
+  {0xfc10, 2710, 2}, {0xfc11, 2712, 2}, {0xfc12, 2714, 2}, {0xfc13, 2716, 2},
+  {0xfc14, 2718, 2}, {0xfc15, 2720, 2}, {0xfc16, 2722, 2}, {0xfc17, 2724, 2},
+  {0xfc18, 2726, 2}, {0xfc19, 2728, 2}, {0xfc1a, 2730, 2}, {0xfc1b, 2732, 2},
+  {0xfc1c, 2734, 2}, {0xfc1d, 2736, 2}, {0xfc1e, 2738, 2}, {0xfc1f, 2740, 2},
+  {0xfc20, 2742, 2}, {0xfc21, 2744, 2}, {0xfc22, 2746, 2}, {0xfc23, 2748, 2},
+  {0xfc24, 2750, 2}, {0xfc25, 2752, 2}, {0xfc26, 2754, 2}, {0xfc27, 2756, 2},
+  {0xfc28, 2758, 2}, {0xfc29, 2760, 2}, {0xfc2a, 2762, 2}, {0xfc2b, 2764, 2},
+  {0xfc2c, 2766, 2}, {0xfc2d, 2768, 2}, {0xfc2e, 2770, 2}, {0xfc2f, 2772, 2},
+  {0xfc30, 2774, 2}, {0xfc31, 2776, 2}, {0xfc32, 2778, 2}, {0xfc33, 2780, 2},
+  {0xfc34, 2782, 2}, {0xfc35, 2784, 2}, {0xfc36, 2786, 2}, {0xfc37, 2788, 2},
+  {0xfc38, 2790, 2}, {0xfc39, 2792, 2}, {0xfc3a, 2794, 2}, {0xfc3b, 2796, 2},
+  {0xfc3c, 2798, 2}, {0xfc3d, 2800, 2}, {0xfc3e, 2802, 2}, {0xfc3f, 2804, 2},
+  {0xfc40, 2806, 2}, {0xfc41, 2808, 2}, {0xfc42, 2810, 2}, {0xfc43, 2812, 2},
+  {0xfc44, 2814, 2}, {0xfc45, 2816, 2}, {0xfc46, 2818, 2}, {0xfc47, 2820, 2},
+  {0xfc48, 2822, 2}, {0xfc49, 2824, 2}, {0xfc4a, 2826, 2}, {0xfc4b, 2828, 2},
+  {0xfc4c, 2830, 2}, {0xfc4d, 2832, 2}, {0xfc4e, 2834, 2}, {0xfc4f, 2836, 2},
+  {0xfc50, 2838, 2}, {0xfc51, 2840, 2}, {0xfc52, 2842, 2}, {0xfc53, 2844, 2},
+  {0xfc54, 2846, 2}, {0xfc55, 2848, 2}, {0xfc56, 2850, 2}, {0xfc57, 2852, 2},
+  {0xfc58, 2854, 2}, {0xfc59, 2856, 2}, {0xfc5a, 2858, 2}, {0xfc5b, 2860, 2},
+  {0xfc5c, 2862, 2}, {0xfc5d, 2864, 2}, {0xfc5e, 2866, 3}, {0xfc5f, 2869, 3},
+  {0xfc60, 2872, 3}, {0xfc61, 2875, 3}, {0xfc62, 2878, 3}, {0xfc63, 2881, 3},
+  {0xfc64, 2884, 3}, {0xfc65, 2887, 3}, {0xfc66, 2890, 3}, {0xfc67, 2893, 3},
+  {0xfc68, 2896, 3}, {0xfc69, 2899, 3}, {0xfc6a, 2902, 2}, {0xfc6b, 2904, 2},
+  {0xfc6c, 2906, 2}, {0xfc6d, 2908, 2}, {0xfc6e, 2910, 2}, {0xfc6f, 2912, 2},
+  {0xfc70, 2914, 2}, {0xfc71, 2916, 2}, {0xfc72, 2918, 2}, {0xfc73, 2920, 2},
+  {0xfc74, 2922, 2}, {0xfc75, 2924, 2}, {0xfc76, 2926, 2}, {0xfc77, 2928, 2},
+  {0xfc78, 2930, 2}, {0xfc79, 2932, 2}, {0xfc7a, 2934, 2}, {0xfc7b, 2936, 2},
+  {0xfc7c, 2938, 2}, {0xfc7d, 2940, 2}, {0xfc7e, 2942, 2}, {0xfc7f, 2944, 2},
+  {0xfc80, 2946, 2}, {0xfc81, 2948, 2}, {0xfc82, 2950, 2}, {0xfc83, 2952, 2},
+  {0xfc84, 2954, 2}, {0xfc85, 2956, 2}, {0xfc86, 2958, 2}, {0xfc87, 2960, 2},
+  {0xfc88, 2962, 2}, {0xfc89, 2964, 2}, {0xfc8a, 2966, 2}, {0xfc8b, 2968, 2},
+  {0xfc8c, 2970, 2}, {0xfc8d, 2972, 2}, {0xfc8e, 2974, 2}, {0xfc8f, 2976, 2},
+  {0xfc90, 2978, 2}, {0xfc91, 2980, 2}, {0xfc92, 2982, 2}, {0xfc93, 2984, 2},
+  {0xfc94, 2986, 2}, {0xfc95, 2988, 2}, {0xfc96, 2990, 2}, {0xfc97, 2992, 3},
+  {0xfc98, 2995, 3}, {0xfc99, 2998, 3}, {0xfc9a, 3001, 3}, {0xfc9b, 3004, 3},
+  {0xfc9c, 3007, 2}, {0xfc9d, 3009, 2}, {0xfc9e, 3011, 2}, {0xfc9f, 3013, 2},
+  {0xfca0, 3015, 2}, {0xfca1, 3017, 2}, {0xfca2, 3019, 2}, {0xfca3, 3021, 2},
+  {0xfca4, 3023, 2}, {0xfca5, 3025, 2}, {0xfca6, 3027, 2}, {0xfca7, 3029, 2},
+  {0xfca8, 3031, 2}, {0xfca9, 3033, 2}, {0xfcaa, 3035, 2}, {0xfcab, 3037, 2},
+  {0xfcac, 3039, 2}, {0xfcad, 3041, 2}, {0xfcae, 3043, 2}, {0xfcaf, 3045, 2},
+  {0xfcb0, 3047, 2}, {0xfcb1, 3049, 2}, {0xfcb2, 3051, 2}, {0xfcb3, 3053, 2},
+  {0xfcb4, 3055, 2}, {0xfcb5, 3057, 2}, {0xfcb6, 3059, 2}, {0xfcb7, 3061, 2},
+  {0xfcb8, 3063, 2}, {0xfcb9, 3065, 2}, {0xfcba, 3067, 2}, {0xfcbb, 3069, 2},
+  {0xfcbc, 3071, 2}, {0xfcbd, 3073, 2}, {0xfcbe, 3075, 2}, {0xfcbf, 3077, 2},
+  {0xfcc0, 3079, 2}, {0xfcc1, 3081, 2}, {0xfcc2, 3083, 2}, {0xfcc3, 3085, 2},
+  {0xfcc4, 3087, 2}, {0xfcc5, 3089, 2}, {0xfcc6, 3091, 2}, {0xfcc7, 3093, 2},
+  {0xfcc8, 3095, 2}, {0xfcc9, 3097, 2}, {0xfcca, 3099, 2}, {0xfccb, 3101, 2},
+  {0xfccc, 3103, 2}, {0xfccd, 3105, 2}, {0xfcce, 3107, 2}, {0xfccf, 3109, 2},
+  {0xfcd0, 3111, 2}, {0xfcd1, 3113, 2}, {0xfcd2, 3115, 2}, {0xfcd3, 3117, 2},
+  {0xfcd4, 3119, 2}, {0xfcd5, 3121, 2}, {0xfcd6, 3123, 2}, {0xfcd7, 3125, 2},
+  {0xfcd8, 3127, 2}, {0xfcd9, 3129, 2}, {0xfcda, 3131, 2}, {0xfcdb, 3133, 2},
+  {0xfcdc, 3135, 2}, {0xfcdd, 3137, 2}, {0xfcde, 3139, 2}, {0xfcdf, 3141, 3},
+  {0xfce0, 3144, 3}, {0xfce1, 3147, 2}, {0xfce2, 3149, 2}, {0xfce3, 3151, 2},
+  {0xfce4, 3153, 2}, {0xfce5, 3155, 2}, {0xfce6, 3157, 2}, {0xfce7, 3159, 2},
+  {0xfce8, 3161, 2}, {0xfce9, 3163, 2}, {0xfcea, 3165, 2}, {0xfceb, 3167, 2},
+  {0xfcec, 3169, 2}, {0xfced, 3171, 2}, {0xfcee, 3173, 2}, {0xfcef, 3175, 2},
+  {0xfcf0, 3177, 2}, {0xfcf1, 3179, 2}, {0xfcf2, 3181, 3}, {0xfcf3, 3184, 3},
+  {0xfcf4, 3187, 3}, {0xfcf5, 3190, 2}, {0xfcf6, 3192, 2}, {0xfcf7, 3194, 2},
+  {0xfcf8, 3196, 2}, {0xfcf9, 3198, 2}, {0xfcfa, 3200, 2}, {0xfcfb, 3202, 2},
+  {0xfcfc, 3204, 2}, {0xfcfd, 3206, 2}, {0xfcfe, 3208, 2}, {0xfcff, 3210, 2},
+  {0xfd00, 3212, 2}, {0xfd01, 3214, 2}, {0xfd02, 3216, 2}, {0xfd03, 3218, 2},
+  {0xfd04, 3220, 2}, {0xfd05, 3222, 2}, {0xfd06, 3224, 2}, {0xfd07, 3226, 2},
+  {0xfd08, 3228, 2}, {0xfd09, 3230, 2}, {0xfd0a, 3232, 2}, {0xfd0b, 3234, 2},
+  {0xfd0c, 3236, 2}, {0xfd0d, 3238, 2}, {0xfd0e, 3240, 2}, {0xfd0f, 3242, 2},
+  {0xfd10, 3244, 2}, {0xfd11, 3246, 2}, {0xfd12, 3248, 2}, {0xfd13, 3250, 2},
+  {0xfd14, 3252, 2}, {0xfd15, 3254, 2}, {0xfd16, 3256, 2}, {0xfd17, 3258, 2},
+  {0xfd18, 3260, 2}, {0xfd19, 3262, 2}, {0xfd1a, 3264, 2}, {0xfd1b, 3266, 2},
+  {0xfd1c, 3268, 2}, {0xfd1d, 3270, 2}, {0xfd1e, 3272, 2}, {0xfd1f, 3274, 2},
+  {0xfd20, 3276, 2}, {0xfd21, 3278, 2}, {0xfd22, 3280, 2}, {0xfd23, 3282, 2},
+  {0xfd24, 3284, 2}, {0xfd25, 3286, 2}, {0xfd26, 3288, 2}, {0xfd27, 3290, 2},
+  {0xfd28, 3292, 2}, {0xfd29, 3294, 2}, {0xfd2a, 3296, 2}, {0xfd2b, 3298, 2},
+  {0xfd2c, 3300, 2}, {0xfd2d, 3302, 2}, {0xfd2e, 3304, 2}, {0xfd2f, 3306, 2},
+  {0xfd30, 3308, 2}, {0xfd31, 3310, 2}, {0xfd32, 3312, 2}, {0xfd33, 3314, 2},
+  {0xfd34, 3316, 2}, {0xfd35, 3318, 2}, {0xfd36, 3320, 2}, {0xfd37, 3322, 2},
+  {0xfd38, 3324, 2}, {0xfd39, 3326, 2}, {0xfd3a, 3328, 2}, {0xfd3b, 3330, 2},
+  {0xfd3c, 3332, 2}, {0xfd3d, 3334, 2}, {0xfd50, 3336, 3}, {0xfd51, 3339, 3},
+  {0xfd52, 3342, 3}, {0xfd53, 3345, 3}, {0xfd54, 3348, 3}, {0xfd55, 3351, 3},
+  {0xfd56, 3354, 3}, {0xfd57, 3357, 3}, {0xfd58, 3360, 3}, {0xfd59, 3363, 3},
+  {0xfd5a, 3366, 3}, {0xfd5b, 3369, 3}, {0xfd5c, 3372, 3}, {0xfd5d, 3375, 3},
+  {0xfd5e, 3378, 3}, {0xfd5f, 3381, 3}, {0xfd60, 3384, 3}, {0xfd61, 3387, 3},
+  {0xfd62, 3390, 3}, {0xfd63, 3393, 3}, {0xfd64, 3396, 3}, {0xfd65, 3399, 3},
+  {0xfd66, 3402, 3}, {0xfd67, 3405, 3}, {0xfd68, 3408, 3}, {0xfd69, 3411, 3},
+  {0xfd6a, 3414, 3}, {0xfd6b, 3417, 3}, {0xfd6c, 3420, 3}, {0xfd6d, 3423, 3},
+  {0xfd6e, 3426, 3}, {0xfd6f, 3429, 3}, {0xfd70, 3432, 3}, {0xfd71, 3435, 3},
+  {0xfd72, 3438, 3}, {0xfd73, 3441, 3}, {0xfd74, 3444, 3}, {0xfd75, 3447, 3},
+  {0xfd76, 3450, 3}, {0xfd77, 3453, 3}, {0xfd78, 3456, 3}, {0xfd79, 3459, 3},
+  {0xfd7a, 3462, 3}, {0xfd7b, 3465, 3}, {0xfd7c, 3468, 3}, {0xfd7d, 3471, 3},
+  {0xfd7e, 3474, 3}, {0xfd7f, 3477, 3}, {0xfd80, 3480, 3}, {0xfd81, 3483, 3},
+  {0xfd82, 3486, 3}, {0xfd83, 3489, 3}, {0xfd84, 3492, 3}, {0xfd85, 3495, 3},
+  {0xfd86, 3498, 3}, {0xfd87, 3501, 3}, {0xfd88, 3504, 3}, {0xfd89, 3507, 3},
+  {0xfd8a, 3510, 3}, {0xfd8b, 3513, 3}, {0xfd8c, 3516, 3}, {0xfd8d, 3519, 3},
+  {0xfd8e, 3522, 3}, {0xfd8f, 3525, 3}, {0xfd92, 3528, 3}, {0xfd93, 3531, 3},
+  {0xfd94, 3534, 3}, {0xfd95, 3537, 3}, {0xfd96, 3540, 3}, {0xfd97, 3543, 3},
+  {0xfd98, 3546, 3}, {0xfd99, 3549, 3}, {0xfd9a, 3552, 3}, {0xfd9b, 3555, 3},
+  {0xfd9c, 3558, 3}, {0xfd9d, 3561, 3}, {0xfd9e, 3564, 3}, {0xfd9f, 3567, 3},
+  {0xfda0, 3570, 3}, {0xfda1, 3573, 3}, {0xfda2, 3576, 3}, {0xfda3, 3579, 3},
+  {0xfda4, 3582, 3}, {0xfda5, 3585, 3}, {0xfda6, 3588, 3}, {0xfda7, 3591, 3},
+  {0xfda8, 3594, 3}, {0xfda9, 3597, 3}, {0xfdaa, 3600, 3}, {0xfdab, 3603, 3},
+  {0xfdac, 3606, 3}, {0xfdad, 3609, 3}, {0xfdae, 3612, 3}, {0xfdaf, 3615, 3},
+  {0xfdb0, 3618, 3}, {0xfdb1, 3621, 3}, {0xfdb2, 3624, 3}, {0xfdb3, 3627, 3},
+  {0xfdb4, 3630, 3}, {0xfdb5, 3633, 3}, {0xfdb6, 3636, 3}, {0xfdb7, 3639, 3},
+  {0xfdb8, 3642, 3}, {0xfdb9, 3645, 3}, {0xfdba, 3648, 3}, {0xfdbb, 3651, 3},
+  {0xfdbc, 3654, 3}, {0xfdbd, 3657, 3}, {0xfdbe, 3660, 3}, {0xfdbf, 3663, 3},
+  {0xfdc0, 3666, 3}, {0xfdc1, 3669, 3}, {0xfdc2, 3672, 3}, {0xfdc3, 3675, 3},
+  {0xfdc4, 3678, 3}, {0xfdc5, 3681, 3}, {0xfdc6, 3684, 3}, {0xfdc7, 3687, 3},
+  {0xfdf0, 3690, 3}, {0xfdf1, 3693, 3}, {0xfdf2, 3696, 4}, {0xfdf3, 3700, 4},
+  {0xfdf4, 3704, 4}, {0xfdf5, 3708, 4}, {0xfdf6, 3712, 4}, {0xfdf7, 3716, 4},
+  {0xfdf8, 3720, 4}, {0xfdf9, 3724, 3}, {0xfdfa, 3727, 18}, {0xfdfb, 3745, 8},
+  {0xfdfc, 3753, 4}, {0xfe10, 3757, 1}, {0xfe11, 3758, 1}, {0xfe12, 3759, 1},
+  {0xfe13, 3760, 1}, {0xfe14, 3761, 1}, {0xfe15, 3762, 1}, {0xfe16, 3763, 1},
+  {0xfe17, 3764, 1}, {0xfe18, 3765, 1}, {0xfe19, 3766, 3}, {0xfe30, 3769, 2},
+  {0xfe31, 3771, 1}, {0xfe32, 3772, 1}, {0xfe33, 3773, 1}, {0xfe34, 3774, 1},
+  {0xfe35, 3775, 1}, {0xfe36, 3776, 1}, {0xfe37, 3777, 1}, {0xfe38, 3778, 1},
+  {0xfe39, 3779, 1}, {0xfe3a, 3780, 1}, {0xfe3b, 3781, 1}, {0xfe3c, 3782, 1},
+  {0xfe3d, 3783, 1}, {0xfe3e, 3784, 1}, {0xfe3f, 3785, 1}, {0xfe40, 3786, 1},
+  {0xfe41, 3787, 1}, {0xfe42, 3788, 1}, {0xfe43, 3789, 1}, {0xfe44, 3790, 1},
+  {0xfe47, 3791, 1}, {0xfe48, 3792, 1}, {0xfe49, 3793, 2}, {0xfe4a, 3795, 2},
+  {0xfe4b, 3797, 2}, {0xfe4c, 3799, 2}, {0xfe4d, 3801, 1}, {0xfe4e, 3802, 1},
+  {0xfe4f, 3803, 1}, {0xfe50, 3804, 1}, {0xfe51, 3805, 1}, {0xfe52, 3806, 1},
+  {0xfe54, 3807, 1}, {0xfe55, 3808, 1}, {0xfe56, 3809, 1}, {0xfe57, 3810, 1},
+  {0xfe58, 3811, 1}, {0xfe59, 3812, 1}, {0xfe5a, 3813, 1}, {0xfe5b, 3814, 1},
+  {0xfe5c, 3815, 1}, {0xfe5d, 3816, 1}, {0xfe5e, 3817, 1}, {0xfe5f, 3818, 1},
+  {0xfe60, 3819, 1}, {0xfe61, 3820, 1}, {0xfe62, 3821, 1}, {0xfe63, 3822, 1},
+  {0xfe64, 3823, 1}, {0xfe65, 3824, 1}, {0xfe66, 3825, 1}, {0xfe68, 3826, 1},
+  {0xfe69, 3827, 1}, {0xfe6a, 3828, 1}, {0xfe6b, 3829, 1}, {0xfe70, 3830, 2},
+  {0xfe71, 3832, 2}, {0xfe72, 3834, 2}, {0xfe74, 3836, 2}, {0xfe76, 3838, 2},
+  {0xfe77, 3840, 2}, {0xfe78, 3842, 2}, {0xfe79, 3844, 2}, {0xfe7a, 3846, 2},
+  {0xfe7b, 3848, 2}, {0xfe7c, 3850, 2}, {0xfe7d, 3852, 2}, {0xfe7e, 3854, 2},
+  {0xfe7f, 3856, 2}, {0xfe80, 3858, 1}, {0xfe81, 3859, 2}, {0xfe82, 3861, 2},
+  {0xfe83, 3863, 2}, {0xfe84, 3865, 2}, {0xfe85, 3867, 2}, {0xfe86, 3869, 2},
+  {0xfe87, 3871, 2}, {0xfe88, 3873, 2}, {0xfe89, 3875, 2}, {0xfe8a, 3877, 2},
+  {0xfe8b, 3879, 2}, {0xfe8c, 3881, 2}, {0xfe8d, 3883, 1}, {0xfe8e, 3884, 1},
+  {0xfe8f, 3885, 1}, {0xfe90, 3886, 1}, {0xfe91, 3887, 1}, {0xfe92, 3888, 1},
+  {0xfe93, 3889, 1}, {0xfe94, 3890, 1}, {0xfe95, 3891, 1}, {0xfe96, 3892, 1},
+  {0xfe97, 3893, 1}, {0xfe98, 3894, 1}, {0xfe99, 3895, 1}, {0xfe9a, 3896, 1},
+  {0xfe9b, 3897, 1}, {0xfe9c, 3898, 1}, {0xfe9d, 3899, 1}, {0xfe9e, 3900, 1},
+  {0xfe9f, 3901, 1}, {0xfea0, 3902, 1}, {0xfea1, 3903, 1}, {0xfea2, 3904, 1},
+  {0xfea3, 3905, 1}, {0xfea4, 3906, 1}, {0xfea5, 3907, 1}, {0xfea6, 3908, 1},
+  {0xfea7, 3909, 1}, {0xfea8, 3910, 1}, {0xfea9, 3911, 1}, {0xfeaa, 3912, 1},
+  {0xfeab, 3913, 1}, {0xfeac, 3914, 1}, {0xfead, 3915, 1}, {0xfeae, 3916, 1},
+  {0xfeaf, 3917, 1}, {0xfeb0, 3918, 1}, {0xfeb1, 3919, 1}, {0xfeb2, 3920, 1},
+  {0xfeb3, 3921, 1}, {0xfeb4, 3922, 1}, {0xfeb5, 3923, 1}, {0xfeb6, 3924, 1},
+  {0xfeb7, 3925, 1}, {0xfeb8, 3926, 1}, {0xfeb9, 3927, 1}, {0xfeba, 3928, 1},
+  {0xfebb, 3929, 1}, {0xfebc, 3930, 1}, {0xfebd, 3931, 1}, {0xfebe, 3932, 1},
+  {0xfebf, 3933, 1}, {0xfec0, 3934, 1}, {0xfec1, 3935, 1}, {0xfec2, 3936, 1},
+  {0xfec3, 3937, 1}, {0xfec4, 3938, 1}, {0xfec5, 3939, 1}, {0xfec6, 3940, 1},
+  {0xfec7, 3941, 1}, {0xfec8, 3942, 1}, {0xfec9, 3943, 1}, {0xfeca, 3944, 1},
+  {0xfecb, 3945, 1}, {0xfecc, 3946, 1}, {0xfecd, 3947, 1}, {0xfece, 3948, 1},
+  {0xfecf, 3949, 1}, {0xfed0, 3950, 1}, {0xfed1, 3951, 1}, {0xfed2, 3952, 1},
+  {0xfed3, 3953, 1}, {0xfed4, 3954, 1}, {0xfed5, 3955, 1}, {0xfed6, 3956, 1},
+  {0xfed7, 3957, 1}, {0xfed8, 3958, 1}, {0xfed9, 3959, 1}, {0xfeda, 3960, 1},
+  {0xfedb, 3961, 1}, {0xfedc, 3962, 1}, {0xfedd, 3963, 1}, {0xfede, 3964, 1},
+  {0xfedf, 3965, 1}, {0xfee0, 3966, 1}, {0xfee1, 3967, 1}, {0xfee2, 3968, 1},
+  {0xfee3, 3969, 1}, {0xfee4, 3970, 1}, {0xfee5, 3971, 1}, {0xfee6, 3972, 1},
+  {0xfee7, 3973, 1}, {0xfee8, 3974, 1}, {0xfee9, 3975, 1}, {0xfeea, 3976, 1},
+  {0xfeeb, 3977, 1}, {0xfeec, 3978, 1}, {0xfeed, 3979, 1}, {0xfeee, 3980, 1},
+  {0xfeef, 3981, 1}, {0xfef0, 3982, 1}, {0xfef1, 3983, 1}, {0xfef2, 3984, 1},
+  {0xfef3, 3985, 1}, {0xfef4, 3986, 1}, {0xfef5, 3987, 3}, {0xfef6, 3990, 3},
+  {0xfef7, 3993, 3}, {0xfef8, 3996, 3}, {0xfef9, 3999, 3}, {0xfefa, 4002, 3},
+  {0xfefb, 4005, 2}, {0xfefc, 4007, 2}, {0xff01, 4009, 1}, {0xff02, 4010, 1},
+  {0xff03, 4011, 1}, {0xff04, 4012, 1}, {0xff05, 4013, 1}, {0xff06, 4014, 1},
+  {0xff07, 4015, 1}, {0xff08, 4016, 1}, {0xff09, 4017, 1}, {0xff0a, 4018, 1},
+  {0xff0b, 4019, 1}, {0xff0c, 4020, 1}, {0xff0d, 4021, 1}, {0xff0e, 4022, 1},
+  {0xff0f, 4023, 1}, {0xff10, 4024, 1}, {0xff11, 4025, 1}, {0xff12, 4026, 1},
+  {0xff13, 4027, 1}, {0xff14, 4028, 1}, {0xff15, 4029, 1}, {0xff16, 4030, 1},
+  {0xff17, 4031, 1}, {0xff18, 4032, 1}, {0xff19, 4033, 1}, {0xff1a, 4034, 1},
+  {0xff1b, 4035, 1}, {0xff1c, 4036, 1}, {0xff1d, 4037, 1}, {0xff1e, 4038, 1},
+  {0xff1f, 4039, 1}, {0xff20, 4040, 1}, {0xff21, 4041, 1}, {0xff22, 4042, 1},
+  {0xff23, 4043, 1}, {0xff24, 4044, 1}, {0xff25, 4045, 1}, {0xff26, 4046, 1},
+  {0xff27, 4047, 1}, {0xff28, 4048, 1}, {0xff29, 4049, 1}, {0xff2a, 4050, 1},
+  {0xff2b, 4051, 1}, {0xff2c, 4052, 1}, {0xff2d, 4053, 1}, {0xff2e, 4054, 1},
+  {0xff2f, 4055, 1}, {0xff30, 4056, 1}, {0xff31, 4057, 1}, {0xff32, 4058, 1},
+  {0xff33, 4059, 1}, {0xff34, 4060, 1}, {0xff35, 4061, 1}, {0xff36, 4062, 1},
+  {0xff37, 4063, 1}, {0xff38, 4064, 1}, {0xff39, 4065, 1}, {0xff3a, 4066, 1},
+  {0xff3b, 4067, 1}, {0xff3c, 4068, 1}, {0xff3d, 4069, 1}, {0xff3e, 4070, 1},
+  {0xff3f, 4071, 1}, {0xff40, 4072, 1}, {0xff41, 4073, 1}, {0xff42, 4074, 1},
+  {0xff43, 4075, 1}, {0xff44, 4076, 1}, {0xff45, 4077, 1}, {0xff46, 4078, 1},
+  {0xff47, 4079, 1}, {0xff48, 4080, 1}, {0xff49, 4081, 1}, {0xff4a, 4082, 1},
+  {0xff4b, 4083, 1}, {0xff4c, 4084, 1}, {0xff4d, 4085, 1}, {0xff4e, 4086, 1},
+  {0xff4f, 4087, 1}, {0xff50, 4088, 1}, {0xff51, 4089, 1}, {0xff52, 4090, 1},
+  {0xff53, 4091, 1}, {0xff54, 4092, 1}, {0xff55, 4093, 1}, {0xff56, 4094, 1},
+  {0xff57, 4095, 1}, {0xff58, 4096, 1}, {0xff59, 4097, 1}, {0xff5a, 4098, 1},
+  {0xff5b, 4099, 1}, {0xff5c, 4100, 1}, {0xff5d, 4101, 1}, {0xff5e, 4102, 1},
+  {0xff5f, 4103, 1}, {0xff60, 4104, 1}, {0xff61, 4105, 1}, {0xff62, 4106, 1},
+  {0xff63, 4107, 1}, {0xff64, 4108, 1}, {0xff65, 4109, 1}, {0xff66, 4110, 1},
+  {0xff67, 4111, 1}, {0xff68, 4112, 1}, {0xff69, 4113, 1}, {0xff6a, 4114, 1},
+  {0xff6b, 4115, 1}, {0xff6c, 4116, 1}, {0xff6d, 4117, 1}, {0xff6e, 4118, 1},
+  {0xff6f, 4119, 1}, {0xff70, 4120, 1}, {0xff71, 4121, 1}, {0xff72, 4122, 1},
+  {0xff73, 4123, 1}, {0xff74, 4124, 1}, {0xff75, 4125, 1}, {0xff76, 4126, 1},
+  {0xff77, 4127, 1}, {0xff78, 4128, 1}, {0xff79, 4129, 1}, {0xff7a, 4130, 1},
+  {0xff7b, 4131, 1}, {0xff7c, 4132, 1}, {0xff7d, 4133, 1}, {0xff7e, 4134, 1},
+  {0xff7f, 4135, 1}, {0xff80, 4136, 1}, {0xff81, 4137, 1}, {0xff82, 4138, 1},
+  {0xff83, 4139, 1}, {0xff84, 4140, 1}, {0xff85, 4141, 1}, {0xff86, 4142, 1},
+  {0xff87, 4143, 1}, {0xff88, 4144, 1}, {0xff89, 4145, 1}, {0xff8a, 4146, 1},
+  {0xff8b, 4147, 1}, {0xff8c, 4148, 1}, {0xff8d, 4149, 1}, {0xff8e, 4150, 1},
+  {0xff8f, 4151, 1}, {0xff90, 4152, 1}, {0xff91, 4153, 1}, {0xff92, 4154, 1},
+  {0xff93, 4155, 1}, {0xff94, 4156, 1}, {0xff95, 4157, 1}, {0xff96, 4158, 1},
+  {0xff97, 4159, 1}, {0xff98, 4160, 1}, {0xff99, 4161, 1}, {0xff9a, 4162, 1},
+  {0xff9b, 4163, 1}, {0xff9c, 4164, 1}, {0xff9d, 4165, 1}, {0xff9e, 4166, 1},
+  {0xff9f, 4167, 1}, {0xffa0, 4168, 1}, {0xffa1, 4169, 1}, {0xffa2, 4170, 1},
+  {0xffa3, 4171, 1}, {0xffa4, 4172, 1}, {0xffa5, 4173, 1}, {0xffa6, 4174, 1},
+  {0xffa7, 4175, 1}, {0xffa8, 4176, 1}, {0xffa9, 4177, 1}, {0xffaa, 4178, 1},
+  {0xffab, 4179, 1}, {0xffac, 4180, 1}, {0xffad, 4181, 1}, {0xffae, 4182, 1},
+  {0xffaf, 4183, 1}, {0xffb0, 4184, 1}, {0xffb1, 4185, 1}, {0xffb2, 4186, 1},
+  {0xffb3, 4187, 1}, {0xffb4, 4188, 1}, {0xffb5, 4189, 1}, {0xffb6, 4190, 1},
+  {0xffb7, 4191, 1}, {0xffb8, 4192, 1}, {0xffb9, 4193, 1}, {0xffba, 4194, 1},
+  {0xffbb, 4195, 1}, {0xffbc, 4196, 1}, {0xffbd, 4197, 1}, {0xffbe, 4198, 1},
+  {0xffc2, 4199, 1}, {0xffc3, 4200, 1}, {0xffc4, 4201, 1}, {0xffc5, 4202, 1},
+  {0xffc6, 4203, 1}, {0xffc7, 4204, 1}, {0xffca, 4205, 1}, {0xffcb, 4206, 1},
+  {0xffcc, 4207, 1}, {0xffcd, 4208, 1}, {0xffce, 4209, 1}, {0xffcf, 4210, 1},
+  {0xffd2, 4211, 1}, {0xffd3, 4212, 1}, {0xffd4, 4213, 1}, {0xffd5, 4214, 1},
+  {0xffd6, 4215, 1}, {0xffd7, 4216, 1}, {0xffda, 4217, 1}, {0xffdb, 4218, 1},
+  {0xffdc, 4219, 1}, {0xffe0, 4220, 1}, {0xffe1, 4221, 1}, {0xffe2, 4222, 1},
+  {0xffe3, 4223, 2}, {0xffe4, 4225, 1}, {0xffe5, 4226, 1}, {0xffe6, 4227, 1},
+  {0xffe8, 4228, 1}, {0xffe9, 4229, 1}, {0xffea, 4230, 1}, {0xffeb, 4231, 1},
+  {0xffec, 4232, 1}, {0xffed, 4233, 1}, {0xffee, 4234, 1}, {0x10781, 4235, 1},
+  {0x10782, 4236, 1}, {0x10783, 4237, 1}, {0x10784, 4238, 1}, {0x10785, 4239, 1},
+  {0x10787, 4240, 1}, {0x10788, 4241, 1}, {0x10789, 4242, 1}, {0x1078a, 4243, 1},
+  {0x1078b, 4244, 1}, {0x1078c, 4245, 1}, {0x1078d, 4246, 1}, {0x1078e, 4247, 1},
+  {0x1078f, 4248, 1}, {0x10790, 4249, 1}, {0x10791, 4250, 1}, {0x10792, 4251, 1},
+  {0x10793, 4252, 1}, {0x10794, 4253, 1}, {0x10795, 4254, 1}, {0x10796, 4255, 1},
+  {0x10797, 4256, 1}, {0x10798, 4257, 1}, {0x10799, 4258, 1}, {0x1079a, 4259, 1},
+  {0x1079b, 4260, 1}, {0x1079c, 4261, 1}, {0x1079d, 4262, 1}, {0x1079e, 4263, 1},
+  {0x1079f, 4264, 1}, {0x107a0, 4265, 1}, {0x107a1, 4266, 1}, {0x107a2, 4267, 1},
+  {0x107a3, 4268, 1}, {0x107a4, 4269, 1}, {0x107a5, 4270, 1}, {0x107a6, 4271, 1},
+  {0x107a7, 4272, 1}, {0x107a8, 4273, 1}, {0x107a9, 4274, 1}, {0x107aa, 4275, 1},
+  {0x107ab, 4276, 1}, {0x107ac, 4277, 1}, {0x107ad, 4278, 1}, {0x107ae, 4279, 1},
+  {0x107af, 4280, 1}, {0x107b0, 4281, 1}, {0x107b2, 4282, 1}, {0x107b3, 4283, 1},
+  {0x107b4, 4284, 1}, {0x107b5, 4285, 1}, {0x107b6, 4286, 1}, {0x107b7, 4287, 1},
+  {0x107b8, 4288, 1}, {0x107b9, 4289, 1}, {0x107ba, 4290, 1}, {0x1d400, 4291, 1},
+  {0x1d401, 4292, 1}, {0x1d402, 4293, 1}, {0x1d403, 4294, 1}, {0x1d404, 4295, 1},
+  {0x1d405, 4296, 1}, {0x1d406, 4297, 1}, {0x1d407, 4298, 1}, {0x1d408, 4299, 1},
+  {0x1d409, 4300, 1}, {0x1d40a, 4301, 1}, {0x1d40b, 4302, 1}, {0x1d40c, 4303, 1},
+  {0x1d40d, 4304, 1}, {0x1d40e, 4305, 1}, {0x1d40f, 4306, 1}, {0x1d410, 4307, 1},
+  {0x1d411, 4308, 1}, {0x1d412, 4309, 1}, {0x1d413, 4310, 1}, {0x1d414, 4311, 1},
+  {0x1d415, 4312, 1}, {0x1d416, 4313, 1}, {0x1d417, 4314, 1}, {0x1d418, 4315, 1},
+  {0x1d419, 4316, 1}, {0x1d41a, 4317, 1}, {0x1d41b, 4318, 1}, {0x1d41c, 4319, 1},
+  {0x1d41d, 4320, 1}, {0x1d41e, 4321, 1}, {0x1d41f, 4322, 1}, {0x1d420, 4323, 1},
+  {0x1d421, 4324, 1}, {0x1d422, 4325, 1}, {0x1d423, 4326, 1}, {0x1d424, 4327, 1},
+  {0x1d425, 4328, 1}, {0x1d426, 4329, 1}, {0x1d427, 4330, 1}, {0x1d428, 4331, 1},
+  {0x1d429, 4332, 1}, {0x1d42a, 4333, 1}, {0x1d42b, 4334, 1}, {0x1d42c, 4335, 1},
+  {0x1d42d, 4336, 1}, {0x1d42e, 4337, 1}, {0x1d42f, 4338, 1}, {0x1d430, 4339, 1},
+  {0x1d431, 4340, 1}, {0x1d432, 4341, 1}, {0x1d433, 4342, 1}, {0x1d434, 4343, 1},
+  {0x1d435, 4344, 1}, {0x1d436, 4345, 1}, {0x1d437, 4346, 1}, {0x1d438, 4347, 1},
+  {0x1d439, 4348, 1}, {0x1d43a, 4349, 1}, {0x1d43b, 4350, 1}, {0x1d43c, 4351, 1},
+  {0x1d43d, 4352, 1}, {0x1d43e, 4353, 1}, {0x1d43f, 4354, 1}, {0x1d440, 4355, 1},
+  {0x1d441, 4356, 1}, {0x1d442, 4357, 1}, {0x1d443, 4358, 1}, {0x1d444, 4359, 1},
+  {0x1d445, 4360, 1}, {0x1d446, 4361, 1}, {0x1d447, 4362, 1}, {0x1d448, 4363, 1},
+  {0x1d449, 4364, 1}, {0x1d44a, 4365, 1}, {0x1d44b, 4366, 1}, {0x1d44c, 4367, 1},
+  {0x1d44d, 4368, 1}, {0x1d44e, 4369, 1}, {0x1d44f, 4370, 1}, {0x1d450, 4371, 1},
+  {0x1d451, 4372, 1}, {0x1d452, 4373, 1}, {0x1d453, 4374, 1}, {0x1d454, 4375, 1},
+  {0x1d456, 4376, 1}, {0x1d457, 4377, 1}, {0x1d458, 4378, 1}, {0x1d459, 4379, 1},
+  {0x1d45a, 4380, 1}, {0x1d45b, 4381, 1}, {0x1d45c, 4382, 1}, {0x1d45d, 4383, 1},
+  {0x1d45e, 4384, 1}, {0x1d45f, 4385, 1}, {0x1d460, 4386, 1}, {0x1d461, 4387, 1},
+  {0x1d462, 4388, 1}, {0x1d463, 4389, 1}, {0x1d464, 4390, 1}, {0x1d465, 4391, 1},
+  {0x1d466, 4392, 1}, {0x1d467, 4393, 1}, {0x1d468, 4394, 1}, {0x1d469, 4395, 1},
+  {0x1d46a, 4396, 1}, {0x1d46b, 4397, 1}, {0x1d46c, 4398, 1}, {0x1d46d, 4399, 1},
+  {0x1d46e, 4400, 1}, {0x1d46f, 4401, 1}, {0x1d470, 4402, 1}, {0x1d471, 4403, 1},
+  {0x1d472, 4404, 1}, {0x1d473, 4405, 1}, {0x1d474, 4406, 1}, {0x1d475, 4407, 1},
+  {0x1d476, 4408, 1}, {0x1d477, 4409, 1}, {0x1d478, 4410, 1}, {0x1d479, 4411, 1},
+  {0x1d47a, 4412, 1}, {0x1d47b, 4413, 1}, {0x1d47c, 4414, 1}, {0x1d47d, 4415, 1},
+  {0x1d47e, 4416, 1}, {0x1d47f, 4417, 1}, {0x1d480, 4418, 1}, {0x1d481, 4419, 1},
+  {0x1d482, 4420, 1}, {0x1d483, 4421, 1}, {0x1d484, 4422, 1}, {0x1d485, 4423, 1},
+  {0x1d486, 4424, 1}, {0x1d487, 4425, 1}, {0x1d488, 4426, 1}, {0x1d489, 4427, 1},
+  {0x1d48a, 4428, 1}, {0x1d48b, 4429, 1}, {0x1d48c, 4430, 1}, {0x1d48d, 4431, 1},
+  {0x1d48e, 4432, 1}, {0x1d48f, 4433, 1}, {0x1d490, 4434, 1}, {0x1d491, 4435, 1},
+  {0x1d492, 4436, 1}, {0x1d493, 4437, 1}, {0x1d494, 4438, 1}, {0x1d495, 4439, 1},
+  {0x1d496, 4440, 1}, {0x1d497, 4441, 1}, {0x1d498, 4442, 1}, {0x1d499, 4443, 1},
+  {0x1d49a, 4444, 1}, {0x1d49b, 4445, 1}, {0x1d49c, 4446, 1}, {0x1d49e, 4447, 1},
+  {0x1d49f, 4448, 1}, {0x1d4a2, 4449, 1}, {0x1d4a5, 4450, 1}, {0x1d4a6, 4451, 1},
+  {0x1d4a9, 4452, 1}, {0x1d4aa, 4453, 1}, {0x1d4ab, 4454, 1}, {0x1d4ac, 4455, 1},
+  {0x1d4ae, 4456, 1}, {0x1d4af, 4457, 1}, {0x1d4b0, 4458, 1}, {0x1d4b1, 4459, 1},
+  {0x1d4b2, 4460, 1}, {0x1d4b3, 4461, 1}, {0x1d4b4, 4462, 1}, {0x1d4b5, 4463, 1},
+  {0x1d4b6, 4464, 1}, {0x1d4b7, 4465, 1}, {0x1d4b8, 4466, 1}, {0x1d4b9, 4467, 1},
+  {0x1d4bb, 4468, 1}, {0x1d4bd, 4469, 1}, {0x1d4be, 4470, 1}, {0x1d4bf, 4471, 1},
+  {0x1d4c0, 4472, 1}, {0x1d4c1, 4473, 1}, {0x1d4c2, 4474, 1}, {0x1d4c3, 4475, 1},
+  {0x1d4c5, 4476, 1}, {0x1d4c6, 4477, 1}, {0x1d4c7, 4478, 1}, {0x1d4c8, 4479, 1},
+  {0x1d4c9, 4480, 1}, {0x1d4ca, 4481, 1}, {0x1d4cb, 4482, 1}, {0x1d4cc, 4483, 1},
+  {0x1d4cd, 4484, 1}, {0x1d4ce, 4485, 1}, {0x1d4cf, 4486, 1}, {0x1d4d0, 4487, 1},
+  {0x1d4d1, 4488, 1}, {0x1d4d2, 4489, 1}, {0x1d4d3, 4490, 1}, {0x1d4d4, 4491, 1},
+  {0x1d4d5, 4492, 1}, {0x1d4d6, 4493, 1}, {0x1d4d7, 4494, 1}, {0x1d4d8, 4495, 1},
+  {0x1d4d9, 4496, 1}, {0x1d4da, 4497, 1}, {0x1d4db, 4498, 1}, {0x1d4dc, 4499, 1},
+  {0x1d4dd, 4500, 1}, {0x1d4de, 4501, 1}, {0x1d4df, 4502, 1}, {0x1d4e0, 4503, 1},
+  {0x1d4e1, 4504, 1}, {0x1d4e2, 4505, 1}, {0x1d4e3, 4506, 1}, {0x1d4e4, 4507, 1},
+  {0x1d4e5, 4508, 1}, {0x1d4e6, 4509, 1}, {0x1d4e7, 4510, 1}, {0x1d4e8, 4511, 1},
+  {0x1d4e9, 4512, 1}, {0x1d4ea, 4513, 1}, {0x1d4eb, 4514, 1}, {0x1d4ec, 4515, 1},
+  {0x1d4ed, 4516, 1}, {0x1d4ee, 4517, 1}, {0x1d4ef, 4518, 1}, {0x1d4f0, 4519, 1},
+  {0x1d4f1, 4520, 1}, {0x1d4f2, 4521, 1}, {0x1d4f3, 4522, 1}, {0x1d4f4, 4523, 1},
+  {0x1d4f5, 4524, 1}, {0x1d4f6, 4525, 1}, {0x1d4f7, 4526, 1}, {0x1d4f8, 4527, 1},
+  {0x1d4f9, 4528, 1}, {0x1d4fa, 4529, 1}, {0x1d4fb, 4530, 1}, {0x1d4fc, 4531, 1},
+  {0x1d4fd, 4532, 1}, {0x1d4fe, 4533, 1}, {0x1d4ff, 4534, 1}, {0x1d500, 4535, 1},
+  {0x1d501, 4536, 1}, {0x1d502, 4537, 1}, {0x1d503, 4538, 1}, {0x1d504, 4539, 1},
+  {0x1d505, 4540, 1}, {0x1d507, 4541, 1}, {0x1d508, 4542, 1}, {0x1d509, 4543, 1},
+  {0x1d50a, 4544, 1}, {0x1d50d, 4545, 1}, {0x1d50e, 4546, 1}, {0x1d50f, 4547, 1},
+  {0x1d510, 4548, 1}, {0x1d511, 4549, 1}, {0x1d512, 4550, 1}, {0x1d513, 4551, 1},
+  {0x1d514, 4552, 1}, {0x1d516, 4553, 1}, {0x1d517, 4554, 1}, {0x1d518, 4555, 1},
+  {0x1d519, 4556, 1}, {0x1d51a, 4557, 1}, {0x1d51b, 4558, 1}, {0x1d51c, 4559, 1},
+  {0x1d51e, 4560, 1}, {0x1d51f, 4561, 1}, {0x1d520, 4562, 1}, {0x1d521, 4563, 1},
+  {0x1d522, 4564, 1}, {0x1d523, 4565, 1}, {0x1d524, 4566, 1}, {0x1d525, 4567, 1},
+  {0x1d526, 4568, 1}, {0x1d527, 4569, 1}, {0x1d528, 4570, 1}, {0x1d529, 4571, 1},
+  {0x1d52a, 4572, 1}, {0x1d52b, 4573, 1}, {0x1d52c, 4574, 1}, {0x1d52d, 4575, 1},
+  {0x1d52e, 4576, 1}, {0x1d52f, 4577, 1}, {0x1d530, 4578, 1}, {0x1d531, 4579, 1},
+  {0x1d532, 4580, 1}, {0x1d533, 4581, 1}, {0x1d534, 4582, 1}, {0x1d535, 4583, 1},
+  {0x1d536, 4584, 1}, {0x1d537, 4585, 1}, {0x1d538, 4586, 1}, {0x1d539, 4587, 1},
+  {0x1d53b, 4588, 1}, {0x1d53c, 4589, 1}, {0x1d53d, 4590, 1}, {0x1d53e, 4591, 1},
+  {0x1d540, 4592, 1}, {0x1d541, 4593, 1}, {0x1d542, 4594, 1}, {0x1d543, 4595, 1},
+  {0x1d544, 4596, 1}, {0x1d546, 4597, 1}, {0x1d54a, 4598, 1}, {0x1d54b, 4599, 1},
+  {0x1d54c, 4600, 1}, {0x1d54d, 4601, 1}, {0x1d54e, 4602, 1}, {0x1d54f, 4603, 1},
+  {0x1d550, 4604, 1}, {0x1d552, 4605, 1}, {0x1d553, 4606, 1}, {0x1d554, 4607, 1},
+  {0x1d555, 4608, 1}, {0x1d556, 4609, 1}, {0x1d557, 4610, 1}, {0x1d558, 4611, 1},
+  {0x1d559, 4612, 1}, {0x1d55a, 4613, 1}, {0x1d55b, 4614, 1}, {0x1d55c, 4615, 1},
+  {0x1d55d, 4616, 1}, {0x1d55e, 4617, 1}, {0x1d55f, 4618, 1}, {0x1d560, 4619, 1},
+  {0x1d561, 4620, 1}, {0x1d562, 4621, 1}, {0x1d563, 4622, 1}, {0x1d564, 4623, 1},
+  {0x1d565, 4624, 1}, {0x1d566, 4625, 1}, {0x1d567, 4626, 1}, {0x1d568, 4627, 1},
+  {0x1d569, 4628, 1}, {0x1d56a, 4629, 1}, {0x1d56b, 4630, 1}, {0x1d56c, 4631, 1},
+  {0x1d56d, 4632, 1}, {0x1d56e, 4633, 1}, {0x1d56f, 4634, 1}, {0x1d570, 4635, 1},
+  {0x1d571, 4636, 1}, {0x1d572, 4637, 1}, {0x1d573, 4638, 1}, {0x1d574, 4639, 1},
+  {0x1d575, 4640, 1}, {0x1d576, 4641, 1}, {0x1d577, 4642, 1}, {0x1d578, 4643, 1},
+  {0x1d579, 4644, 1}, {0x1d57a, 4645, 1}, {0x1d57b, 4646, 1}, {0x1d57c, 4647, 1},
+  {0x1d57d, 4648, 1}, {0x1d57e, 4649, 1}, {0x1d57f, 4650, 1}, {0x1d580, 4651, 1},
+  {0x1d581, 4652, 1}, {0x1d582, 4653, 1}, {0x1d583, 4654, 1}, {0x1d584, 4655, 1},
+  {0x1d585, 4656, 1}, {0x1d586, 4657, 1}, {0x1d587, 4658, 1}, {0x1d588, 4659, 1},
+  {0x1d589, 4660, 1}, {0x1d58a, 4661, 1}, {0x1d58b, 4662, 1}, {0x1d58c, 4663, 1},
+  {0x1d58d, 4664, 1}, {0x1d58e, 4665, 1}, {0x1d58f, 4666, 1}, {0x1d590, 4667, 1},
+  {0x1d591, 4668, 1}, {0x1d592, 4669, 1}, {0x1d593, 4670, 1}, {0x1d594, 4671, 1},
+  {0x1d595, 4672, 1}, {0x1d596, 4673, 1}, {0x1d597, 4674, 1}, {0x1d598, 4675, 1},
+  {0x1d599, 4676, 1}, {0x1d59a, 4677, 1}, {0x1d59b, 4678, 1}, {0x1d59c, 4679, 1},
+  {0x1d59d, 4680, 1}, {0x1d59e, 4681, 1}, {0x1d59f, 4682, 1}, {0x1d5a0, 4683, 1},
+  {0x1d5a1, 4684, 1}, {0x1d5a2, 4685, 1}, {0x1d5a3, 4686, 1}, {0x1d5a4, 4687, 1},
+  {0x1d5a5, 4688, 1}, {0x1d5a6, 4689, 1}, {0x1d5a7, 4690, 1}, {0x1d5a8, 4691, 1},
+  {0x1d5a9, 4692, 1}, {0x1d5aa, 4693, 1}, {0x1d5ab, 4694, 1}, {0x1d5ac, 4695, 1},
+  {0x1d5ad, 4696, 1}, {0x1d5ae, 4697, 1}, {0x1d5af, 4698, 1}, {0x1d5b0, 4699, 1},
+  {0x1d5b1, 4700, 1}, {0x1d5b2, 4701, 1}, {0x1d5b3, 4702, 1}, {0x1d5b4, 4703, 1},
+  {0x1d5b5, 4704, 1}, {0x1d5b6, 4705, 1}, {0x1d5b7, 4706, 1}, {0x1d5b8, 4707, 1},
+  {0x1d5b9, 4708, 1}, {0x1d5ba, 4709, 1}, {0x1d5bb, 4710, 1}, {0x1d5bc, 4711, 1},
+  {0x1d5bd, 4712, 1}, {0x1d5be, 4713, 1}, {0x1d5bf, 4714, 1}, {0x1d5c0, 4715, 1},
+  {0x1d5c1, 4716, 1}, {0x1d5c2, 4717, 1}, {0x1d5c3, 4718, 1}, {0x1d5c4, 4719, 1},
+  {0x1d5c5, 4720, 1}, {0x1d5c6, 4721, 1}, {0x1d5c7, 4722, 1}, {0x1d5c8, 4723, 1},
+  {0x1d5c9, 4724, 1}, {0x1d5ca, 4725, 1}, {0x1d5cb, 4726, 1}, {0x1d5cc, 4727, 1},
+  {0x1d5cd, 4728, 1}, {0x1d5ce, 4729, 1}, {0x1d5cf, 4730, 1}, {0x1d5d0, 4731, 1},
+  {0x1d5d1, 4732, 1}, {0x1d5d2, 4733, 1}, {0x1d5d3, 4734, 1}, {0x1d5d4, 4735, 1},
+  {0x1d5d5, 4736, 1}, {0x1d5d6, 4737, 1}, {0x1d5d7, 4738, 1}, {0x1d5d8, 4739, 1},
+  {0x1d5d9, 4740, 1}, {0x1d5da, 4741, 1}, {0x1d5db, 4742, 1}, {0x1d5dc, 4743, 1},
+  {0x1d5dd, 4744, 1}, {0x1d5de, 4745, 1}, {0x1d5df, 4746, 1}, {0x1d5e0, 4747, 1},
+  {0x1d5e1, 4748, 1}, {0x1d5e2, 4749, 1}, {0x1d5e3, 4750, 1}, {0x1d5e4, 4751, 1},
+  {0x1d5e5, 4752, 1}, {0x1d5e6, 4753, 1}, {0x1d5e7, 4754, 1}, {0x1d5e8, 4755, 1},
+  {0x1d5e9, 4756, 1}, {0x1d5ea, 4757, 1}, {0x1d5eb, 4758, 1}, {0x1d5ec, 4759, 1},
+  {0x1d5ed, 4760, 1}, {0x1d5ee, 4761, 1}, {0x1d5ef, 4762, 1}, {0x1d5f0, 4763, 1},
+  {0x1d5f1, 4764, 1}, {0x1d5f2, 4765, 1}, {0x1d5f3, 4766, 1}, {0x1d5f4, 4767, 1},
+  {0x1d5f5, 4768, 1}, {0x1d5f6, 4769, 1}, {0x1d5f7, 4770, 1}, {0x1d5f8, 4771, 1},
+  {0x1d5f9, 4772, 1}, {0x1d5fa, 4773, 1}, {0x1d5fb, 4774, 1}, {0x1d5fc, 4775, 1},
+  {0x1d5fd, 4776, 1}, {0x1d5fe, 4777, 1}, {0x1d5ff, 4778, 1}, {0x1d600, 4779, 1},
+  {0x1d601, 4780, 1}, {0x1d602, 4781, 1}, {0x1d603, 4782, 1}, {0x1d604, 4783, 1},
+  {0x1d605, 4784, 1}, {0x1d606, 4785, 1}, {0x1d607, 4786, 1}, {0x1d608, 4787, 1},
+  {0x1d609, 4788, 1}, {0x1d60a, 4789, 1}, {0x1d60b, 4790, 1}, {0x1d60c, 4791, 1},
+  {0x1d60d, 4792, 1}, {0x1d60e, 4793, 1}, {0x1d60f, 4794, 1}, {0x1d610, 4795, 1},
+  {0x1d611, 4796, 1}, {0x1d612, 4797, 1}, {0x1d613, 4798, 1}, {0x1d614, 4799, 1},
+  {0x1d615, 4800, 1}, {0x1d616, 4801, 1}, {0x1d617, 4802, 1}, {0x1d618, 4803, 1},
+  {0x1d619, 4804, 1}, {0x1d61a, 4805, 1}, {0x1d61b, 4806, 1}, {0x1d61c, 4807, 1},
+  {0x1d61d, 4808, 1}, {0x1d61e, 4809, 1}, {0x1d61f, 4810, 1}, {0x1d620, 4811, 1},
+  {0x1d621, 4812, 1}, {0x1d622, 4813, 1}, {0x1d623, 4814, 1}, {0x1d624, 4815, 1},
+  {0x1d625, 4816, 1}, {0x1d626, 4817, 1}, {0x1d627, 4818, 1}, {0x1d628, 4819, 1},
+  {0x1d629, 4820, 1}, {0x1d62a, 4821, 1}, {0x1d62b, 4822, 1}, {0x1d62c, 4823, 1},
+  {0x1d62d, 4824, 1}, {0x1d62e, 4825, 1}, {0x1d62f, 4826, 1}, {0x1d630, 4827, 1},
+  {0x1d631, 4828, 1}, {0x1d632, 4829, 1}, {0x1d633, 4830, 1}, {0x1d634, 4831, 1},
+  {0x1d635, 4832, 1}, {0x1d636, 4833, 1}, {0x1d637, 4834, 1}, {0x1d638, 4835, 1},
+  {0x1d639, 4836, 1}, {0x1d63a, 4837, 1}, {0x1d63b, 4838, 1}, {0x1d63c, 4839, 1},
+  {0x1d63d, 4840, 1}, {0x1d63e, 4841, 1}, {0x1d63f, 4842, 1}, {0x1d640, 4843, 1},
+  {0x1d641, 4844, 1}, {0x1d642, 4845, 1}, {0x1d643, 4846, 1}, {0x1d644, 4847, 1},
+  {0x1d645, 4848, 1}, {0x1d646, 4849, 1}, {0x1d647, 4850, 1}, {0x1d648, 4851, 1},
+  {0x1d649, 4852, 1}, {0x1d64a, 4853, 1}, {0x1d64b, 4854, 1}, {0x1d64c, 4855, 1},
+  {0x1d64d, 4856, 1}, {0x1d64e, 4857, 1}, {0x1d64f, 4858, 1}, {0x1d650, 4859, 1},
+  {0x1d651, 4860, 1}, {0x1d652, 4861, 1}, {0x1d653, 4862, 1}, {0x1d654, 4863, 1},
+  {0x1d655, 4864, 1}, {0x1d656, 4865, 1}, {0x1d657, 4866, 1}, {0x1d658, 4867, 1},
+  {0x1d659, 4868, 1}, {0x1d65a, 4869, 1}, {0x1d65b, 4870, 1}, {0x1d65c, 4871, 1},
+  {0x1d65d, 4872, 1}, {0x1d65e, 4873, 1}, {0x1d65f, 4874, 1}, {0x1d660, 4875, 1},
+  {0x1d661, 4876, 1}, {0x1d662, 4877, 1}, {0x1d663, 4878, 1}, {0x1d664, 4879, 1},
+  {0x1d665, 4880, 1}, {0x1d666, 4881, 1}, {0x1d667, 4882, 1}, {0x1d668, 4883, 1},
+  {0x1d669, 4884, 1}, {0x1d66a, 4885, 1}, {0x1d66b, 4886, 1}, {0x1d66c, 4887, 1},
+  {0x1d66d, 4888, 1}, {0x1d66e, 4889, 1}, {0x1d66f, 4890, 1}, {0x1d670, 4891, 1},
+  {0x1d671, 4892, 1}, {0x1d672, 4893, 1}, {0x1d673, 4894, 1}, {0x1d674, 4895, 1},
+  {0x1d675, 4896, 1}, {0x1d676, 4897, 1}, {0x1d677, 4898, 1}, {0x1d678, 4899, 1},
+  {0x1d679, 4900, 1}, {0x1d67a, 4901, 1}, {0x1d67b, 4902, 1}, {0x1d67c, 4903, 1},
+  {0x1d67d, 4904, 1}, {0x1d67e, 4905, 1}, {0x1d67f, 4906, 1}, {0x1d680, 4907, 1},
+  {0x1d681, 4908, 1}, {0x1d682, 4909, 1}, {0x1d683, 4910, 1}, {0x1d684, 4911, 1},
+  {0x1d685, 4912, 1}, {0x1d686, 4913, 1}, {0x1d687, 4914, 1}, {0x1d688, 4915, 1},
+  {0x1d689, 4916, 1}, {0x1d68a, 4917, 1}, {0x1d68b, 4918, 1}, {0x1d68c, 4919, 1},
+  {0x1d68d, 4920, 1}, {0x1d68e, 4921, 1}, {0x1d68f, 4922, 1}, {0x1d690, 4923, 1},
+  {0x1d691, 4924, 1}, {0x1d692, 4925, 1}, {0x1d693, 4926, 1}, {0x1d694, 4927, 1},
+  {0x1d695, 4928, 1}, {0x1d696, 4929, 1}, {0x1d697, 4930, 1}, {0x1d698, 4931, 1},
+  {0x1d699, 4932, 1}, {0x1d69a, 4933, 1}, {0x1d69b, 4934, 1}, {0x1d69c, 4935, 1},
+  {0x1d69d, 4936, 1}, {0x1d69e, 4937, 1}, {0x1d69f, 4938, 1}, {0x1d6a0, 4939, 1},
+  {0x1d6a1, 4940, 1}, {0x1d6a2, 4941, 1}, {0x1d6a3, 4942, 1}, {0x1d6a4, 4943, 1},
+  {0x1d6a5, 4944, 1}, {0x1d6a8, 4945, 1}, {0x1d6a9, 4946, 1}, {0x1d6aa, 4947, 1},
+  {0x1d6ab, 4948, 1}, {0x1d6ac, 4949, 1}, {0x1d6ad, 4950, 1}, {0x1d6ae, 4951, 1},
+  {0x1d6af, 4952, 1}, {0x1d6b0, 4953, 1}, {0x1d6b1, 4954, 1}, {0x1d6b2, 4955, 1},
+  {0x1d6b3, 4956, 1}, {0x1d6b4, 4957, 1}, {0x1d6b5, 4958, 1}, {0x1d6b6, 4959, 1},
+  {0x1d6b7, 4960, 1}, {0x1d6b8, 4961, 1}, {0x1d6b9, 4962, 1}, {0x1d6ba, 4963, 1},
+  {0x1d6bb, 4964, 1}, {0x1d6bc, 4965, 1}, {0x1d6bd, 4966, 1}, {0x1d6be, 4967, 1},
+  {0x1d6bf, 4968, 1}, {0x1d6c0, 4969, 1}, {0x1d6c1, 4970, 1}, {0x1d6c2, 4971, 1},
+  {0x1d6c3, 4972, 1}, {0x1d6c4, 4973, 1}, {0x1d6c5, 4974, 1}, {0x1d6c6, 4975, 1},
+  {0x1d6c7, 4976, 1}, {0x1d6c8, 4977, 1}, {0x1d6c9, 4978, 1}, {0x1d6ca, 4979, 1},
+  {0x1d6cb, 4980, 1}, {0x1d6cc, 4981, 1}, {0x1d6cd, 4982, 1}, {0x1d6ce, 4983, 1},
+  {0x1d6cf, 4984, 1}, {0x1d6d0, 4985, 1}, {0x1d6d1, 4986, 1}, {0x1d6d2, 4987, 1},
+  {0x1d6d3, 4988, 1}, {0x1d6d4, 4989, 1}, {0x1d6d5, 4990, 1}, {0x1d6d6, 4991, 1},
+  {0x1d6d7, 4992, 1}, {0x1d6d8, 4993, 1}, {0x1d6d9, 4994, 1}, {0x1d6da, 4995, 1},
+  {0x1d6db, 4996, 1}, {0x1d6dc, 4997, 1}, {0x1d6dd, 4998, 1}, {0x1d6de, 4999, 1},
+  {0x1d6df, 5000, 1}, {0x1d6e0, 5001, 1}, {0x1d6e1, 5002, 1}, {0x1d6e2, 5003, 1},
+  {0x1d6e3, 5004, 1}, {0x1d6e4, 5005, 1}, {0x1d6e5, 5006, 1}, {0x1d6e6, 5007, 1},
+  {0x1d6e7, 5008, 1}, {0x1d6e8, 5009, 1}, {0x1d6e9, 5010, 1}, {0x1d6ea, 5011, 1},
+  {0x1d6eb, 5012, 1}, {0x1d6ec, 5013, 1}, {0x1d6ed, 5014, 1}, {0x1d6ee, 5015, 1},
+  {0x1d6ef, 5016, 1}, {0x1d6f0, 5017, 1}, {0x1d6f1, 5018, 1}, {0x1d6f2, 5019, 1},
+  {0x1d6f3, 5020, 1}, {0x1d6f4, 5021, 1}, {0x1d6f5, 5022, 1}, {0x1d6f6, 5023, 1},
+  {0x1d6f7, 5024, 1}, {0x1d6f8, 5025, 1}, {0x1d6f9, 5026, 1}, {0x1d6fa, 5027, 1},
+  {0x1d6fb, 5028, 1}, {0x1d6fc, 5029, 1}, {0x1d6fd, 5030, 1}, {0x1d6fe, 5031, 1},
+  {0x1d6ff, 5032, 1}, {0x1d700, 5033, 1}, {0x1d701, 5034, 1}, {0x1d702, 5035, 1},
+  {0x1d703, 5036, 1}, {0x1d704, 5037, 1}, {0x1d705, 5038, 1}, {0x1d706, 5039, 1},
+  {0x1d707, 5040, 1}, {0x1d708, 5041, 1}, {0x1d709, 5042, 1}, {0x1d70a, 5043, 1},
+  {0x1d70b, 5044, 1}, {0x1d70c, 5045, 1}, {0x1d70d, 5046, 1}, {0x1d70e, 5047, 1},
+  {0x1d70f, 5048, 1}, {0x1d710, 5049, 1}, {0x1d711, 5050, 1}, {0x1d712, 5051, 1},
+  {0x1d713, 5052, 1}, {0x1d714, 5053, 1}, {0x1d715, 5054, 1}, {0x1d716, 5055, 1},
+  {0x1d717, 5056, 1}, {0x1d718, 5057, 1}, {0x1d719, 5058, 1}, {0x1d71a, 5059, 1},
+  {0x1d71b, 5060, 1}, {0x1d71c, 5061, 1}, {0x1d71d, 5062, 1}, {0x1d71e, 5063, 1},
+  {0x1d71f, 5064, 1}, {0x1d720, 5065, 1}, {0x1d721, 5066, 1}, {0x1d722, 5067, 1},
+  {0x1d723, 5068, 1}, {0x1d724, 5069, 1}, {0x1d725, 5070, 1}, {0x1d726, 5071, 1},
+  {0x1d727, 5072, 1}, {0x1d728, 5073, 1}, {0x1d729, 5074, 1}, {0x1d72a, 5075, 1},
+  {0x1d72b, 5076, 1}, {0x1d72c, 5077, 1}, {0x1d72d, 5078, 1}, {0x1d72e, 5079, 1},
+  {0x1d72f, 5080, 1}, {0x1d730, 5081, 1}, {0x1d731, 5082, 1}, {0x1d732, 5083, 1},
+  {0x1d733, 5084, 1}, {0x1d734, 5085, 1}, {0x1d735, 5086, 1}, {0x1d736, 5087, 1},
+  {0x1d737, 5088, 1}, {0x1d738, 5089, 1}, {0x1d739, 5090, 1}, {0x1d73a, 5091, 1},
+  {0x1d73b, 5092, 1}, {0x1d73c, 5093, 1}, {0x1d73d, 5094, 1}, {0x1d73e, 5095, 1},
+  {0x1d73f, 5096, 1}, {0x1d740, 5097, 1}, {0x1d741, 5098, 1}, {0x1d742, 5099, 1},
+  {0x1d743, 5100, 1}, {0x1d744, 5101, 1}, {0x1d745, 5102, 1}, {0x1d746, 5103, 1},
+  {0x1d747, 5104, 1}, {0x1d748, 5105, 1}, {0x1d749, 5106, 1}, {0x1d74a, 5107, 1},
+  {0x1d74b, 5108, 1}, {0x1d74c, 5109, 1}, {0x1d74d, 5110, 1}, {0x1d74e, 5111, 1},
+  {0x1d74f, 5112, 1}, {0x1d750, 5113, 1}, {0x1d751, 5114, 1}, {0x1d752, 5115, 1},
+  {0x1d753, 5116, 1}, {0x1d754, 5117, 1}, {0x1d755, 5118, 1}, {0x1d756, 5119, 1},
+  {0x1d757, 5120, 1}, {0x1d758, 5121, 1}, {0x1d759, 5122, 1}, {0x1d75a, 5123, 1},
+  {0x1d75b, 5124, 1}, {0x1d75c, 5125, 1}, {0x1d75d, 5126, 1}, {0x1d75e, 5127, 1},
+  {0x1d75f, 5128, 1}, {0x1d760, 5129, 1}, {0x1d761, 5130, 1}, {0x1d762, 5131, 1},
+  {0x1d763, 5132, 1}, {0x1d764, 5133, 1}, {0x1d765, 5134, 1}, {0x1d766, 5135, 1},
+  {0x1d767, 5136, 1}, {0x1d768, 5137, 1}, {0x1d769, 5138, 1}, {0x1d76a, 5139, 1},
+  {0x1d76b, 5140, 1}, {0x1d76c, 5141, 1}, {0x1d76d, 5142, 1}, {0x1d76e, 5143, 1},
+  {0x1d76f, 5144, 1}, {0x1d770, 5145, 1}, {0x1d771, 5146, 1}, {0x1d772, 5147, 1},
+  {0x1d773, 5148, 1}, {0x1d774, 5149, 1}, {0x1d775, 5150, 1}, {0x1d776, 5151, 1},
+  {0x1d777, 5152, 1}, {0x1d778, 5153, 1}, {0x1d779, 5154, 1}, {0x1d77a, 5155, 1},
+  {0x1d77b, 5156, 1}, {0x1d77c, 5157, 1}, {0x1d77d, 5158, 1}, {0x1d77e, 5159, 1},
+  {0x1d77f, 5160, 1}, {0x1d780, 5161, 1}, {0x1d781, 5162, 1}, {0x1d782, 5163, 1},
+  {0x1d783, 5164, 1}, {0x1d784, 5165, 1}, {0x1d785, 5166, 1}, {0x1d786, 5167, 1},
+  {0x1d787, 5168, 1}, {0x1d788, 5169, 1}, {0x1d789, 5170, 1}, {0x1d78a, 5171, 1},
+  {0x1d78b, 5172, 1}, {0x1d78c, 5173, 1}, {0x1d78d, 5174, 1}, {0x1d78e, 5175, 1},
+  {0x1d78f, 5176, 1}, {0x1d790, 5177, 1}, {0x1d791, 5178, 1}, {0x1d792, 5179, 1},
+  {0x1d793, 5180, 1}, {0x1d794, 5181, 1}, {0x1d795, 5182, 1}, {0x1d796, 5183, 1},
+  {0x1d797, 5184, 1}, {0x1d798, 5185, 1}, {0x1d799, 5186, 1}, {0x1d79a, 5187, 1},
+  {0x1d79b, 5188, 1}, {0x1d79c, 5189, 1}, {0x1d79d, 5190, 1}, {0x1d79e, 5191, 1},
+  {0x1d79f, 5192, 1}, {0x1d7a0, 5193, 1}, {0x1d7a1, 5194, 1}, {0x1d7a2, 5195, 1},
+  {0x1d7a3, 5196, 1}, {0x1d7a4, 5197, 1}, {0x1d7a5, 5198, 1}, {0x1d7a6, 5199, 1},
+  {0x1d7a7, 5200, 1}, {0x1d7a8, 5201, 1}, {0x1d7a9, 5202, 1}, {0x1d7aa, 5203, 1},
+  {0x1d7ab, 5204, 1}, {0x1d7ac, 5205, 1}, {0x1d7ad, 5206, 1}, {0x1d7ae, 5207, 1},
+  {0x1d7af, 5208, 1}, {0x1d7b0, 5209, 1}, {0x1d7b1, 5210, 1}, {0x1d7b2, 5211, 1},
+  {0x1d7b3, 5212, 1}, {0x1d7b4, 5213, 1}, {0x1d7b5, 5214, 1}, {0x1d7b6, 5215, 1},
+  {0x1d7b7, 5216, 1}, {0x1d7b8, 5217, 1}, {0x1d7b9, 5218, 1}, {0x1d7ba, 5219, 1},
+  {0x1d7bb, 5220, 1}, {0x1d7bc, 5221, 1}, {0x1d7bd, 5222, 1}, {0x1d7be, 5223, 1},
+  {0x1d7bf, 5224, 1}, {0x1d7c0, 5225, 1}, {0x1d7c1, 5226, 1}, {0x1d7c2, 5227, 1},
+  {0x1d7c3, 5228, 1}, {0x1d7c4, 5229, 1}, {0x1d7c5, 5230, 1}, {0x1d7c6, 5231, 1},
+  {0x1d7c7, 5232, 1}, {0x1d7c8, 5233, 1}, {0x1d7c9, 5234, 1}, {0x1d7ca, 5235, 1},
+  {0x1d7cb, 5236, 1}, {0x1d7ce, 5237, 1}, {0x1d7cf, 5238, 1}, {0x1d7d0, 5239, 1},
+  {0x1d7d1, 5240, 1}, {0x1d7d2, 5241, 1}, {0x1d7d3, 5242, 1}, {0x1d7d4, 5243, 1},
+  {0x1d7d5, 5244, 1}, {0x1d7d6, 5245, 1}, {0x1d7d7, 5246, 1}, {0x1d7d8, 5247, 1},
+  {0x1d7d9, 5248, 1}, {0x1d7da, 5249, 1}, {0x1d7db, 5250, 1}, {0x1d7dc, 5251, 1},
+  {0x1d7dd, 5252, 1}, {0x1d7de, 5253, 1}, {0x1d7df, 5254, 1}, {0x1d7e0, 5255, 1},
+  {0x1d7e1, 5256, 1}, {0x1d7e2, 5257, 1}, {0x1d7e3, 5258, 1}, {0x1d7e4, 5259, 1},
+  {0x1d7e5, 5260, 1}, {0x1d7e6, 5261, 1}, {0x1d7e7, 5262, 1}, {0x1d7e8, 5263, 1},
+  {0x1d7e9, 5264, 1}, {0x1d7ea, 5265, 1}, {0x1d7eb, 5266, 1}, {0x1d7ec, 5267, 1},
+  {0x1d7ed, 5268, 1}, {0x1d7ee, 5269, 1}, {0x1d7ef, 5270, 1}, {0x1d7f0, 5271, 1},
+  {0x1d7f1, 5272, 1}, {0x1d7f2, 5273, 1}, {0x1d7f3, 5274, 1}, {0x1d7f4, 5275, 1},
+  {0x1d7f5, 5276, 1}, {0x1d7f6, 5277, 1}, {0x1d7f7, 5278, 1}, {0x1d7f8, 5279, 1},
+  {0x1d7f9, 5280, 1}, {0x1d7fa, 5281, 1}, {0x1d7fb, 5282, 1}, {0x1d7fc, 5283, 1},
+  {0x1d7fd, 5284, 1}, {0x1d7fe, 5285, 1}, {0x1d7ff, 5286, 1}, {0x1ee00, 5287, 1},
+  {0x1ee01, 5288, 1}, {0x1ee02, 5289, 1}, {0x1ee03, 5290, 1}, {0x1ee05, 5291, 1},
+  {0x1ee06, 5292, 1}, {0x1ee07, 5293, 1}, {0x1ee08, 5294, 1}, {0x1ee09, 5295, 1},
+  {0x1ee0a, 5296, 1}, {0x1ee0b, 5297, 1}, {0x1ee0c, 5298, 1}, {0x1ee0d, 5299, 1},
+  {0x1ee0e, 5300, 1}, {0x1ee0f, 5301, 1}, {0x1ee10, 5302, 1}, {0x1ee11, 5303, 1},
+  {0x1ee12, 5304, 1}, {0x1ee13, 5305, 1}, {0x1ee14, 5306, 1}, {0x1ee15, 5307, 1},
+  {0x1ee16, 5308, 1}, {0x1ee17, 5309, 1}, {0x1ee18, 5310, 1}, {0x1ee19, 5311, 1},
+  {0x1ee1a, 5312, 1}, {0x1ee1b, 5313, 1}, {0x1ee1c, 5314, 1}, {0x1ee1d, 5315, 1},
+  {0x1ee1e, 5316, 1}, {0x1ee1f, 5317, 1}, {0x1ee21, 5318, 1}, {0x1ee22, 5319, 1},
+  {0x1ee24, 5320, 1}, {0x1ee27, 5321, 1}, {0x1ee29, 5322, 1}, {0x1ee2a, 5323, 1},
+  {0x1ee2b, 5324, 1}, {0x1ee2c, 5325, 1}, {0x1ee2d, 5326, 1}, {0x1ee2e, 5327, 1},
+  {0x1ee2f, 5328, 1}, {0x1ee30, 5329, 1}, {0x1ee31, 5330, 1}, {0x1ee32, 5331, 1},
+  {0x1ee34, 5332, 1}, {0x1ee35, 5333, 1}, {0x1ee36, 5334, 1}, {0x1ee37, 5335, 1},
+  {0x1ee39, 5336, 1}, {0x1ee3b, 5337, 1}, {0x1ee42, 5338, 1}, {0x1ee47, 5339, 1},
+  {0x1ee49, 5340, 1}, {0x1ee4b, 5341, 1}, {0x1ee4d, 5342, 1}, {0x1ee4e, 5343, 1},
+  {0x1ee4f, 5344, 1}, {0x1ee51, 5345, 1}, {0x1ee52, 5346, 1}, {0x1ee54, 5347, 1},
+  {0x1ee57, 5348, 1}, {0x1ee59, 5349, 1}, {0x1ee5b, 5350, 1}, {0x1ee5d, 5351, 1},
+  {0x1ee5f, 5352, 1}, {0x1ee61, 5353, 1}, {0x1ee62, 5354, 1}, {0x1ee64, 5355, 1},
+  {0x1ee67, 5356, 1}, {0x1ee68, 5357, 1}, {0x1ee69, 5358, 1}, {0x1ee6a, 5359, 1},
+  {0x1ee6c, 5360, 1}, {0x1ee6d, 5361, 1}, {0x1ee6e, 5362, 1}, {0x1ee6f, 5363, 1},
+  {0x1ee70, 5364, 1}, {0x1ee71, 5365, 1}, {0x1ee72, 5366, 1}, {0x1ee74, 5367, 1},
+  {0x1ee75, 5368, 1}, {0x1ee76, 5369, 1}, {0x1ee77, 5370, 1}, {0x1ee79, 5371, 1},
+  {0x1ee7a, 5372, 1}, {0x1ee7b, 5373, 1}, {0x1ee7c, 5374, 1}, {0x1ee7e, 5375, 1},
+  {0x1ee80, 5376, 1}, {0x1ee81, 5377, 1}, {0x1ee82, 5378, 1}, {0x1ee83, 5379, 1},
+  {0x1ee84, 5380, 1}, {0x1ee85, 5381, 1}, {0x1ee86, 5382, 1}, {0x1ee87, 5383, 1},
+  {0x1ee88, 5384, 1}, {0x1ee89, 5385, 1}, {0x1ee8b, 5386, 1}, {0x1ee8c, 5387, 1},
+  {0x1ee8d, 5388, 1}, {0x1ee8e, 5389, 1}, {0x1ee8f, 5390, 1}, {0x1ee90, 5391, 1},
+  {0x1ee91, 5392, 1}, {0x1ee92, 5393, 1}, {0x1ee93, 5394, 1}, {0x1ee94, 5395, 1},
+  {0x1ee95, 5396, 1}, {0x1ee96, 5397, 1}, {0x1ee97, 5398, 1}, {0x1ee98, 5399, 1},
+  {0x1ee99, 5400, 1}, {0x1ee9a, 5401, 1}, {0x1ee9b, 5402, 1}, {0x1eea1, 5403, 1},
+  {0x1eea2, 5404, 1}, {0x1eea3, 5405, 1}, {0x1eea5, 5406, 1}, {0x1eea6, 5407, 1},
+  {0x1eea7, 5408, 1}, {0x1eea8, 5409, 1}, {0x1eea9, 5410, 1}, {0x1eeab, 5411, 1},
+  {0x1eeac, 5412, 1}, {0x1eead, 5413, 1}, {0x1eeae, 5414, 1}, {0x1eeaf, 5415, 1},
+  {0x1eeb0, 5416, 1}, {0x1eeb1, 5417, 1}, {0x1eeb2, 5418, 1}, {0x1eeb3, 5419, 1},
+  {0x1eeb4, 5420, 1}, {0x1eeb5, 5421, 1}, {0x1eeb6, 5422, 1}, {0x1eeb7, 5423, 1},
+  {0x1eeb8, 5424, 1}, {0x1eeb9, 5425, 1}, {0x1eeba, 5426, 1}, {0x1eebb, 5427, 1},
+  {0x1f100, 5428, 2}, {0x1f101, 5430, 2}, {0x1f102, 5432, 2}, {0x1f103, 5434, 2},
+  {0x1f104, 5436, 2}, {0x1f105, 5438, 2}, {0x1f106, 5440, 2}, {0x1f107, 5442, 2},
+  {0x1f108, 5444, 2}, {0x1f109, 5446, 2}, {0x1f10a, 5448, 2}, {0x1f110, 5450, 3},
+  {0x1f111, 5453, 3}, {0x1f112, 5456, 3}, {0x1f113, 5459, 3}, {0x1f114, 5462, 3},
+  {0x1f115, 5465, 3}, {0x1f116, 5468, 3}, {0x1f117, 5471, 3}, {0x1f118, 5474, 3},
+  {0x1f119, 5477, 3}, {0x1f11a, 5480, 3}, {0x1f11b, 5483, 3}, {0x1f11c, 5486, 3},
+  {0x1f11d, 5489, 3}, {0x1f11e, 5492, 3}, {0x1f11f, 5495, 3}, {0x1f120, 5498, 3},
+  {0x1f121, 5501, 3}, {0x1f122, 5504, 3}, {0x1f123, 5507, 3}, {0x1f124, 5510, 3},
+  {0x1f125, 5513, 3}, {0x1f126, 5516, 3}, {0x1f127, 5519, 3}, {0x1f128, 5522, 3},
+  {0x1f129, 5525, 3}, {0x1f12a, 5528, 3}, {0x1f12b, 5531, 1}, {0x1f12c, 5532, 1},
+  {0x1f12d, 5533, 2}, {0x1f12e, 5535, 2}, {0x1f130, 5537, 1}, {0x1f131, 5538, 1},
+  {0x1f132, 5539, 1}, {0x1f133, 5540, 1}, {0x1f134, 5541, 1}, {0x1f135, 5542, 1},
+  {0x1f136, 5543, 1}, {0x1f137, 5544, 1}, {0x1f138, 5545, 1}, {0x1f139, 5546, 1},
+  {0x1f13a, 5547, 1}, {0x1f13b, 5548, 1}, {0x1f13c, 5549, 1}, {0x1f13d, 5550, 1},
+  {0x1f13e, 5551, 1}, {0x1f13f, 5552, 1}, {0x1f140, 5553, 1}, {0x1f141, 5554, 1},
+  {0x1f142, 5555, 1}, {0x1f143, 5556, 1}, {0x1f144, 5557, 1}, {0x1f145, 5558, 1},
+  {0x1f146, 5559, 1}, {0x1f147, 5560, 1}, {0x1f148, 5561, 1}, {0x1f149, 5562, 1},
+  {0x1f14a, 5563, 2}, {0x1f14b, 5565, 2}, {0x1f14c, 5567, 2}, {0x1f14d, 5569, 2},
+  {0x1f14e, 5571, 3}, {0x1f14f, 5574, 2}, {0x1f16a, 5576, 2}, {0x1f16b, 5578, 2},
+  {0x1f16c, 5580, 2}, {0x1f190, 5582, 2}, {0x1f200, 5584, 2}, {0x1f201, 5586, 2},
+  {0x1f202, 5588, 1}, {0x1f210, 5589, 1}, {0x1f211, 5590, 1}, {0x1f212, 5591, 1},
+  {0x1f213, 5592, 2}, {0x1f214, 5594, 1}, {0x1f215, 5595, 1}, {0x1f216, 5596, 1},
+  {0x1f217, 5597, 1}, {0x1f218, 5598, 1}, {0x1f219, 5599, 1}, {0x1f21a, 5600, 1},
+  {0x1f21b, 5601, 1}, {0x1f21c, 5602, 1}, {0x1f21d, 5603, 1}, {0x1f21e, 5604, 1},
+  {0x1f21f, 5605, 1}, {0x1f220, 5606, 1}, {0x1f221, 5607, 1}, {0x1f222, 5608, 1},
+  {0x1f223, 5609, 1}, {0x1f224, 5610, 1}, {0x1f225, 5611, 1}, {0x1f226, 5612, 1},
+  {0x1f227, 5613, 1}, {0x1f228, 5614, 1}, {0x1f229, 5615, 1}, {0x1f22a, 5616, 1},
+  {0x1f22b, 5617, 1}, {0x1f22c, 5618, 1}, {0x1f22d, 5619, 1}, {0x1f22e, 5620, 1},
+  {0x1f22f, 5621, 1}, {0x1f230, 5622, 1}, {0x1f231, 5623, 1}, {0x1f232, 5624, 1},
+  {0x1f233, 5625, 1}, {0x1f234, 5626, 1}, {0x1f235, 5627, 1}, {0x1f236, 5628, 1},
+  {0x1f237, 5629, 1}, {0x1f238, 5630, 1}, {0x1f239, 5631, 1}, {0x1f23a, 5632, 1},
+  {0x1f23b, 5633, 1}, {0x1f240, 5634, 3}, {0x1f241, 5637, 3}, {0x1f242, 5640, 3},
+  {0x1f243, 5643, 3}, {0x1f244, 5646, 3}, {0x1f245, 5649, 3}, {0x1f246, 5652, 3},
+  {0x1f247, 5655, 3}, {0x1f248, 5658, 3}, {0x1f250, 5661, 1}, {0x1f251, 5662, 1},
+  {0x1fbf0, 5663, 1}, {0x1fbf1, 5664, 1}, {0x1fbf2, 5665, 1}, {0x1fbf3, 5666, 1},
+  {0x1fbf4, 5667, 1}, {0x1fbf5, 5668, 1}, {0x1fbf6, 5669, 1}, {0x1fbf7, 5670, 1},
+  {0x1fbf8, 5671, 1}, {0x1fbf9, 5672, 1},
+};
+
+const size_t kNumCompatMappings = 3750;
+
+const int32_t kCompatData[5673] = {
+  0x0020, 0x0020, 0x0308, 0x0061, 0x0020, 0x0304, 0x0032, 0x0033,
+  0x0020, 0x0301, 0x03bc, 0x0020, 0x0327, 0x0031, 0x006f, 0x0031,
+  0x2044, 0x0034, 0x0031, 0x2044, 0x0032, 0x0033, 0x2044, 0x0034,
+  0x0049, 0x004a, 0x0069, 0x006a, 0x004c, 0x00b7, 0x006c, 0x00b7,
+  0x02bc, 0x006e, 0x0073, 0x0044, 0x005a, 0x030c, 0x0044, 0x007a,
+  0x030c, 0x0064, 0x007a, 0x030c, 0x004c, 0x004a, 0x004c, 0x006a,
+  0x006c, 0x006a, 0x004e, 0x004a, 0x004e, 0x006a, 0x006e, 0x006a,
+  0x0044, 0x005a, 0x0044, 0x007a, 0x0064, 0x007a, 0x0068, 0x0266,
+  0x006a, 0x0072, 0x0279, 0x027b, 0x0281, 0x0077, 0x0079, 0x0020,
+  0x0306, 0x0020, 0x0307, 0x0020, 0x030a, 0x0020, 0x0328, 0x0020,
+  0x0303, 0x0020, 0x030b, 0x0263, 0x006c, 0x0073, 0x0078, 0x0295,
+  0x0020, 0x0345, 0x0020, 0x0301, 0x0020, 0x0308, 0x0301, 0x03b2,
+  0x03b8, 0x03a5, 0x03a5, 0x0301, 0x03a5, 0x0308, 0x03c6, 0x03c0,
+  0x03ba, 0x03c1, 0x03c2, 0x0398, 0x03b5, 0x03a3, 0x0565, 0x0582,
+  0x0627, 0x0674, 0x0648, 0x0674, 0x06c7, 0x0674, 0x064a, 0x0674,
+  0x0e4d, 0x0e32, 0x0ecd, 0x0eb2, 0x0eab, 0x0e99, 0x0eab, 0x0ea1,
+  0x0f0b, 0x0fb2, 0x0f71, 0x0f80, 0x0fb3, 0x0f71, 0x0f80, 0x10dc,
+  0x0041, 0x00c6, 0x0042, 0x0044, 0x0045, 0x018e, 0x0047, 0x0048,
+  0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0222,
+  0x0050, 0x0052, 0x0054, 0x0055, 0x0057, 0x0061, 0x0250, 0x0251,
+  0x1d02, 0x0062, 0x0064, 0x0065, 0x0259, 0x025b, 0x025c, 0x0067,
+  0x006b, 0x006d, 0x014b, 0x006f, 0x0254, 0x1d16, 0x1d17, 0x0070,
+  0x0074, 0x0075, 0x1d1d, 0x026f, 0x0076, 0x1d25, 0x03b2, 0x03b3,
+  0x03b4, 0x03c6, 0x03c7, 0x0069, 0x0072, 0x0075, 0x0076, 0x03b2,
+  0x03b3, 0x03c1, 0x03c6, 0x03c7, 0x043d, 0x0252, 0x0063, 0x0255,
+  0x00f0, 0x025c, 0x0066, 0x025f, 0x0261, 0x0265, 0x0268, 0x0269,
+  0x026a, 0x1d7b, 0x029d, 0x026d, 0x1d85, 0x029f, 0x0271, 0x0270,
+  0x0272, 0x0273, 0x0274, 0x0275, 0x0278, 0x0282, 0x0283, 0x01ab,
+  0x0289, 0x028a, 0x1d1c, 0x028b, 0x028c, 0x007a, 0x0290, 0x0291,
+  0x0292, 0x03b8, 0x0061, 0x02be, 0x0073, 0x0307, 0x0020, 0x0313,
+  0x0020, 0x0313, 0x0020, 0x0342, 0x0020, 0x0308, 0x0342, 0x0020,
+  0x0313, 0x0300, 0x0020, 0x0313, 0x0301, 0x0020, 0x0313, 0x0342,
+  0x0020, 0x0314, 0x0300, 0x0020, 0x0314, 0x0301, 0x0020, 0x0314,
+  0x0342, 0x0020, 0x0308, 0x0300, 0x0020, 0x0308, 0x0301, 0x0020,
+  0x0301, 0x0020, 0x0314, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x2010, 0x0020,
+  0x0333, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x002e, 0x0020,
+  0x2032, 0x2032, 0x2032, 0x2032, 0x2032, 0x2035, 0x2035, 0x2035,
+  0x2035, 0x2035, 0x0021, 0x0021, 0x0020, 0x0305, 0x003f, 0x003f,
+  0x003f, 0x0021, 0x0021, 0x003f, 0x2032, 0x2032, 0x2032, 0x2032,
+  0x0020, 0x0030, 0x0069, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038,
+  0x0039, 0x002b, 0x2212, 0x003d, 0x0028, 0x0029, 0x006e, 0x0030,
+  0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038,
+  0x0039, 0x002b, 0x2212, 0x003d, 0x0028, 0x0029, 0x0061, 0x0065,
+  0x006f, 0x0078, 0x0259, 0x0068, 0x006b, 0x006c, 0x006d, 0x006e,
+  0x0070, 0x0073, 0x0074, 0x0052, 0x0073, 0x0061, 0x002f, 0x0063,
+  0x0061, 0x002f, 0x0073, 0x0043, 0x00b0, 0x0043, 0x0063, 0x002f,
+  0x006f, 0x0063, 0x002f, 0x0075, 0x0190, 0x00b0, 0x0046, 0x0067,
+  0x0048, 0x0048, 0x0048, 0x0068, 0x0127, 0x0049, 0x0049, 0x004c,
+  0x006c, 0x004e, 0x004e, 0x006f, 0x0050, 0x0051, 0x0052, 0x0052,
+  0x0052, 0x0053, 0x004d, 0x0054, 0x0045, 0x004c, 0x0054, 0x004d,
+  0x005a, 0x005a, 0x0042, 0x0043, 0x0065, 0x0045, 0x0046, 0x004d,
+  0x006f, 0x05d0, 0x05d1, 0x05d2, 0x05d3, 0x0069, 0x0046, 0x0041,
+  0x0058, 0x03c0, 0x03b3, 0x0393, 0x03a0, 0x2211, 0x0044, 0x0064,
+  0x0065, 0x0069, 0x006a, 0x0031, 0x2044, 0x0037, 0x0031, 0x2044,
+  0x0039, 0x0031, 0x2044, 0x0031, 0x0030, 0x0031, 0x2044, 0x0033,
+  0x0032, 0x2044, 0x0033, 0x0031, 0x2044, 0x0035, 0x0032, 0x2044,
+  0x0035, 0x0033, 0x2044, 0x0035, 0x0034, 0x2044, 0x0035, 0x0031,
+  0x2044, 0x0036, 0x0035, 0x2044, 0x0036, 0x0031, 0x2044, 0x0038,
+  0x0033, 0x2044, 0x0038, 0x0035, 0x2044, 0x0038, 0x0037, 0x2044,
+  0x0038, 0x0031, 0x2044, 0x0049, 0x0049, 0x0049, 0x0049, 0x0049,
+  0x0049, 0x0049, 0x0056, 0x0056, 0x0056, 0x0049, 0x0056, 0x0049,
+  0x0049, 0x0056, 0x0049, 0x0049, 0x0049, 0x0049, 0x0058, 0x0058,
+  0x0058, 0x0049, 0x0058, 0x0049, 0x0049, 0x004c, 0x0043, 0x0044,
+  0x004d, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069, 0x0069,
+  0x0076, 0x0076, 0x0076, 0x0069, 0x0076, 0x0069, 0x0069, 0x0076,
+  0x0069, 0x0069, 0x0069, 0x0069, 0x0078, 0x0078, 0x0078, 0x0069,
+  0x0078, 0x0069, 0x0069, 0x006c, 0x0063, 0x0064, 0x006d, 0x0030,
+  0x2044, 0x0033, 0x222b, 0x222b, 0x222b, 0x222b, 0x222b, 0x222e,
+  0x222e, 0x222e, 0x222e, 0x222e, 0x0031, 0x0032, 0x0033, 0x0034,
+  0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x0031, 0x0030, 0x0031,
+  0x0031, 0x0031, 0x0032, 0x0031, 0x0033, 0x0031, 0x0034, 0x0031,
+  0x0035, 0x0031, 0x0036, 0x0031, 0x0037, 0x0031, 0x0038, 0x0031,
+  0x0039, 0x0032, 0x0030, 0x0028, 0x0031, 0x0029, 0x0028, 0x0032,
+  0x0029, 0x0028, 0x0033, 0x0029, 0x0028, 0x0034, 0x0029, 0x0028,
+  0x0035, 0x0029, 0x0028, 0x0036, 0x0029, 0x0028, 0x0037, 0x0029,
+  0x0028, 0x0038, 0x0029, 0x0028, 0x0039, 0x0029, 0x0028, 0x0031,
+  0x0030, 0x0029, 0x0028, 0x0031, 0x0031, 0x0029, 0x0028, 0x0031,
+  0x0032, 0x0029, 0x0028, 0x0031, 0x0033, 0x0029, 0x0028, 0x0031,
+  0x0034, 0x0029, 0x0028, 0x0031, 0x0035, 0x0029, 0x0028, 0x0031,
+  0x0036, 0x0029, 0x0028, 0x0031, 0x0037, 0x0029, 0x0028, 0x0031,
+  0x0038, 0x0029, 0x0028, 0x0031, 0x0039, 0x0029, 0x0028, 0x0032,
+  0x0030, 0x0029, 0x0031, 0x002e, 0x0032, 0x002e, 0x0033, 0x002e,
+  0x0034, 0x002e, 0x0035, 0x002e, 0x0036, 0x002e, 0x0037, 0x002e,
+  0x0038, 0x002e, 0x0039, 0x002e, 0x0031, 0x0030, 0x002e, 0x0031,
+  0x0031, 0x002e, 0x0031, 0x0032, 0x002e, 0x0031, 0x0033, 0x002e,
+  0x0031, 0x0034, 0x002e, 0x0031, 0x0035, 0x002e, 0x0031, 0x0036,
+  0x002e, 0x0031, 0x0037, 0x002e, 0x0031, 0x0038, 0x002e, 0x0031,
+  0x0039, 0x002e, 0x0032, 0x0030, 0x002e, 0x0028, 0x0061, 0x0029,
+  0x0028, 0x0062, 0x0029, 0x0028, 0x0063, 0x0029, 0x0028, 0x0064,
+  0x0029, 0x0028, 0x0065, 0x0029, 0x0028, 0x0066, 0x0029, 0x0028,
+  0x0067, 0x0029, 0x0028, 0x0068, 0x0029, 0x0028, 0x0069, 0x0029,
+  0x0028, 0x006a, 0x0029, 0x0028, 0x006b, 0x0029, 0x0028, 0x006c,
+  0x0029, 0x0028, 0x006d, 0x0029, 0x0028, 0x006e, 0x0029, 0x0028,
+  0x006f, 0x0029, 0x0028, 0x0070, 0x0029, 0x0028, 0x0071, 0x0029,
+  0x0028, 0x0072, 0x0029, 0x0028, 0x0073, 0x0029, 0x0028, 0x0074,
+  0x0029, 0x0028, 0x0075, 0x0029, 0x0028, 0x0076, 0x0029, 0x0028,
+  0x0077, 0x0029, 0x0028, 0x0078, 0x0029, 0x0028, 0x0079, 0x0029,
+  0x0028, 0x007a, 0x0029, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045,
+  0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d,
+  0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055,
+  0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x0061, 0x0062, 0x0063,
+  0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b,
+  0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073,
+  0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x0030,
+  0x222b, 0x222b, 0x222b, 0x222b, 0x003a, 0x003a, 0x003d, 0x003d,
+  0x003d, 0x003d, 0x003d, 0x003d, 0x006a, 0x0056, 0x2d61, 0x6bcd,
+  0x9f9f, 0x4e00, 0x4e28, 0x4e36, 0x4e3f, 0x4e59, 0x4e85, 0x4e8c,
+  0x4ea0, 0x4eba, 0x513f, 0x5165, 0x516b, 0x5182, 0x5196, 0x51ab,
+  0x51e0, 0x51f5, 0x5200, 0x529b, 0x52f9, 0x5315, 0x531a, 0x5338,
+  0x5341, 0x535c, 0x5369, 0x5382, 0x53b6, 0x53c8, 0x53e3, 0x56d7,
+  0x571f, 0x58eb, 0x5902, 0x590a, 0x5915, 0x5927, 0x5973, 0x5b50,
+  0x5b80, 0x5bf8, 0x5c0f, 0x5c22, 0x5c38, 0x5c6e, 0x5c71, 0x5ddb,
+  0x5de5, 0x5df1, 0x5dfe, 0x5e72, 0x5e7a, 0x5e7f, 0x5ef4, 0x5efe,
+  0x5f0b, 0x5f13, 0x5f50, 0x5f61, 0x5f73, 0x5fc3, 0x6208, 0x6236,
+  0x624b, 0x652f, 0x6534, 0x6587, 0x6597, 0x65a4, 0x65b9, 0x65e0,
+  0x65e5, 0x66f0, 0x6708, 0x6728, 0x6b20, 0x6b62, 0x6b79, 0x6bb3,
+  0x6bcb, 0x6bd4, 0x6bdb, 0x6c0f, 0x6c14, 0x6c34, 0x706b, 0x722a,
+  0x7236, 0x723b, 0x723f, 0x7247, 0x7259, 0x725b, 0x72ac, 0x7384,
+  0x7389, 0x74dc, 0x74e6, 0x7518, 0x751f, 0x7528, 0x7530, 0x758b,
+  0x7592, 0x7676, 0x767d, 0x76ae, 0x76bf, 0x76ee, 0x77db, 0x77e2,
+  0x77f3, 0x793a, 0x79b8, 0x79be, 0x7a74, 0x7acb, 0x7af9, 0x7c73,
+  0x7cf8, 0x7f36, 0x7f51, 0x7f8a, 0x7fbd, 0x8001, 0x800c, 0x8012,
+  0x8033, 0x807f, 0x8089, 0x81e3, 0x81ea, 0x81f3, 0x81fc, 0x820c,
+  0x821b, 0x821f, 0x826e, 0x8272, 0x8278, 0x864d, 0x866b, 0x8840,
+  0x884c, 0x8863, 0x897e, 0x898b, 0x89d2, 0x8a00, 0x8c37, 0x8c46,
+  0x8c55, 0x8c78, 0x8c9d, 0x8d64, 0x8d70, 0x8db3, 0x8eab, 0x8eca,
+  0x8f9b, 0x8fb0, 0x8fb5, 0x9091, 0x9149, 0x91c6, 0x91cc, 0x91d1,
+  0x9577, 0x9580, 0x961c, 0x96b6, 0x96b9, 0x96e8, 0x9751, 0x975e,
+  0x9762, 0x9769, 0x97cb, 0x97ed, 0x97f3, 0x9801, 0x98a8, 0x98db,
+  0x98df, 0x9996, 0x9999, 0x99ac, 0x9aa8, 0x9ad8, 0x9adf, 0x9b25,
+  0x9b2f, 0x9b32, 0x9b3c, 0x9b5a, 0x9ce5, 0x9e75, 0x9e7f, 0x9ea5,
+  0x9ebb, 0x9ec3, 0x9ecd, 0x9ed1, 0x9ef9, 0x9efd, 0x9f0e, 0x9f13,
+  0x9f20, 0x9f3b, 0x9f4a, 0x9f52, 0x9f8d, 0x9f9c, 0x9fa0, 0x0020,
+  0x3012, 0x5341, 0x5344, 0x5345, 0x0020, 0x3099, 0x0020, 0x309a,
+  0x3088, 0x308a, 0x30b3, 0x30c8, 0x1100, 0x1101, 0x11aa, 0x1102,
+  0x11ac, 0x11ad, 0x1103, 0x1104, 0x1105, 0x11b0, 0x11b1, 0x11b2,
+  0x11b3, 0x11b4, 0x11b5, 0x111a, 0x1106, 0x1107, 0x1108, 0x1121,
+  0x1109, 0x110a, 0x110b, 0x110c, 0x110d, 0x110e, 0x110f, 0x1110,
+  0x1111, 0x1112, 0x1161, 0x1162, 0x1163, 0x1164, 0x1165, 0x1166,
+  0x1167, 0x1168, 0x1169, 0x116a, 0x116b, 0x116c, 0x116d, 0x116e,
+  0x116f, 0x1170, 0x1171, 0x1172, 0x1173, 0x1174, 0x1175, 0x1160,
+  0x1114, 0x1115, 0x11c7, 0x11c8, 0x11cc, 0x11ce, 0x11d3, 0x11d7,
+  0x11d9, 0x111c, 0x11dd, 0x11df, 0x111d, 0x111e, 0x1120, 0x1122,
+  0x1123, 0x1127, 0x1129, 0x112b, 0x112c, 0x112d, 0x112e, 0x112f,
+  0x1132, 0x1136, 0x1140, 0x1147, 0x114c, 0x11f1, 0x11f2, 0x1157,
+  0x1158, 0x1159, 0x1184, 0x1185, 0x1188, 0x1191, 0x1192, 0x1194,
+  0x119e, 0x11a1, 0x4e00, 0x4e8c, 0x4e09, 0x56db, 0x4e0a, 0x4e2d,
+  0x4e0b, 0x7532, 0x4e59, 0x4e19, 0x4e01, 0x5929, 0x5730, 0x4eba,
+  0x0028, 0x1100, 0x0029, 0x0028, 0x1102, 0x0029, 0x0028, 0x1103,
+  0x0029, 0x0028, 0x1105, 0x0029, 0x0028, 0x1106, 0x0029, 0x0028,
+  0x1107, 0x0029, 0x0028, 0x1109, 0x0029, 0x0028, 0x110b, 0x0029,
+  0x0028, 0x110c, 0x0029, 0x0028, 0x110e, 0x0029, 0x0028, 0x110f,
+  0x0029, 0x0028, 0x1110, 0x0029, 0x0028, 0x1111, 0x0029, 0x0028,
+  0x1112, 0x0029, 0x0028, 0x1100, 0x1161, 0x0029, 0x0028, 0x1102,
+  0x1161, 0x0029, 0x0028, 0x1103, 0x1161, 0x0029, 0x0028, 0x1105,
+  0x1161, 0x0029, 0x0028, 0x1106, 0x1161, 0x0029, 0x0028, 0x1107,
+  0x1161, 0x0029, 0x0028, 0x1109, 0x1161, 0x0029, 0x0028, 0x110b,
+  0x1161, 0x0029, 0x0028, 0x110c, 0x1161, 0x0029, 0x0028, 0x110e,
+  0x1161, 0x0029, 0x0028, 0x110f, 0x1161, 0x0029, 0x0028, 0x1110,
+  0x1161, 0x0029, 0x0028, 0x1111, 0x1161, 0x0029, 0x0028, 0x1112,
+  0x1161, 0x0029, 0x0028, 0x110c, 0x116e, 0x0029, 0x0028, 0x110b,
+  0x1169, 0x110c, 0x1165, 0x11ab, 0x0029, 0x0028, 0x110b, 0x1169,
+  0x1112, 0x116e, 0x0029, 0x0028, 0x4e00, 0x0029, 0x0028, 0x4e8c,
+  0x0029, 0x0028, 0x4e09, 0x0029, 0x0028, 0x56db, 0x0029, 0x0028,
+  0x4e94, 0x0029, 0x0028, 0x516d, 0x0029, 0x0028, 0x4e03, 0x0029,
+  0x0028, 0x516b, 0x0029, 0x0028, 0x4e5d, 0x0029, 0x0028, 0x5341,
+  0x0029, 0x0028, 0x6708, 0x0029, 0x0028, 0x706b, 0x0029, 0x0028,
+  0x6c34, 0x0029, 0x0028, 0x6728, 0x0029, 0x0028, 0x91d1, 0x0029,
+  0x0028, 0x571f, 0x0029, 0x0028, 0x65e5, 0x0029, 0x0028, 0x682a,
+  0x0029, 0x0028, 0x6709, 0x0029, 0x0028, 0x793e, 0x0029, 0x0028,
+  0x540d, 0x0029, 0x0028, 0x7279, 0x0029, 0x0028, 0x8ca1, 0x0029,
+  0x0028, 0x795d, 0x0029, 0x0028, 0x52b4, 0x0029, 0x0028, 0x4ee3,
+  0x0029, 0x0028, 0x547c, 0x0029, 0x0028, 0x5b66, 0x0029, 0x0028,
+  0x76e3, 0x0029, 0x0028, 0x4f01, 0x0029, 0x0028, 0x8cc7, 0x0029,
+  0x0028, 0x5354, 0x0029, 0x0028, 0x796d, 0x0029, 0x0028, 0x4f11,
+  0x0029, 0x0028, 0x81ea, 0x0029, 0x0028, 0x81f3, 0x0029, 0x554f,
+  0x5e7c, 0x6587, 0x7b8f, 0x0050, 0x0054, 0x0045, 0x0032, 0x0031,
+  0x0032, 0x0032, 0x0032, 0x0033, 0x0032, 0x0034, 0x0032, 0x0035,
+  0x0032, 0x0036, 0x0032, 0x0037, 0x0032, 0x0038, 0x0032, 0x0039,
+  0x0033, 0x0030, 0x0033, 0x0031, 0x0033, 0x0032, 0x0033, 0x0033,
+  0x0033, 0x0034, 0x0033, 0x0035, 0x1100, 0x1102, 0x1103, 0x1105,
+  0x1106, 0x1107, 0x1109, 0x110b, 0x110c, 0x110e, 0x110f, 0x1110,
+  0x1111, 0x1112, 0x1100, 0x1161, 0x1102, 0x1161, 0x1103, 0x1161,
+  0x1105, 0x1161, 0x1106, 0x1161, 0x1107, 0x1161, 0x1109, 0x1161,
+  0x110b, 0x1161, 0x110c, 0x1161, 0x110e, 0x1161, 0x110f, 0x1161,
+  0x1110, 0x1161, 0x1111, 0x1161, 0x1112, 0x1161, 0x110e, 0x1161,
+  0x11b7, 0x1100, 0x1169, 0x110c, 0x116e, 0x110b, 0x1174, 0x110b,
+  0x116e, 0x4e00, 0x4e8c, 0x4e09, 0x56db, 0x4e94, 0x516d, 0x4e03,
+  0x516b, 0x4e5d, 0x5341, 0x6708, 0x706b, 0x6c34, 0x6728, 0x91d1,
+  0x571f, 0x65e5, 0x682a, 0x6709, 0x793e, 0x540d, 0x7279, 0x8ca1,
+  0x795d, 0x52b4, 0x79d8, 0x7537, 0x5973, 0x9069, 0x512a, 0x5370,
+  0x6ce8, 0x9805, 0x4f11, 0x5199, 0x6b63, 0x4e0a, 0x4e2d, 0x4e0b,
+  0x5de6, 0x53f3, 0x533b, 0x5b97, 0x5b66, 0x76e3, 0x4f01, 0x8cc7,
+  0x5354, 0x591c, 0x0033, 0x0036, 0x0033, 0x0037, 0x0033, 0x0038,
+  0x0033, 0x0039, 0x0034, 0x0030, 0x0034, 0x0031, 0x0034, 0x0032,
+  0x0034, 0x0033, 0x0034, 0x0034, 0x0034, 0x0035, 0x0034, 0x0036,
+  0x0034, 0x0037, 0x0034, 0x0038, 0x0034, 0x0039, 0x0035, 0x0030,
+  0x0031, 0x6708, 0x0032, 0x6708, 0x0033, 0x6708, 0x0034, 0x6708,
+  0x0035, 0x6708, 0x0036, 0x6708, 0x0037, 0x6708, 0x0038, 0x6708,
+  0x0039, 0x6708, 0x0031, 0x0030, 0x6708, 0x0031, 0x0031, 0x6708,
+  0x0031, 0x0032, 0x6708, 0x0048, 0x0067, 0x0065, 0x0072, 0x0067,
+  0x0065, 0x0056, 0x004c, 0x0054, 0x0044, 0x30a2, 0x30a4, 0x30a6,
+  0x30a8, 0x30aa, 0x30ab, 0x30ad, 0x30af, 0x30b1, 0x30b3, 0x30b5,
+  0x30b7, 0x30b9, 0x30bb, 0x30bd, 0x30bf, 0x30c1, 0x30c4, 0x30c6,
+  0x30c8, 0x30ca, 0x30cb, 0x30cc, 0x30cd, 0x30ce, 0x30cf, 0x30d2,
+  0x30d5, 0x30d8, 0x30db, 0x30de, 0x30df, 0x30e0, 0x30e1, 0x30e2,
+  0x30e4, 0x30e6, 0x30e8, 0x30e9, 0x30ea, 0x30eb, 0x30ec, 0x30ed,
+  0x30ef, 0x30f0, 0x30f1, 0x30f2, 0x4ee4, 0x548c, 0x30a2, 0x30cf,
+  0x309a, 0x30fc, 0x30c8, 0x30a2, 0x30eb, 0x30d5, 0x30a1, 0x30a2,
+  0x30f3, 0x30d8, 0x309a, 0x30a2, 0x30a2, 0x30fc, 0x30eb, 0x30a4,
+  0x30cb, 0x30f3, 0x30af, 0x3099, 0x30a4, 0x30f3, 0x30c1, 0x30a6,
+  0x30a9, 0x30f3, 0x30a8, 0x30b9, 0x30af, 0x30fc, 0x30c8, 0x3099,
+  0x30a8, 0x30fc, 0x30ab, 0x30fc, 0x30aa, 0x30f3, 0x30b9, 0x30aa,
+  0x30fc, 0x30e0, 0x30ab, 0x30a4, 0x30ea, 0x30ab, 0x30e9, 0x30c3,
+  0x30c8, 0x30ab, 0x30ed, 0x30ea, 0x30fc, 0x30ab, 0x3099, 0x30ed,
+  0x30f3, 0x30ab, 0x3099, 0x30f3, 0x30de, 0x30ad, 0x3099, 0x30ab,
+  0x3099, 0x30ad, 0x3099, 0x30cb, 0x30fc, 0x30ad, 0x30e5, 0x30ea,
+  0x30fc, 0x30ad, 0x3099, 0x30eb, 0x30bf, 0x3099, 0x30fc, 0x30ad,
+  0x30ed, 0x30ad, 0x30ed, 0x30af, 0x3099, 0x30e9, 0x30e0, 0x30ad,
+  0x30ed, 0x30e1, 0x30fc, 0x30c8, 0x30eb, 0x30ad, 0x30ed, 0x30ef,
+  0x30c3, 0x30c8, 0x30af, 0x3099, 0x30e9, 0x30e0, 0x30af, 0x3099,
+  0x30e9, 0x30e0, 0x30c8, 0x30f3, 0x30af, 0x30eb, 0x30bb, 0x3099,
+  0x30a4, 0x30ed, 0x30af, 0x30ed, 0x30fc, 0x30cd, 0x30b1, 0x30fc,
+  0x30b9, 0x30b3, 0x30eb, 0x30ca, 0x30b3, 0x30fc, 0x30db, 0x309a,
+  0x30b5, 0x30a4, 0x30af, 0x30eb, 0x30b5, 0x30f3, 0x30c1, 0x30fc,
+  0x30e0, 0x30b7, 0x30ea, 0x30f3, 0x30af, 0x3099, 0x30bb, 0x30f3,
+  0x30c1, 0x30bb, 0x30f3, 0x30c8, 0x30bf, 0x3099, 0x30fc, 0x30b9,
+  0x30c6, 0x3099, 0x30b7, 0x30c8, 0x3099, 0x30eb, 0x30c8, 0x30f3,
+  0x30ca, 0x30ce, 0x30ce, 0x30c3, 0x30c8, 0x30cf, 0x30a4, 0x30c4,
+  0x30cf, 0x309a, 0x30fc, 0x30bb, 0x30f3, 0x30c8, 0x30cf, 0x309a,
+  0x30fc, 0x30c4, 0x30cf, 0x3099, 0x30fc, 0x30ec, 0x30eb, 0x30d2,
+  0x309a, 0x30a2, 0x30b9, 0x30c8, 0x30eb, 0x30d2, 0x309a, 0x30af,
+  0x30eb, 0x30d2, 0x309a, 0x30b3, 0x30d2, 0x3099, 0x30eb, 0x30d5,
+  0x30a1, 0x30e9, 0x30c3, 0x30c8, 0x3099, 0x30d5, 0x30a3, 0x30fc,
+  0x30c8, 0x30d5, 0x3099, 0x30c3, 0x30b7, 0x30a7, 0x30eb, 0x30d5,
+  0x30e9, 0x30f3, 0x30d8, 0x30af, 0x30bf, 0x30fc, 0x30eb, 0x30d8,
+  0x309a, 0x30bd, 0x30d8, 0x309a, 0x30cb, 0x30d2, 0x30d8, 0x30eb,
+  0x30c4, 0x30d8, 0x309a, 0x30f3, 0x30b9, 0x30d8, 0x309a, 0x30fc,
+  0x30b7, 0x3099, 0x30d8, 0x3099, 0x30fc, 0x30bf, 0x30db, 0x309a,
+  0x30a4, 0x30f3, 0x30c8, 0x30db, 0x3099, 0x30eb, 0x30c8, 0x30db,
+  0x30f3, 0x30db, 0x309a, 0x30f3, 0x30c8, 0x3099, 0x30db, 0x30fc,
+  0x30eb, 0x30db, 0x30fc, 0x30f3, 0x30de, 0x30a4, 0x30af, 0x30ed,
+  0x30de, 0x30a4, 0x30eb, 0x30de, 0x30c3, 0x30cf, 0x30de, 0x30eb,
+  0x30af, 0x30de, 0x30f3, 0x30b7, 0x30e7, 0x30f3, 0x30df, 0x30af,
+  0x30ed, 0x30f3, 0x30df, 0x30ea, 0x30df, 0x30ea, 0x30cf, 0x3099,
+  0x30fc, 0x30eb, 0x30e1, 0x30ab, 0x3099, 0x30e1, 0x30ab, 0x3099,
+  0x30c8, 0x30f3, 0x30e1, 0x30fc, 0x30c8, 0x30eb, 0x30e4, 0x30fc,
+  0x30c8, 0x3099, 0x30e4, 0x30fc, 0x30eb, 0x30e6, 0x30a2, 0x30f3,
+  0x30ea, 0x30c3, 0x30c8, 0x30eb, 0x30ea, 0x30e9, 0x30eb, 0x30d2,
+  0x309a, 0x30fc, 0x30eb, 0x30fc, 0x30d5, 0x3099, 0x30eb, 0x30ec,
+  0x30e0, 0x30ec, 0x30f3, 0x30c8, 0x30b1, 0x3099, 0x30f3, 0x30ef,
+  0x30c3, 0x30c8, 0x0030, 0x70b9, 0x0031, 0x70b9, 0x0032, 0x70b9,
+  0x0033, 0x70b9, 0x0034, 0x70b9, 0x0035, 0x70b9, 0x0036, 0x70b9,
+  0x0037, 0x70b9, 0x0038, 0x70b9, 0x0039, 0x70b9, 0x0031, 0x0030,
+  0x70b9, 0x0031, 0x0031, 0x70b9, 0x0031, 0x0032, 0x70b9, 0x0031,
+  0x0033, 0x70b9, 0x0031, 0x0034, 0x70b9, 0x0031, 0x0035, 0x70b9,
+  0x0031, 0x0036, 0x70b9, 0x0031, 0x0037, 0x70b9, 0x0031, 0x0038,
+  0x70b9, 0x0031, 0x0039, 0x70b9, 0x0032, 0x0030, 0x70b9, 0x0032,
+  0x0031, 0x70b9, 0x0032, 0x0032, 0x70b9, 0x0032, 0x0033, 0x70b9,
+  0x0032, 0x0034, 0x70b9, 0x0068, 0x0050, 0x0061, 0x0064, 0x0061,
+  0x0041, 0x0055, 0x0062, 0x0061, 0x0072, 0x006f, 0x0056, 0x0070,
+  0x0063, 0x0064, 0x006d, 0x0064, 0x006d, 0x0032, 0x0064, 0x006d,
+  0x0033, 0x0049, 0x0055, 0x5e73, 0x6210, 0x662d, 0x548c, 0x5927,
+  0x6b63, 0x660e, 0x6cbb, 0x682a, 0x5f0f, 0x4f1a, 0x793e, 0x0070,
+  0x0041, 0x006e, 0x0041, 0x03bc, 0x0041, 0x006d, 0x0041, 0x006b,
+  0x0041, 0x004b, 0x0042, 0x004d, 0x0042, 0x0047, 0x0042, 0x0063,
+  0x0061, 0x006c, 0x006b, 0x0063, 0x0061, 0x006c, 0x0070, 0x0046,
+  0x006e, 0x0046, 0x03bc, 0x0046, 0x03bc, 0x0067, 0x006d, 0x0067,
+  0x006b, 0x0067, 0x0048, 0x007a, 0x006b, 0x0048, 0x007a, 0x004d,
+  0x0048, 0x007a, 0x0047, 0x0048, 0x007a, 0x0054, 0x0048, 0x007a,
+  0x03bc, 0x006c, 0x006d, 0x006c, 0x0064, 0x006c, 0x006b, 0x006c,
+  0x0066, 0x006d, 0x006e, 0x006d, 0x03bc, 0x006d, 0x006d, 0x006d,
+  0x0063, 0x006d, 0x006b, 0x006d, 0x006d, 0x006d, 0x0032, 0x0063,
+  0x006d, 0x0032, 0x006d, 0x0032, 0x006b, 0x006d, 0x0032, 0x006d,
+  0x006d, 0x0033, 0x0063, 0x006d, 0x0033, 0x006d, 0x0033, 0x006b,
+  0x006d, 0x0033, 0x006d, 0x2215, 0x0073, 0x006d, 0x2215, 0x0073,
+  0x0032, 0x0050, 0x0061, 0x006b, 0x0050, 0x0061, 0x004d, 0x0050,
+  0x0061, 0x0047, 0x0050, 0x0061, 0x0072, 0x0061, 0x0064, 0x0072,
+  0x0061, 0x0064, 0x2215, 0x0073, 0x0072, 0x0061, 0x0064, 0x2215,
+  0x0073, 0x0032, 0x0070, 0x0073, 0x006e, 0x0073, 0x03bc, 0x0073,
+  0x006d, 0x0073, 0x0070, 0x0056, 0x006e, 0x0056, 0x03bc, 0x0056,
+  0x006d, 0x0056, 0x006b, 0x0056, 0x004d, 0x0056, 0x0070, 0x0057,
+  0x006e, 0x0057, 0x03bc, 0x0057, 0x006d, 0x0057, 0x006b, 0x0057,
+  0x004d, 0x0057, 0x006b, 0x03a9, 0x004d, 0x03a9, 0x0061, 0x002e,
+  0x006d, 0x002e, 0x0042, 0x0071, 0x0063, 0x0063, 0x0063, 0x0064,
+  0x0043, 0x2215, 0x006b, 0x0067, 0x0043, 0x006f, 0x002e, 0x0064,
+  0x0042, 0x0047, 0x0079, 0x0068, 0x0061, 0x0048, 0x0050, 0x0069,
+  0x006e, 0x004b, 0x004b, 0x004b, 0x004d, 0x006b, 0x0074, 0x006c,
+  0x006d, 0x006c, 0x006e, 0x006c, 0x006f, 0x0067, 0x006c, 0x0078,
+  0x006d, 0x0062, 0x006d, 0x0069, 0x006c, 0x006d, 0x006f, 0x006c,
+  0x0050, 0x0048, 0x0070, 0x002e, 0x006d, 0x002e, 0x0050, 0x0050,
+  0x004d, 0x0050, 0x0052, 0x0073, 0x0072, 0x0053, 0x0076, 0x0057,
+  0x0062, 0x0056, 0x2215, 0x006d, 0x0041, 0x2215, 0x006d, 0x0031,
+  0x65e5, 0x0032, 0x65e5, 0x0033, 0x65e5, 0x0034, 0x65e5, 0x0035,
+  0x65e5, 0x0036, 0x65e5, 0x0037, 0x65e5, 0x0038, 0x65e5, 0x0039,
+  0x65e5, 0x0031, 0x0030, 0x65e5, 0x0031, 0x0031, 0x65e5, 0x0031,
+  0x0032, 0x65e5, 0x0031, 0x0033, 0x65e5, 0x0031, 0x0034, 0x65e5,
+  0x0031, 0x0035, 0x65e5, 0x0031, 0x0036, 0x65e5, 0x0031, 0x0037,
+  0x65e5, 0x0031, 0x0038, 0x65e5, 0x0031, 0x0039, 0x65e5, 0x0032,
+  0x0030, 0x65e5, 0x0032, 0x0031, 0x65e5, 0x0032, 0x0032, 0x65e5,
+  0x0032, 0x0033, 0x65e5, 0x0032, 0x0034, 0x65e5, 0x0032, 0x0035,
+  0x65e5, 0x0032, 0x0036, 0x65e5, 0x0032, 0x0037, 0x65e5, 0x0032,
+  0x0038, 0x65e5, 0x0032, 0x0039, 0x65e5, 0x0033, 0x0030, 0x65e5,
+  0x0033, 0x0031, 0x65e5, 0x0067, 0x0061, 0x006c, 0x044a, 0x044c,
+  0xa76f, 0x0043, 0x0046, 0x0051, 0x0126, 0x0153, 0xa727, 0xab37,
+  0x026b, 0xab52, 0x028d, 0x0066, 0x0066, 0x0066, 0x0069, 0x0066,
+  0x006c, 0x0066, 0x0066, 0x0069, 0x0066, 0x0066, 0x006c, 0x0073,
+  0x0074, 0x0073, 0x0074, 0x0574, 0x0576, 0x0574, 0x0565, 0x0574,
+  0x056b, 0x057e, 0x0576, 0x0574, 0x056d, 0x05e2, 0x05d0, 0x05d3,
+  0x05d4, 0x05db, 0x05dc, 0x05dd, 0x05e8, 0x05ea, 0x002b, 0x05d0,
+  0x05dc, 0x0671, 0x0671, 0x067b, 0x067b, 0x067b, 0x067b, 0x067e,
+  0x067e, 0x067e, 0x067e, 0x0680, 0x0680, 0x0680, 0x0680, 0x067a,
+  0x067a, 0x067a, 0x067a, 0x067f, 0x067f, 0x067f, 0x067f, 0x0679,
+  0x0679, 0x0679, 0x0679, 0x06a4, 0x06a4, 0x06a4, 0x06a4, 0x06a6,
+  0x06a6, 0x06a6, 0x06a6, 0x0684, 0x0684, 0x0684, 0x0684, 0x0683,
+  0x0683, 0x0683, 0x0683, 0x0686, 0x0686, 0x0686, 0x0686, 0x0687,
+  0x0687, 0x0687, 0x0687, 0x068d, 0x068d, 0x068c, 0x068c, 0x068e,
+  0x068e, 0x0688, 0x0688, 0x0698, 0x0698, 0x0691, 0x0691, 0x06a9,
+  0x06a9, 0x06a9, 0x06a9, 0x06af, 0x06af, 0x06af, 0x06af, 0x06b3,
+  0x06b3, 0x06b3, 0x06b3, 0x06b1, 0x06b1, 0x06b1, 0x06b1, 0x06ba,
+  0x06ba, 0x06bb, 0x06bb, 0x06bb, 0x06bb, 0x06d5, 0x0654, 0x06d5,
+  0x0654, 0x06c1, 0x06c1, 0x06c1, 0x06c1, 0x06be, 0x06be, 0x06be,
+  0x06be, 0x06d2, 0x06d2, 0x06d2, 0x0654, 0x06d2, 0x0654, 0x06ad,
+  0x06ad, 0x06ad, 0x06ad, 0x06c7, 0x06c7, 0x06c6, 0x06c6, 0x06c8,
+  0x06c8, 0x06c7, 0x0674, 0x06cb, 0x06cb, 0x06c5, 0x06c5, 0x06c9,
+  0x06c9, 0x06d0, 0x06d0, 0x06d0, 0x06d0, 0x0649, 0x0649, 0x064a,
+  0x0654, 0x0627, 0x064a, 0x0654, 0x0627, 0x064a, 0x0654, 0x06d5,
+  0x064a, 0x0654, 0x06d5, 0x064a, 0x0654, 0x0648, 0x064a, 0x0654,
+  0x0648, 0x064a, 0x0654, 0x06c7, 0x064a, 0x0654, 0x06c7, 0x064a,
+  0x0654, 0x06c6, 0x064a, 0x0654, 0x06c6, 0x064a, 0x0654, 0x06c8,
+  0x064a, 0x0654, 0x06c8, 0x064a, 0x0654, 0x06d0, 0x064a, 0x0654,
+  0x06d0, 0x064a, 0x0654, 0x06d0, 0x064a, 0x0654, 0x0649, 0x064a,
+  0x0654, 0x0649, 0x064a, 0x0654, 0x0649, 0x06cc, 0x06cc, 0x06cc,
+  0x06cc, 0x064a, 0x0654, 0x062c, 0x064a, 0x0654, 0x062d, 0x064a,
+  0x0654, 0x0645, 0x064a, 0x0654, 0x0649, 0x064a, 0x0654, 0x064a,
+  0x0628, 0x062c, 0x0628, 0x062d, 0x0628, 0x062e, 0x0628, 0x0645,
+  0x0628, 0x0649, 0x0628, 0x064a, 0x062a, 0x062c, 0x062a, 0x062d,
+  0x062a, 0x062e, 0x062a, 0x0645, 0x062a, 0x0649, 0x062a, 0x064a,
+  0x062b, 0x062c, 0x062b, 0x0645, 0x062b, 0x0649, 0x062b, 0x064a,
+  0x062c, 0x062d, 0x062c, 0x0645, 0x062d, 0x062c, 0x062d, 0x0645,
+  0x062e, 0x062c, 0x062e, 0x062d, 0x062e, 0x0645, 0x0633, 0x062c,
+  0x0633, 0x062d, 0x0633, 0x062e, 0x0633, 0x0645, 0x0635, 0x062d,
+  0x0635, 0x0645, 0x0636, 0x062c, 0x0636, 0x062d, 0x0636, 0x062e,
+  0x0636, 0x0645, 0x0637, 0x062d, 0x0637, 0x0645, 0x0638, 0x0645,
+  0x0639, 0x062c, 0x0639, 0x0645, 0x063a, 0x062c, 0x063a, 0x0645,
+  0x0641, 0x062c, 0x0641, 0x062d, 0x0641, 0x062e, 0x0641, 0x0645,
+  0x0641, 0x0649, 0x0641, 0x064a, 0x0642, 0x062d, 0x0642, 0x0645,
+  0x0642, 0x0649, 0x0642, 0x064a, 0x0643, 0x0627, 0x0643, 0x062c,
+  0x0643, 0x062d, 0x0643, 0x062e, 0x0643, 0x0644, 0x0643, 0x0645,
+  0x0643, 0x0649, 0x0643, 0x064a, 0x0644, 0x062c, 0x0644, 0x062d,
+  0x0644, 0x062e, 0x0644, 0x0645, 0x0644, 0x0649, 0x0644, 0x064a,
+  0x0645, 0x062c, 0x0645, 0x062d, 0x0645, 0x062e, 0x0645, 0x0645,
+  0x0645, 0x0649, 0x0645, 0x064a, 0x0646, 0x062c, 0x0646, 0x062d,
+  0x0646, 0x062e, 0x0646, 0x0645, 0x0646, 0x0649, 0x0646, 0x064a,
+  0x0647, 0x062c, 0x0647, 0x0645, 0x0647, 0x0649, 0x0647, 0x064a,
+  0x064a, 0x062c, 0x064a, 0x062d, 0x064a, 0x062e, 0x064a, 0x0645,
+  0x064a, 0x0649, 0x064a, 0x064a, 0x0630, 0x0670, 0x0631, 0x0670,
+  0x0649, 0x0670, 0x0020, 0x064c, 0x0651, 0x0020, 0x064d, 0x0651,
+  0x0020, 0x064e, 0x0651, 0x0020, 0x064f, 0x0651, 0x0020, 0x0650,
+  0x0651, 0x0020, 0x0651, 0x0670, 0x064a, 0x0654, 0x0631, 0x064a,
+  0x0654, 0x0632, 0x064a, 0x0654, 0x0645, 0x064a, 0x0654, 0x0646,
+  0x064a, 0x0654, 0x0649, 0x064a, 0x0654, 0x064a, 0x0628, 0x0631,
+  0x0628, 0x0632, 0x0628, 0x0645, 0x0628, 0x0646, 0x0628, 0x0649,
+  0x0628, 0x064a, 0x062a, 0x0631, 0x062a, 0x0632, 0x062a, 0x0645,
+  0x062a, 0x0646, 0x062a, 0x0649, 0x062a, 0x064a, 0x062b, 0x0631,
+  0x062b, 0x0632, 0x062b, 0x0645, 0x062b, 0x0646, 0x062b, 0x0649,
+  0x062b, 0x064a, 0x0641, 0x0649, 0x0641, 0x064a, 0x0642, 0x0649,
+  0x0642, 0x064a, 0x0643, 0x0627, 0x0643, 0x0644, 0x0643, 0x0645,
+  0x0643, 0x0649, 0x0643, 0x064a, 0x0644, 0x0645, 0x0644, 0x0649,
+  0x0644, 0x064a, 0x0645, 0x0627, 0x0645, 0x0645, 0x0646, 0x0631,
+  0x0646, 0x0632, 0x0646, 0x0645, 0x0646, 0x0646, 0x0646, 0x0649,
+  0x0646, 0x064a, 0x0649, 0x0670, 0x064a, 0x0631, 0x064a, 0x0632,
+  0x064a, 0x0645, 0x064a, 0x0646, 0x064a, 0x0649, 0x064a, 0x064a,
+  0x064a, 0x0654, 0x062c, 0x064a, 0x0654, 0x062d, 0x064a, 0x0654,
+  0x062e, 0x064a, 0x0654, 0x0645, 0x064a, 0x0654, 0x0647, 0x0628,
+  0x062c, 0x0628, 0x062d, 0x0628, 0x062e, 0x0628, 0x0645, 0x0628,
+  0x0647, 0x062a, 0x062c, 0x062a, 0x062d, 0x062a, 0x062e, 0x062a,
+  0x0645, 0x062a, 0x0647, 0x062b, 0x0645, 0x062c, 0x062d, 0x062c,
+  0x0645, 0x062d, 0x062c, 0x062d, 0x0645, 0x062e, 0x062c, 0x062e,
+  0x0645, 0x0633, 0x062c, 0x0633, 0x062d, 0x0633, 0x062e, 0x0633,
+  0x0645, 0x0635, 0x062d, 0x0635, 0x062e, 0x0635, 0x0645, 0x0636,
+  0x062c, 0x0636, 0x062d, 0x0636, 0x062e, 0x0636, 0x0645, 0x0637,
+  0x062d, 0x0638, 0x0645, 0x0639, 0x062c, 0x0639, 0x0645, 0x063a,
+  0x062c, 0x063a, 0x0645, 0x0641, 0x062c, 0x0641, 0x062d, 0x0641,
+  0x062e, 0x0641, 0x0645, 0x0642, 0x062d, 0x0642, 0x0645, 0x0643,
+  0x062c, 0x0643, 0x062d, 0x0643, 0x062e, 0x0643, 0x0644, 0x0643,
+  0x0645, 0x0644, 0x062c, 0x0644, 0x062d, 0x0644, 0x062e, 0x0644,
+  0x0645, 0x0644, 0x0647, 0x0645, 0x062c, 0x0645, 0x062d, 0x0645,
+  0x062e, 0x0645, 0x0645, 0x0646, 0x062c, 0x0646, 0x062d, 0x0646,
+  0x062e, 0x0646, 0x0645, 0x0646, 0x0647, 0x0647, 0x062c, 0x0647,
+  0x0645, 0x0647, 0x0670, 0x064a, 0x062c, 0x064a, 0x062d, 0x064a,
+  0x062e, 0x064a, 0x0645, 0x064a, 0x0647, 0x064a, 0x0654, 0x0645,
+  0x064a, 0x0654, 0x0647, 0x0628, 0x0645, 0x0628, 0x0647, 0x062a,
+  0x0645, 0x062a, 0x0647, 0x062b, 0x0645, 0x062b, 0x0647, 0x0633,
+  0x0645, 0x0633, 0x0647, 0x0634, 0x0645, 0x0634, 0x0647, 0x0643,
+  0x0644, 0x0643, 0x0645, 0x0644, 0x0645, 0x0646, 0x0645, 0x0646,
+  0x0647, 0x064a, 0x0645, 0x064a, 0x0647, 0x0640, 0x064e, 0x0651,
+  0x0640, 0x064f, 0x0651, 0x0640, 0x0650, 0x0651, 0x0637, 0x0649,
+  0x0637, 0x064a, 0x0639, 0x0649, 0x0639, 0x064a, 0x063a, 0x0649,
+  0x063a, 0x064a, 0x0633, 0x0649, 0x0633, 0x064a, 0x0634, 0x0649,
+  0x0634, 0x064a, 0x062d, 0x0649, 0x062d, 0x064a, 0x062c, 0x0649,
+  0x062c, 0x064a, 0x062e, 0x0649, 0x062e, 0x064a, 0x0635, 0x0649,
+  0x0635, 0x064a, 0x0636, 0x0649, 0x0636, 0x064a, 0x0634, 0x062c,
+  0x0634, 0x062d, 0x0634, 0x062e, 0x0634, 0x0645, 0x0634, 0x0631,
+  0x0633, 0x0631, 0x0635, 0x0631, 0x0636, 0x0631, 0x0637, 0x0649,
+  0x0637, 0x064a, 0x0639, 0x0649, 0x0639, 0x064a, 0x063a, 0x0649,
+  0x063a, 0x064a, 0x0633, 0x0649, 0x0633, 0x064a, 0x0634, 0x0649,
+  0x0634, 0x064a, 0x062d, 0x0649, 0x062d, 0x064a, 0x062c, 0x0649,
+  0x062c, 0x064a, 0x062e, 0x0649, 0x062e, 0x064a, 0x0635, 0x0649,
+  0x0635, 0x064a, 0x0636, 0x0649, 0x0636, 0x064a, 0x0634, 0x062c,
+  0x0634, 0x062d, 0x0634, 0x062e, 0x0634, 0x0645, 0x0634, 0x0631,
+  0x0633, 0x0631, 0x0635, 0x0631, 0x0636, 0x0631, 0x0634, 0x062c,
+  0x0634, 0x062d, 0x0634, 0x062e, 0x0634, 0x0645, 0x0633, 0x0647,
+  0x0634, 0x0647, 0x0637, 0x0645, 0x0633, 0x062c, 0x0633, 0x062d,
+  0x0633, 0x062e, 0x0634, 0x062c, 0x0634, 0x062d, 0x0634, 0x062e,
+  0x0637, 0x0645, 0x0638, 0x0645, 0x0627, 0x064b, 0x0627, 0x064b,
+  0x062a, 0x062c, 0x0645, 0x062a, 0x062d, 0x062c, 0x062a, 0x062d,
+  0x062c, 0x062a, 0x062d, 0x0645, 0x062a, 0x062e, 0x0645, 0x062a,
+  0x0645, 0x062c, 0x062a, 0x0645, 0x062d, 0x062a, 0x0645, 0x062e,
+  0x062c, 0x0645, 0x062d, 0x062c, 0x0645, 0x062d, 0x062d, 0x0645,
+  0x064a, 0x062d, 0x0645, 0x0649, 0x0633, 0x062d, 0x062c, 0x0633,
+  0x062c, 0x062d, 0x0633, 0x062c, 0x0649, 0x0633, 0x0645, 0x062d,
+  0x0633, 0x0645, 0x062d, 0x0633, 0x0645, 0x062c, 0x0633, 0x0645,
+  0x0645, 0x0633, 0x0645, 0x0645, 0x0635, 0x062d, 0x062d, 0x0635,
+  0x062d, 0x062d, 0x0635, 0x0645, 0x0645, 0x0634, 0x062d, 0x0645,
+  0x0634, 0x062d, 0x0645, 0x0634, 0x062c, 0x064a, 0x0634, 0x0645,
+  0x062e, 0x0634, 0x0645, 0x062e, 0x0634, 0x0645, 0x0645, 0x0634,
+  0x0645, 0x0645, 0x0636, 0x062d, 0x0649, 0x0636, 0x062e, 0x0645,
+  0x0636, 0x062e, 0x0645, 0x0637, 0x0645, 0x062d, 0x0637, 0x0645,
+  0x062d, 0x0637, 0x0645, 0x0645, 0x0637, 0x0645, 0x064a, 0x0639,
+  0x062c, 0x0645, 0x0639, 0x0645, 0x0645, 0x0639, 0x0645, 0x0645,
+  0x0639, 0x0645, 0x0649, 0x063a, 0x0645, 0x0645, 0x063a, 0x0645,
+  0x064a, 0x063a, 0x0645, 0x0649, 0x0641, 0x062e, 0x0645, 0x0641,
+  0x062e, 0x0645, 0x0642, 0x0645, 0x062d, 0x0642, 0x0645, 0x0645,
+  0x0644, 0x062d, 0x0645, 0x0644, 0x062d, 0x064a, 0x0644, 0x062d,
+  0x0649, 0x0644, 0x062c, 0x062c, 0x0644, 0x062c, 0x062c, 0x0644,
+  0x062e, 0x0645, 0x0644, 0x062e, 0x0645, 0x0644, 0x0645, 0x062d,
+  0x0644, 0x0645, 0x062d, 0x0645, 0x062d, 0x062c, 0x0645, 0x062d,
+  0x0645, 0x0645, 0x062d, 0x064a, 0x0645, 0x062c, 0x062d, 0x0645,
+  0x062c, 0x0645, 0x0645, 0x062e, 0x062c, 0x0645, 0x062e, 0x0645,
+  0x0645, 0x062c, 0x062e, 0x0647, 0x0645, 0x062c, 0x0647, 0x0645,
+  0x0645, 0x0646, 0x062d, 0x0645, 0x0646, 0x062d, 0x0649, 0x0646,
+  0x062c, 0x0645, 0x0646, 0x062c, 0x0645, 0x0646, 0x062c, 0x0649,
+  0x0646, 0x0645, 0x064a, 0x0646, 0x0645, 0x0649, 0x064a, 0x0645,
+  0x0645, 0x064a, 0x0645, 0x0645, 0x0628, 0x062e, 0x064a, 0x062a,
+  0x062c, 0x064a, 0x062a, 0x062c, 0x0649, 0x062a, 0x062e, 0x064a,
+  0x062a, 0x062e, 0x0649, 0x062a, 0x0645, 0x064a, 0x062a, 0x0645,
+  0x0649, 0x062c, 0x0645, 0x064a, 0x062c, 0x062d, 0x0649, 0x062c,
+  0x0645, 0x0649, 0x0633, 0x062e, 0x0649, 0x0635, 0x062d, 0x064a,
+  0x0634, 0x062d, 0x064a, 0x0636, 0x062d, 0x064a, 0x0644, 0x062c,
+  0x064a, 0x0644, 0x0645, 0x064a, 0x064a, 0x062d, 0x064a, 0x064a,
+  0x062c, 0x064a, 0x064a, 0x0645, 0x064a, 0x0645, 0x0645, 0x064a,
+  0x0642, 0x0645, 0x064a, 0x0646, 0x062d, 0x064a, 0x0642, 0x0645,
+  0x062d, 0x0644, 0x062d, 0x0645, 0x0639, 0x0645, 0x064a, 0x0643,
+  0x0645, 0x064a, 0x0646, 0x062c, 0x062d, 0x0645, 0x062e, 0x064a,
+  0x0644, 0x062c, 0x0645, 0x0643, 0x0645, 0x0645, 0x0644, 0x062c,
+  0x0645, 0x0646, 0x062c, 0x062d, 0x062c, 0x062d, 0x064a, 0x062d,
+  0x062c, 0x064a, 0x0645, 0x062c, 0x064a, 0x0641, 0x0645, 0x064a,
+  0x0628, 0x062d, 0x064a, 0x0643, 0x0645, 0x0645, 0x0639, 0x062c,
+  0x0645, 0x0635, 0x0645, 0x0645, 0x0633, 0x062e, 0x064a, 0x0646,
+  0x062c, 0x064a, 0x0635, 0x0644, 0x06d2, 0x0642, 0x0644, 0x06d2,
+  0x0627, 0x0644, 0x0644, 0x0647, 0x0627, 0x0643, 0x0628, 0x0631,
+  0x0645, 0x062d, 0x0645, 0x062f, 0x0635, 0x0644, 0x0639, 0x0645,
+  0x0631, 0x0633, 0x0648, 0x0644, 0x0639, 0x0644, 0x064a, 0x0647,
+  0x0648, 0x0633, 0x0644, 0x0645, 0x0635, 0x0644, 0x0649, 0x0635,
+  0x0644, 0x0649, 0x0020, 0x0627, 0x0644, 0x0644, 0x0647, 0x0020,
+  0x0639, 0x0644, 0x064a, 0x0647, 0x0020, 0x0648, 0x0633, 0x0644,
+  0x0645, 0x062c, 0x0644, 0x0020, 0x062c, 0x0644, 0x0627, 0x0644,
+  0x0647, 0x0631, 0x06cc, 0x0627, 0x0644, 0x002c, 0x3001, 0x3002,
+  0x003a, 0x003b, 0x0021, 0x003f, 0x3016, 0x3017, 0x002e, 0x002e,
+  0x002e, 0x002e, 0x002e, 0x2014, 0x2013, 0x005f, 0x005f, 0x0028,
+  0x0029, 0x007b, 0x007d, 0x3014, 0x3015, 0x3010, 0x3011, 0x300a,
+  0x300b, 0x3008, 0x3009, 0x300c, 0x300d, 0x300e, 0x300f, 0x005b,
+  0x005d, 0x0020, 0x0305, 0x0020, 0x0305, 0x0020, 0x0305, 0x0020,
+  0x0305, 0x005f, 0x005f, 0x005f, 0x002c, 0x3001, 0x002e, 0x003b,
+  0x003a, 0x003f, 0x0021, 0x2014, 0x0028, 0x0029, 0x007b, 0x007d,
+  0x3014, 0x3015, 0x0023, 0x0026, 0x002a, 0x002b, 0x002d, 0x003c,
+  0x003e, 0x003d, 0x005c, 0x0024, 0x0025, 0x0040, 0x0020, 0x064b,
+  0x0640, 0x064b, 0x0020, 0x064c, 0x0020, 0x064d, 0x0020, 0x064e,
+  0x0640, 0x064e, 0x0020, 0x064f, 0x0640, 0x064f, 0x0020, 0x0650,
+  0x0640, 0x0650, 0x0020, 0x0651, 0x0640, 0x0651, 0x0020, 0x0652,
+  0x0640, 0x0652, 0x0621, 0x0627, 0x0653, 0x0627, 0x0653, 0x0627,
+  0x0654, 0x0627, 0x0654, 0x0648, 0x0654, 0x0648, 0x0654, 0x0627,
+  0x0655, 0x0627, 0x0655, 0x064a, 0x0654, 0x064a, 0x0654, 0x064a,
+  0x0654, 0x064a, 0x0654, 0x0627, 0x0627, 0x0628, 0x0628, 0x0628,
+  0x0628, 0x0629, 0x0629, 0x062a, 0x062a, 0x062a, 0x062a, 0x062b,
+  0x062b, 0x062b, 0x062b, 0x062c, 0x062c, 0x062c, 0x062c, 0x062d,
+  0x062d, 0x062d, 0x062d, 0x062e, 0x062e, 0x062e, 0x062e, 0x062f,
+  0x062f, 0x0630, 0x0630, 0x0631, 0x0631, 0x0632, 0x0632, 0x0633,
+  0x0633, 0x0633, 0x0633, 0x0634, 0x0634, 0x0634, 0x0634, 0x0635,
+  0x0635, 0x0635, 0x0635, 0x0636, 0x0636, 0x0636, 0x0636, 0x0637,
+  0x0637, 0x0637, 0x0637, 0x0638, 0x0638, 0x0638, 0x0638, 0x0639,
+  0x0639, 0x0639, 0x0639, 0x063a, 0x063a, 0x063a, 0x063a, 0x0641,
+  0x0641, 0x0641, 0x0641, 0x0642, 0x0642, 0x0642, 0x0642, 0x0643,
+  0x0643, 0x0643, 0x0643, 0x0644, 0x0644, 0x0644, 0x0644, 0x0645,
+  0x0645, 0x0645, 0x0645, 0x0646, 0x0646, 0x0646, 0x0646, 0x0647,
+  0x0647, 0x0647, 0x0647, 0x0648, 0x0648, 0x0649, 0x0649, 0x064a,
+  0x064a, 0x064a, 0x064a, 0x0644, 0x0627, 0x0653, 0x0644, 0x0627,
+  0x0653, 0x0644, 0x0627, 0x0654, 0x0644, 0x0627, 0x0654, 0x0644,
+  0x0627, 0x0655, 0x0644, 0x0627, 0x0655, 0x0644, 0x0627, 0x0644,
+  0x0627, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+  0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f,
+  0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+  0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f,
+  0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+  0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+  0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+  0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f,
+  0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+  0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+  0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+  0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x2985,
+  0x2986, 0x3002, 0x300c, 0x300d, 0x3001, 0x30fb, 0x30f2, 0x30a1,
+  0x30a3, 0x30a5, 0x30a7, 0x30a9, 0x30e3, 0x30e5, 0x30e7, 0x30c3,
+  0x30fc, 0x30a2, 0x30a4, 0x30a6, 0x30a8, 0x30aa, 0x30ab, 0x30ad,
+  0x30af, 0x30b1, 0x30b3, 0x30b5, 0x30b7, 0x30b9, 0x30bb, 0x30bd,
+  0x30bf, 0x30c1, 0x30c4, 0x30c6, 0x30c8, 0x30ca, 0x30cb, 0x30cc,
+  0x30cd, 0x30ce, 0x30cf, 0x30d2, 0x30d5, 0x30d8, 0x30db, 0x30de,
+  0x30df, 0x30e0, 0x30e1, 0x30e2, 0x30e4, 0x30e6, 0x30e8, 0x30e9,
+  0x30ea, 0x30eb, 0x30ec, 0x30ed, 0x30ef, 0x30f3, 0x3099, 0x309a,
+  0x1160, 0x1100, 0x1101, 0x11aa, 0x1102, 0x11ac, 0x11ad, 0x1103,
+  0x1104, 0x1105, 0x11b0, 0x11b1, 0x11b2, 0x11b3, 0x11b4, 0x11b5,
+  0x111a, 0x1106, 0x1107, 0x1108, 0x1121, 0x1109, 0x110a, 0x110b,
+  0x110c, 0x110d, 0x110e, 0x110f, 0x1110, 0x1111, 0x1112, 0x1161,
+  0x1162, 0x1163, 0x1164, 0x1165, 0x1166, 0x1167, 0x1168, 0x1169,
+  0x116a, 0x116b, 0x116c, 0x116d, 0x116e, 0x116f, 0x1170, 0x1171,
+  0x1172, 0x1173, 0x1174, 0x1175, 0x00a2, 0x00a3, 0x00ac, 0x0020,
+  0x0304, 0x00a6, 0x00a5, 0x20a9, 0x2502, 0x2190, 0x2191, 0x2192,
+  0x2193, 0x25a0, 0x25cb, 0x02d0, 0x02d1, 0x00e6, 0x0299, 0x0253,
+  0x02a3, 0xab66, 0x02a5, 0x02a4, 0x0256, 0x0257, 0x1d91, 0x0258,
+  0x025e, 0x02a9, 0x0264, 0x0262, 0x0260, 0x029b, 0x0127, 0x029c,
+  0x0267, 0x0284, 0x02aa, 0x02ab, 0x026c, 0x1df04, 0xa78e, 0x026e,
+  0x1df05, 0x028e, 0x1df06, 0x00f8, 0x0276, 0x0277, 0x0071, 0x027a,
+  0x1df08, 0x027d, 0x027e, 0x0280, 0x02a8, 0x02a6, 0xab67, 0x02a7,
+  0x0288, 0x2c71, 0x028f, 0x02a1, 0x02a2, 0x0298, 0x01c0, 0x01c1,
+  0x01c2, 0x1df0a, 0x1df1e, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045,
+  0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d,
+  0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055,
+  0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x0061, 0x0062, 0x0063,
+  0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b,
+  0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073,
+  0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x0041,
+  0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049,
+  0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051,
+  0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059,
+  0x005a, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+  0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070,
+  0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078,
+  0x0079, 0x007a, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046,
+  0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e,
+  0x004f, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056,
+  0x0057, 0x0058, 0x0059, 0x005a, 0x0061, 0x0062, 0x0063, 0x0064,
+  0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c,
+  0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074,
+  0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x0041, 0x0043,
+  0x0044, 0x0047, 0x004a, 0x004b, 0x004e, 0x004f, 0x0050, 0x0051,
+  0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005a,
+  0x0061, 0x0062, 0x0063, 0x0064, 0x0066, 0x0068, 0x0069, 0x006a,
+  0x006b, 0x006c, 0x006d, 0x006e, 0x0070, 0x0071, 0x0072, 0x0073,
+  0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x0041,
+  0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049,
+  0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051,
+  0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059,
+  0x005a, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+  0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+  0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+  0x0078, 0x0079, 0x007a, 0x0041, 0x0042, 0x0044, 0x0045, 0x0046,
+  0x0047, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050,
+  0x0051, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059,
+  0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068,
+  0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070,
+  0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078,
+  0x0079, 0x007a, 0x0041, 0x0042, 0x0044, 0x0045, 0x0046, 0x0047,
+  0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004f, 0x0053, 0x0054,
+  0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x0061, 0x0062, 0x0063,
+  0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b,
+  0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073,
+  0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x0041,
+  0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049,
+  0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051,
+  0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059,
+  0x005a, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+  0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+  0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+  0x0078, 0x0079, 0x007a, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045,
+  0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d,
+  0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055,
+  0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x0061, 0x0062, 0x0063,
+  0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b,
+  0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073,
+  0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x0041,
+  0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049,
+  0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051,
+  0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059,
+  0x005a, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+  0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+  0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+  0x0078, 0x0079, 0x007a, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045,
+  0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d,
+  0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055,
+  0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x0061, 0x0062, 0x0063,
+  0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b,
+  0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073,
+  0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x0041,
+  0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049,
+  0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051,
+  0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059,
+  0x005a, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+  0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f,
+  0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+  0x0078, 0x0079, 0x007a, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045,
+  0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d,
+  0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055,
+  0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x0061, 0x0062, 0x0063,
+  0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b,
+  0x006c, 0x006d, 0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073,
+  0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x0131,
+  0x0237, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397,
+  0x0398, 0x0399, 0x039a, 0x039b, 0x039c, 0x039d, 0x039e, 0x039f,
+  0x03a0, 0x03a1, 0x0398, 0x03a3, 0x03a4, 0x03a5, 0x03a6, 0x03a7,
+  0x03a8, 0x03a9, 0x2207, 0x03b1, 0x03b2, 0x03b3, 0x03b4, 0x03b5,
+  0x03b6, 0x03b7, 0x03b8, 0x03b9, 0x03ba, 0x03bb, 0x03bc, 0x03bd,
+  0x03be, 0x03bf, 0x03c0, 0x03c1, 0x03c2, 0x03c3, 0x03c4, 0x03c5,
+  0x03c6, 0x03c7, 0x03c8, 0x03c9, 0x2202, 0x03b5, 0x03b8, 0x03ba,
+  0x03c6, 0x03c1, 0x03c0, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395,
+  0x0396, 0x0397, 0x0398, 0x0399, 0x039a, 0x039b, 0x039c, 0x039d,
+  0x039e, 0x039f, 0x03a0, 0x03a1, 0x0398, 0x03a3, 0x03a4, 0x03a5,
+  0x03a6, 0x03a7, 0x03a8, 0x03a9, 0x2207, 0x03b1, 0x03b2, 0x03b3,
+  0x03b4, 0x03b5, 0x03b6, 0x03b7, 0x03b8, 0x03b9, 0x03ba, 0x03bb,
+  0x03bc, 0x03bd, 0x03be, 0x03bf, 0x03c0, 0x03c1, 0x03c2, 0x03c3,
+  0x03c4, 0x03c5, 0x03c6, 0x03c7, 0x03c8, 0x03c9, 0x2202, 0x03b5,
+  0x03b8, 0x03ba, 0x03c6, 0x03c1, 0x03c0, 0x0391, 0x0392, 0x0393,
+  0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039a, 0x039b,
+  0x039c, 0x039d, 0x039e, 0x039f, 0x03a0, 0x03a1, 0x0398, 0x03a3,
+  0x03a4, 0x03a5, 0x03a6, 0x03a7, 0x03a8, 0x03a9, 0x2207, 0x03b1,
+  0x03b2, 0x03b3, 0x03b4, 0x03b5, 0x03b6, 0x03b7, 0x03b8, 0x03b9,
+  0x03ba, 0x03bb, 0x03bc, 0x03bd, 0x03be, 0x03bf, 0x03c0, 0x03c1,
+  0x03c2, 0x03c3, 0x03c4, 0x03c5, 0x03c6, 0x03c7, 0x03c8, 0x03c9,
+  0x2202, 0x03b5, 0x03b8, 0x03ba, 0x03c6, 0x03c1, 0x03c0, 0x0391,
+  0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399,
+  0x039a, 0x039b, 0x039c, 0x039d, 0x039e, 0x039f, 0x03a0, 0x03a1,
+  0x0398, 0x03a3, 0x03a4, 0x03a5, 0x03a6, 0x03a7, 0x03a8, 0x03a9,
+  0x2207, 0x03b1, 0x03b2, 0x03b3, 0x03b4, 0x03b5, 0x03b6, 0x03b7,
+  0x03b8, 0x03b9, 0x03ba, 0x03bb, 0x03bc, 0x03bd, 0x03be, 0x03bf,
+  0x03c0, 0x03c1, 0x03c2, 0x03c3, 0x03c4, 0x03c5, 0x03c6, 0x03c7,
+  0x03c8, 0x03c9, 0x2202, 0x03b5, 0x03b8, 0x03ba, 0x03c6, 0x03c1,
+  0x03c0, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397,
+  0x0398, 0x0399, 0x039a, 0x039b, 0x039c, 0x039d, 0x039e, 0x039f,
+  0x03a0, 0x03a1, 0x0398, 0x03a3, 0x03a4, 0x03a5, 0x03a6, 0x03a7,
+  0x03a8, 0x03a9, 0x2207, 0x03b1, 0x03b2, 0x03b3, 0x03b4, 0x03b5,
+  0x03b6, 0x03b7, 0x03b8, 0x03b9, 0x03ba, 0x03bb, 0x03bc, 0x03bd,
+  0x03be, 0x03bf, 0x03c0, 0x03c1, 0x03c2, 0x03c3, 0x03c4, 0x03c5,
+  0x03c6, 0x03c7, 0x03c8, 0x03c9, 0x2202, 0x03b5, 0x03b8, 0x03ba,
+  0x03c6, 0x03c1, 0x03c0, 0x03dc, 0x03dd, 0x0030, 0x0031, 0x0032,
+  0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x0030,
+  0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038,
+  0x0039, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036,
+  0x0037, 0x0038, 0x0039, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034,
+  0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x0030, 0x0031, 0x0032,
+  0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x0627,
+  0x0628, 0x062c, 0x062f, 0x0648, 0x0632, 0x062d, 0x0637, 0x064a,
+  0x0643, 0x0644, 0x0645, 0x0646, 0x0633, 0x0639, 0x0641, 0x0635,
+  0x0642, 0x0631, 0x0634, 0x062a, 0x062b, 0x062e, 0x0630, 0x0636,
+  0x0638, 0x063a, 0x066e, 0x06ba, 0x06a1, 0x066f, 0x0628, 0x062c,
+  0x0647, 0x062d, 0x064a, 0x0643, 0x0644, 0x0645, 0x0646, 0x0633,
+  0x0639, 0x0641, 0x0635, 0x0642, 0x0634, 0x062a, 0x062b, 0x062e,
+  0x0636, 0x063a, 0x062c, 0x062d, 0x064a, 0x0644, 0x0646, 0x0633,
+  0x0639, 0x0635, 0x0642, 0x0634, 0x062e, 0x0636, 0x063a, 0x06ba,
+  0x066f, 0x0628, 0x062c, 0x0647, 0x062d, 0x0637, 0x064a, 0x0643,
+  0x0645, 0x0646, 0x0633, 0x0639, 0x0641, 0x0635, 0x0642, 0x0634,
+  0x062a, 0x062b, 0x062e, 0x0636, 0x0638, 0x063a, 0x066e, 0x06a1,
+  0x0627, 0x0628, 0x062c, 0x062f, 0x0647, 0x0648, 0x0632, 0x062d,
+  0x0637, 0x064a, 0x0644, 0x0645, 0x0646, 0x0633, 0x0639, 0x0641,
+  0x0635, 0x0642, 0x0631, 0x0634, 0x062a, 0x062b, 0x062e, 0x0630,
+  0x0636, 0x0638, 0x063a, 0x0628, 0x062c, 0x062f, 0x0648, 0x0632,
+  0x062d, 0x0637, 0x064a, 0x0644, 0x0645, 0x0646, 0x0633, 0x0639,
+  0x0641, 0x0635, 0x0642, 0x0631, 0x0634, 0x062a, 0x062b, 0x062e,
+  0x0630, 0x0636, 0x0638, 0x063a, 0x0030, 0x002e, 0x0030, 0x002c,
+  0x0031, 0x002c, 0x0032, 0x002c, 0x0033, 0x002c, 0x0034, 0x002c,
+  0x0035, 0x002c, 0x0036, 0x002c, 0x0037, 0x002c, 0x0038, 0x002c,
+  0x0039, 0x002c, 0x0028, 0x0041, 0x0029, 0x0028, 0x0042, 0x0029,
+  0x0028, 0x0043, 0x0029, 0x0028, 0x0044, 0x0029, 0x0028, 0x0045,
+  0x0029, 0x0028, 0x0046, 0x0029, 0x0028, 0x0047, 0x0029, 0x0028,
+  0x0048, 0x0029, 0x0028, 0x0049, 0x0029, 0x0028, 0x004a, 0x0029,
+  0x0028, 0x004b, 0x0029, 0x0028, 0x004c, 0x0029, 0x0028, 0x004d,
+  0x0029, 0x0028, 0x004e, 0x0029, 0x0028, 0x004f, 0x0029, 0x0028,
+  0x0050, 0x0029, 0x0028, 0x0051, 0x0029, 0x0028, 0x0052, 0x0029,
+  0x0028, 0x0053, 0x0029, 0x0028, 0x0054, 0x0029, 0x0028, 0x0055,
+  0x0029, 0x0028, 0x0056, 0x0029, 0x0028, 0x0057, 0x0029, 0x0028,
+  0x0058, 0x0029, 0x0028, 0x0059, 0x0029, 0x0028, 0x005a, 0x0029,
+  0x3014, 0x0053, 0x3015, 0x0043, 0x0052, 0x0043, 0x0044, 0x0057,
+  0x005a, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+  0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+  0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+  0x0058, 0x0059, 0x005a, 0x0048, 0x0056, 0x004d, 0x0056, 0x0053,
+  0x0044, 0x0053, 0x0053, 0x0050, 0x0050, 0x0056, 0x0057, 0x0043,
+  0x004d, 0x0043, 0x004d, 0x0044, 0x004d, 0x0052, 0x0044, 0x004a,
+  0x307b, 0x304b, 0x30b3, 0x30b3, 0x30b5, 0x624b, 0x5b57, 0x53cc,
+  0x30c6, 0x3099, 0x4e8c, 0x591a, 0x89e3, 0x5929, 0x4ea4, 0x6620,
+  0x7121, 0x6599, 0x524d, 0x5f8c, 0x518d, 0x65b0, 0x521d, 0x7d42,
+  0x751f, 0x8ca9, 0x58f0, 0x5439, 0x6f14, 0x6295, 0x6355, 0x4e00,
+  0x4e09, 0x904a, 0x5de6, 0x4e2d, 0x53f3, 0x6307, 0x8d70, 0x6253,
+  0x7981, 0x7a7a, 0x5408, 0x6e80, 0x6709, 0x6708, 0x7533, 0x5272,
+  0x55b6, 0x914d, 0x3014, 0x672c, 0x3015, 0x3014, 0x4e09, 0x3015,
+  0x3014, 0x4e8c, 0x3015, 0x3014, 0x5b89, 0x3015, 0x3014, 0x70b9,
+  0x3015, 0x3014, 0x6253, 0x3015, 0x3014, 0x76d7, 0x3015, 0x3014,
+  0x52dd, 0x3015, 0x3014, 0x6557, 0x3015, 0x5f97, 0x53ef, 0x0030,
+  0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038,
+  0x0039,
+};
+
+const Mapping kCaseFoldMappings[1530] = {
+  {0x0041, 0, 1}, {0x0042, 1, 1}, {0x0043, 2, 1}, {0x0044, 3, 1},
+  {0x0045, 4, 1}, {0x0046, 5, 1}, {0x0047, 6, 1}, {0x0048, 7, 1},
+  {0x0049, 8, 1}, {0x004a, 9, 1}, {0x004b, 10, 1}, {0x004c, 11, 1},
+  {0x004d, 12, 1}, {0x004e, 13, 1}, {0x004f, 14, 1}, {0x0050, 15, 1},
+  {0x0051, 16, 1}, {0x0052, 17, 1}, {0x0053, 18, 1}, {0x0054, 19, 1},
+  {0x0055, 20, 1}, {0x0056, 21, 1}, {0x0057, 22, 1}, {0x0058, 23, 1},
+  {0x0059, 24, 1}, {0x005a, 25, 1}, {0x00b5, 26, 1}, {0x00c0, 27, 1},
+  {0x00c1, 28, 1}, {0x00c2, 29, 1}, {0x00c3, 30, 1}, {0x00c4, 31, 1},
+  {0x00c5, 32, 1}, {0x00c6, 33, 1}, {0x00c7, 34, 1}, {0x00c8, 35, 1},
+  {0x00c9, 36, 1}, {0x00ca, 37, 1}, {0x00cb, 38, 1}, {0x00cc, 39, 1},
+  {0x00cd, 40, 1}, {0x00ce, 41, 1}, {0x00cf, 42, 1}, {0x00d0, 43, 1},
+  {0x00d1, 44, 1}, {0x00d2, 45, 1}, {0x00d3, 46, 1}, {0x00d4, 47, 1},
+  {0x00d5, 48, 1}, {0x00d6, 49, 1}, {0x00d8, 50, 1}, {0x00d9, 51, 1},
+  {0x00da, 52, 1}, {0x00db, 53, 1}, {0x00dc, 54, 1}, {0x00dd, 55, 1},
+  {0x00de, 56, 1}, {0x00df, 57, 2}, {0x0100, 59, 1}, {0x0102, 60, 1},
+  {0x0104, 61, 1}, {0x0106, 62, 1}, {0x0108, 63, 1}, {0x010a, 64, 1},
+  {0x010c, 65, 1}, {0x010e, 66, 1}, {0x0110, 67, 1}, {0x0112, 68, 1},
+  {0x0114, 69, 1}, {0x0116, 70, 1}, {0x0118, 71, 1}, {0x011a, 72, 1},
+  {0x011c, 73, 1}, {0x011e, 74, 1}, {0x0120, 75, 1}, {0x0122, 76, 1},
+  {0x0124, 77, 1}, {0x0126, 78, 1}, {0x0128, 79, 1}, {0x012a, 80, 1},
+  {0x012c, 81, 1}, {0x012e, 82, 1}, {0x0130, 83, 2}, {0x0132, 85, 1},
+  {0x0134, 86, 1}, {0x0136, 87, 1}, {0x0139, 88, 1}, {0x013b, 89, 1},
+  {0x013d, 90, 1}, {0x013f, 91, 1}, {0x0141, 92, 1}, {0x0143, 93, 1},
+  {0x0145, 94, 1}, {0x0147, 95, 1}, {0x0149, 96, 2}, {0x014a, 98, 1},
+  {0x014c, 99, 1}, {0x014e, 100, 1}, {0x0150, 101, 1}, {0x0152, 102, 1},
+  {0x0154, 103, 1}, {0x0156, 104, 1}, {0x0158, 105, 1}, {0x015a, 106, 1},
+  {0x015c, 107, 1}, {0x015e, 108, 1}, {0x0160, 109, 1}, {0x0162, 110, 1},
+  {0x0164, 111, 1}, {0x0166, 112, 1}, {0x0168, 113, 1}, {0x016a, 114, 1},
+  {0x016c, 115, 1}, {0x016e, 116, 1}, {0x0170, 117, 1}, {0x0172, 118, 1},
+  {0x0174, 119, 1}, {0x0176, 120, 1}, {0x0178, 121, 1}, {0x0179, 122, 1},
+  {0x017b, 123, 1}, {0x017d, 124, 1}, {0x017f, 125, 1}, {0x0181, 126, 1},
+  {0x0182, 127, 1}, {0x0184, 128, 1}, {0x0186, 129, 1}, {0x0187, 130, 1},
+  {0x0189, 131, 1}, {0x018a, 132, 1}, {0x018b, 133, 1}, {0x018e, 134, 1},
+  {0x018f, 135, 1}, {0x0190, 136, 1}, {0x0191, 137, 1}, {0x0193, 138, 1},
+  {0x0194, 139, 1}, {0x0196, 140, 1}, {0x0197, 141, 1}, {0x0198, 142, 1},
+  {0x019c, 143, 1}, {0x019d, 144, 1}, {0x019f, 145, 1}, {0x01a0, 146, 1},
+  {0x01a2, 147, 1}, {0x01a4, 148, 1}, {0x01a6, 149, 1}, {0x01a7, 150, 1},
+  {0x01a9, 151, 1}, {0x01ac, 152, 1}, {0x01ae, 153, 1}, {0x01af, 154, 1},
+  {0x01b1, 155, 1}, {0x01b2, 156, 1}, {0x01b3, 157, 1}, {0x01b5, 158, 1},
+  {0x01b7, 159, 1}, {0x01b8, 160, 1}, {0x01bc, 161, 1}, {0x01c4, 162, 1},
+  {0x01c5, 163, 1}, {0x01c7, 164, 1}, {0x01c8, 165, 1}, {0x01ca, 166, 1},
+  {0x01cb, 167, 1}, {0x01cd, 168, 1}, {0x01cf, 169, 1}, {0x01d1, 170, 1},
+  {0x01d3, 171, 1}, {0x01d5, 172, 1}, {0x01d7, 173, 1}, {0x01d9, 174, 1},
+  {0x01db, 175, 1}, {0x01de, 176, 1}, {0x01e0, 177, 1}, {0x01e2, 178, 1},
+  {0x01e4, 179, 1}, {0x01e6, 180, 1}, {0x01e8, 181, 1}, {0x01ea, 182, 1},
+  {0x01ec, 183, 1}, {0x01ee, 184, 1}, {0x01f0, 185, 2}, {0x01f1, 187, 1},
+  {0x01f2, 188, 1}, {0x01f4, 189, 1}, {0x01f6, 190, 1}, {0x01f7, 191, 1},
+  {0x01f8, 192, 1}, {0x01fa, 193, 1}, {0x01fc, 194, 1}, {0x01fe, 195, 1},
+  {0x0200, 196, 1}, {0x0202, 197, 1}, {0x0204, 198, 1}, {0x0206, 199, 1},
+  {0x0208, 200, 1}, {0x020a, 201, 1}, {0x020c, 202, 1}, {0x020e, 203, 1},
+  {0x0210, 204, 1}, {0x0212, 205, 1}, {0x0214, 206, 1}, {0x0216, 207, 1},
+  {0x0218, 208, 1}, {0x021a, 209, 1}, {0x021c, 210, 1}, {0x021e, 211, 1},
+  {0x0220, 212, 1}, {0x0222, 213, 1}, {0x0224, 214, 1}, {0x0226, 215, 1},
+  {0x0228, 216, 1}, {0x022a, 217, 1}, {0x022c, 218, 1}, {0x022e, 219, 1},
+  {0x0230, 220, 1}, {0x0232, 221, 1}, {0x023a, 222, 1}, {0x023b, 223, 1},
+  {0x023d, 224, 1}, {0x023e, 225, 1}, {0x0241, 226, 1}, {0x0243, 227, 1},
+  {0x0244, 228, 1}, {0x0245, 229, 1}, {0x0246, 230, 1}, {0x0248, 231, 1},
+  {0x024a, 232, 1}, {0x024c, 233, 1}, {0x024e, 234, 1}, {0x0345, 235, 1},
+  {0x0370, 236, 1}, {0x0372, 237, 1}, {0x0376, 238, 1}, {0x037f, 239, 1},
+  {0x0386, 240, 1}, {0x0388, 241, 1}, {0x0389, 242, 1}, {0x038a, 243, 1},
+  {0x038c, 244, 1}, {0x038e, 245, 1}, {0x038f, 246, 1}, {0x0390, 247, 3},
+  {0x0391, 250, 1}, {0x0392, 251, 1}, {0x0393, 252, 1}, {0x0394, 253, 1},
+  {0x0395, 254, 1}, {0x0396, 255, 1}, {0x0397, 256, 1}, {0x0398, 257, 1},
+  {0x0399, 258, 1}, {0x039a, 259, 1}, {0x039b, 260, 1}, {0x039c, 261, 1},
+  {0x039d, 262, 1}, {0x039e, 263, 1}, {0x039f, 264, 1}, {0x03a0, 265, 1},
+  {0x03a1, 266, 1}, {0x03a3, 267, 1}, {0x03a4, 268, 1}, {0x03a5, 269, 1},
+  {0x03a6, 270, 1}, {0x03a7, 271, 1}, {0x03a8, 272, 1}, {0x03a9, 273, 1},
+  {0x03aa, 274, 1}, {0x03ab, 275, 1}, {0x03b0, 276, 3}, {0x03c2, 279, 1},
+  {0x03cf, 280, 1}, {0x03d0, 281, 1}, {0x03d1, 282, 1}, {0x03d5, 283, 1},
+  {0x03d6, 284, 1}, {0x03d8, 285, 1}, {0x03da, 286, 1}, {0x03dc, 287, 1},
+  {0x03de, 288, 1}, {0x03e0, 289, 1}, {0x03e2, 290, 1}, {0x03e4, 291, 1},
+  {0x03e6, 292, 1}, {0x03e8, 293, 1}, {0x03ea, 294, 1}, {0x03ec, 295, 1},
+  {0x03ee, 296, 1}, {0x03f0, 297, 1}, {0x03f1, 298, 1}, {0x03f4, 299, 1},
+  {0x03f5, 300, 1}, {0x03f7, 301, 1}, {0x03f9, 302, 1}, {0x03fa, 303, 1},
+  {0x03fd, 304, 1}, {0x03fe, 305, 1}, {0x03ff, 306, 1}, {0x0400, 307, 1},
+  {0x0401, 308, 1}, {0x0402, 309, 1}, {0x0403, 310, 1}, {0x0404, 311, 1},
+  {0x0405, 312, 1}, {0x0406, 313, 1}, {0x0407, 314, 1}, {0x0408, 315, 1},
+  {0x0409, 316, 1}, {0x040a, 317, 1}, {0x040b, 318, 1}, {0x040c, 319, 1},
+  {0x040d, 320, 1}, {0x040e, 321, 1}, {0x040f, 322, 1}, {0x0410, 323, 1},
+  {0x0411, 324, 1}, {0x0412, 325, 1}, {0x0413, 326, 1}, {0x0414, 327, 1},
+  {0x0415, 328, 1}, {0x0416, 329, 1}, {0x0417, 330, 1}, {0x0418, 331, 1},
+  {0x0419, 332, 1}, {0x041a, 333, 1}, {0x041b, 334, 1}, {0x041c, 335, 1},
+  {0x041d, 336, 1}, {0x041e, 337, 1}, {0x041f, 338, 1}, {0x0420, 339, 1},
+  {0x0421, 340, 1}, {0x0422, 341, 1}, {0x0423, 342, 1}, {0x0424, 343, 1},
+  {0x0425, 344, 1}, {0x0426, 345, 1}, {0x0427, 346, 1}, {0x0428, 347, 1},
+  {0x0429, 348, 1}, {0x042a, 349, 1}, {0x042b, 350, 1}, {0x042c, 351, 1},
+  {0x042d, 352, 1}, {0x042e, 353, 1}, {0x042f, 354, 1}, {0x0460, 355, 1},
+  {0x0462, 356, 1}, {0x0464, 357, 1}, {0x0466, 358, 1}, {0x0468, 359, 1},
+  {0x046a, 360, 1}, {0x046c, 361, 1}, {0x046e, 362, 1}, {0x0470, 363, 1},
+  {0x0472, 364, 1}, {0x0474, 365, 1}, {0x0476, 366, 1}, {0x0478, 367, 1},
+  {0x047a, 368, 1}, {0x047c, 369, 1}, {0x047e, 370, 1}, {0x0480, 371, 1},
+  {0x048a, 372, 1}, {0x048c, 373, 1}, {0x048e, 374, 1}, {0x0490, 375, 1},
+  {0x0492, 376, 1}, {0x0494, 377, 1}, {0x0496, 378, 1}, {0x0498, 379, 1},
+  {0x049a, 380, 1}, {0x049c, 381, 1}, {0x049e, 382, 1}, {0x04a0, 383, 1},
+  {0x04a2, 384, 1}, {0x04a4, 385, 1}, {0x04a6, 386, 1}, {0x04a8, 387, 1},
+  {0x04aa, 388, 1}, {0x04ac, 389, 1}, {0x04ae, 390, 1}, {0x04b0, 391, 1},
+  {0x04b2, 392, 1}, {0x04b4, 393, 1}, {0x04b6, 394, 1}, {0x04b8, 395, 1},
+  {0x04ba, 396, 1}, {0x04bc, 397, 1}, {0x04be, 398, 1}, {0x04c0, 399, 1},
+  {0x04c1, 400, 1}, {0x04c3, 401, 1}, {0x04c5, 402, 1}, {0x04c7, 403, 1},
+  {0x04c9, 404, 1}, {0x04cb, 405, 1}, {0x04cd, 406, 1}, {0x04d0, 407, 1},
+  {0x04d2, 408, 1}, {0x04d4, 409, 1}, {0x04d6, 410, 1}, {0x04d8, 411, 1},
+  {0x04da, 412, 1}, {0x04dc, 413, 1}, {0x04de, 414, 1}, {0x04e0, 415, 1},
+  {0x04e2, 416, 1}, {0x04e4, 417, 1}, {0x04e6, 418, 1}, {0x04e8, 419, 1},
+  {0x04ea, 420, 1}, {0x04ec, 421, 1}, {0x04ee, 422, 1}, {0x04f0, 423, 1},
+  {0x04f2, 424, 1}, {0x04f4, 425, 1}, {0x04f6, 426, 1}, {0x04f8, 427, 1},
+  {0x04fa, 428, 1}, {0x04fc, 429, 1}, {0x04fe, 430, 1}, {0x0500, 431, 1},
+  {0x0502, 432, 1}, {0x0504, 433, 1}, {0x0506, 434, 1}, {0x0508, 435, 1},
+  {0x050a, 436, 1}, {0x050c, 437, 1}, {0x050e, 438, 1}, {0x0510, 439, 1},
+  {0x0512, 440, 1}, {0x0514, 441, 1}, {0x0516, 442, 1}, {0x0518, 443, 1},
+  {0x051a, 444, 1}, {0x051c, 445, 1}, {0x051e, 446, 1}, {0x0520, 447, 1},
+  {0x0522, 448, 1}, {0x0524, 449, 1}, {0x0526, 450, 1}, {0x0528, 451, 1},
+  {0x052a, 452, 1}, {0x052c, 453, 1}, {0x052e, 454, 1}, {0x0531, 455, 1},
+  {0x0532, 456, 1}, {0x0533, 457, 1}, {0x0534, 458, 1}, {0x0535, 459, 1},
+  {0x0536, 460, 1}, {0x0537, 461, 1}, {0x0538, 462, 1}, {0x0539, 463, 1},
+  {0x053a, 464, 1}, {0x053b, 465, 1}, {0x053c, 466, 1}, {0x053d, 467, 1},
+  {0x053e, 468, 1}, {0x053f, 469, 1}, {0x0540, 470, 1}, {0x0541, 471, 1},
+  {0x0542, 472, 1}, {0x0543, 473, 1}, {0x0544, 474, 1}, {0x0545, 475, 1},
+  {0x0546, 476, 1}, {0x0547, 477, 1}, {0x0548, 478, 1}, {0x0549, 479, 1},
+  {0x054a, 480, 1}, {0x054b, 481, 1}, {0x054c, 482, 1}, {0x054d, 483, 1},
+  {0x054e, 484, 1}, {0x054f, 485, 1}, {0x0550, 486, 1}, {0x0551, 487, 1},
+  {0x0552, 488, 1}, {0x0553, 489, 1}, {0x0554, 490, 1}, {0x0555, 491, 1},
+  {0x0556, 492, 1}, {0x0587, 493, 2}, {0x10a0, 495, 1}, {0x10a1, 496, 1},
+  {0x10a2, 497, 1}, {0x10a3, 498, 1}, {0x10a4, 499, 1}, {0x10a5, 500, 1},
+  {0x10a6, 501, 1}, {0x10a7, 502, 1}, {0x10a8, 503, 1}, {0x10a9, 504, 1},
+  {0x10aa, 505, 1}, {0x10ab, 506, 1}, {0x10ac, 507, 1}, {0x10ad, 508, 1},
+  {0x10ae, 509, 1}, {0x10af, 510, 1}, {0x10b0, 511, 1}, {0x10b1, 512, 1},
+  {0x10b2, 513, 1}, {0x10b3, 514, 1}, {0x10b4, 515, 1}, {0x10b5, 516, 1},
+  {0x10b6, 517, 1}, {0x10b7, 518, 1}, {0x10b8, 519, 1}, {0x10b9, 520, 1},
+  {0x10ba, 521, 1}, {0x10bb, 522, 1}, {0x10bc, 523, 1}, {0x10bd, 524, 1},
+  {0x10be, 525, 1}, {0x10bf, 526, 1}, {0x10c0, 527, 1}, {0x10c1, 528, 1},
+  {0x10c2, 529, 1}, {0x10c3, 530, 1}, {0x10c4, 531, 1}, {0x10c5, 532, 1},
+  {0x10c7, 533, 1}, {0x10cd, 534, 1}, {0x13f8, 535, 1}, {0x13f9, 536, 1},
+  {0x13fa, 537, 1}, {0x13fb, 538, 1}, {0x13fc, 539, 1}, {0x13fd, 540, 1},
+  {0x1c80, 541, 1}, {0x1c81, 542, 1}, {0x1c82, 543, 1}, {0x1c83, 544, 1},
+  {0x1c84, 545, 1}, {0x1c85, 546, 1}, {0x1c86, 547, 1}, {0x1c87, 548, 1},
+  {0x1c88, 549, 1}, {0x1c90, 550, 1}, {0x1c91, 551, 1}, {0x1c92, 552, 1},
+  {0x1c93, 553, 1}, {0x1c94, 554, 1}, {0x1c95, 555, 1}, {0x1c96, 556, 1},
+  {0x1c97, 557, 1}, {0x1c98, 558, 1}, {0x1c99, 559, 1}, {0x1c9a, 560, 1},
+  {0x1c9b, 561, 1}, {0x1c9c, 562, 1}, {0x1c9d, 563, 1}, {0x1c9e, 564, 1},
+  {0x1c9f, 565, 1}, {0x1ca0, 566, 1}, {0x1ca1, 567, 1}, {0x1ca2, 568, 1},
+  {0x1ca3, 569, 1}, {0x1ca4, 570, 1}, {0x1ca5, 571, 1}, {0x1ca6, 572, 1},
+  {0x1ca7, 573, 1}, {0x1ca8, 574, 1}, {0x1ca9, 575, 1}, {0x1caa, 576, 1},
+  {0x1cab, 577, 1}, {0x1cac, 578, 1}, {0x1cad, 579, 1}, {0x1cae, 580, 1},
+  {0x1caf, 581, 1}, {0x1cb0, 582, 1}, {0x1cb1, 583, 1}, {0x1cb2, 584, 1},
+  {0x1cb3, 585, 1}, {0x1cb4, 586, 1}, {0x1cb5, 587, 1}, {0x1cb6, 588, 1},
+  {0x1cb7, 589, 1}, {0x1cb8, 590, 1}, {0x1cb9, 591, 1}, {0x1cba, 592, 1},
+  {0x1cbd, 593, 1}, {0x1cbe, 594, 1}, {0x1cbf, 595, 1}, {0x1e00, 596, 1},
+  {0x1e02, 597, 1}, {0x1e04, 598, 1}, {0x1e06, 599, 1}, {0x1e08, 600, 1},
+  {0x1e0a, 601, 1}, {0x1e0c, 602, 1}, {0x1e0e, 603, 1}, {0x1e10, 604, 1},
+  {0x1e12, 605, 1}, {0x1e14, 606, 1}, {0x1e16, 607, 1}, {0x1e18, 608, 1},
+  {0x1e1a, 609, 1}, {0x1e1c, 610, 1}, {0x1e1e, 611, 1}, {0x1e20, 612, 1},
+  {0x1e22, 613, 1}, {0x1e24, 614, 1}, {0x1e26, 615, 1}, {0x1e28, 616, 1},
+  {0x1e2a, 617, 1}, {0x1e2c, 618, 1}, {0x1e2e, 619, 1}, {0x1e30, 620, 1},
+  {0x1e32, 621, 1}, {0x1e34, 622, 1}, {0x1e36, 623, 1}, {0x1e38, 624, 1},
+  {0x1e3a, 625, 1}, {0x1e3c, 626, 1}, {0x1e3e, 627, 1}, {0x1e40, 628, 1},
+  {0x1e42, 629, 1}, {0x1e44, 630, 1}, {0x1e46, 631, 1}, {0x1e48, 632, 1},
+  {0x1e4a, 633, 1}, {0x1e4c, 634, 1}, {0x1e4e, 635, 1}, {0x1e50, 636, 1},
+  {0x1e52, 637, 1}, {0x1e54, 638, 1}, {0x1e56, 639, 1}, {0x1e58, 640, 1},
+  {0x1e5a, 641, 1}, {0x1e5c, 642, 1}, {0x1e5e, 643, 1}, {0x1e60, 644, 1},
+  {0x1e62, 645, 1}, {0x1e64, 646, 1}, {0x1e66, 647, 1}, {0x1e68, 648, 1},
+  {0x1e6a, 649, 1}, {0x1e6c, 650, 1}, {0x1e6e, 651, 1}, {0x1e70, 652, 1},
+  {0x1e72, 653, 1}, {0x1e74, 654, 1}, {0x1e76, 655, 1}, {0x1e78, 656, 1},
+  {0x1e7a, 657, 1}, {0x1e7c, 658, 1}, {0x1e7e, 659, 1}, {0x1e80, 660, 1},
+  {0x1e82, 661, 1}, {0x1e84, 662, 1}, {0x1e86, 663, 1}, {0x1e88, 664, 1},
+  {0x1e8a, 665, 1}, {0x1e8c, 666, 1}, {0x1e8e, 667, 1}, {0x1e90, 668, 1},
+  {0x1e92, 669, 1}, {0x1e94, 670, 1}, {0x1e96, 671, 2}, {0x1e97, 673, 2},
+  {0x1e98, 675, 2}, {0x1e99, 677, 2}, {0x1e9a, 679, 2}, {0x1e9b, 681, 1},
+  {0x1e9e, 682, 2}, {0x1ea0, 684, 1}, {0x1ea2, 685, 1}, {0x1ea4, 686, 1},
+  {0x1ea6, 687, 1}, {0x1ea8, 688, 1}, {0x1eaa, 689, 1}, {0x1eac, 690, 1},
+  {0x1eae, 691, 1}, {0x1eb0, 692, 1}, {0x1eb2, 693, 1}, {0x1eb4, 694, 1},
+  {0x1eb6, 695, 1}, {0x1eb8, 696, 1}, {0x1eba, 697, 1}, {0x1ebc, 698, 1},
+  {0x1ebe, 699, 1}, {0x1ec0, 700, 1}, {0x1ec2, 701, 1}, {0x1ec4, 702, 1},
+  {0x1ec6, 703, 1}, {0x1ec8, 704, 1}, {0x1eca, 705, 1}, {0x1ecc, 706, 1},
+  {0x1ece, 707, 1}, {0x1ed0, 708, 1}, {0x1ed2, 709, 1}, {0x1ed4, 710, 1},
+  {0x1ed6, 711, 1}, {0x1ed8, 712, 1}, {0x1eda, 713, 1}, {0x1edc, 714, 1},
+  {0x1ede, 715, 1}, {0x1ee0, 716, 1}, {0x1ee2, 717, 1}, {0x1ee4, 718, 1},
+  {0x1ee6, 719, 1}, {0x1ee8, 720, 1}, {0x1eea, 721, 1}, {0x1eec, 722, 1},
+  {0x1eee, 723, 1}, {0x1ef0, 724, 1}, {0x1ef2, 725, 1}, {0x1ef4, 726, 1},
+  {0x1ef6, 727, 1}, {0x1ef8, 728, 1}, {0x1efa, 729, 1}, {0x1efc, 730, 1},
+  {0x1efe, 731, 1}, {0x1f08, 732, 1}, {0x1f09, 733, 1}, {0x1f0a, 734, 1},
+  {0x1f0b, 735, 1}, {0x1f0c, 736, 1}, {0x1f0d, 737, 1}, {0x1f0e, 738, 1},
+  {0x1f0f, 739, 1}, {0x1f18, 740, 1}, {0x1f19, 741, 1}, {0x1f1a, 742, 1},
+  {0x1f1b, 743, 1}, {0x1f1c, 744, 1}, {0x1f1d, 745, 1}, {0x1f28, 746, 1},
+  {0x1f29, 747, 1}, {0x1f2a, 748, 1}, {0x1f2b, 749, 1}, {0x1f2c, 750, 1},
+  {0x1f2d, 751, 1}, {0x1f2e, 752, 1}, {0x1f2f, 753, 1}, {0x1f38, 754, 1},
+  {0x1f39, 755, 1}, {0x1f3a, 756, 1}, {0x1f3b, 757, 1}, {0x1f3c, 758, 1},
+  {0x1f3d, 759, 1}, {0x1f3e, 760, 1}, {0x1f3f, 761, 1}, {0x1f48, 762, 1},
+  {0x1f49, 763, 1}, {0x1f4a, 764, 1}, {0x1f4b, 765, 1}, {0x1f4c, 766, 1},
+  {0x1f4d, 767, 1}, {0x1f50, 768, 2}, {0x1f52, 770, 3}, {0x1f54, 773, 3},
+  {0x1f56, 776, 3}, {0x1f59, 779, 1}, {0x1f5b, 780, 1}, {0x1f5d, 781, 1},
+  {0x1f5f, 782, 1}, {0x1f68, 783, 1}, {0x1f69, 784, 1}, {0x1f6a, 785, 1},
+  {0x1f6b, 786, 1}, {0x1f6c, 787, 1}, {0x1f6d, 788, 1}, {0x1f6e, 789, 1},
+  {0x1f6f, 790, 1}, {0x1f80, 791, 2}, {0x1f81, 793, 2}, {0x1f82, 795, 2},
+  {0x1f83, 797, 2}, {0x1f84, 799, 2}, {0x1f85, 801, 2}, {0x1f86, 803, 2},
+  {0x1f87, 805, 2}, {0x1f88, 807, 2}, {0x1f89, 809, 2}, {0x1f8a, 811, 2},
+  {0x1f8b, 813, 2}, {0x1f8c, 815, 2}, {0x1f8d, 817, 2}, {0x1f8e, 819, 2},
+  {0x1f8f, 821, 2}, {0x1f90, 823, 2}, {0x1f91, 825, 2}, {0x1f92, 827, 2},
+  {0x1f93, 829, 2}, {0x1f94, 831, 2}, {0x1f95, 833, 2}, {0x1f96, 835, 2},
+  {0x1f97, 837, 2}, {0x1f98, 839, 2}, {0x1f99, 841, 2}, {0x1f9a, 843, 2},
+  {0x1f9b, 845, 2}, {0x1f9c, 847, 2}, {0x1f9d, 849, 2}, {0x1f9e, 851, 2},
+  {0x1f9f, 853, 2}, {0x1fa0, 855, 2}, {0x1fa1, 857, 2}, {0x1fa2, 859, 2},
+  {0x1fa3, 861, 2}, {0x1fa4, 863, 2}, {0x1fa5, 865, 2}, {0x1fa6, 867, 2},
+  {0x1fa7, 869, 2}, {0x1fa8, 871, 2}, {0x1fa9, 873, 2}, {0x1faa, 875, 2},
+  {0x1fab, 877, 2}, {0x1fac, 879, 2}, {0x1fad, 881, 2}, {0x1fae, 883, 2},
+  {0x1faf, 885, 2}, {0x1fb2, 887, 2}, {0x1fb3, 889, 2}, {0x1fb4, 891, 2},
+  {0x1fb6, 893, 2}, {0x1fb7, 895, 3}, {0x1fb8, 898, 1}, {0x1fb9, 899, 1},
+  {0x1fba, 900, 1}, {0x1fbb, 901, 1}, {0x1fbc, 902, 2}, {0x1fbe, 904, 1},
+  {0x1fc2, 905, 2}, {0x1fc3, 907, 2}, {0x1fc4, 909, 2}, {0x1fc6, 911, 2},
+  {0x1fc7, 913, 3}, {0x1fc8, 916, 1}, {0x1fc9, 917, 1}, {0x1fca, 918, 1},
+  {0x1fcb, 919, 1}, {0x1fcc, 920, 2}, {0x1fd2, 922, 3}, {0x1fd3, 925, 3},
+  {0x1fd6, 928, 2}, {0x1fd7, 930, 3}, {0x1fd8, 933, 1}, {0x1fd9, 934, 1},
+  {0x1fda, 935, 1}, {0x1fdb, 936, 1}, {0x1fe2, 937, 3}, {0x1fe3, 940, 3},
+  {0x1fe4, 943, 2}, {0x1fe6, 945, 2}, {0x1fe7, 947, 3}, {0x1fe8, 950, 1},
+  {0x1fe9, 951, 1}, {0x1fea, 952, 1}, {0x1feb, 953, 1}, {0x1fec, 954, 1},
+  {0x1ff2, 955, 2}, {0x1ff3, 957, 2}, {0x1ff4, 959, 2}, {0x1ff6, 961, 2},
+  {0x1ff7, 963, 3}, {0x1ff8, 966, 1}, {0x1ff9, 967, 1}, {0x1ffa, 968, 1},
+  {0x1ffb, 969, 1}, {0x1ffc, 970, 2}, {0x2126, 972, 1}, {0x212a, 973, 1},
+  {0x212b, 974, 1}, {0x2132, 975, 1}, {0x2160, 976, 1}, {0x2161, 977, 1},
+  {0x2162, 978, 1}, {0x2163, 979, 1}, {0x2164, 980, 1}, {0x2165, 981, 1},
+  {0x2166, 982, 1}, {0x2167, 983, 1}, {0x2168, 984, 1}, {0x2169, 985, 1},
+  {0x216a, 986, 1}, {0x216b, 987, 1}, {0x216c, 988, 1}, {0x216d, 989, 1},
+  {0x216e, 990, 1}, {0x216f, 991, 1}, {0x2183, 992, 1}, {0x24b6, 993, 1},
+  {0x24b7, 994, 1}, {0x24b8, 995, 1}, {0x24b9, 996, 1}, {0x24ba, 997, 1},
+  {0x24bb, 998, 1}, {0x24bc, 999, 1}, {0x24bd, 1000, 1}, {0x24be, 1001, 1},
+  {0x24bf, 1002, 1}, {0x24c0, 1003, 1}, {0x24c1, 1004, 1}, {0x24c2, 1005, 1},
+  {0x24c3, 1006, 1}, {0x24c4, 1007, 1}, {0x24c5, 1008, 1}, {0x24c6, 1009, 1},
+  {0x24c7, 1010, 1}, {0x24c8, 1011, 1}, {0x24c9, 1012, 1}, {0x24ca, 1013, 1},
+  {0x24cb, 1014, 1}, {0x24cc, 1015, 1}, {0x24cd, 1016, 1}, {0x24ce, 1017, 1},
+  {0x24cf, 1018, 1}, {0x2c00, 1019, 1}, {0x2c01, 1020, 1}, {0x2c02, 1021, 1},
+  {0x2c03, 1022, 1}, {0x2c04, 1023, 1}, {0x2c05, 1024, 1}, {0x2c06, 1025, 1},
+  {0x2c07, 1026, 1}, {0x2c08, 1027, 1}, {0x2c09, 1028, 1}, {0x2c0a, 1029, 1},
+  {0x2c0b, 1030, 1}, {0x2c0c, 1031, 1}, {0x2c0d, 1032, 1}, {0x2c0e, 1033, 1},
+  {0x2c0f, 1034, 1}, {0x2c10, 1035, 1}, {0x2c11, 1036, 1}, {0x2c12, 1037, 1},
+  {0x2c13, 1038, 1}, {0x2c14, 1039, 1}, {0x2c15, 1040, 1}, {0x2c16, 1041, 1},
+  {0x2c17, 1042, 1}, {0x2c18, 1043, 1}, {0x2c19, 1044, 1}, {0x2c1a, 1045, 1},
+  {0x2c1b, 1046, 1}, {0x2c1c, 1047, 1}, {0x2c1d, 1048, 1}, {0x2c1e, 1049, 1},
+  {0x2c1f, 1050, 1}, {0x2c20, 1051, 1}, {0x2c21, 1052, 1}, {0x2c22, 1053, 1},
+  {0x2c23, 1054, 1}, {0x2c24, 1055, 1}, {0x2c25, 1056, 1}, {0x2c26, 1057, 1},
+  {0x2c27, 1058, 1}, {0x2c28, 1059, 1}, {0x2c29, 1060, 1}, {0x2c2a, 1061, 1},
+  {0x2c2b, 1062, 1}, {0x2c2c, 1063, 1}, {0x2c2d, 1064, 1}, {0x2c2e, 1065, 1},
+  {0x2c2f, 1066, 1}, {0x2c60, 1067, 1}, {0x2c62, 1068, 1}, {0x2c63, 1069, 1},
+  {0x2c64, 1070, 1}, {0x2c67, 1071, 1}, {0x2c69, 1072, 1}, {0x2c6b, 1073, 1},
+  {0x2c6d, 1074, 1}, {0x2c6e, 1075, 1}, {0x2c6f, 1076, 1}, {0x2c70, 1077, 1},
+  {0x2c72, 1078, 1}, {0x2c75, 1079, 1}, {0x2c7e, 1080, 1}, {0x2c7f, 1081, 1},
+  {0x2c80, 1082, 1}, {0x2c82, 1083, 1}, {0x2c84, 1084, 1}, {0x2c86, 1085, 1},
+  {0x2c88, 1086, 1}, {0x2c8a, 1087, 1}, {0x2c8c, 1088, 1}, {0x2c8e, 1089, 1},
+  {0x2c90, 1090, 1}, {0x2c92, 1091, 1}, {0x2c94, 1092, 1}, {0x2c96, 1093, 1},
+  {0x2c98, 1094, 1}, {0x2c9a, 1095, 1}, {0x2c9c, 1096, 1}, {0x2c9e, 1097, 1},
+  {0x2ca0, 1098, 1}, {0x2ca2, 1099, 1}, {0x2ca4, 1100, 1}, {0x2ca6, 1101, 1},
+  {0x2ca8, 1102, 1}, {0x2caa, 1103, 1}, {0x2cac, 1104, 1}, {0x2cae, 1105, 1},
+  {0x2cb0, 1106, 1}, {0x2cb2, 1107, 1}, {0x2cb4, 1108, 1}, {0x2cb6, 1109, 1},
+  {0x2cb8, 1110, 1}, {0x2cba, 1111, 1}, {0x2cbc, 1112, 1}, {0x2cbe, 1113, 1},
+  {0x2cc0, 1114, 1}, {0x2cc2, 1115, 1}, {0x2cc4, 1116, 1}, {0x2cc6, 1117, 1},
+  {0x2cc8, 1118, 1}, {0x2cca, 1119, 1}, {0x2ccc, 1120, 1}, {0x2cce, 1121, 1},
+  {0x2cd0, 1122, 1}, {0x2cd2, 1123, 1}, {0x2cd4, 1124, 1}, {0x2cd6, 1125, 1},
+  {0x2cd8, 1126, 1}, {0x2cda, 1127, 1}, {0x2cdc, 1128, 1}, {0x2cde, 1129, 1},
+  {0x2ce0, 1130, 1}, {0x2ce2, 1131, 1}, {0x2ceb, 1132, 1}, {0x2ced, 1133, 1},
+  {0x2cf2, 1134, 1}, {0xa640, 1135, 1}, {0xa642, 1136, 1}, {0xa644, 1137, 1},
+  {0xa646, 1138, 1}, {0xa648, 1139, 1}, {0xa64a, 1140, 1}, {0xa64c, 1141, 1},
+  {0xa64e, 1142, 1}, {0xa650, 1143, 1}, {0xa652, 1144, 1}, {0xa654, 1145, 1},
+  {0xa656, 1146, 1}, {0xa658, 1147, 1}, {0xa65a, 1148, 1}, {0xa65c, 1149, 1},
+  {0xa65e, 1150, 1}, {0xa660, 1151, 1}, {0xa662, 1152, 1}, {0xa664, 1153, 1},
+  {0xa666, 1154, 1}, {0xa668, 1155, 1}, {0xa66a, 1156, 1}, {0xa66c, 1157, 1},
+  {0xa680, 1158, 1}, {0xa682, 1159, 1}, {0xa684, 1160, 1}, {0xa686, 1161, 1},
+  {0xa688, 1162, 1}, {0xa68a, 1163, 1}, {0xa68c, 1164, 1}, {0xa68e, 1165, 1},
+  {0xa690, 1166, 1}, {0xa692, 1167, 1}, {0xa694, 1168, 1}, {0xa696, 1169, 1},
+  {0xa698, 1170, 1}, {0xa69a, 1171, 1}, {0xa722, 1172, 1}, {0xa724, 1173, 1},
+  {0xa726, 1174, 1}, {0xa728, 1175, 1}, {0xa72a, 1176, 1}, {0xa72c, 1177, 1},
+  {0xa72e, 1178, 1}, {0xa732, 1179, 1}, {0xa734, 1180, 1}, {0xa736, 1181, 1},
+  {0xa738, 1182, 1}, {0xa73a, 1183, 1}, {0xa73c, 1184, 1}, {0xa73e, 1185, 1},
+  {0xa740, 1186, 1}, {0xa742, 1187, 1}, {0xa744, 1188, 1}, {0xa746, 1189, 1},
+  {0xa748, 1190, 1}, {0xa74a, 1191, 1}, {0xa74c, 1192, 1}, {0xa74e, 1193, 1},
+  {0xa750, 1194, 1}, {0xa752, 1195, 1}, {0xa754, 1196, 1}, {0xa756, 1197, 1},
+  {0xa758, 1198, 1}, {0xa75a, 1199, 1}, {0xa75c, 1200, 1}, {0xa75e, 1201, 1},
+  {0xa760, 1202, 1}, {0xa762, 1203, 1}, {0xa764, 1204, 1}, {0xa766, 1205, 1},
+  {0xa768, 1206, 1}, {0xa76a, 1207, 1}, {0xa76c, 1208, 1}, {0xa76e, 1209, 1},
+  {0xa779, 1210, 1}, {0xa77b, 1211, 1}, {0xa77d, 1212, 1}, {0xa77e, 1213, 1},
+  {0xa780, 1214, 1}, {0xa782, 1215, 1}, {0xa784, 1216, 1}, {0xa786, 1217, 1},
+  {0xa78b, 1218, 1}, {0xa78d, 1219, 1}, {0xa790, 1220, 1}, {0xa792, 1221, 1},
+  {0xa796, 1222, 1}, {0xa798, 1223, 1}, {0xa79a, 1224, 1}, {0xa79c, 1225, 1},
+  {0xa79e, 1226, 1}, {0xa7a0, 1227, 1}, {0xa7a2, 1228, 1}, {0xa7a4, 1229, 1},
+  {0xa7a6, 1230, 1}, {0xa7a8, 1231, 1}, {0xa7aa, 1232, 1}, {0xa7ab, 1233, 1},
+  {0xa7ac, 1234, 1}, {0xa7ad, 1235, 1}, {0xa7ae, 1236, 1}, {0xa7b0, 1237, 1},
+  {0xa7b1, 1238, 1}, {0xa7b2, 1239, 1}, {0xa7b3, 1240, 1}, {0xa7b4, 1241, 1},
+  {0xa7b6, 1242, 1}, {0xa7b8, 1243, 1}, {0xa7ba, 1244, 1}, {0xa7bc, 1245, 1},
+  {0xa7be, 1246, 1}, {0xa7c0, 1247, 1}, {0xa7c2, 1248, 1}, {0xa7c4, 1249, 1},
+  {0xa7c5, 1250, 1}, {0xa7c6, 1251, 1}, {0xa7c7, 1252, 1}, {0xa7c9, 1253, 1},
+  {0xa7d0, 1254, 1}, {0xa7d6, 1255, 1}, {0xa7d8, 1256, 1}, {0xa7f5, 1257, 1},
+  {0xab70, 1258, 1}, {0xab71, 1259, 1}, {0xab72, 1260, 1}, {0xab73, 1261, 1},
+  {0xab74, 1262, 1}, {0xab75, 1263, 1}, {0xab76, 1264, 1}, {0xab77, 1265, 1},
+  {0xab78, 1266, 1}, {0xab79, 1267, 1}, {0xab7a, 1268, 1}, {0xab7b, 1269, 1},
+  {0xab7c, 1270, 1}, {0xab7d, 1271, 1}, {0xab7e, 1272, 1}, {0xab7f, 1273, 1},
+  {0xab80, 1274, 1}, {0xab81, 1275, 1}, {0xab82, 1276, 1}, {0xab83, 1277, 1},
+  {0xab84, 1278, 1}, {0xab85, 1279, 1}, {0xab86, 1280, 1}, {0xab87, 1281, 1},
+  {0xab88, 1282, 1}, {0xab89, 1283, 1}, {0xab8a, 1284, 1}, {0xab8b, 1285, 1},
+  {0xab8c, 1286, 1}, {0xab8d, 1287, 1}, {0xab8e, 1288, 1}, {0xab8f, 1289, 1},
+  {0xab90, 1290, 1}, {0xab91, 1291, 1}, {0xab92, 1292, 1}, {0xab93, 1293, 1},
+  {0xab94, 1294, 1}, {0xab95, 1295, 1}, {0xab96, 1296, 1}, {0xab97, 1297, 1},
+  {0xab98, 1298, 1}, {0xab99, 1299, 1}, {0xab9a, 1300, 1}, {0xab9b, 1301, 1},
+  {0xab9c, 1302, 1}, {0xab9d, 1303, 1}, {0xab9e, 1304, 1}, {0xab9f, 1305, 1},
+  {0xaba0, 1306, 1}, {0xaba1, 1307, 1}, {0xaba2, 1308, 1}, {0xaba3, 1309, 1},
+  {0xaba4, 1310, 1}, {0xaba5, 1311, 1}, {0xaba6, 1312, 1}, {0xaba7, 1313, 1},
+  {0xaba8, 1314, 1}, {0xaba9, 1315, 1}, {0xabaa, 1316, 1}, {0xabab, 1317, 1},
+  {0xabac, 1318, 1}, {0xabad, 1319, 1}, {0xabae, 1320, 1}, {0xabaf, 1321, 1},
+  {0xabb0, 1322, 1}, {0xabb1, 1323, 1}, {0xabb2, 1324, 1}, {0xabb3, 1325, 1},
+  {0xabb4, 1326, 1}, {0xabb5, 1327, 1}, {0xabb6, 1328, 1}, {0xabb7, 1329, 1},
+  {0xabb8, 1330, 1}, {0xabb9, 1331, 1}, {0xabba, 1332, 1}, {0xabbb, 1333, 1},
+  {0xabbc, 1334, 1}, {0xabbd, 1335, 1}, {0xabbe, 1336, 1}, {0xabbf, 1337, 1},
+  {0xfb00, 1338, 2}, {0xfb01, 1340, 2}, {0xfb02, 1342, 2}, {0xfb03, 1344, 3},
+  {0xfb04, 1347, 3}, {0xfb05, 1350, 2}, {0xfb06, 1352, 2}, {0xfb13, 1354, 2},
+  {0xfb14, 1356, 2}, {0xfb15, 1358, 2}, {0xfb16, 1360, 2}, {0xfb17, 1362, 2},
+  {0xff21, 1364, 1}, {0xff22, 1365, 1}, {0xff23, 1366, 1}, {0xff24, 1367, 1},
+  {0xff25, 1368, 1}, {0xff26, 1369, 1}, {0xff27, 1370, 1}, {0xff28, 1371, 1},
+  {0xff29, 1372, 1}, {0xff2a, 1373, 1}, {0xff2b, 1374, 1}, {0xff2c, 1375, 1},
+  {0xff2d, 1376, 1}, {0xff2e, 1377, 1}, {0xff2f, 1378, 1}, {0xff30, 1379, 1},
+  {0xff31, 1380, 1}, {0xff32, 1381, 1}, {0xff33, 1382, 1}, {0xff34, 1383, 1},
+  {0xff35, 1384, 1}, {0xff36, 1385, 1}, {0xff37, 1386, 1}, {0xff38, 1387, 1},
+  {0xff39, 1388, 1}, {0xff3a, 1389, 1}, {0x10400, 1390, 1}, {0x10401, 1391, 1},
+  {0x10402, 1392, 1}, {0x10403, 1393, 1}, {0x10404, 1394, 1}, {0x10405, 1395, 1},
+  {0x10406, 1396, 1}, {0x10407, 1397, 1}, {0x10408, 1398, 1}, {0x10409, 1399, 1},
+  {0x1040a, 1400, 1}, {0x1040b, 1401, 1}, {0x1040c, 1402, 1}, {0x1040d, 1403, 1},
+  {0x1040e, 1404, 1}, {0x1040f, 1405, 1}, {0x10410, 1406, 1}, {0x10411, 1407, 1},
+  {0x10412, 1408, 1}, {0x10413, 1409, 1}, {0x10414, 1410, 1}, {0x10415, 1411, 1},
+  {0x10416, 1412, 1}, {0x10417, 1413, 1}, {0x10418, 1414, 1}, {0x10419, 1415, 1},
+  {0x1041a, 1416, 1}, {0x1041b, 1417, 1}, {0x1041c, 1418, 1}, {0x1041d, 1419, 1},
+  {0x1041e, 1420, 1}, {0x1041f, 1421, 1}, {0x10420, 1422, 1}, {0x10421, 1423, 1},
+  {0x10422, 1424, 1}, {0x10423, 1425, 1}, {0x10424, 1426, 1}, {0x10425, 1427, 1},
+  {0x10426, 1428, 1}, {0x10427, 1429, 1}, {0x104b0, 1430, 1}, {0x104b1, 1431, 1},
+  {0x104b2, 1432, 1}, {0x104b3, 1433, 1}, {0x104b4, 1434, 1}, {0x104b5, 1435, 1},
+  {0x104b6, 1436, 1}, {0x104b7, 1437, 1}, {0x104b8, 1438, 1}, {0x104b9, 1439, 1},
+  {0x104ba, 1440, 1}, {0x104bb, 1441, 1}, {0x104bc, 1442, 1}, {0x104bd, 1443, 1},
+  {0x104be, 1444, 1}, {0x104bf, 1445, 1}, {0x104c0, 1446, 1}, {0x104c1, 1447, 1},
+  {0x104c2, 1448, 1}, {0x104c3, 1449, 1}, {0x104c4, 1450, 1}, {0x104c5, 1451, 1},
+  {0x104c6, 1452, 1}, {0x104c7, 1453, 1}, {0x104c8, 1454, 1}, {0x104c9, 1455, 1},
+  {0x104ca, 1456, 1}, {0x104cb, 1457, 1}, {0x104cc, 1458, 1}, {0x104cd, 1459, 1},
+  {0x104ce, 1460, 1}, {0x104cf, 1461, 1}, {0x104d0, 1462, 1}, {0x104d1, 1463, 1},
+  {0x104d2, 1464, 1}, {0x104d3, 1465, 1}, {0x10570, 1466, 1}, {0x10571, 1467, 1},
+  {0x10572, 1468, 1}, {0x10573, 1469, 1}, {0x10574, 1470, 1}, {0x10575, 1471, 1},
+  {0x10576, 1472, 1}, {0x10577, 1473, 1}, {0x10578, 1474, 1}, {0x10579, 1475, 1},
+  {0x1057a, 1476, 1}, {0x1057c, 1477, 1}, {0x1057d, 1478, 1}, {0x1057e, 1479, 1},
+  {0x1057f, 1480, 1}, {0x10580, 1481, 1}, {0x10581, 1482, 1}, {0x10582, 1483, 1},
+  {0x10583, 1484, 1}, {0x10584, 1485, 1}, {0x10585, 1486, 1}, {0x10586, 1487, 1},
+  {0x10587, 1488, 1}, {0x10588, 1489, 1}, {0x10589, 1490, 1}, {0x1058a, 1491, 1},
+  {0x1058c, 1492, 1}, {0x1058d, 1493, 1}, {0x1058e, 1494, 1}, {0x1058f, 1495, 1},
+  {0x10590, 1496, 1}, {0x10591, 1497, 1}, {0x10592, 1498, 1}, {0x10594, 1499, 1},
+  {0x10595, 1500, 1}, {0x10c80, 1501, 1}, {0x10c81, 1502, 1}, {0x10c82, 1503, 1},
+  {0x10c83, 1504, 1}, {0x10c84, 1505, 1}, {0x10c85, 1506, 1}, {0x10c86, 1507, 1},
+  {0x10c87, 1508, 1}, {0x10c88, 1509, 1}, {0x10c89, 1510, 1}, {0x10c8a, 1511, 1},
+  {0x10c8b, 1512, 1}, {0x10c8c, 1513, 1}, {0x10c8d, 1514, 1}, {0x10c8e, 1515, 1},
+  {0x10c8f, 1516, 1}, {0x10c90, 1517, 1}, {0x10c91, 1518, 1}, {0x10c92, 1519, 1},
+  {0x10c93, 1520, 1}, {0x10c94, 1521, 1}, {0x10c95, 1522, 1}, {0x10c96, 1523, 1},
+  {0x10c97, 1524, 1}, {0x10c98, 1525, 1}, {0x10c99, 1526, 1}, {0x10c9a, 1527, 1},
+  {0x10c9b, 1528, 1}, {0x10c9c, 1529, 1}, {0x10c9d, 1530, 1}, {0x10c9e, 1531, 1},
+  {0x10c9f, 1532, 1}, {0x10ca0, 1533, 1}, {0x10ca1, 1534, 1}, {0x10ca2, 1535, 1},
+  {0x10ca3, 1536, 1}, {0x10ca4, 1537, 1}, {0x10ca5, 1538, 1}, {0x10ca6, 1539, 1},
+  {0x10ca7, 1540, 1}, {0x10ca8, 1541, 1}, {0x10ca9, 1542, 1}, {0x10caa, 1543, 1},
+  {0x10cab, 1544, 1}, {0x10cac, 1545, 1}, {0x10cad, 1546, 1}, {0x10cae, 1547, 1},
+  {0x10caf, 1548, 1}, {0x10cb0, 1549, 1}, {0x10cb1, 1550, 1}, {0x10cb2, 1551, 1},
+  {0x118a0, 1552, 1}, {0x118a1, 1553, 1}, {0x118a2, 1554, 1}, {0x118a3, 1555, 1},
+  {0x118a4, 1556, 1}, {0x118a5, 1557, 1}, {0x118a6, 1558, 1}, {0x118a7, 1559, 1},
+  {0x118a8, 1560, 1}, {0x118a9, 1561, 1}, {0x118aa, 1562, 1}, {0x118ab, 1563, 1},
+  {0x118ac, 1564, 1}, {0x118ad, 1565, 1}, {0x118ae, 1566, 1}, {0x118af, 1567, 1},
+  {0x118b0, 1568, 1}, {0x118b1, 1569, 1}, {0x118b2, 1570, 1}, {0x118b3, 1571, 1},
+  {0x118b4, 1572, 1}, {0x118b5, 1573, 1}, {0x118b6, 1574, 1}, {0x118b7, 1575, 1},
+  {0x118b8, 1576, 1}, {0x118b9, 1577, 1}, {0x118ba, 1578, 1}, {0x118bb, 1579, 1},
+  {0x118bc, 1580, 1}, {0x118bd, 1581, 1}, {0x118be, 1582, 1}, {0x118bf, 1583, 1},
+  {0x16e40, 1584, 1}, {0x16e41, 1585, 1}, {0x16e42, 1586, 1}, {0x16e43, 1587, 1},
+  {0x16e44, 1588, 1}, {0x16e45, 1589, 1}, {0x16e46, 1590, 1}, {0x16e47, 1591, 1},
+  {0x16e48, 1592, 1}, {0x16e49, 1593, 1}, {0x16e4a, 1594, 1}, {0x16e4b, 1595, 1},
+  {0x16e4c, 1596, 1}, {0x16e4d, 1597, 1}, {0x16e4e, 1598, 1}, {0x16e4f, 1599, 1},
+  {0x16e50, 1600, 1}, {0x16e51, 1601, 1}, {0x16e52, 1602, 1}, {0x16e53, 1603, 1},
+  {0x16e54, 1604, 1}, {0x16e55, 1605, 1}, {0x16e56, 1606, 1}, {0x16e57, 1607, 1},
+  {0x16e58, 1608, 1}, {0x16e59, 1609, 1}, {0x16e5a, 1610, 1}, {0x16e5b, 1611, 1},
+  {0x16e5c, 1612, 1}, {0x16e5d, 1613, 1}, {0x16e5e, 1614, 1}, {0x16e5f, 1615, 1},
+  {0x1e900, 1616, 1}, {0x1e901, 1617, 1}, {0x1e902, 1618, 1}, {0x1e903, 1619, 1},
+  {0x1e904, 1620, 1}, {0x1e905, 1621, 1}, {0x1e906, 1622, 1}, {0x1e907, 1623, 1},
+  {0x1e908, 1624, 1}, {0x1e909, 1625, 1}, {0x1e90a, 1626, 1}, {0x1e90b, 1627, 1},
+  {0x1e90c, 1628, 1}, {0x1e90d, 1629, 1}, {0x1e90e, 1630, 1}, {0x1e90f, 1631, 1},
+  {0x1e910, 1632, 1}, {0x1e911, 1633, 1}, {0x1e912, 1634, 1}, {0x1e913, 1635, 1},
+  {0x1e914, 1636, 1}, {0x1e915, 1637, 1}, {0x1e916, 1638, 1}, {0x1e917, 1639, 1},
+  {0x1e918, 1640, 1}, {0x1e919, 1641, 1}, {0x1e91a, 1642, 1}, {0x1e91b, 1643, 1},
+  {0x1e91c, 1644, 1}, {0x1e91d, 1645, 1}, {0x1e91e, 1646, 1}, {0x1e91f, 1647, 1},
+  {0x1e920, 1648, 1}, {0x1e921, 1649, 1},
+};
+
+const size_t kNumCaseFoldMappings = 1530;
+
+const int32_t kCaseFoldData[1650] = {
+  0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068,
+  0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 0x0070,
+  0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078,
+  0x0079, 0x007a, 0x03bc, 0x00e0, 0x00e1, 0x00e2, 0x00e3, 0x00e4,
+  0x00e5, 0x00e6, 0x00e7, 0x00e8, 0x00e9, 0x00ea, 0x00eb, 0x00ec,
+  0x00ed, 0x00ee, 0x00ef, 0x00f0, 0x00f1, 0x00f2, 0x00f3, 0x00f4,
+  0x00f5, 0x00f6, 0x00f8, 0x00f9, 0x00fa, 0x00fb, 0x00fc, 0x00fd,
+  0x00fe, 0x0073, 0x0073, 0x0101, 0x0103, 0x0105, 0x0107, 0x0109,
+  0x010b, 0x010d, 0x010f, 0x0111, 0x0113, 0x0115, 0x0117, 0x0119,
+  0x011b, 0x011d, 0x011f, 0x0121, 0x0123, 0x0125, 0x0127, 0x0129,
+  0x012b, 0x012d, 0x012f, 0x0069, 0x0307, 0x0133, 0x0135, 0x0137,
+  0x013a, 0x013c, 0x013e, 0x0140, 0x0142, 0x0144, 0x0146, 0x0148,
+  0x02bc, 0x006e, 0x014b, 0x014d, 0x014f, 0x0151, 0x0153, 0x0155,
+  0x0157, 0x0159, 0x015b, 0x015d, 0x015f, 0x0161, 0x0163, 0x0165,
+  0x0167, 0x0169, 0x016b, 0x016d, 0x016f, 0x0171, 0x0173, 0x0175,
+  0x0177, 0x00ff, 0x017a, 0x017c, 0x017e, 0x0073, 0x0253, 0x0183,
+  0x0185, 0x0254, 0x0188, 0x0256, 0x0257, 0x018c, 0x01dd, 0x0259,
+  0x025b, 0x0192, 0x0260, 0x0263, 0x0269, 0x0268, 0x0199, 0x026f,
+  0x0272, 0x0275, 0x01a1, 0x01a3, 0x01a5, 0x0280, 0x01a8, 0x0283,
+  0x01ad, 0x0288, 0x01b0, 0x028a, 0x028b, 0x01b4, 0x01b6, 0x0292,
+  0x01b9, 0x01bd, 0x01c6, 0x01c6, 0x01c9, 0x01c9, 0x01cc, 0x01cc,
+  0x01ce, 0x01d0, 0x01d2, 0x01d4, 0x01d6, 0x01d8, 0x01da, 0x01dc,
+  0x01df, 0x01e1, 0x01e3, 0x01e5, 0x01e7, 0x01e9, 0x01eb, 0x01ed,
+  0x01ef, 0x006a, 0x030c, 0x01f3, 0x01f3, 0x01f5, 0x0195, 0x01bf,
+  0x01f9, 0x01fb, 0x01fd, 0x01ff, 0x0201, 0x0203, 0x0205, 0x0207,
+  0x0209, 0x020b, 0x020d, 0x020f, 0x0211, 0x0213, 0x0215, 0x0217,
+  0x0219, 0x021b, 0x021d, 0x021f, 0x019e, 0x0223, 0x0225, 0x0227,
+  0x0229, 0x022b, 0x022d, 0x022f, 0x0231, 0x0233, 0x2c65, 0x023c,
+  0x019a, 0x2c66, 0x0242, 0x0180, 0x0289, 0x028c, 0x0247, 0x0249,
+  0x024b, 0x024d, 0x024f, 0x03b9, 0x0371, 0x0373, 0x0377, 0x03f3,
+  0x03ac, 0x03ad, 0x03ae, 0x03af, 0x03cc, 0x03cd, 0x03ce, 0x03b9,
+  0x0308, 0x0301, 0x03b1, 0x03b2, 0x03b3, 0x03b4, 0x03b5, 0x03b6,
+  0x03b7, 0x03b8, 0x03b9, 0x03ba, 0x03bb, 0x03bc, 0x03bd, 0x03be,
+  0x03bf, 0x03c0, 0x03c1, 0x03c3, 0x03c4, 0x03c5, 0x03c6, 0x03c7,
+  0x03c8, 0x03c9, 0x03ca, 0x03cb, 0x03c5, 0x0308, 0x0301, 0x03c3,
+  0x03d7, 0x03b2, 0x03b8, 0x03c6, 0x03c0, 0x03d9, 0x03db, 0x03dd,
+  0x03df, 0x03e1, 0x03e3, 0x03e5, 0x03e7, 0x03e9, 0x03eb, 0x03ed,
+  0x03ef, 0x03ba, 0x03c1, 0x03b8, 0x03b5, 0x03f8, 0x03f2, 0x03fb,
+  0x037b, 0x037c, 0x037d, 0x0450, 0x0451, 0x0452, 0x0453, 0x0454,
+  0x0455, 0x0456, 0x0457, 0x0458, 0x0459, 0x045a, 0x045b, 0x045c,
+  0x045d, 0x045e, 0x045f, 0x0430, 0x0431, 0x0432, 0x0433, 0x0434,
+  0x0435, 0x0436, 0x0437, 0x0438, 0x0439, 0x043a, 0x043b, 0x043c,
+  0x043d, 0x043e, 0x043f, 0x0440, 0x0441, 0x0442, 0x0443, 0x0444,
+  0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044a, 0x044b, 0x044c,
+  0x044d, 0x044e, 0x044f, 0x0461, 0x0463, 0x0465, 0x0467, 0x0469,
+  0x046b, 0x046d, 0x046f, 0x0471, 0x0473, 0x0475, 0x0477, 0x0479,
+  0x047b, 0x047d, 0x047f, 0x0481, 0x048b, 0x048d, 0x048f, 0x0491,
+  0x0493, 0x0495, 0x0497, 0x0499, 0x049b, 0x049d, 0x049f, 0x04a1,
+  0x04a3, 0x04a5, 0x04a7, 0x04a9, 0x04ab, 0x04ad, 0x04af, 0x04b1,
+  0x04b3, 0x04b5, 0x04b7, 0x04b9, 0x04bb, 0x04bd, 0x04bf, 0x04cf,
+  0x04c2, 0x04c4, 0x04c6, 0x04c8, 0x04ca, 0x04cc, 0x04ce, 0x04d1,
+  0x04d3, 0x04d5, 0x04d7, 0x04d9, 0x04db, 0x04dd, 0x04df, 0x04e1,
+  0x04e3, 0x04e5, 0x04e7, 0x04e9, 0x04eb, 0x04ed, 0x04ef, 0x04f1,
+  0x04f3, 0x04f5, 0x04f7, 0x04f9, 0x04fb, 0x04fd, 0x04ff, 0x0501,
+  0x0503, 0x0505, 0x0507, 0x0509, 0x050b, 0x050d, 0x050f, 0x0511,
+  0x0513, 0x0515, 0x0517, 0x0519, 0x051b, 0x051d, 0x051f, 0x0521,
+  0x0523, 0x0525, 0x0527, 0x0529, 0x052b, 0x052d, 0x052f, 0x0561,
+  0x0562, 0x0563, 0x0564, 0x0565, 0x0566, 0x0567, 0x0568, 0x0569,
+  0x056a, 0x056b, 0x056c, 0x056d, 0x056e, 0x056f, 0x0570, 0x0571,
+  0x0572, 0x0573, 0x0574, 0x0575, 0x0576, 0x0577, 0x0578, 0x0579,
+  0x057a, 0x057b, 0x057c, 0x057d, 0x057e, 0x057f, 0x0580, 0x0581,
+  0x0582, 0x0583, 0x0584, 0x0585, 0x0586, 0x0565, 0x0582, 0x2d00,
+  0x2d01, 0x2d02, 0x2d03, 0x2d04, 0x2d05, 0x2d06, 0x2d07, 0x2d08,
+  0x2d09, 0x2d0a, 0x2d0b, 0x2d0c, 0x2d0d, 0x2d0e, 0x2d0f, 0x2d10,
+  0x2d11, 0x2d12, 0x2d13, 0x2d14, 0x2d15, 0x2d16, 0x2d17, 0x2d18,
+  0x2d19, 0x2d1a, 0x2d1b, 0x2d1c, 0x2d1d, 0x2d1e, 0x2d1f, 0x2d20,
+  0x2d21, 0x2d22, 0x2d23, 0x2d24, 0x2d25, 0x2d27, 0x2d2d, 0x13f0,
+  0x13f1, 0x13f2, 0x13f3, 0x13f4, 0x13f5, 0x0432, 0x0434, 0x043e,
+  0x0441, 0x0442, 0x0442, 0x044a, 0x0463, 0xa64b, 0x10d0, 0x10d1,
+  0x10d2, 0x10d3, 0x10d4, 0x10d5, 0x10d6, 0x10d7, 0x10d8, 0x10d9,
+  0x10da, 0x10db, 0x10dc, 0x10dd, 0x10de, 0x10df, 0x10e0, 0x10e1,
+  0x10e2, 0x10e3, 0x10e4, 0x10e5, 0x10e6, 0x10e7, 0x10e8, 0x10e9,
+  0x10ea, 0x10eb, 0x10ec, 0x10ed, 0x10ee, 0x10ef, 0x10f0, 0x10f1,
+  0x10f2, 0x10f3, 0x10f4, 0x10f5, 0x10f6, 0x10f7, 0x10f8, 0x10f9,
+  0x10fa, 0x10fd, 0x10fe, 0x10ff, 0x1e01, 0x1e03, 0x1e05, 0x1e07,
+  0x1e09, 0x1e0b, 0x1e0d, 0x1e0f, 0x1e11, 0x1e13, 0x1e15, 0x1e17,
+  0x1e19, 0x1e1b, 0x1e1d, 0x1e1f, 0x1e21, 0x1e23, 0x1e25, 0x1e27,
+  0x1e29, 0x1e2b, 0x1e2d, 0x1e2f, 0x1e31, 0x1e33, 0x1e35, 0x1e37,
+  0x1e39, 0x1e3b, 0x1e3d, 0x1e3f, 0x1e41, 0x1e43, 0x1e45, 0x1e47,
+  0x1e49, 0x1e4b, 0x1e4d, 0x1e4f, 0x1e51, 0x1e53, 0x1e55, 0x1e57,
+  0x1e59, 0x1e5b, 0x1e5d, 0x1e5f, 0x1e61, 0x1e63, 0x1e65, 0x1e67,
+  0x1e69, 0x1e6b, 0x1e6d, 0x1e6f, 0x1e71, 0x1e73, 0x1e75, 0x1e77,
+  0x1e79, 0x1e7b, 0x1e7d, 0x1e7f, 0x1e81, 0x1e83, 0x1e85, 0x1e87,
+  0x1e89, 0x1e8b, 0x1e8d, 0x1e8f, 0x1e91, 0x1e93, 0x1e95, 0x0068,
+  0x0331, 0x0074, 0x0308, 0x0077, 0x030a, 0x0079, 0x030a, 0x0061,
+  0x02be, 0x1e61, 0x0073, 0x0073, 0x1ea1, 0x1ea3, 0x1ea5, 0x1ea7,
+  0x1ea9, 0x1eab, 0x1ead, 0x1eaf, 0x1eb1, 0x1eb3, 0x1eb5, 0x1eb7,
+  0x1eb9, 0x1ebb, 0x1ebd, 0x1ebf, 0x1ec1, 0x1ec3, 0x1ec5, 0x1ec7,
+  0x1ec9, 0x1ecb, 0x1ecd, 0x1ecf, 0x1ed1, 0x1ed3, 0x1ed5, 0x1ed7,
+  0x1ed9, 0x1edb, 0x1edd, 0x1edf, 0x1ee1, 0x1ee3, 0x1ee5, 0x1ee7,
+  0x1ee9, 0x1eeb, 0x1eed, 0x1eef, 0x1ef1, 0x1ef3, 0x1ef5, 0x1ef7,
+  0x1ef9, 0x1efb, 0x1efd, 0x1eff, 0x1f00, 0x1f01, 0x1f02, 0x1f03,
+  0x1f04, 0x1f05, 0x1f06, 0x1f07, 0x1f10, 0x1f11, 0x1f12, 0x1f13,
+  0x1f14, 0x1f15, 0x1f20, 0x1f21, 0x1f22, 0x1f23, 0x1f24, 0x1f25,
+  0x1f26, 0x1f27, 0x1f30, 0x1f31, 0x1f32, 0x1f33, 0x1f34, 0x1f35,
+  0x1f36, 0x1f37, 0x1f40, 0x1f41, 0x1f42, 0x1f43, 0x1f44, 0x1f45,
+  0x03c5, 0x0313, 0x03c5, 0x0313, 0x0300, 0x03c5, 0x0313, 0x0301,
+  0x03c5, 0x0313, 0x0342, 0x1f51, 0x1f53, 0x1f55, 0x1f57, 0x1f60,
+  0x1f61, 0x1f62, 0x1f63, 0x1f64, 0x1f65, 0x1f66, 0x1f67, 0x1f00,
+  0x03b9, 0x1f01, 0x03b9, 0x1f02, 0x03b9, 0x1f03, 0x03b9, 0x1f04,
+  0x03b9, 0x1f05, 0x03b9, 0x1f06, 0x03b9, 0x1f07, 0x03b9, 0x1f00,
+  0x03b9, 0x1f01, 0x03b9, 0x1f02, 0x03b9, 0x1f03, 0x03b9, 0x1f04,
+  0x03b9, 0x1f05, 0x03b9, 0x1f06, 0x03b9, 0x1f07, 0x03b9, 0x1f20,
+  0x03b9, 0x1f21, 0x03b9, 0x1f22, 0x03b9, 0x1f23, 0x03b9, 0x1f24,
+  0x03b9, 0x1f25, 0x03b9, 0x1f26, 0x03b9, 0x1f27, 0x03b9, 0x1f20,
+  0x03b9, 0x1f21, 0x03b9, 0x1f22, 0x03b9, 0x1f23, 0x03b9, 0x1f24,
+  0x03b9, 0x1f25, 0x03b9, 0x1f26, 0x03b9, 0x1f27, 0x03b9, 0x1f60,
+  0x03b9, 0x1f61, 0x03b9, 0x1f62, 0x03b9, 0x1f63, 0x03b9, 0x1f64,
+  0x03b9, 0x1f65, 0x03b9, 0x1f66, 0x03b9, 0x1f67, 0x03b9, 0x1f60,
+  0x03b9, 0x1f61, 0x03b9, 0x1f62, 0x03b9, 0x1f63, 0x03b9, 0x1f64,
+  0x03b9, 0x1f65, 0x03b9, 0x1f66, 0x03b9, 0x1f67, 0x03b9, 0x1f70,
+  0x03b9, 0x03b1, 0x03b9, 0x03ac, 0x03b9, 0x03b1, 0x0342, 0x03b1,
+  0x0342, 0x03b9, 0x1fb0, 0x1fb1, 0x1f70, 0x1f71, 0x03b1, 0x03b9,
+  0x03b9, 0x1f74, 0x03b9, 0x03b7, 0x03b9, 0x03ae, 0x03b9, 0x03b7,
+  0x0342, 0x03b7, 0x0342, 0x03b9, 0x1f72, 0x1f73, 0x1f74, 0x1f75,
+  0x03b7, 0x03b9, 0x03b9, 0x0308, 0x0300, 0x03b9, 0x0308, 0x0301,
+  0x03b9, 0x0342, 0x03b9, 0x0308, 0x0342, 0x1fd0, 0x1fd1, 0x1f76,
+  0x1f77, 0x03c5, 0x0308, 0x0300, 0x03c5, 0x0308, 0x0301, 0x03c1,
+  0x0313, 0x03c5, 0x0342, 0x03c5, 0x0308, 0x0342, 0x1fe0, 0x1fe1,
+  0x1f7a, 0x1f7b, 0x1fe5, 0x1f7c, 0x03b9, 0x03c9, 0x03b9, 0x03ce,
+  0x03b9, 0x03c9, 0x0342, 0x03c9, 0x0342, 0x03b9, 0x1f78, 0x1f79,
+  0x1f7c, 0x1f7d, 0x03c9, 0x03b9, 0x03c9, 0x006b, 0x00e5, 0x214e,
+  0x2170, 0x2171, 0x2172, 0x2173, 0x2174, 0x2175, 0x2176, 0x2177,
+  0x2178, 0x2179, 0x217a, 0x217b, 0x217c, 0x217d, 0x217e, 0x217f,
+  0x2184, 0x24d0, 0x24d1, 0x24d2, 0x24d3, 0x24d4, 0x24d5, 0x24d6,
+  0x24d7, 0x24d8, 0x24d9, 0x24da, 0x24db, 0x24dc, 0x24dd, 0x24de,
+  0x24df, 0x24e0, 0x24e1, 0x24e2, 0x24e3, 0x24e4, 0x24e5, 0x24e6,
+  0x24e7, 0x24e8, 0x24e9, 0x2c30, 0x2c31, 0x2c32, 0x2c33, 0x2c34,
+  0x2c35, 0x2c36, 0x2c37, 0x2c38, 0x2c39, 0x2c3a, 0x2c3b, 0x2c3c,
+  0x2c3d, 0x2c3e, 0x2c3f, 0x2c40, 0x2c41, 0x2c42, 0x2c43, 0x2c44,
+  0x2c45, 0x2c46, 0x2c47, 0x2c48, 0x2c49, 0x2c4a, 0x2c4b, 0x2c4c,
+  0x2c4d, 0x2c4e, 0x2c4f, 0x2c50, 0x2c51, 0x2c52, 0x2c53, 0x2c54,
+  0x2c55, 0x2c56, 0x2c57, 0x2c58, 0x2c59, 0x2c5a, 0x2c5b, 0x2c5c,
+  0x2c5d, 0x2c5e, 0x2c5f, 0x2c61, 0x026b, 0x1d7d, 0x027d, 0x2c68,
+  0x2c6a, 0x2c6c, 0x0251, 0x0271, 0x0250, 0x0252, 0x2c73, 0x2c76,
+  0x023f, 0x0240, 0x2c81, 0x2c83, 0x2c85, 0x2c87, 0x2c89, 0x2c8b,
+  0x2c8d, 0x2c8f, 0x2c91, 0x2c93, 0x2c95, 0x2c97, 0x2c99, 0x2c9b,
+  0x2c9d, 0x2c9f, 0x2ca1, 0x2ca3, 0x2ca5, 0x2ca7, 0x2ca9, 0x2cab,
+  0x2cad, 0x2caf, 0x2cb1, 0x2cb3, 0x2cb5, 0x2cb7, 0x2cb9, 0x2cbb,
+  0x2cbd, 0x2cbf, 0x2cc1, 0x2cc3, 0x2cc5, 0x2cc7, 0x2cc9, 0x2ccb,
+  0x2ccd, 0x2ccf, 0x2cd1, 0x2cd3, 0x2cd5, 0x2cd7, 0x2cd9, 0x2cdb,
+  0x2cdd, 0x2cdf, 0x2ce1, 0x2ce3, 0x2cec, 0x2cee, 0x2cf3, 0xa641,
+  0xa643, 0xa645, 0xa647, 0xa649, 0xa64b, 0xa64d, 0xa64f, 0xa651,
+  0xa653, 0xa655, 0xa657, 0xa659, 0xa65b, 0xa65d, 0xa65f, 0xa661,
+  0xa663, 0xa665, 0xa667, 0xa669, 0xa66b, 0xa66d, 0xa681, 0xa683,
+  0xa685, 0xa687, 0xa689, 0xa68b, 0xa68d, 0xa68f, 0xa691, 0xa693,
+  0xa695, 0xa697, 0xa699, 0xa69b, 0xa723, 0xa725, 0xa727, 0xa729,
+  0xa72b, 0xa72d, 0xa72f, 0xa733, 0xa735, 0xa737, 0xa739, 0xa73b,
+  0xa73d, 0xa73f, 0xa741, 0xa743, 0xa745, 0xa747, 0xa749, 0xa74b,
+  0xa74d, 0xa74f, 0xa751, 0xa753, 0xa755, 0xa757, 0xa759, 0xa75b,
+  0xa75d, 0xa75f, 0xa761, 0xa763, 0xa765, 0xa767, 0xa769, 0xa76b,
+  0xa76d, 0xa76f, 0xa77a, 0xa77c, 0x1d79, 0xa77f, 0xa781, 0xa783,
+  0xa785, 0xa787, 0xa78c, 0x0265, 0xa791, 0xa793, 0xa797, 0xa799,
+  0xa79b, 0xa79d, 0xa79f, 0xa7a1, 0xa7a3, 0xa7a5, 0xa7a7, 0xa7a9,
+  0x0266, 0x025c, 0x0261, 0x026c, 0x026a, 0x029e, 0x0287, 0x029d,
+  0xab53, 0xa7b5, 0xa7b7, 0xa7b9, 0xa7bb, 0xa7bd, 0xa7bf, 0xa7c1,
+  0xa7c3, 0xa794, 0x0282, 0x1d8e, 0xa7c8, 0xa7ca, 0xa7d1, 0xa7d7,
+  0xa7d9, 0xa7f6, 0x13a0, 0x13a1, 0x13a2, 0x13a3, 0x13a4, 0x13a5,
+  0x13a6, 0x13a7, 0x13a8, 0x13a9, 0x13aa, 0x13ab, 0x13ac, 0x13ad,
+  0x13ae, 0x13af, 0x13b0, 0x13b1, 0x13b2, 0x13b3, 0x13b4, 0x13b5,
+  0x13b6, 0x13b7, 0x13b8, 0x13b9, 0x13ba, 0x13bb, 0x13bc, 0x13bd,
+  0x13be, 0x13bf, 0x13c0, 0x13c1, 0x13c2, 0x13c3, 0x13c4, 0x13c5,
+  0x13c6, 0x13c7, 0x13c8, 0x13c9, 0x13ca, 0x13cb, 0x13cc, 0x13cd,
+  0x13ce, 0x13cf, 0x13d0, 0x13d1, 0x13d2, 0x13d3, 0x13d4, 0x13d5,
+  0x13d6, 0x13d7, 0x13d8, 0x13d9, 0x13da, 0x13db, 0x13dc, 0x13dd,
+  0x13de, 0x13df, 0x13e0, 0x13e1, 0x13e2, 0x13e3, 0x13e4, 0x13e5,
+  0x13e6, 0x13e7, 0x13e8, 0x13e9, 0x13ea, 0x13eb, 0x13ec, 0x13ed,
+  0x13ee, 0x13ef, 0x0066, 0x0066, 0x0066, 0x0069, 0x0066, 0x006c,
+  0x0066, 0x0066, 0x0069, 0x0066, 0x0066, 0x006c, 0x0073, 0x0074,
+  0x0073, 0x0074, 0x0574, 0x0576, 0x0574, 0x0565, 0x0574, 0x056b,
+  0x057e, 0x0576, 0x0574, 0x056d, 0xff41, 0xff42, 0xff43, 0xff44,
+  0xff45, 0xff46, 0xff47, 0xff48, 0xff49, 0xff4a, 0xff4b, 0xff4c,
+  0xff4d, 0xff4e, 0xff4f, 0xff50, 0xff51, 0xff52, 0xff53, 0xff54,
+  0xff55, 0xff56, 0xff57, 0xff58, 0xff59, 0xff5a, 0x10428, 0x10429,
+  0x1042a, 0x1042b, 0x1042c, 0x1042d, 0x1042e, 0x1042f, 0x10430, 0x10431,
+  0x10432, 0x10433, 0x10434, 0x10435, 0x10436, 0x10437, 0x10438, 0x10439,
+  0x1043a, 0x1043b, 0x1043c, 0x1043d, 0x1043e, 0x1043f, 0x10440, 0x10441,
+  0x10442, 0x10443, 0x10444, 0x10445, 0x10446, 0x10447, 0x10448, 0x10449,
+  0x1044a, 0x1044b, 0x1044c, 0x1044d, 0x1044e, 0x1044f, 0x104d8, 0x104d9,
+  0x104da, 0x104db, 0x104dc, 0x104dd, 0x104de, 0x104df, 0x104e0, 0x104e1,
+  0x104e2, 0x104e3, 0x104e4, 0x104e5, 0x104e6, 0x104e7, 0x104e8, 0x104e9,
+  0x104ea, 0x104eb, 0x104ec, 0x104ed, 0x104ee, 0x104ef, 0x104f0, 0x104f1,
+  0x104f2, 0x104f3, 0x104f4, 0x104f5, 0x104f6, 0x104f7, 0x104f8, 0x104f9,
+  0x104fa, 0x104fb, 0x10597, 0x10598, 0x10599, 0x1059a, 0x1059b, 0x1059c,
+  0x1059d, 0x1059e, 0x1059f, 0x105a0, 0x105a1, 0x105a3, 0x105a4, 0x105a5,
+  0x105a6, 0x105a7, 0x105a8, 0x105a9, 0x105aa, 0x105ab, 0x105ac, 0x105ad,
+  0x105ae, 0x105af, 0x105b0, 0x105b1, 0x105b3, 0x105b4, 0x105b5, 0x105b6,
+  0x105b7, 0x105b8, 0x105b9, 0x105bb, 0x105bc, 0x10cc0, 0x10cc1, 0x10cc2,
+  0x10cc3, 0x10cc4, 0x10cc5, 0x10cc6, 0x10cc7, 0x10cc8, 0x10cc9, 0x10cca,
+  0x10ccb, 0x10ccc, 0x10ccd, 0x10cce, 0x10ccf, 0x10cd0, 0x10cd1, 0x10cd2,
+  0x10cd3, 0x10cd4, 0x10cd5, 0x10cd6, 0x10cd7, 0x10cd8, 0x10cd9, 0x10cda,
+  0x10cdb, 0x10cdc, 0x10cdd, 0x10cde, 0x10cdf, 0x10ce0, 0x10ce1, 0x10ce2,
+  0x10ce3, 0x10ce4, 0x10ce5, 0x10ce6, 0x10ce7, 0x10ce8, 0x10ce9, 0x10cea,
+  0x10ceb, 0x10cec, 0x10ced, 0x10cee, 0x10cef, 0x10cf0, 0x10cf1, 0x10cf2,
+  0x118c0, 0x118c1, 0x118c2, 0x118c3, 0x118c4, 0x118c5, 0x118c6, 0x118c7,
+  0x118c8, 0x118c9, 0x118ca, 0x118cb, 0x118cc, 0x118cd, 0x118ce, 0x118cf,
+  0x118d0, 0x118d1, 0x118d2, 0x118d3, 0x118d4, 0x118d5, 0x118d6, 0x118d7,
+  0x118d8, 0x118d9, 0x118da, 0x118db, 0x118dc, 0x118dd, 0x118de, 0x118df,
+  0x16e60, 0x16e61, 0x16e62, 0x16e63, 0x16e64, 0x16e65, 0x16e66, 0x16e67,
+  0x16e68, 0x16e69, 0x16e6a, 0x16e6b, 0x16e6c, 0x16e6d, 0x16e6e, 0x16e6f,
+  0x16e70, 0x16e71, 0x16e72, 0x16e73, 0x16e74, 0x16e75, 0x16e76, 0x16e77,
+  0x16e78, 0x16e79, 0x16e7a, 0x16e7b, 0x16e7c, 0x16e7d, 0x16e7e, 0x16e7f,
+  0x1e922, 0x1e923, 0x1e924, 0x1e925, 0x1e926, 0x1e927, 0x1e928, 0x1e929,
+  0x1e92a, 0x1e92b, 0x1e92c, 0x1e92d, 0x1e92e, 0x1e92f, 0x1e930, 0x1e931,
+  0x1e932, 0x1e933, 0x1e934, 0x1e935, 0x1e936, 0x1e937, 0x1e938, 0x1e939,
+  0x1e93a, 0x1e93b, 0x1e93c, 0x1e93d, 0x1e93e, 0x1e93f, 0x1e940, 0x1e941,
+  0x1e942, 0x1e943,
+};
+
+const Composition kCompositions[941] = {
+  {0x003c, 0x0338, 0x226e}, {0x003d, 0x0338, 0x2260}, {0x003e, 0x0338, 0x226f},
+  {0x0041, 0x0300, 0x00c0}, {0x0041, 0x0301, 0x00c1}, {0x0041, 0x0302, 0x00c2},
+  {0x0041, 0x0303, 0x00c3}, {0x0041, 0x0304, 0x0100}, {0x0041, 0x0306, 0x0102},
+  {0x0041, 0x0307, 0x0226}, {0x0041, 0x0308, 0x00c4}, {0x0041, 0x0309, 0x1ea2},
+  {0x0041, 0x030a, 0x00c5}, {0x0041, 0x030c, 0x01cd}, {0x0041, 0x030f, 0x0200},
+  {0x0041, 0x0311, 0x0202}, {0x0041, 0x0323, 0x1ea0}, {0x0041, 0x0325, 0x1e00},
+  {0x0041, 0x0328, 0x0104}, {0x0042, 0x0307, 0x1e02}, {0x0042, 0x0323, 0x1e04},
+  {0x0042, 0x0331, 0x1e06}, {0x0043, 0x0301, 0x0106}, {0x0043, 0x0302, 0x0108},
+  {0x0043, 0x0307, 0x010a}, {0x0043, 0x030c, 0x010c}, {0x0043, 0x0327, 0x00c7},
+  {0x0044, 0x0307, 0x1e0a}, {0x0044, 0x030c, 0x010e}, {0x0044, 0x0323, 0x1e0c},
+  {0x0044, 0x0327, 0x1e10}, {0x0044, 0x032d, 0x1e12}, {0x0044, 0x0331, 0x1e0e},
+  {0x0045, 0x0300, 0x00c8}, {0x0045, 0x0301, 0x00c9}, {0x0045, 0x0302, 0x00ca},
+  {0x0045, 0x0303, 0x1ebc}, {0x0045, 0x0304, 0x0112}, {0x0045, 0x0306, 0x0114},
+  {0x0045, 0x0307, 0x0116}, {0x0045, 0x0308, 0x00cb}, {0x0045, 0x0309, 0x1eba},
+  {0x0045, 0x030c, 0x011a}, {0x0045, 0x030f, 0x0204}, {0x0045, 0x0311, 0x0206},
+  {0x0045, 0x0323, 0x1eb8}, {0x0045, 0x0327, 0x0228}, {0x0045, 0x0328, 0x0118},
+  {0x0045, 0x032d, 0x1e18}, {0x0045, 0x0330, 0x1e1a}, {0x0046, 0x0307, 0x1e1e},
+  {0x0047, 0x0301, 0x01f4}, {0x0047, 0x0302, 0x011c}, {0x0047, 0x0304, 0x1e20},
+  {0x0047, 0x0306, 0x011e}, {0x0047, 0x0307, 0x0120}, {0x0047, 0x030c, 0x01e6},
+  {0x0047, 0x0327, 0x0122}, {0x0048, 0x0302, 0x0124}, {0x0048, 0x0307, 0x1e22},
+  {0x0048, 0x0308, 0x1e26}, {0x0048, 0x030c, 0x021e}, {0x0048, 0x0323, 0x1e24},
+  {0x0048, 0x0327, 0x1e28}, {0x0048, 0x032e, 0x1e2a}, {0x0049, 0x0300, 0x00cc},
+  {0x0049, 0x0301, 0x00cd}, {0x0049, 0x0302, 0x00ce}, {0x0049, 0x0303, 0x0128},
+  {0x0049, 0x0304, 0x012a}, {0x0049, 0x0306, 0x012c}, {0x0049, 0x0307, 0x0130},
+  {0x0049, 0x0308, 0x00cf}, {0x0049, 0x0309, 0x1ec8}, {0x0049, 0x030c, 0x01cf},
+  {0x0049, 0x030f, 0x0208}, {0x0049, 0x0311, 0x020a}, {0x0049, 0x0323, 0x1eca},
+  {0x0049, 0x0328, 0x012e}, {0x0049, 0x0330, 0x1e2c}, {0x004a, 0x0302, 0x0134},
+  {0x004b, 0x0301, 0x1e30}, {0x004b, 0x030c, 0x01e8}, {0x004b, 0x0323, 0x1e32},
+  {0x004b, 0x0327, 0x0136}, {0x004b, 0x0331, 0x1e34}, {0x004c, 0x0301, 0x0139},
+  {0x004c, 0x030c, 0x013d}, {0x004c, 0x0323, 0x1e36}, {0x004c, 0x0327, 0x013b},
+  {0x004c, 0x032d, 0x1e3c}, {0x004c, 0x0331, 0x1e3a}, {0x004d, 0x0301, 0x1e3e},
+  {0x004d, 0x0307, 0x1e40}, {0x004d, 0x0323, 0x1e42}, {0x004e, 0x0300, 0x01f8},
+  {0x004e, 0x0301, 0x0143}, {0x004e, 0x0303, 0x00d1}, {0x004e, 0x0307, 0x1e44},
+  {0x004e, 0x030c, 0x0147}, {0x004e, 0x0323, 0x1e46}, {0x004e, 0x0327, 0x0145},
+  {0x004e, 0x032d, 0x1e4a}, {0x004e, 0x0331, 0x1e48}, {0x004f, 0x0300, 0x00d2},
+  {0x004f, 0x0301, 0x00d3}, {0x004f, 0x0302, 0x00d4}, {0x004f, 0x0303, 0x00d5},
+  {0x004f, 0x0304, 0x014c}, {0x004f, 0x0306, 0x014e}, {0x004f, 0x0307, 0x022e},
+  {0x004f, 0x0308, 0x00d6}, {0x004f, 0x0309, 0x1ece}, {0x004f, 0x030b, 0x0150},
+  {0x004f, 0x030c, 0x01d1}, {0x004f, 0x030f, 0x020c}, {0x004f, 0x0311, 0x020e},
+  {0x004f, 0x031b, 0x01a0}, {0x004f, 0x0323, 0x1ecc}, {0x004f, 0x0328, 0x01ea},
+  {0x0050, 0x0301, 0x1e54}, {0x0050, 0x0307, 0x1e56}, {0x0052, 0x0301, 0x0154},
+  {0x0052, 0x0307, 0x1e58}, {0x0052, 0x030c, 0x0158}, {0x0052, 0x030f, 0x0210},
+  {0x0052, 0x0311, 0x0212}, {0x0052, 0x0323, 0x1e5a}, {0x0052, 0x0327, 0x0156},
+  {0x0052, 0x0331, 0x1e5e}, {0x0053, 0x0301, 0x015a}, {0x0053, 0x0302, 0x015c},
+  {0x0053, 0x0307, 0x1e60}, {0x0053, 0x030c, 0x0160}, {0x0053, 0x0323, 0x1e62},
+  {0x0053, 0x0326, 0x0218}, {0x0053, 0x0327, 0x015e}, {0x0054, 0x0307, 0x1e6a},
+  {0x0054, 0x030c, 0x0164}, {0x0054, 0x0323, 0x1e6c}, {0x0054, 0x0326, 0x021a},
+  {0x0054, 0x0327, 0x0162}, {0x0054, 0x032d, 0x1e70}, {0x0054, 0x0331, 0x1e6e},
+  {0x0055, 0x0300, 0x00d9}, {0x0055, 0x0301, 0x00da}, {0x0055, 0x0302, 0x00db},
+  {0x0055, 0x0303, 0x0168}, {0x0055, 0x0304, 0x016a}, {0x0055, 0x0306, 0x016c},
+  {0x0055, 0x0308, 0x00dc}, {0x0055, 0x0309, 0x1ee6}, {0x0055, 0x030a, 0x016e},
+  {0x0055, 0x030b, 0x0170}, {0x0055, 0x030c, 0x01d3}, {0x0055, 0x030f, 0x0214},
+  {0x0055, 0x0311, 0x0216}, {0x0055, 0x031b, 0x01af}, {0x0055, 0x0323, 0x1ee4},
+  {0x0055, 0x0324, 0x1e72}, {0x0055, 0x0328, 0x0172}, {0x0055, 0x032d, 0x1e76},
+  {0x0055, 0x0330, 0x1e74}, {0x0056, 0x0303, 0x1e7c}, {0x0056, 0x0323, 0x1e7e},
+  {0x0057, 0x0300, 0x1e80}, {0x0057, 0x0301, 0x1e82}, {0x0057, 0x0302, 0x0174},
+  {0x0057, 0x0307, 0x1e86}, {0x0057, 0x0308, 0x1e84}, {0x0057, 0x0323, 0x1e88},
+  {0x0058, 0x0307, 0x1e8a}, {0x0058, 0x0308, 0x1e8c}, {0x0059, 0x0300, 0x1ef2},
+  {0x0059, 0x0301, 0x00dd}, {0x0059, 0x0302, 0x0176}, {0x0059, 0x0303, 0x1ef8},
+  {0x0059, 0x0304, 0x0232}, {0x0059, 0x0307, 0x1e8e}, {0x0059, 0x0308, 0x0178},
+  {0x0059, 0x0309, 0x1ef6}, {0x0059, 0x0323, 0x1ef4}, {0x005a, 0x0301, 0x0179},
+  {0x005a, 0x0302, 0x1e90}, {0x005a, 0x0307, 0x017b}, {0x005a, 0x030c, 0x017d},
+  {0x005a, 0x0323, 0x1e92}, {0x005a, 0x0331, 0x1e94}, {0x0061, 0x0300, 0x00e0},
+  {0x0061, 0x0301, 0x00e1}, {0x0061, 0x0302, 0x00e2}, {0x0061, 0x0303, 0x00e3},
+  {0x0061, 0x0304, 0x0101}, {0x0061, 0x0306, 0x0103}, {0x0061, 0x0307, 0x0227},
+  {0x0061, 0x0308, 0x00e4}, {0x0061, 0x0309, 0x1ea3}, {0x0061, 0x030a, 0x00e5},
+  {0x0061, 0x030c, 0x01ce}, {0x0061, 0x030f, 0x0201}, {0x0061, 0x0311, 0x0203},
+  {0x0061, 0x0323, 0x1ea1}, {0x0061, 0x0325, 0x1e01}, {0x0061, 0x0328, 0x0105},
+  {0x0062, 0x0307, 0x1e03}, {0x0062, 0x0323, 0x1e05}, {0x0062, 0x0331, 0x1e07},
+  {0x0063, 0x0301, 0x0107}, {0x0063, 0x0302, 0x0109}, {0x0063, 0x0307, 0x010b},
+  {0x0063, 0x030c, 0x010d}, {0x0063, 0x0327, 0x00e7}, {0x0064, 0x0307, 0x1e0b},
+  {0x0064, 0x030c, 0x010f}, {0x0064, 0x0323, 0x1e0d}, {0x0064, 0x0327, 0x1e11},
+  {0x0064, 0x032d, 0x1e13}, {0x0064, 0x0331, 0x1e0f}, {0x0065, 0x0300, 0x00e8},
+  {0x0065, 0x0301, 0x00e9}, {0x0065, 0x0302, 0x00ea}, {0x0065, 0x0303, 0x1ebd},
+  {0x0065, 0x0304, 0x0113}, {0x0065, 0x0306, 0x0115}, {0x0065, 0x0307, 0x0117},
+  {0x0065, 0x0308, 0x00eb}, {0x0065, 0x0309, 0x1ebb}, {0x0065, 0x030c, 0x011b},
+  {0x0065, 0x030f, 0x0205}, {0x0065, 0x0311, 0x0207}, {0x0065, 0x0323, 0x1eb9},
+  {0x0065, 0x0327, 0x0229}, {0x0065, 0x0328, 0x0119}, {0x0065, 0x032d, 0x1e19},
+  {0x0065, 0x0330, 0x1e1b}, {0x0066, 0x0307, 0x1e1f}, {0x0067, 0x0301, 0x01f5},
+  {0x0067, 0x0302, 0x011d}, {0x0067, 0x0304, 0x1e21}, {0x0067, 0x0306, 0x011f},
+  {0x0067, 0x0307, 0x0121}, {0x0067, 0x030c, 0x01e7}, {0x0067, 0x0327, 0x0123},
+  {0x0068, 0x0302, 0x0125}, {0x0068, 0x0307, 0x1e23}, {0x0068, 0x0308, 0x1e27},
+  {0x0068, 0x030c, 0x021f}, {0x0068, 0x0323, 0x1e25}, {0x0068, 0x0327, 0x1e29},
+  {0x0068, 0x032e, 0x1e2b}, {0x0068, 0x0331, 0x1e96}, {0x0069, 0x0300, 0x00ec},
+  {0x0069, 0x0301, 0x00ed}, {0x0069, 0x0302, 0x00ee}, {0x0069, 0x0303, 0x0129},
+  {0x0069, 0x0304, 0x012b}, {0x0069, 0x0306, 0x012d}, {0x0069, 0x0308, 0x00ef},
+  {0x0069, 0x0309, 0x1ec9}, {0x0069, 0x030c, 0x01d0}, {0x0069, 0x030f, 0x0209},
+  {0x0069, 0x0311, 0x020b}, {0x0069, 0x0323, 0x1ecb}, {0x0069, 0x0328, 0x012f},
+  {0x0069, 0x0330, 0x1e2d}, {0x006a, 0x0302, 0x0135}, {0x006a, 0x030c, 0x01f0},
+  {0x006b, 0x0301, 0x1e31}, {0x006b, 0x030c, 0x01e9}, {0x006b, 0x0323, 0x1e33},
+  {0x006b, 0x0327, 0x0137}, {0x006b, 0x0331, 0x1e35}, {0x006c, 0x0301, 0x013a},
+  {0x006c, 0x030c, 0x013e}, {0x006c, 0x0323, 0x1e37}, {0x006c, 0x0327, 0x013c},
+  {0x006c, 0x032d, 0x1e3d}, {0x006c, 0x0331, 0x1e3b}, {0x006d, 0x0301, 0x1e3f},
+  {0x006d, 0x0307, 0x1e41}, {0x006d, 0x0323, 0x1e43}, {0x006e, 0x0300, 0x01f9},
+  {0x006e, 0x0301, 0x0144}, {0x006e, 0x0303, 0x00f1}, {0x006e, 0x0307, 0x1e45},
+  {0x006e, 0x030c, 0x0148}, {0x006e, 0x0323, 0x1e47}, {0x006e, 0x0327, 0x0146},
+  {0x006e, 0x032d, 0x1e4b}, {0x006e, 0x0331, 0x1e49}, {0x006f, 0x0300, 0x00f2},
+  {0x006f, 0x0301, 0x00f3}, {0x006f, 0x0302, 0x00f4}, {0x006f, 0x0303, 0x00f5},
+  {0x006f, 0x0304, 0x014d}, {0x006f, 0x0306, 0x014f}, {0x006f, 0x0307, 0x022f},
+  {0x006f, 0x0308, 0x00f6}, {0x006f, 0x0309, 0x1ecf}, {0x006f, 0x030b, 0x0151},
+  {0x006f, 0x030c, 0x01d2}, {0x006f, 0x030f, 0x020d}, {0x006f, 0x0311, 0x020f},
+  {0x006f, 0x031b, 0x01a1}, {0x006f, 0x0323, 0x1ecd}, {0x006f, 0x0328, 0x01eb},
+  {0x0070, 0x0301, 0x1e55}, {0x0070, 0x0307, 0x1e57}, {0x0072, 0x0301, 0x0155},
+  {0x0072, 0x0307, 0x1e59}, {0x0072, 0x030c, 0x0159}, {0x0072, 0x030f, 0x0211},
+  {0x0072, 0x0311, 0x0213}, {0x0072, 0x0323, 0x1e5b}, {0x0072, 0x0327, 0x0157},
+  {0x0072, 0x0331, 0x1e5f}, {0x0073, 0x0301, 0x015b}, {0x0073, 0x0302, 0x015d},
+  {0x0073, 0x0307, 0x1e61}, {0x0073, 0x030c, 0x0161}, {0x0073, 0x0323, 0x1e63},
+  {0x0073, 0x0326, 0x0219}, {0x0073, 0x0327, 0x015f}, {0x0074, 0x0307, 0x1e6b},
+  {0x0074, 0x0308, 0x1e97}, {0x0074, 0x030c, 0x0165}, {0x0074, 0x0323, 0x1e6d},
+  {0x0074, 0x0326, 0x021b}, {0x0074, 0x0327, 0x0163}, {0x0074, 0x032d, 0x1e71},
+  {0x0074, 0x0331, 0x1e6f}, {0x0075, 0x0300, 0x00f9}, {0x0075, 0x0301, 0x00fa},
+  {0x0075, 0x0302, 0x00fb}, {0x0075, 0x0303, 0x0169}, {0x0075, 0x0304, 0x016b},
+  {0x0075, 0x0306, 0x016d}, {0x0075, 0x0308, 0x00fc}, {0x0075, 0x0309, 0x1ee7},
+  {0x0075, 0x030a, 0x016f}, {0x0075, 0x030b, 0x0171}, {0x0075, 0x030c, 0x01d4},
+  {0x0075, 0x030f, 0x0215}, {0x0075, 0x0311, 0x0217}, {0x0075, 0x031b, 0x01b0},
+  {0x0075, 0x0323, 0x1ee5}, {0x0075, 0x0324, 0x1e73}, {0x0075, 0x0328, 0x0173},
+  {0x0075, 0x032d, 0x1e77}, {0x0075, 0x0330, 0x1e75}, {0x0076, 0x0303, 0x1e7d},
+  {0x0076, 0x0323, 0x1e7f}, {0x0077, 0x0300, 0x1e81}, {0x0077, 0x0301, 0x1e83},
+  {0x0077, 0x0302, 0x0175}, {0x0077, 0x0307, 0x1e87}, {0x0077, 0x0308, 0x1e85},
+  {0x0077, 0x030a, 0x1e98}, {0x0077, 0x0323, 0x1e89}, {0x0078, 0x0307, 0x1e8b},
+  {0x0078, 0x0308, 0x1e8d}, {0x0079, 0x0300, 0x1ef3}, {0x0079, 0x0301, 0x00fd},
+  {0x0079, 0x0302, 0x0177}, {0x0079, 0x0303, 0x1ef9}, {0x0079, 0x0304, 0x0233},
+  {0x0079, 0x0307, 0x1e8f}, {0x0079, 0x0308, 0x00ff}, {0x0079, 0x0309, 0x1ef7},
+  {0x0079, 0x030a, 0x1e99}, {0x0079, 0x0323, 0x1ef5}, {0x007a, 0x0301, 0x017a},
+  {0x007a, 0x0302, 0x1e91}, {0x007a, 0x0307, 0x017c}, {0x007a, 0x030c, 0x017e},
+  {0x007a, 0x0323, 0x1e93}, {0x007a, 0x0331, 0x1e95}, {0x00a8, 0x0300, 0x1fed},
+  {0x00a8, 0x0301, 0x0385}, {0x00a8, 0x0342, 0x1fc1}, {0x00c2, 0x0300, 0x1ea6},
+  {0x00c2, 0x0301, 0x1ea4}, {0x00c2, 0x0303, 0x1eaa}, {0x00c2, 0x0309, 0x1ea8},
+  {0x00c4, 0x0304, 0x01de}, {0x00c5, 0x0301, 0x01fa}, {0x00c6, 0x0301, 0x01fc},
+  {0x00c6, 0x0304, 0x01e2}, {0x00c7, 0x0301, 0x1e08}, {0x00ca, 0x0300, 0x1ec0},
+  {0x00ca, 0x0301, 0x1ebe}, {0x00ca, 0x0303, 0x1ec4}, {0x00ca, 0x0309, 0x1ec2},
+  {0x00cf, 0x0301, 0x1e2e}, {0x00d4, 0x0300, 0x1ed2}, {0x00d4, 0x0301, 0x1ed0},
+  {0x00d4, 0x0303, 0x1ed6}, {0x00d4, 0x0309, 0x1ed4}, {0x00d5, 0x0301, 0x1e4c},
+  {0x00d5, 0x0304, 0x022c}, {0x00d5, 0x0308, 0x1e4e}, {0x00d6, 0x0304, 0x022a},
+  {0x00d8, 0x0301, 0x01fe}, {0x00dc, 0x0300, 0x01db}, {0x00dc, 0x0301, 0x01d7},
+  {0x00dc, 0x0304, 0x01d5}, {0x00dc, 0x030c, 0x01d9}, {0x00e2, 0x0300, 0x1ea7},
+  {0x00e2, 0x0301, 0x1ea5}, {0x00e2, 0x0303, 0x1eab}, {0x00e2, 0x0309, 0x1ea9},
+  {0x00e4, 0x0304, 0x01df}, {0x00e5, 0x0301, 0x01fb}, {0x00e6, 0x0301, 0x01fd},
+  {0x00e6, 0x0304, 0x01e3}, {0x00e7, 0x0301, 0x1e09}, {0x00ea, 0x0300, 0x1ec1},
+  {0x00ea, 0x0301, 0x1ebf}, {0x00ea, 0x0303, 0x1ec5}, {0x00ea, 0x0309, 0x1ec3},
+  {0x00ef, 0x0301, 0x1e2f}, {0x00f4, 0x0300, 0x1ed3}, {0x00f4, 0x0301, 0x1ed1},
+  {0x00f4, 0x0303, 0x1ed7}, {0x00f4, 0x0309, 0x1ed5}, {0x00f5, 0x0301, 0x1e4d},
+  {0x00f5, 0x0304, 0x022d}, {0x00f5, 0x0308, 0x1e4f}, {0x00f6, 0x0304, 0x022b},
+  {0x00f8, 0x0301, 0x01ff}, {0x00fc, 0x0300, 0x01dc}, {0x00fc, 0x0301, 0x01d8},
+  {0x00fc, 0x0304, 0x01d6}, {0x00fc, 0x030c, 0x01da}, {0x0102, 0x0300, 0x1eb0},
+  {0x0102, 0x0301, 0x1eae}, {0x0102, 0x0303, 0x1eb4}, {0x0102, 0x0309, 0x1eb2},
+  {0x0103, 0x0300, 0x1eb1}, {0x0103, 0x0301, 0x1eaf}, {0x0103, 0x0303, 0x1eb5},
+  {0x0103, 0x0309, 0x1eb3}, {0x0112, 0x0300, 0x1e14}, {0x0112, 0x0301, 0x1e16},
+  {0x0113, 0x0300, 0x1e15}, {0x0113, 0x0301, 0x1e17}, {0x014c, 0x0300, 0x1e50},
+  {0x014c, 0x0301, 0x1e52}, {0x014d, 0x0300, 0x1e51}, {0x014d, 0x0301, 0x1e53},
+  {0x015a, 0x0307, 0x1e64}, {0x015b, 0x0307, 0x1e65}, {0x0160, 0x0307, 0x1e66},
+  {0x0161, 0x0307, 0x1e67}, {0x0168, 0x0301, 0x1e78}, {0x0169, 0x0301, 0x1e79},
+  {0x016a, 0x0308, 0x1e7a}, {0x016b, 0x0308, 0x1e7b}, {0x017f, 0x0307, 0x1e9b},
+  {0x01a0, 0x0300, 0x1edc}, {0x01a0, 0x0301, 0x1eda}, {0x01a0, 0x0303, 0x1ee0},
+  {0x01a0, 0x0309, 0x1ede}, {0x01a0, 0x0323, 0x1ee2}, {0x01a1, 0x0300, 0x1edd},
+  {0x01a1, 0x0301, 0x1edb}, {0x01a1, 0x0303, 0x1ee1}, {0x01a1, 0x0309, 0x1edf},
+  {0x01a1, 0x0323, 0x1ee3}, {0x01af, 0x0300, 0x1eea}, {0x01af, 0x0301, 0x1ee8},
+  {0x01af, 0x0303, 0x1eee}, {0x01af, 0x0309, 0x1eec}, {0x01af, 0x0323, 0x1ef0},
+  {0x01b0, 0x0300, 0x1eeb}, {0x01b0, 0x0301, 0x1ee9}, {0x01b0, 0x0303, 0x1eef},
+  {0x01b0, 0x0309, 0x1eed}, {0x01b0, 0x0323, 0x1ef1}, {0x01b7, 0x030c, 0x01ee},
+  {0x01ea, 0x0304, 0x01ec}, {0x01eb, 0x0304, 0x01ed}, {0x0226, 0x0304, 0x01e0},
+  {0x0227, 0x0304, 0x01e1}, {0x0228, 0x0306, 0x1e1c}, {0x0229, 0x0306, 0x1e1d},
+  {0x022e, 0x0304, 0x0230}, {0x022f, 0x0304, 0x0231}, {0x0292, 0x030c, 0x01ef},
+  {0x0391, 0x0300, 0x1fba}, {0x0391, 0x0301, 0x0386}, {0x0391, 0x0304, 0x1fb9},
+  {0x0391, 0x0306, 0x1fb8}, {0x0391, 0x0313, 0x1f08}, {0x0391, 0x0314, 0x1f09},
+  {0x0391, 0x0345, 0x1fbc}, {0x0395, 0x0300, 0x1fc8}, {0x0395, 0x0301, 0x0388},
+  {0x0395, 0x0313, 0x1f18}, {0x0395, 0x0314, 0x1f19}, {0x0397, 0x0300, 0x1fca},
+  {0x0397, 0x0301, 0x0389}, {0x0397, 0x0313, 0x1f28}, {0x0397, 0x0314, 0x1f29},
+  {0x0397, 0x0345, 0x1fcc}, {0x0399, 0x0300, 0x1fda}, {0x0399, 0x0301, 0x038a},
+  {0x0399, 0x0304, 0x1fd9}, {0x0399, 0x0306, 0x1fd8}, {0x0399, 0x0308, 0x03aa},
+  {0x0399, 0x0313, 0x1f38}, {0x0399, 0x0314, 0x1f39}, {0x039f, 0x0300, 0x1ff8},
+  {0x039f, 0x0301, 0x038c}, {0x039f, 0x0313, 0x1f48}, {0x039f, 0x0314, 0x1f49},
+  {0x03a1, 0x0314, 0x1fec}, {0x03a5, 0x0300, 0x1fea}, {0x03a5, 0x0301, 0x038e},
+  {0x03a5, 0x0304, 0x1fe9}, {0x03a5, 0x0306, 0x1fe8}, {0x03a5, 0x0308, 0x03ab},
+  {0x03a5, 0x0314, 0x1f59}, {0x03a9, 0x0300, 0x1ffa}, {0x03a9, 0x0301, 0x038f},
+  {0x03a9, 0x0313, 0x1f68}, {0x03a9, 0x0314, 0x1f69}, {0x03a9, 0x0345, 0x1ffc},
+  {0x03ac, 0x0345, 0x1fb4}, {0x03ae, 0x0345, 0x1fc4}, {0x03b1, 0x0300, 0x1f70},
+  {0x03b1, 0x0301, 0x03ac}, {0x03b1, 0x0304, 0x1fb1}, {0x03b1, 0x0306, 0x1fb0},
+  {0x03b1, 0x0313, 0x1f00}, {0x03b1, 0x0314, 0x1f01}, {0x03b1, 0x0342, 0x1fb6},
+  {0x03b1, 0x0345, 0x1fb3}, {0x03b5, 0x0300, 0x1f72}, {0x03b5, 0x0301, 0x03ad},
+  {0x03b5, 0x0313, 0x1f10}, {0x03b5, 0x0314, 0x1f11}, {0x03b7, 0x0300, 0x1f74},
+  {0x03b7, 0x0301, 0x03ae}, {0x03b7, 0x0313, 0x1f20}, {0x03b7, 0x0314, 0x1f21},
+  {0x03b7, 0x0342, 0x1fc6}, {0x03b7, 0x0345, 0x1fc3}, {0x03b9, 0x0300, 0x1f76},
+  {0x03b9, 0x0301, 0x03af}, {0x03b9, 0x0304, 0x1fd1}, {0x03b9, 0x0306, 0x1fd0},
+  {0x03b9, 0x0308, 0x03ca}, {0x03b9, 0x0313, 0x1f30}, {0x03b9, 0x0314, 0x1f31},
+  {0x03b9, 0x0342, 0x1fd6}, {0x03bf, 0x0300, 0x1f78}, {0x03bf, 0x0301, 0x03cc},
+  {0x03bf, 0x0313, 0x1f40}, {0x03bf, 0x0314, 0x1f41}, {0x03c1, 0x0313, 0x1fe4},
+  {0x03c1, 0x0314, 0x1fe5}, {0x03c5, 0x0300, 0x1f7a}, {0x03c5, 0x0301, 0x03cd},
+  {0x03c5, 0x0304, 0x1fe1}, {0x03c5, 0x0306, 0x1fe0}, {0x03c5, 0x0308, 0x03cb},
+  {0x03c5, 0x0313, 0x1f50}, {0x03c5, 0x0314, 0x1f51}, {0x03c5, 0x0342, 0x1fe6},
+  {0x03c9, 0x0300, 0x1f7c}, {0x03c9, 0x0301, 0x03ce}, {0x03c9, 0x0313, 0x1f60},
+  {0x03c9, 0x0314, 0x1f61}, {0x03c9, 0x0342, 0x1ff6}, {0x03c9, 0x0345, 0x1ff3},
+  {0x03ca, 0x0300, 0x1fd2}, {0x03ca, 0x0301, 0x0390}, {0x03ca, 0x0342, 0x1fd7},
+  {0x03cb, 0x0300, 0x1fe2}, {0x03cb, 0x0301, 0x03b0}, {0x03cb, 0x0342, 0x1fe7},
+  {0x03ce, 0x0345, 0x1ff4}, {0x03d2, 0x0301, 0x03d3}, {0x03d2, 0x0308, 0x03d4},
+  {0x0406, 0x0308, 0x0407}, {0x0410, 0x0306, 0x04d0}, {0x0410, 0x0308, 0x04d2},
+  {0x0413, 0x0301, 0x0403}, {0x0415, 0x0300, 0x0400}, {0x0415, 0x0306, 0x04d6},
+  {0x0415, 0x0308, 0x0401}, {0x0416, 0x0306, 0x04c1}, {0x0416, 0x0308, 0x04dc},
+  {0x0417, 0x0308, 0x04de}, {0x0418, 0x0300, 0x040d}, {0x0418, 0x0304, 0x04e2},
+  {0x0418, 0x0306, 0x0419}, {0x0418, 0x0308, 0x04e4}, {0x041a, 0x0301, 0x040c},
+  {0x041e, 0x0308, 0x04e6}, {0x0423, 0x0304, 0x04ee}, {0x0423, 0x0306, 0x040e},
+  {0x0423, 0x0308, 0x04f0}, {0x0423, 0x030b, 0x04f2}, {0x0427, 0x0308, 0x04f4},
+  {0x042b, 0x0308, 0x04f8}, {0x042d, 0x0308, 0x04ec}, {0x0430, 0x0306, 0x04d1},
+  {0x0430, 0x0308, 0x04d3}, {0x0433, 0x0301, 0x0453}, {0x0435, 0x0300, 0x0450},
+  {0x0435, 0x0306, 0x04d7}, {0x0435, 0x0308, 0x0451}, {0x0436, 0x0306, 0x04c2},
+  {0x0436, 0x0308, 0x04dd}, {0x0437, 0x0308, 0x04df}, {0x0438, 0x0300, 0x045d},
+  {0x0438, 0x0304, 0x04e3}, {0x0438, 0x0306, 0x0439}, {0x0438, 0x0308, 0x04e5},
+  {0x043a, 0x0301, 0x045c}, {0x043e, 0x0308, 0x04e7}, {0x0443, 0x0304, 0x04ef},
+  {0x0443, 0x0306, 0x045e}, {0x0443, 0x0308, 0x04f1}, {0x0443, 0x030b, 0x04f3},
+  {0x0447, 0x0308, 0x04f5}, {0x044b, 0x0308, 0x04f9}, {0x044d, 0x0308, 0x04ed},
+  {0x0456, 0x0308, 0x0457}, {0x0474, 0x030f, 0x0476}, {0x0475, 0x030f, 0x0477},
+  {0x04d8, 0x0308, 0x04da}, {0x04d9, 0x0308, 0x04db}, {0x04e8, 0x0308, 0x04ea},
+  {0x04e9, 0x0308, 0x04eb}, {0x0627, 0x0653, 0x0622}, {0x0627, 0x0654, 0x0623},
+  {0x0627, 0x0655, 0x0625}, {0x0648, 0x0654, 0x0624}, {0x064a, 0x0654, 0x0626},
+  {0x06c1, 0x0654, 0x06c2}, {0x06d2, 0x0654, 0x06d3}, {0x06d5, 0x0654, 0x06c0},
+  {0x0928, 0x093c, 0x0929}, {0x0930, 0x093c, 0x0931}, {0x0933, 0x093c, 0x0934},
+  {0x09c7, 0x09be, 0x09cb}, {0x09c7, 0x09d7, 0x09cc}, {0x0b47, 0x0b3e, 0x0b4b},
+  {0x0b47, 0x0b56, 0x0b48}, {0x0b47, 0x0b57, 0x0b4c}, {0x0b92, 0x0bd7, 0x0b94},
+  {0x0bc6, 0x0bbe, 0x0bca}, {0x0bc6, 0x0bd7, 0x0bcc}, {0x0bc7, 0x0bbe, 0x0bcb},
+  {0x0c46, 0x0c56, 0x0c48}, {0x0cbf, 0x0cd5, 0x0cc0}, {0x0cc6, 0x0cc2, 0x0cca},
+  {0x0cc6, 0x0cd5, 0x0cc7}, {0x0cc6, 0x0cd6, 0x0cc8}, {0x0cca, 0x0cd5, 0x0ccb},
+  {0x0d46, 0x0d3e, 0x0d4a}, {0x0d46, 0x0d57, 0x0d4c}, {0x0d47, 0x0d3e, 0x0d4b},
+  {0x0dd9, 0x0dca, 0x0dda}, {0x0dd9, 0x0dcf, 0x0ddc}, {0x0dd9, 0x0ddf, 0x0dde},
+  {0x0ddc, 0x0dca, 0x0ddd}, {0x1025, 0x102e, 0x1026}, {0x1b05, 0x1b35, 0x1b06},
+  {0x1b07, 0x1b35, 0x1b08}, {0x1b09, 0x1b35, 0x1b0a}, {0x1b0b, 0x1b35, 0x1b0c},
+  {0x1b0d, 0x1b35, 0x1b0e}, {0x1b11, 0x1b35, 0x1b12}, {0x1b3a, 0x1b35, 0x1b3b},
+  {0x1b3c, 0x1b35, 0x1b3d}, {0x1b3e, 0x1b35, 0x1b40}, {0x1b3f, 0x1b35, 0x1b41},
+  {0x1b42, 0x1b35, 0x1b43}, {0x1e36, 0x0304, 0x1e38}, {0x1e37, 0x0304, 0x1e39},
+  {0x1e5a, 0x0304, 0x1e5c}, {0x1e5b, 0x0304, 0x1e5d}, {0x1e62, 0x0307, 0x1e68},
+  {0x1e63, 0x0307, 0x1e69}, {0x1ea0, 0x0302, 0x1eac}, {0x1ea0, 0x0306, 0x1eb6},
+  {0x1ea1, 0x0302, 0x1ead}, {0x1ea1, 0x0306, 0x1eb7}, {0x1eb8, 0x0302, 0x1ec6},
+  {0x1eb9, 0x0302, 0x1ec7}, {0x1ecc, 0x0302, 0x1ed8}, {0x1ecd, 0x0302, 0x1ed9},
+  {0x1f00, 0x0300, 0x1f02}, {0x1f00, 0x0301, 0x1f04}, {0x1f00, 0x0342, 0x1f06},
+  {0x1f00, 0x0345, 0x1f80}, {0x1f01, 0x0300, 0x1f03}, {0x1f01, 0x0301, 0x1f05},
+  {0x1f01, 0x0342, 0x1f07}, {0x1f01, 0x0345, 0x1f81}, {0x1f02, 0x0345, 0x1f82},
+  {0x1f03, 0x0345, 0x1f83}, {0x1f04, 0x0345, 0x1f84}, {0x1f05, 0x0345, 0x1f85},
+  {0x1f06, 0x0345, 0x1f86}, {0x1f07, 0x0345, 0x1f87}, {0x1f08, 0x0300, 0x1f0a},
+  {0x1f08, 0x0301, 0x1f0c}, {0x1f08, 0x0342, 0x1f0e}, {0x1f08, 0x0345, 0x1f88},
+  {0x1f09, 0x0300, 0x1f0b}, {0x1f09, 0x0301, 0x1f0d}, {0x1f09, 0x0342, 0x1f0f},
+  {0x1f09, 0x0345, 0x1f89}, {0x1f0a, 0x0345, 0x1f8a}, {0x1f0b, 0x0345, 0x1f8b},
+  {0x1f0c, 0x0345, 0x1f8c}, {0x1f0d, 0x0345, 0x1f8d}, {0x1f0e, 0x0345, 0x1f8e},
+  {0x1f0f, 0x0345, 0x1f8f}, {0x1f10, 0x0300, 0x1f12}, {0x1f10, 0x0301, 0x1f14},
+  {0x1f11, 0x0300, 0x1f13}, {0x1f11, 0x0301, 0x1f15}, {0x1f18, 0x0300, 0x1f1a},
+  {0x1f18, 0x0301, 0x1f1c}, {0x1f19, 0x0300, 0x1f1b}, {0x1f19, 0x0301, 0x1f1d},
+  {0x1f20, 0x0300, 0x1f22}, {0x1f20, 0x0301, 0x1f24}, {0x1f20, 0x0342, 0x1f26},
+  {0x1f20, 0x0345, 0x1f90}, {0x1f21, 0x0300, 0x1f23}, {0x1f21, 0x0301, 0x1f25},
+  {0x1f21, 0x0342, 0x1f27}, {0x1f21, 0x0345, 0x1f91}, {0x1f22, 0x0345, 0x1f92},
+  {0x1f23, 0x0345, 0x1f93}, {0x1f24, 0x0345, 0x1f94}, {0x1f25, 0x0345, 0x1f95},
+  {0x1f26, 0x0345, 0x1f96}, {0x1f27, 0x0345, 0x1f97}, {0x1f28, 0x0300, 0x1f2a},
+  {0x1f28, 0x0301, 0x1f2c}, {0x1f28, 0x0342, 0x1f2e}, {0x1f28, 0x0345, 0x1f98},
+  {0x1f29, 0x0300, 0x1f2b}, {0x1f29, 0x0301, 0x1f2d}, {0x1f29, 0x0342, 0x1f2f},
+  {0x1f29, 0x0345, 0x1f99}, {0x1f2a, 0x0345, 0x1f9a}, {0x1f2b, 0x0345, 0x1f9b},
+  {0x1f2c, 0x0345, 0x1f9c}, {0x1f2d, 0x0345, 0x1f9d}, {0x1f2e, 0x0345, 0x1f9e},
+  {0x1f2f, 0x0345, 0x1f9f}, {0x1f30, 0x0300, 0x1f32}, {0x1f30, 0x0301, 0x1f34},
+  {0x1f30, 0x0342, 0x1f36}, {0x1f31, 0x0300, 0x1f33}, {0x1f31, 0x0301, 0x1f35},
+  {0x1f31, 0x0342, 0x1f37}, {0x1f38, 0x0300, 0x1f3a}, {0x1f38, 0x0301, 0x1f3c},
+  {0x1f38, 0x0342, 0x1f3e}, {0x1f39, 0x0300, 0x1f3b}, {0x1f39, 0x0301, 0x1f3d},
+  {0x1f39, 0x0342, 0x1f3f}, {0x1f40, 0x0300, 0x1f42}, {0x1f40, 0x0301, 0x1f44},
+  {0x1f41, 0x0300, 0x1f43}, {0x1f41, 0x0301, 0x1f45}, {0x1f48, 0x0300, 0x1f4a},
+  {0x1f48, 0x0301, 0x1f4c}, {0x1f49, 0x0300, 0x1f4b}, {0x1f49, 0x0301, 0x1f4d},
+  {0x1f50, 0x0300, 0x1f52}, {0x1f50, 0x0301, 0x1f54}, {0x1f50, 0x0342, 0x1f56},
+  {0x1f51, 0x0300, 0x1f53}, {0x1f51, 0x0301, 0x1f55}, {0x1f51, 0x0342, 0x1f57},
+  {0x1f59, 0x0300, 0x1f5b}, {0x1f59, 0x0301, 0x1f5d}, {0x1f59, 0x0342, 0x1f5f},
+  {0x1f60, 0x0300, 0x1f62}, {0x1f60, 0x0301, 0x1f64}, {0x1f60, 0x0342, 0x1f66},
+  {0x1f60, 0x0345, 0x1fa0}, {0x1f61, 0x0300, 0x1f63}, {0x1f61, 0x0301, 0x1f65},
+  {0x1f61, 0x0342, 0x1f67}, {0x1f61, 0x0345, 0x1fa1}, {0x1f62, 0x0345, 0x1fa2},
+  {0x1f63, 0x0345, 0x1fa3}, {0x1f64, 0x0345, 0x1fa4}, {0x1f65, 0x0345, 0x1fa5},
+  {0x1f66, 0x0345, 0x1fa6}, {0x1f67, 0x0345, 0x1fa7}, {0x1f68, 0x0300, 0x1f6a},
+  {0x1f68, 0x0301, 0x1f6c}, {0x1f68, 0x0342, 0x1f6e}, {0x1f68, 0x0345, 0x1fa8},
+  {0x1f69, 0x0300, 0x1f6b}, {0x1f69, 0x0301, 0x1f6d}, {0x1f69, 0x0342, 0x1f6f},
+  {0x1f69, 0x0345, 0x1fa9}, {0x1f6a, 0x0345, 0x1faa}, {0x1f6b, 0x0345, 0x1fab},
+  {0x1f6c, 0x0345, 0x1fac}, {0x1f6d, 0x0345, 0x1fad}, {0x1f6e, 0x0345, 0x1fae},
+  {0x1f6f, 0x0345, 0x1faf}, {0x1f70, 0x0345, 0x1fb2}, {0x1f74, 0x0345, 0x1fc2},
+  {0x1f7c, 0x0345, 0x1ff2}, {0x1fb6, 0x0345, 0x1fb7}, {0x1fbf, 0x0300, 0x1fcd},
+  {0x1fbf, 0x0301, 0x1fce}, {0x1fbf, 0x0342, 0x1fcf}, {0x1fc6, 0x0345, 0x1fc7},
+  {0x1ff6, 0x0345, 0x1ff7}, {0x1ffe, 0x0300, 0x1fdd}, {0x1ffe, 0x0301, 0x1fde},
+  {0x1ffe, 0x0342, 0x1fdf}, {0x2190, 0x0338, 0x219a}, {0x2192, 0x0338, 0x219b},
+  {0x2194, 0x0338, 0x21ae}, {0x21d0, 0x0338, 0x21cd}, {0x21d2, 0x0338, 0x21cf},
+  {0x21d4, 0x0338, 0x21ce}, {0x2203, 0x0338, 0x2204}, {0x2208, 0x0338, 0x2209},
+  {0x220b, 0x0338, 0x220c}, {0x2223, 0x0338, 0x2224}, {0x2225, 0x0338, 0x2226},
+  {0x223c, 0x0338, 0x2241}, {0x2243, 0x0338, 0x2244}, {0x2245, 0x0338, 0x2247},
+  {0x2248, 0x0338, 0x2249}, {0x224d, 0x0338, 0x226d}, {0x2261, 0x0338, 0x2262},
+  {0x2264, 0x0338, 0x2270}, {0x2265, 0x0338, 0x2271}, {0x2272, 0x0338, 0x2274},
+  {0x2273, 0x0338, 0x2275}, {0x2276, 0x0338, 0x2278}, {0x2277, 0x0338, 0x2279},
+  {0x227a, 0x0338, 0x2280}, {0x227b, 0x0338, 0x2281}, {0x227c, 0x0338, 0x22e0},
+  {0x227d, 0x0338, 0x22e1}, {0x2282, 0x0338, 0x2284}, {0x2283, 0x0338, 0x2285},
+  {0x2286, 0x0338, 0x2288}, {0x2287, 0x0338, 0x2289}, {0x2291, 0x0338, 0x22e2},
+  {0x2292, 0x0338, 0x22e3}, {0x22a2, 0x0338, 0x22ac}, {0x22a8, 0x0338, 0x22ad},
+  {0x22a9, 0x0338, 0x22ae}, {0x22ab, 0x0338, 0x22af}, {0x22b2, 0x0338, 0x22ea},
+  {0x22b3, 0x0338, 0x22eb}, {0x22b4, 0x0338, 0x22ec}, {0x22b5, 0x0338, 0x22ed},
+  {0x3046, 0x3099, 0x3094}, {0x304b, 0x3099, 0x304c}, {0x304d, 0x3099, 0x304e},
+  {0x304f, 0x3099, 0x3050}, {0x3051, 0x3099, 0x3052}, {0x3053, 0x3099, 0x3054},
+  {0x3055, 0x3099, 0x3056}, {0x3057, 0x3099, 0x3058}, {0x3059, 0x3099, 0x305a},
+  {0x305b, 0x3099, 0x305c}, {0x305d, 0x3099, 0x305e}, {0x305f, 0x3099, 0x3060},
+  {0x3061, 0x3099, 0x3062}, {0x3064, 0x3099, 0x3065}, {0x3066, 0x3099, 0x3067},
+  {0x3068, 0x3099, 0x3069}, {0x306f, 0x3099, 0x3070}, {0x306f, 0x309a, 0x3071},
+  {0x3072, 0x3099, 0x3073}, {0x3072, 0x309a, 0x3074}, {0x3075, 0x3099, 0x3076},
+  {0x3075, 0x309a, 0x3077}, {0x3078, 0x3099, 0x3079}, {0x3078, 0x309a, 0x307a},
+  {0x307b, 0x3099, 0x307c}, {0x307b, 0x309a, 0x307d}, {0x309d, 0x3099, 0x309e},
+  {0x30a6, 0x3099, 0x30f4}, {0x30ab, 0x3099, 0x30ac}, {0x30ad, 0x3099, 0x30ae},
+  {0x30af, 0x3099, 0x30b0}, {0x30b1, 0x3099, 0x30b2}, {0x30b3, 0x3099, 0x30b4},
+  {0x30b5, 0x3099, 0x30b6}, {0x30b7, 0x3099, 0x30b8}, {0x30b9, 0x3099, 0x30ba},
+  {0x30bb, 0x3099, 0x30bc}, {0x30bd, 0x3099, 0x30be}, {0x30bf, 0x3099, 0x30c0},
+  {0x30c1, 0x3099, 0x30c2}, {0x30c4, 0x3099, 0x30c5}, {0x30c6, 0x3099, 0x30c7},
+  {0x30c8, 0x3099, 0x30c9}, {0x30cf, 0x3099, 0x30d0}, {0x30cf, 0x309a, 0x30d1},
+  {0x30d2, 0x3099, 0x30d3}, {0x30d2, 0x309a, 0x30d4}, {0x30d5, 0x3099, 0x30d6},
+  {0x30d5, 0x309a, 0x30d7}, {0x30d8, 0x3099, 0x30d9}, {0x30d8, 0x309a, 0x30da},
+  {0x30db, 0x3099, 0x30dc}, {0x30db, 0x309a, 0x30dd}, {0x30ef, 0x3099, 0x30f7},
+  {0x30f0, 0x3099, 0x30f8}, {0x30f1, 0x3099, 0x30f9}, {0x30f2, 0x3099, 0x30fa},
+  {0x30fd, 0x3099, 0x30fe}, {0x11099, 0x110ba, 0x1109a}, {0x1109b, 0x110ba, 0x1109c},
+  {0x110a5, 0x110ba, 0x110ab}, {0x11131, 0x11127, 0x1112e}, {0x11132, 0x11127, 0x1112f},
+  {0x11347, 0x1133e, 0x1134b}, {0x11347, 0x11357, 0x1134c}, {0x114b9, 0x114b0, 0x114bc},
+  {0x114b9, 0x114ba, 0x114bb}, {0x114b9, 0x114bd, 0x114be}, {0x115b8, 0x115af, 0x115ba},
+  {0x115b9, 0x115af, 0x115bb}, {0x11935, 0x11930, 0x11938},
+};
+
+const size_t kNumCompositions = 941;
+
+}  // namespace unicode_internal
+}  // namespace unicode
+}  // namespace sfu
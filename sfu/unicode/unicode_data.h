@@ -0,0 +1,78 @@
+#ifndef SFU_UNICODE_UNICODE_DATA_H_
+#define SFU_UNICODE_UNICODE_DATA_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace sfu {
+namespace unicode {
+namespace unicode_internal {
+
+// Generated tables, see gen_unicode_data.py. Not part of the public API.
+
+// Quick check and mapping flags in Props::flags.
+static const uint8_t kFlagNfdNo    = 0x01;
+static const uint8_t kFlagNfkdNo   = 0x02;
+static const uint8_t kFlagNfcNo    = 0x04;
+static const uint8_t kFlagNfkcNo   = 0x08;
+// Can combine with a preceding char, for both NFC and NFKC.
+static const uint8_t kFlagNfcMaybe = 0x10;
+static const uint8_t kFlagCaseFold = 0x20;
+
+static const int kPropBlockShift = 7;
+
+struct Props {
+  uint8_t ccc;    // Canonical combining class.
+  uint8_t flags;
+};
+
+// Maps a codepoint to a sequence of codepoints in the matching *Data array.
+struct Mapping {
+  int32_t  cp;
+  uint16_t offset;
+  uint8_t  length;
+};
+
+// Primary composite of a canonical pair.
+struct Composition {
+  int32_t first;
+  int32_t second;
+  int32_t composite;
+};
+
+extern const char* const kUnicodeVersion;
+
+extern const uint8_t kPropStage1[];
+extern const uint8_t kPropStage2[];
+extern const Props   kProps[];
+
+// Full canonical decompositions (NFD), excluding hangul syllables.
+extern const Mapping kCanonicalMappings[];
+extern const size_t  kNumCanonicalMappings;
+extern const int32_t kCanonicalData[];
+
+// Full compatibility decompositions (NFKD), where it differs from NFD.
+extern const Mapping kCompatMappings[];
+extern const size_t  kNumCompatMappings;
+extern const int32_t kCompatData[];
+
+// Full case folding (status C + F).
+extern const Mapping kCaseFoldMappings[];
+extern const size_t  kNumCaseFoldMappings;
+extern const int32_t kCaseFoldData[];
+
+// Sorted by (first, second), excluding hangul.
+extern const Composition kCompositions[];
+extern const size_t      kNumCompositions;
+
+inline const Props& GetProps(int32_t cp) {
+  static const int32_t kMask = (1 << kPropBlockShift) - 1;
+  return kProps[kPropStage2[(kPropStage1[cp >> kPropBlockShift]
+                             << kPropBlockShift) | (cp & kMask)]];
+}
+
+}  // namespace unicode_internal
+}  // namespace unicode
+}  // namespace sfu
+
+#endif  // SFU_UNICODE_UNICODE_DATA_H_
@@ -87,4 +87,30 @@ int32_t Utf8ToCodepoint(const char* buffer, size_t len) {
   return cp;
 }
 
+bool Utf8AppendCodepoint(int32_t cp, std::string* out) {
+  char buffer[4];
+  if (cp < 0 || cp > 0x10ffff || (cp >= 0xd800 && cp < 0xe000)) {
+    return false;
+  } else if (cp < 0x80) {
+    out->push_back(static_cast<char>(cp));
+    return true;
+  } else if (cp < 0x800) {
+    buffer[0] = 0xc0 | (cp >> 6);
+    buffer[1] = 0x80 | (cp & 0x3f);
+    out->append(buffer, 2);
+  } else if (cp < 0x10000) {
+    buffer[0] = 0xe0 | (cp >> 12);
+    buffer[1] = 0x80 | ((cp >> 6) & 0x3f);
+    buffer[2] = 0x80 | (cp & 0x3f);
+    out->append(buffer, 3);
+  } else {
+    buffer[0] = 0xf0 | (cp >> 18);
+    buffer[1] = 0x80 | ((cp >> 12) & 0x3f);
+    buffer[2] = 0x80 | ((cp >> 6) & 0x3f);
+    buffer[3] = 0x80 | (cp & 0x3f);
+    out->append(buffer, 4);
+  }
+  return true;
+}
+
 }  // namespace sfu
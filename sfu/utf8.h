@@ -1,8 +1,13 @@
 #ifndef SFU_UTF8_H_
 #define SFU_UTF8_H_
 
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <iterator>
+#include <string>
+
+#include "sfu/strings/cord.h"
 
 namespace sfu {
 
@@ -28,6 +33,219 @@ void Utf8FromCodepoint(int32_t cp, char* buffer, size_t len);
 // Get the Utf8 codepoint (unicode value) from a utf8 encoded buffer.
 int32_t Utf8ToCodepoint(const char* buffer, size_t len);
 
+// Append the utf8 encoding of the codepoint to out. Returns false (and appends
+// nothing) if cp is not a valid unicode codepoint.
+bool Utf8AppendCodepoint(int32_t cp, std::string* out);
+
+// The codepoint given back for invalid sequences with UTF8_REPLACE.
+static const int32_t kUtf8ReplacementChar = 0xfffd;
+
+// How to handle invalid utf8 byte sequences when iterating codepoints.
+typedef enum {
+  // Each invalid byte is given as kUtf8ReplacementChar.
+  UTF8_REPLACE = 0,
+  // Invalid bytes are silently skipped.
+  UTF8_SKIP,
+  // Iteration ends at the first invalid byte.
+  UTF8_STOP
+} Utf8InvalidPolicy;
+
+namespace utf8_internal {
+
+// Sequence length from the 5 top bits of the lead byte. Continuation bytes
+// and the obsolete 5 and 6 byte forms are 0 (invalid as lead).
+constexpr uint8_t kSequenceLength[32] = {
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,  // 0xxxxxxx
+  0, 0, 0, 0, 0, 0, 0, 0,                          // 10xxxxxx
+  2, 2, 2, 2,                                      // 110xxxxx
+  3, 3,                                            // 1110xxxx
+  4,                                               // 11110xxx
+  0,                                               // 11111xxx
+};
+
+// Lowest codepoint allowed for each sequence length, to reject overlong
+// encodings.
+constexpr int32_t kMinCodepoint[5] = { 0, 0, 0x80, 0x800, 0x10000 };
+
+constexpr size_t SequenceLength(uint8_t lead) {
+  return kSequenceLength[lead >> 3];
+}
+
+constexpr bool IsContinuation(uint8_t c) {
+  return (c & 0xc0) == 0x80;
+}
+
+// Decode a single codepoint at ptr, reading no further than end. Returns the
+// codepoint and sets *len to the number of bytes consumed, or returns -1 and
+// sets *len to 1 if the sequence at ptr is not valid utf8.
+inline int32_t Decode(const char* ptr, const char* end, size_t* len) {
+  const uint8_t* p = reinterpret_cast<const uint8_t*>(ptr);
+  if (p[0] < 0x80) {
+    *len = 1;
+    return p[0];
+  }
+  size_t n = SequenceLength(p[0]);
+  *len = 1;
+  if (n == 0 || static_cast<size_t>(end - ptr) < n) return -1;
+
+  int32_t cp = p[0] & (0x7f >> n);
+  for (size_t i = 1; i < n; ++i) {
+    if (!IsContinuation(p[i])) return -1;
+    cp = (cp << 6) | (p[i] & 0x3f);
+  }
+  // Overlong, UTF-16 surrogate halves, and beyond the unicode range.
+  if (cp < kMinCodepoint[n] || (cp >= 0xd800 && cp < 0xe000) ||
+      cp > 0x10ffff) {
+    return -1;
+  }
+  *len = n;
+  return cp;
+}
+
+}  // namespace utf8_internal
+
+// Bidirectional iterator over the codepoints of a utf8 encoded buffer. The
+// iterator does not own the buffer, and decodes one codepoint at a time, so
+// stepping is O(1) regardless of the buffer size.
+//
+// for (auto it = codepoints(str).begin(); ...) {
+//   int32_t cp = *it;           // The codepoint.
+//   size_t bytes = it.length(); // The encoded length of the codepoint.
+// }
+class utf8_iterator {
+ public:
+  typedef std::bidirectional_iterator_tag iterator_category;
+  typedef int32_t   value_type;
+  typedef ptrdiff_t difference_type;
+  typedef const int32_t* pointer;
+  typedef int32_t   reference;
+
+  utf8_iterator()
+      : begin_(NULL), end_(NULL), pos_(NULL), len_(0), cp_(-1),
+        policy_(UTF8_REPLACE) {}
+  // Iterate the buffer [begin, end), starting at pos. Pos must be at the
+  // start of a sequence, or equal to end.
+  utf8_iterator(const char* begin, const char* end, const char* pos,
+                Utf8InvalidPolicy policy = UTF8_REPLACE)
+      : begin_(begin), end_(end), pos_(pos), len_(0), cp_(-1),
+        policy_(policy) {
+    forward();
+  }
+
+  // The current codepoint. For invalid sequences with UTF8_REPLACE this is
+  // kUtf8ReplacementChar.
+  inline int32_t operator*() const {
+    return cp_ < 0 ? kUtf8ReplacementChar : cp_;
+  }
+  // Start of the encoded sequence.
+  inline const char* ptr() const { return pos_; }
+  // Number of bytes in the current encoded sequence.
+  inline size_t length() const { return len_; }
+  // Byte offset from the start of the buffer.
+  inline size_t offset() const { return pos_ - begin_; }
+  // If the current sequence is valid utf8.
+  inline bool valid() const { return cp_ >= 0; }
+
+  inline utf8_iterator& operator++() {
+    pos_ += len_;
+    forward();
+    return *this;
+  }
+  inline utf8_iterator operator++(int) {
+    utf8_iterator tmp(*this);
+    ++(*this);
+    return tmp;
+  }
+  inline utf8_iterator& operator--() {
+    backward();
+    return *this;
+  }
+  inline utf8_iterator operator--(int) {
+    utf8_iterator tmp(*this);
+    --(*this);
+    return tmp;
+  }
+
+  inline bool operator==(const utf8_iterator& o) const {
+    return pos_ == o.pos_;
+  }
+  inline bool operator!=(const utf8_iterator& o) const {
+    return pos_ != o.pos_;
+  }
+
+ private:
+  const char* begin_;
+  const char* end_;
+  const char* pos_;
+  size_t      len_;
+  int32_t     cp_;
+  Utf8InvalidPolicy policy_;
+
+  // Decode the sequence at pos_, applying the invalid policy.
+  inline void forward() {
+    while (pos_ < end_) {
+      cp_ = utf8_internal::Decode(pos_, end_, &len_);
+      if (cp_ >= 0 || policy_ == UTF8_REPLACE) return;
+      if (policy_ == UTF8_STOP) break;
+      ++pos_;  // UTF8_SKIP
+    }
+    pos_ = end_;
+    len_ = 0;
+    cp_ = -1;
+  }
+
+  // Step back to the start of the previous sequence. At most 3 continuation
+  // bytes are looked at, so this never scans the whole buffer.
+  inline void backward() {
+    while (pos_ > begin_) {
+      const char* start = pos_ - 1;
+      while (start > begin_ && pos_ - start < 4 &&
+             utf8_internal::IsContinuation(static_cast<uint8_t>(*start))) {
+        --start;
+      }
+      size_t len;
+      int32_t cp = utf8_internal::Decode(start, end_, &len);
+      if (cp < 0 || start + len != pos_) {
+        // The byte before pos_ is not the end of a valid sequence.
+        --pos_;
+        len_ = 1;
+        cp_ = -1;
+        if (policy_ == UTF8_SKIP) continue;
+        return;
+      }
+      pos_ = start;
+      len_ = len;
+      cp_ = cp;
+      return;
+    }
+  }
+};
+
+// Range of codepoints over a cord, usable in range-based for loops:
+//
+// for (int32_t cp : codepoints(str)) { ... }
+class utf8_range {
+ public:
+  utf8_range(const strings::cord& str, Utf8InvalidPolicy policy)
+      : str_(str), policy_(policy) {}
+
+  inline utf8_iterator begin() const {
+    return utf8_iterator(str_.begin(), str_.end(), str_.begin(), policy_);
+  }
+  inline utf8_iterator end() const {
+    return utf8_iterator(str_.begin(), str_.end(), str_.end(), policy_);
+  }
+
+ private:
+  strings::cord str_;
+  Utf8InvalidPolicy policy_;
+};
+
+inline utf8_range codepoints(const strings::cord& str,
+                             Utf8InvalidPolicy policy = UTF8_REPLACE) {
+  return utf8_range(str, policy);
+}
+
 }  // namespace sfu
 
 #endif
@@ -0,0 +1,89 @@
+#include <string>
+#include <vector>
+
+#include "sfu/utf8.h"
+#include "gtest/gtest.h"
+
+using namespace std;
+using namespace sfu;
+
+namespace {
+
+vector<int32_t> collect(const strings::cord& str, Utf8InvalidPolicy policy) {
+  vector<int32_t> out;
+  for (int32_t cp : codepoints(str, policy)) {
+    out.push_back(cp);
+  }
+  return out;
+}
+
+}  // namespace
+
+TEST(Utf8Test, TestIterateValid) {
+  string str("aæ‘\U0001f600z");
+  vector<int32_t> cps = collect(str, UTF8_REPLACE);
+  ASSERT_EQ(5, cps.size());
+  EXPECT_EQ('a', cps[0]);
+  EXPECT_EQ(0xe6, cps[1]);
+  EXPECT_EQ(0x2018, cps[2]);
+  EXPECT_EQ(0x1f600, cps[3]);
+  EXPECT_EQ('z', cps[4]);
+
+  utf8_iterator it = codepoints(str).begin();
+  EXPECT_EQ(1, it.length());
+  ++it;
+  EXPECT_EQ(2, it.length());
+  EXPECT_EQ(1, it.offset());
+  ++it;
+  EXPECT_EQ(3, it.length());
+  ++it;
+  EXPECT_EQ(4, it.length());
+}
+
+TEST(Utf8Test, TestIterateBackward) {
+  string str("aæ‘\U0001f600z");
+  utf8_range range = codepoints(str);
+  utf8_iterator it = range.end();
+  vector<int32_t> cps;
+  while (it != range.begin()) {
+    --it;
+    cps.push_back(*it);
+  }
+  ASSERT_EQ(5, cps.size());
+  EXPECT_EQ('z', cps[0]);
+  EXPECT_EQ(0x1f600, cps[1]);
+  EXPECT_EQ(0x2018, cps[2]);
+  EXPECT_EQ(0xe6, cps[3]);
+  EXPECT_EQ('a', cps[4]);
+}
+
+TEST(Utf8Test, TestInvalidPolicy) {
+  // Stray continuation byte, overlong '/' and a truncated sequence.
+  string str("a\x80" "b\xc0\xaf" "c\xe2\x80");
+
+  vector<int32_t> replaced = collect(str, UTF8_REPLACE);
+  ASSERT_EQ(8, replaced.size());
+  EXPECT_EQ('a', replaced[0]);
+  EXPECT_EQ(kUtf8ReplacementChar, replaced[1]);
+  EXPECT_EQ('b', replaced[2]);
+  EXPECT_EQ(kUtf8ReplacementChar, replaced[3]);
+  EXPECT_EQ(kUtf8ReplacementChar, replaced[4]);
+  EXPECT_EQ('c', replaced[5]);
+
+  vector<int32_t> skipped = collect(str, UTF8_SKIP);
+  ASSERT_EQ(3, skipped.size());
+  EXPECT_EQ('a', skipped[0]);
+  EXPECT_EQ('b', skipped[1]);
+  EXPECT_EQ('c', skipped[2]);
+
+  vector<int32_t> stopped = collect(str, UTF8_STOP);
+  ASSERT_EQ(1, stopped.size());
+  EXPECT_EQ('a', stopped[0]);
+}
+
+TEST(Utf8Test, TestRejectSurrogates) {
+  string str("\xed\xa0\x80");
+  utf8_iterator it = codepoints(str).begin();
+  EXPECT_FALSE(it.valid());
+  EXPECT_EQ(1, it.length());
+}